@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_low_power.c
+ * @brief     driver sgp41 low power source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_low_power.h"
+#include "driver_sgp41_algorithm.h"
+
+static sgp41_handle_t gs_handle;                         /**< sgp41 handle */
+static sgp41_gas_index_algorithm_t gs_voc_handle;        /**< voc handle */
+static uint64_t gs_period_us;                            /**< period in us */
+static uint64_t gs_deadline_us;                          /**< next deadline */
+static uint64_t gs_start_us;                             /**< init time */
+static uint64_t gs_heater_on_us;                         /**< heater on time */
+static uint32_t gs_samples;                              /**< sample number */
+static float gs_max_current_ma;                          /**< chip max current */
+
+/**
+ * @brief     low power example init
+ * @param[in] period_ms sampling period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the voc algorithm is set up with the same sampling interval, the heater is off after init
+ */
+uint8_t sgp41_low_power_init(uint32_t period_ms)
+{
+    uint8_t res;
+    sgp41_info_t info;
+
+    /* check the period */
+    if (period_ms <= (SGP41_LOW_POWER_PREHEAT_MS + 2 * SGP41_EXECUTION_TIME_MEASURE_RAW_MS))
+    {
+        sgp41_interface_debug_print("sgp41: period is too short.\n");
+
+        return 1;
+    }
+
+    /* link functions */
+    DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, sgp41_interface_iic_init);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, sgp41_interface_iic_deinit);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, sgp41_interface_iic_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, sgp41_interface_iic_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, sgp41_interface_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle, sgp41_interface_debug_print);
+
+    /* sgp41 init */
+    res = sgp41_init(&gs_handle);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: init failed.\n");
+
+        return 1;
+    }
+
+    /* soft reset */
+    res = sgp41_soft_reset(&gs_handle);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: soft failed.\n");
+        (void)sgp41_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* turn heater off */
+    res = sgp41_turn_heater_off(&gs_handle);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: turn heater off failed.\n");
+        (void)sgp41_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* voc algorithm init with the long interval */
+    sgp41_algorithm_init_with_sampling_interval(&gs_voc_handle, SGP41_ALGORITHM_TYPE_VOC, (float)period_ms / 1000.0f);
+
+    /* energy accounting */
+    (void)sgp41_info(&info);
+    gs_max_current_ma = info.max_current_ma;
+    gs_period_us = (uint64_t)period_ms * 1000;
+    gs_start_us = sgp41_interface_get_time_us();
+    gs_deadline_us = gs_start_us;
+    gs_heater_on_us = 0;
+    gs_samples = 0;
+
+    return 0;
+}
+
+/**
+ * @brief  low power example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t sgp41_low_power_deinit(void)
+{
+    /* close sgp41 */
+    if (sgp41_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      low power example read
+ * @param[in]  temperature current temperature in C
+ * @param[in]  humidity current humidity in %
+ * @param[out] *voc_gas_index pointer to a voc gas index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       sleeps with the heater off until the next deadline, a first measure raw heats the
+ *             hotplate and is thrown away, the second one is used and the heater is turned off again,
+ *             the nox index needs a continuously heated hotplate and is not available in this mode
+ */
+uint8_t sgp41_low_power_read(float temperature, float humidity, int32_t *voc_gas_index)
+{
+    uint8_t res;
+    uint16_t raw_humidity;
+    uint16_t raw_temperature;
+    uint16_t sraw_voc;
+    uint16_t sraw_nox;
+    uint64_t on;
+    uint64_t now;
+
+    /* humidity convert to register */
+    res = sgp41_humidity_convert_to_register(&gs_handle, humidity, &raw_humidity);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: humidity convert to register failed.\n");
+
+        return 1;
+    }
+
+    /* temperature convert to register */
+    res = sgp41_temperature_convert_to_register(&gs_handle, temperature, &raw_temperature);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: temperature convert to register failed.\n");
+
+        return 1;
+    }
+
+    /* sleep with the heater off until the deadline */
+    sgp41_interface_delay_until_us(gs_deadline_us);
+    now = sgp41_interface_get_time_us();
+    gs_deadline_us += gs_period_us;
+    if (now >= gs_deadline_us)
+    {
+        /* skip the deadlines that have already passed */
+        gs_deadline_us += ((now - gs_deadline_us) / gs_period_us + 1) * gs_period_us;
+    }
+
+    /* the first measure raw turns the heater on */
+    on = sgp41_interface_get_time_us();
+    res = sgp41_get_measure_raw(&gs_handle, raw_humidity, raw_temperature, &sraw_voc, &sraw_nox);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: get measure raw failed.\n");
+        (void)sgp41_turn_heater_off(&gs_handle);
+
+        return 1;
+    }
+
+    /* wait for the hotplate */
+    sgp41_interface_delay_ms(SGP41_LOW_POWER_PREHEAT_MS);
+
+    /* get measure raw */
+    res = sgp41_get_measure_raw(&gs_handle, raw_humidity, raw_temperature, &sraw_voc, &sraw_nox);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: get measure raw failed.\n");
+        (void)sgp41_turn_heater_off(&gs_handle);
+
+        return 1;
+    }
+
+    /* turn heater off */
+    res = sgp41_turn_heater_off(&gs_handle);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: turn heater off failed.\n");
+
+        return 1;
+    }
+    gs_heater_on_us += sgp41_interface_get_time_us() - on;
+    gs_samples++;
+
+    /* algorithm process */
+    sgp41_algorithm_process(&gs_voc_handle, sraw_voc, voc_gas_index);
+
+    return 0;
+}
+
+/**
+ * @brief      low power example get the energy
+ * @param[out] *energy pointer to an energy buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get energy failed
+ * @note       every sample owns its whole period, so the elapsed time runs up to the next deadline
+ */
+uint8_t sgp41_low_power_get_energy(sgp41_low_power_energy_t *energy)
+{
+    if (energy == NULL)
+    {
+        return 1;
+    }
+
+    energy->samples = gs_samples;
+    energy->elapsed_ms = (gs_deadline_us - gs_start_us) / 1000;
+    energy->heater_on_ms = gs_heater_on_us / 1000;
+    energy->duty = (energy->elapsed_ms != 0) ? ((float)energy->heater_on_ms / (float)energy->elapsed_ms) : 0.0f;
+    energy->charge_mah = (float)energy->heater_on_ms / 3600000.0f * gs_max_current_ma;
+    energy->mah_per_hour = energy->duty * gs_max_current_ma;
+    energy->continuous_mah_per_hour = gs_max_current_ma;
+
+    return 0;
+}
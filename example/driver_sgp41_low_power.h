@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_low_power.h
+ * @brief     driver sgp41 low power header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_LOW_POWER_H
+#define DRIVER_SGP41_LOW_POWER_H
+
+#include "driver_sgp41_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup sgp41_example_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 low power example default definition
+ */
+#define SGP41_LOW_POWER_DEFAULT_PERIOD_MS        10000        /**< 10 s, the voc algorithm low power interval */
+#define SGP41_LOW_POWER_PREHEAT_MS               170          /**< hotplate warm up after the first measure raw */
+
+/**
+ * @brief sgp41 low power energy structure definition
+ */
+typedef struct sgp41_low_power_energy_s
+{
+    uint32_t samples;                       /**< sample number */
+    uint64_t elapsed_ms;                    /**< time from init to the next deadline in ms */
+    uint64_t heater_on_ms;                  /**< heater on time in ms */
+    float duty;                             /**< heater on share of the elapsed time */
+    float charge_mah;                       /**< heater charge in mAh at the chip max current */
+    float mah_per_hour;                     /**< mean charge per hour */
+    float continuous_mah_per_hour;          /**< charge per hour with the heater always on */
+} sgp41_low_power_energy_t;
+
+/**
+ * @brief     low power example init
+ * @param[in] period_ms sampling period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the voc algorithm is set up with the same sampling interval, the heater is off after init
+ */
+uint8_t sgp41_low_power_init(uint32_t period_ms);
+
+/**
+ * @brief  low power example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t sgp41_low_power_deinit(void);
+
+/**
+ * @brief      low power example read
+ * @param[in]  temperature current temperature in C
+ * @param[in]  humidity current humidity in %
+ * @param[out] *voc_gas_index pointer to a voc gas index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       sleeps with the heater off until the next deadline, a first measure raw heats the
+ *             hotplate and is thrown away, the second one is used and the heater is turned off again,
+ *             the nox index needs a continuously heated hotplate and is not available in this mode
+ */
+uint8_t sgp41_low_power_read(float temperature, float humidity, int32_t *voc_gas_index);
+
+/**
+ * @brief      low power example get the energy
+ * @param[out] *energy pointer to an energy buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get energy failed
+ * @note       the charge is the heater on time multiplied by the chip max current
+ */
+uint8_t sgp41_low_power_get_energy(sgp41_low_power_energy_t *energy);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,266 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_sampler.c
+ * @brief     driver sgp41 sampler source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_sampler.h"
+#include "driver_sgp41_algorithm.h"
+#include <math.h>
+
+static sgp41_handle_t gs_handle;                         /**< sgp41 handle */
+static sgp41_gas_index_algorithm_t gs_voc_handle;        /**< voc handle */
+static sgp41_gas_index_algorithm_t gs_nox_handle;        /**< nox handle */
+static uint64_t gs_period_us;                            /**< period in us */
+static uint64_t gs_deadline_us;                          /**< next deadline */
+static uint64_t gs_last_us;                              /**< last sample time */
+static sgp41_sampler_stats_t gs_stats;                   /**< statistics */
+static float gs_m2;                                      /**< sum of squared period errors around the mean */
+
+/**
+ * @brief     sampler example init
+ * @param[in] period_ms sampling period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the algorithms are set up with the same sampling interval
+ */
+uint8_t sgp41_sampler_init(uint32_t period_ms)
+{
+    uint8_t res;
+
+    /* check the period */
+    if (period_ms == 0)
+    {
+        sgp41_interface_debug_print("sgp41: period is invalid.\n");
+
+        return 1;
+    }
+
+    /* link functions */
+    DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, sgp41_interface_iic_init);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, sgp41_interface_iic_deinit);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, sgp41_interface_iic_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, sgp41_interface_iic_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, sgp41_interface_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle, sgp41_interface_debug_print);
+
+    /* sgp41 init */
+    res = sgp41_init(&gs_handle);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: init failed.\n");
+
+        return 1;
+    }
+
+    /* soft reset */
+    res = sgp41_soft_reset(&gs_handle);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: soft failed.\n");
+        (void)sgp41_deinit(&gs_handle);
+
+        return 1;
+    }
+
+    /* voc algorithm init */
+    sgp41_algorithm_init_with_sampling_interval(&gs_voc_handle, SGP41_ALGORITHM_TYPE_VOC, (float)period_ms / 1000.0f);
+
+    /* nox algorithm init */
+    sgp41_algorithm_init_with_sampling_interval(&gs_nox_handle, SGP41_ALGORITHM_TYPE_NOX, (float)period_ms / 1000.0f);
+
+    /* the first deadline is now */
+    gs_period_us = (uint64_t)period_ms * 1000;
+    gs_deadline_us = sgp41_interface_get_time_us();
+    gs_last_us = 0;
+    gs_stats.samples = 0;
+    gs_stats.slips = 0;
+    gs_stats.jitter_min_us = 0;
+    gs_stats.jitter_max_us = 0;
+    gs_stats.jitter_mean_us = 0.0f;
+    gs_stats.jitter_std_us = 0.0f;
+    gs_stats.late_max_us = 0;
+    gs_m2 = 0.0f;
+
+    return 0;
+}
+
+/**
+ * @brief  sampler example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t sgp41_sampler_deinit(void)
+{
+    /* close sgp41 */
+    if (sgp41_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      sampler example read
+ * @param[in]  temperature current temperature in C
+ * @param[in]  humidity current humidity in %
+ * @param[out] *voc_gas_index pointer to a voc gas index buffer
+ * @param[out] *nox_gas_index pointer to a nox gas index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       sleeps until the next absolute deadline, deadlines advance by whole periods
+ *             so the rate never drifts, missed deadlines are skipped and counted as slips
+ */
+uint8_t sgp41_sampler_read(float temperature, float humidity, int32_t *voc_gas_index, int32_t *nox_gas_index)
+{
+    uint8_t res;
+    uint16_t raw_humidity;
+    uint16_t raw_temperature;
+    uint16_t sraw_voc;
+    uint16_t sraw_nox;
+    uint64_t now;
+    uint64_t late;
+    float elapsed;
+
+    /* humidity convert to register */
+    res = sgp41_humidity_convert_to_register(&gs_handle, humidity, &raw_humidity);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: humidity convert to register failed.\n");
+
+        return 1;
+    }
+
+    /* temperature convert to register */
+    res = sgp41_temperature_convert_to_register(&gs_handle, temperature, &raw_temperature);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: temperature convert to register failed.\n");
+
+        return 1;
+    }
+
+    /* sleep until the deadline */
+    sgp41_interface_delay_until_us(gs_deadline_us);
+    now = sgp41_interface_get_time_us();
+    late = now - gs_deadline_us;
+    if (late > gs_stats.late_max_us)
+    {
+        gs_stats.late_max_us = (uint32_t)((late > 0xFFFFFFFFULL) ? 0xFFFFFFFFULL : late);
+    }
+
+    /* the next deadline is a whole period after this one, not after now */
+    gs_deadline_us += gs_period_us;
+    if (now >= gs_deadline_us)
+    {
+        uint64_t missed;
+
+        /* skip the deadlines that have already passed */
+        missed = (now - gs_deadline_us) / gs_period_us + 1;
+        gs_deadline_us += missed * gs_period_us;
+        gs_stats.slips += (uint32_t)missed;
+    }
+
+    /* get measure raw */
+    res = sgp41_get_measure_raw(&gs_handle, raw_humidity, raw_temperature, &sraw_voc, &sraw_nox);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: get measure raw failed.\n");
+
+        return 1;
+    }
+
+    /* feed the true elapsed time */
+    if (gs_stats.samples != 0)
+    {
+        int32_t error;
+        float delta;
+
+        elapsed = (float)(now - gs_last_us) / 1000000.0f;
+
+        /* period error with a running mean and variance */
+        error = (int32_t)((int64_t)(now - gs_last_us) - (int64_t)gs_period_us);
+        if ((gs_stats.samples == 1) || (error < gs_stats.jitter_min_us))
+        {
+            gs_stats.jitter_min_us = error;
+        }
+        if ((gs_stats.samples == 1) || (error > gs_stats.jitter_max_us))
+        {
+            gs_stats.jitter_max_us = error;
+        }
+        delta = (float)error - gs_stats.jitter_mean_us;
+        gs_stats.jitter_mean_us += delta / (float)gs_stats.samples;
+        gs_m2 += delta * ((float)error - gs_stats.jitter_mean_us);
+        gs_stats.jitter_std_us = sqrtf(gs_m2 / (float)gs_stats.samples);
+    }
+    else
+    {
+        /* the first sample is a nominal step */
+        sgp41_algorithm_get_sampling_interval(&gs_voc_handle, &elapsed);
+    }
+    gs_last_us = now;
+    gs_stats.samples++;
+
+    /* algorithm process */
+    sgp41_algorithm_process_with_elapsed(&gs_voc_handle, sraw_voc, elapsed, voc_gas_index);
+
+    /* algorithm process */
+    sgp41_algorithm_process_with_elapsed(&gs_nox_handle, sraw_nox, elapsed, nox_gas_index);
+
+    return 0;
+}
+
+/**
+ * @brief      sampler example get the statistics
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       the period error is the time between two samples minus the period
+ */
+uint8_t sgp41_sampler_get_stats(sgp41_sampler_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return 1;
+    }
+    *stats = gs_stats;
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_sampler.h
+ * @brief     driver sgp41 sampler header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_SAMPLER_H
+#define DRIVER_SGP41_SAMPLER_H
+
+#include "driver_sgp41_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup sgp41_example_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 sampler example default definition
+ */
+#define SGP41_SAMPLER_DEFAULT_PERIOD_MS        1000        /**< 1 s, the algorithm sampling interval */
+
+/**
+ * @brief sgp41 sampler statistics structure definition
+ */
+typedef struct sgp41_sampler_stats_s
+{
+    uint32_t samples;               /**< sample number */
+    uint32_t slips;                 /**< skipped deadline number */
+    int32_t jitter_min_us;          /**< minimum period error in us */
+    int32_t jitter_max_us;          /**< maximum period error in us */
+    float jitter_mean_us;           /**< mean period error in us */
+    float jitter_std_us;            /**< period error standard deviation in us */
+    uint32_t late_max_us;           /**< maximum wake up lateness in us */
+} sgp41_sampler_stats_t;
+
+/**
+ * @brief     sampler example init
+ * @param[in] period_ms sampling period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the algorithms are set up with the same sampling interval
+ */
+uint8_t sgp41_sampler_init(uint32_t period_ms);
+
+/**
+ * @brief  sampler example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t sgp41_sampler_deinit(void);
+
+/**
+ * @brief      sampler example read
+ * @param[in]  temperature current temperature in C
+ * @param[in]  humidity current humidity in %
+ * @param[out] *voc_gas_index pointer to a voc gas index buffer
+ * @param[out] *nox_gas_index pointer to a nox gas index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       sleeps until the next absolute deadline, deadlines advance by whole periods
+ *             so the rate never drifts, missed deadlines are skipped and counted as slips
+ */
+uint8_t sgp41_sampler_read(float temperature, float humidity, int32_t *voc_gas_index, int32_t *nox_gas_index);
+
+/**
+ * @brief      sampler example get the statistics
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       the period error is the time between two samples minus the period
+ */
+uint8_t sgp41_sampler_get_stats(sgp41_sampler_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -100,6 +100,26 @@ void sgp41_interface_delay_ms(uint32_t ms)
 
 }
 
+/**
+ * @brief  interface get the monotonic time
+ * @return time in us
+ * @note   the clock never goes back and does not follow wall clock changes
+ */
+uint64_t sgp41_interface_get_time_us(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface delay until an absolute time
+ * @param[in] deadline_us deadline on the sgp41_interface_get_time_us clock
+ * @note      returns at once when the deadline has passed
+ */
+void sgp41_interface_delay_until_us(uint64_t deadline_us)
+{
+
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
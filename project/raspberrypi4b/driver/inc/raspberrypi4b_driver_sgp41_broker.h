@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_broker.h
+ * @brief     raspberrypi4b driver sgp41 broker header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_SGP41_BROKER_H
+#define RASPBERRYPI4B_DRIVER_SGP41_BROKER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_broker sgp41 broker function
+ * @brief    sgp41 linux shared iic bus modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 broker param definition
+ */
+#define SGP41_BROKER_MAX_BUSES        8         /**< max bus devices */
+#define SGP41_BROKER_NAME_LEN         32        /**< bus device name length */
+
+/**
+ * @brief sgp41 broker statistics structure definition
+ */
+typedef struct sgp41_broker_stats_s
+{
+    uint32_t refs;                /**< current holders */
+    uint64_t opens;               /**< open calls */
+    uint64_t syscalls;            /**< open and close syscalls */
+    uint64_t transactions;        /**< read and write transactions */
+    uint64_t errors;              /**< failed transactions */
+    uint64_t contended;           /**< locks that waited for another thread */
+    uint64_t acquisitions;        /**< outermost locks */
+    uint64_t process_waits;       /**< locks that waited for another process */
+    uint64_t wait_us;             /**< total time from lock request to grant */
+    uint64_t wait_max_us;         /**< longest time from lock request to grant */
+    uint64_t hold_us;             /**< total time from lock grant to release */
+    uint64_t hold_max_us;         /**< longest time from lock grant to release */
+} sgp41_broker_stats_t;
+
+/**
+ * @brief      open a bus device or share the open one
+ * @param[in]  *name pointer to a bus device name
+ * @param[out] *fd pointer to a fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed or the broker is full
+ * @note       every open needs one sgp41_broker_close
+ */
+uint8_t sgp41_broker_open(char *name, int *fd);
+
+/**
+ * @brief     drop one reference of a bus device
+ * @param[in] fd bus fd
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed or fd is not from the broker
+ * @note      the device is closed with the last reference unless keep open is set
+ */
+uint8_t sgp41_broker_close(int fd);
+
+/**
+ * @brief     keep idle bus devices open
+ * @param[in] enable bool value
+ * @note      disabling it closes the idle devices
+ */
+void sgp41_broker_set_keep_open(uint8_t enable);
+
+/**
+ * @brief     lock the devices against other processes
+ * @param[in] enable bool value
+ * @note      enabled by default, every transaction holds a flock on the device so the
+ *            processes that use the broker never interleave on one bus, a forked child
+ *            shares the flock of an inherited fd and has to open the device again
+ */
+void sgp41_broker_set_process_lock(uint8_t enable);
+
+/**
+ * @brief     write a command on a shared bus
+ * @param[in] fd bus fd
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed or fd is not from the broker
+ * @note      one transaction at a time per bus, the lock is released before the return
+ */
+uint8_t sgp41_broker_write_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      read a command on a shared bus
+ * @param[in]  fd bus fd
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed or fd is not from the broker
+ * @note       one transaction at a time per bus
+ */
+uint8_t sgp41_broker_read_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      lock a shared bus for a multi transaction sequence
+ * @param[in]  fd bus fd
+ * @return     status code
+ *             - 0 success
+ *             - 1 fd is not from the broker
+ * @note       the lock is recursive, the broker transactions of the same thread go on
+ */
+uint8_t sgp41_broker_lock(int fd);
+
+/**
+ * @brief     unlock a shared bus
+ * @param[in] fd bus fd
+ * @return    status code
+ *            - 0 success
+ *            - 1 fd is not from the broker
+ * @note      none
+ */
+uint8_t sgp41_broker_unlock(int fd);
+
+/**
+ * @brief      get the counters of a bus device
+ * @param[in]  *name pointer to a bus device name
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the device was never opened
+ * @note       the counters live as long as the process
+ */
+uint8_t sgp41_broker_get_stats(const char *name, sgp41_broker_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
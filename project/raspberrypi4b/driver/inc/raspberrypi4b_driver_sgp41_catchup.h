@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_catchup.h
+ * @brief     raspberrypi4b driver sgp41 catchup header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_SGP41_CATCHUP_H
+#define RASPBERRYPI4B_DRIVER_SGP41_CATCHUP_H
+
+#include "driver_sgp41_algorithm.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_catchup sgp41 catchup function
+ * @brief    sgp41 linux backlog catch up modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 catchup param definition
+ */
+#define SGP41_CATCHUP_MAX_WORKERS        64        /**< max worker threads */
+
+/**
+ * @brief sgp41 catchup job structure definition
+ */
+typedef struct sgp41_catchup_job_s
+{
+    sgp41_gas_index_algorithm_t *voc;        /**< voc state of the device, one job per state */
+    sgp41_gas_index_algorithm_t *nox;        /**< nox state of the device, NULL runs the voc samples only */
+    const int32_t *sraw_voc;                 /**< voc sraw samples one sampling interval apart */
+    const int32_t *sraw_nox;                 /**< nox sraw samples one sampling interval apart */
+    int32_t *voc_index;                      /**< voc gas index buffer of count values */
+    int32_t *nox_index;                      /**< nox gas index buffer of count values */
+    uint32_t count;                          /**< sample number */
+} sgp41_catchup_job_t;
+
+/**
+ * @brief sgp41 catchup statistics structure definition
+ */
+typedef struct sgp41_catchup_stats_s
+{
+    uint64_t runs;                     /**< finished runs */
+    uint64_t jobs;                     /**< finished jobs */
+    uint64_t samples;                  /**< processed samples, a voc and nox pair is one sample */
+    uint64_t elapsed_us;               /**< wall time inside the runs */
+    uint64_t busy_us;                  /**< worker time inside the jobs, all workers */
+    uint32_t workers;                  /**< worker threads */
+    double samples_per_core;           /**< samples per second of worker time */
+} sgp41_catchup_stats_t;
+
+/**
+ * @brief sgp41 catchup worker structure definition
+ */
+typedef struct sgp41_catchup_worker_s
+{
+    struct sgp41_catchup_s *service;        /**< owner service */
+    pthread_t thread;                       /**< worker thread */
+    uint32_t generation;                    /**< last run taken */
+    uint64_t samples;                       /**< processed samples */
+    uint64_t busy_us;                       /**< time inside the jobs */
+} sgp41_catchup_worker_t;
+
+/**
+ * @brief sgp41 catchup structure definition
+ */
+typedef struct sgp41_catchup_s
+{
+    sgp41_catchup_worker_t worker[SGP41_CATCHUP_MAX_WORKERS];        /**< workers */
+    uint32_t workers;                                                /**< worker number */
+    sgp41_catchup_job_t **order;                                     /**< jobs of the run, longest first */
+    uint32_t order_size;                                             /**< order capacity */
+    uint32_t job_count;                                              /**< jobs of the run */
+    uint32_t next;                                                   /**< next job to take */
+    uint32_t generation;                                             /**< run counter */
+    uint32_t active;                                                 /**< workers inside the run */
+    pthread_mutex_t mutex;                                           /**< run lock */
+    pthread_cond_t cond;                                             /**< run condition */
+    uint64_t runs;                                                   /**< run counter */
+    uint64_t jobs;                                                   /**< job counter */
+    uint64_t elapsed_us;                                             /**< run time */
+    uint8_t stop;                                                    /**< stop flag */
+    uint8_t inited;                                                  /**< inited flag */
+} sgp41_catchup_t;
+
+/**
+ * @brief     start the catchup workers
+ * @param[in] *service pointer to an sgp41 catchup structure
+ * @param[in] workers worker number, 0 starts one per online core
+ * @return    status code
+ *            - 0 success
+ *            - 1 thread, mutex or condition init failed
+ *            - 2 service is NULL
+ *            - 4 workers is over SGP41_CATCHUP_MAX_WORKERS
+ * @note      worker n is pinned to core n modulo the online cores so a state stays in the cache
+ *            of one core for its whole run
+ */
+uint8_t sgp41_catchup_init(sgp41_catchup_t *service, uint32_t workers);
+
+/**
+ * @brief     stop the catchup workers
+ * @param[in] *service pointer to an sgp41 catchup structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ * @note      none
+ */
+uint8_t sgp41_catchup_deinit(sgp41_catchup_t *service);
+
+/**
+ * @brief     process backlogs on all workers
+ * @param[in] *service pointer to an sgp41 catchup structure
+ * @param[in] *job pointer to the jobs
+ * @param[in] count job number
+ * @return    status code
+ *            - 0 success
+ *            - 2 param is NULL
+ *            - 3 service is not initialized
+ *            - 4 a job has a NULL pointer
+ *            - 5 no memory
+ * @note      every job runs sgp41_algorithm_process_run_pair on one worker, the longest jobs are taken
+ *            first so the workers finish together, no two jobs may share a state, it returns
+ *            when all jobs are done and is not reentrant
+ */
+uint8_t sgp41_catchup_run(sgp41_catchup_t *service, sgp41_catchup_job_t *job, uint32_t count);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *service pointer to an sgp41 catchup structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 service is not initialized
+ * @note       none
+ */
+uint8_t sgp41_catchup_get_stats(sgp41_catchup_t *service, sgp41_catchup_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_event.h
+ * @brief     raspberrypi4b driver sgp41 event header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_SGP41_EVENT_H
+#define RASPBERRYPI4B_DRIVER_SGP41_EVENT_H
+
+#include "driver_sgp41.h"
+#include "driver_sgp41_algorithm.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_event sgp41 event loop function
+ * @brief    sgp41 linux event loop modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 event param definition
+ */
+#define SGP41_EVENT_DEFAULT_PERIOD_MS           1000        /**< default sampling period */
+#define SGP41_EVENT_DEFAULT_CONDITIONING        10          /**< default conditioning samples */
+
+/**
+ * @brief sgp41 event pending enumeration definition
+ */
+typedef enum
+{
+    SGP41_EVENT_PENDING_NONE         = 0x00,        /**< no conversion */
+    SGP41_EVENT_PENDING_CONDITIONING = 0x01,        /**< conditioning conversion */
+    SGP41_EVENT_PENDING_MEASURE      = 0x02,        /**< measure raw conversion */
+} sgp41_event_pending_t;
+
+/**
+ * @brief sgp41 event structure definition
+ */
+typedef struct sgp41_event_s
+{
+    sgp41_handle_t *handle;                                                             /**< driver handle */
+    void (*sample_callback)(uint32_t id, uint8_t status,
+                            uint16_t sraw_voc, uint16_t sraw_nox,
+                            int32_t voc_gas_index, int32_t nox_gas_index);              /**< point to a sample_callback function address */
+    uint32_t id;                                                                        /**< sensor id passed to the callback */
+    int epoll_fd;                                                                       /**< pollable fd of both timers */
+    int schedule_fd;                                                                    /**< sampling schedule timerfd */
+    int conversion_fd;                                                                  /**< pending conversion timerfd */
+    uint32_t period_ms;                                                                 /**< sampling period */
+    uint16_t raw_humidity;                                                              /**< compensation humidity raw data */
+    uint16_t raw_temperature;                                                           /**< compensation temperature raw data */
+    uint16_t conditioning;                                                              /**< conditioning samples left */
+    uint8_t pending;                                                                    /**< pending conversion */
+    uint8_t running;                                                                    /**< schedule armed flag */
+    uint64_t samples;                                                                   /**< delivered samples */
+    uint64_t missed;                                                                    /**< skipped schedule ticks */
+    sgp41_gas_index_algorithm_t voc_algorithm;                                          /**< voc algorithm */
+    sgp41_gas_index_algorithm_t nox_algorithm;                                          /**< nox algorithm */
+    uint8_t inited;                                                                     /**< inited flag */
+} sgp41_event_t;
+
+/**
+ * @brief     initialize the event adapter
+ * @param[in] *event pointer to an sgp41 event structure
+ * @param[in] *handle pointer to an initialized sgp41 handle structure
+ * @param[in] id sensor id passed to the callback
+ * @param[in] period_ms sampling period, 0 means the default
+ * @param[in] *sample_callback pointer to a sample callback function
+ * @return    status code
+ *            - 0 success
+ *            - 1 timerfd or epoll create failed
+ *            - 2 event, handle or sample_callback is NULL
+ *            - 3 handle is not initialized
+ * @note      the gas index algorithms run with the sampling period, the
+ *            compensation defaults to 50 %RH and 25 C
+ */
+uint8_t sgp41_event_init(sgp41_event_t *event, sgp41_handle_t *handle, uint32_t id, uint32_t period_ms,
+                         void (*sample_callback)(uint32_t id, uint8_t status,
+                                                 uint16_t sraw_voc, uint16_t sraw_nox,
+                                                 int32_t voc_gas_index, int32_t nox_gas_index));
+
+/**
+ * @brief     close the event adapter
+ * @param[in] *event pointer to an sgp41 event structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      the fds are closed, the driver handle is left open
+ */
+uint8_t sgp41_event_deinit(sgp41_event_t *event);
+
+/**
+ * @brief      get the pollable fd
+ * @param[in]  *event pointer to an sgp41 event structure
+ * @param[out] *fd pointer to a fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 event is NULL
+ *             - 3 event is not initialized
+ * @note       an epoll fd over both timers, add it with EPOLLIN to the
+ *             application loop and call sgp41_event_dispatch when it is readable
+ */
+uint8_t sgp41_event_get_fd(sgp41_event_t *event, int *fd);
+
+/**
+ * @brief      get the timer fds
+ * @param[in]  *event pointer to an sgp41 event structure
+ * @param[out] *schedule_fd pointer to a schedule fd buffer
+ * @param[out] *conversion_fd pointer to a conversion fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 event is NULL
+ *             - 3 event is not initialized
+ * @note       for loops that prefer to watch the timerfds directly
+ */
+uint8_t sgp41_event_get_timer_fd(sgp41_event_t *event, int *schedule_fd, int *conversion_fd);
+
+/**
+ * @brief     set the compensation
+ * @param[in] *event pointer to an sgp41 event structure
+ * @param[in] raw_humidity humidity raw data
+ * @param[in] raw_temperature temperature raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      used from the next sample, convert with sgp41_humidity_convert_to_register
+ *            and sgp41_temperature_convert_to_register
+ */
+uint8_t sgp41_event_set_compensation(sgp41_event_t *event, uint16_t raw_humidity, uint16_t raw_temperature);
+
+/**
+ * @brief     start sampling
+ * @param[in] *event pointer to an sgp41 event structure
+ * @param[in] conditioning conditioning samples before the first measurement
+ * @return    status code
+ *            - 0 success
+ *            - 1 timerfd set failed
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      the schedule is an absolute CLOCK_MONOTONIC timer with the
+ *            period as interval, so the cadence does not drift with the loop
+ */
+uint8_t sgp41_event_start(sgp41_event_t *event, uint16_t conditioning);
+
+/**
+ * @brief     stop sampling
+ * @param[in] *event pointer to an sgp41 event structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 timerfd set failed
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      a pending conversion is dropped
+ */
+uint8_t sgp41_event_stop(sgp41_event_t *event);
+
+/**
+ * @brief     handle the expired timers
+ * @param[in] *event pointer to an sgp41 event structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 timerfd read failed
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      never blocks, a schedule tick starts a command and arms the
+ *            conversion timer, a conversion tick reads the result and calls
+ *            the sample callback, ticks that come while a conversion is
+ *            pending or that the loop slept through are counted as missed
+ */
+uint8_t sgp41_event_dispatch(sgp41_event_t *event);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_ingest.h
+ * @brief     raspberrypi4b driver sgp41 ingest header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_SGP41_INGEST_H
+#define RASPBERRYPI4B_DRIVER_SGP41_INGEST_H
+
+#include "driver_sgp41_algorithm.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_ingest sgp41 ingest function
+ * @brief    sgp41 linux sraw ingestion service modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 ingest param definition
+ * @note  packet: "SGR" 0x01, serial id 3 words, timestamp of the first sample 4 bytes, count 2 bytes,
+ *                then count samples of sraw voc 2 bytes and sraw nox 2 bytes, one second apart,
+ *                every field is big endian like the words of the chip
+ */
+#define SGP41_INGEST_HEADER_SIZE           16                                                   /**< packet header length */
+#define SGP41_INGEST_MAX_SAMPLES           256                                                  /**< samples per packet */
+#define SGP41_INGEST_PACKET_MAX            (SGP41_INGEST_HEADER_SIZE + SGP41_INGEST_MAX_SAMPLES * 4)  /**< max packet length */
+#define SGP41_INGEST_BATCH                 32                                                   /**< packets taken per receive call */
+#define SGP41_INGEST_SINK_RESULTS          1024                                                 /**< results buffered for the sink */
+#define SGP41_INGEST_ADDRESS_LEN           108                                                  /**< socket path length */
+
+/**
+ * @brief sgp41 ingest restart definition
+ */
+#ifndef SGP41_INGEST_RESTART_WINDOW
+    #define SGP41_INGEST_RESTART_WINDOW    600         /**< a packet starting further back in s is a device restart, not a retransmit */
+#endif
+
+/**
+ * @brief sgp41 ingest result structure definition
+ */
+typedef struct sgp41_ingest_result_s
+{
+    uint16_t id[3];                 /**< serial id */
+    uint32_t timestamp;             /**< device time of the sample */
+    int32_t voc_index;              /**< voc gas index */
+    int32_t nox_index;              /**< nox gas index */
+    uint64_t received_us;           /**< packet arrival on CLOCK_MONOTONIC */
+} sgp41_ingest_result_t;
+
+/**
+ * @brief sgp41 ingest device structure definition
+ */
+typedef struct sgp41_ingest_device_s
+{
+    uint16_t id[3];                           /**< serial id */
+    uint8_t used;                             /**< used flag */
+    uint32_t next_timestamp;                  /**< timestamp of the next new sample */
+    uint64_t samples;                         /**< processed samples */
+    sgp41_gas_index_algorithm_t voc;          /**< voc algorithm */
+    sgp41_gas_index_algorithm_t nox;          /**< nox algorithm */
+} sgp41_ingest_device_t;
+
+/**
+ * @brief sgp41 ingest statistics structure definition
+ */
+typedef struct sgp41_ingest_stats_s
+{
+    uint64_t packets;               /**< good packets */
+    uint64_t samples;               /**< processed samples */
+    uint64_t bad_packets;           /**< packets with a bad header or length */
+    uint64_t duplicates;            /**< samples older than the device time, skipped */
+    uint64_t gaps;                  /**< packets that start after a missing sample */
+    uint64_t restarts;              /**< packets whose device time went back, the node restarted */
+    uint64_t rejected;              /**< packets of new devices beyond the capacity */
+    uint64_t flushes;               /**< sink calls */
+    uint64_t sink_errors;           /**< failed sink calls */
+    uint32_t devices;               /**< known devices */
+} sgp41_ingest_stats_t;
+
+/**
+ * @brief sgp41 ingest structure definition
+ */
+typedef struct sgp41_ingest_s
+{
+    int fd;                                                                          /**< socket fd */
+    char path[SGP41_INGEST_ADDRESS_LEN];                                             /**< unix socket path, removed at deinit */
+    uint8_t (*sink)(const sgp41_ingest_result_t *result, uint32_t count);            /**< point to a sink function address */
+    sgp41_ingest_device_t *device;                                                   /**< device hash */
+    uint32_t mask;                                                                   /**< hash size - 1 */
+    uint32_t max_devices;                                                            /**< device capacity */
+    sgp41_ingest_result_t out[SGP41_INGEST_SINK_RESULTS];                            /**< sink buffer */
+    uint32_t out_len;                                                                /**< buffered results */
+    uint8_t rx[SGP41_INGEST_BATCH][SGP41_INGEST_PACKET_MAX];                         /**< receive buffers */
+    sgp41_ingest_stats_t stats;                                                      /**< statistics */
+    uint8_t inited;                                                                  /**< inited flag */
+} sgp41_ingest_t;
+
+/**
+ * @brief      pack samples into a packet
+ * @param[in]  *id pointer to a serial id
+ * @param[in]  timestamp device time of the first sample
+ * @param[in]  *sraw_voc pointer to voc sraw samples
+ * @param[in]  *sraw_nox pointer to nox sraw samples
+ * @param[in]  count sample number
+ * @param[out] *buf pointer to a packet buffer of SGP41_INGEST_PACKET_MAX bytes
+ * @param[out] *len pointer to a packet length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 4 count is 0 or over SGP41_INGEST_MAX_SAMPLES
+ * @note       the node side of the service, it needs no socket
+ */
+uint8_t sgp41_ingest_pack(const uint16_t id[3], uint32_t timestamp, const uint16_t *sraw_voc, const uint16_t *sraw_nox,
+                          uint16_t count, uint8_t *buf, uint16_t *len);
+
+/**
+ * @brief     start the service
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @param[in] *address pointer to "unix:<path>" or "udp:<port>"
+ * @param[in] max_devices device capacity
+ * @param[in] *sink pointer to a sink function
+ * @return    status code
+ *            - 0 success
+ *            - 1 socket bind failed
+ *            - 2 param is NULL
+ *            - 4 address or capacity is invalid
+ *            - 5 no memory for the devices
+ * @note      an old unix socket file is replaced, the udp socket listens on every address
+ */
+uint8_t sgp41_ingest_init(sgp41_ingest_t *ingest, const char *address, uint32_t max_devices,
+                          uint8_t (*sink)(const sgp41_ingest_result_t *result, uint32_t count));
+
+/**
+ * @brief     stop the service
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sink failed
+ *            - 2 ingest is NULL
+ *            - 3 ingest is not initialized
+ * @note      the buffered results are flushed first
+ */
+uint8_t sgp41_ingest_deinit(sgp41_ingest_t *ingest);
+
+/**
+ * @brief      wait for packets and process them
+ * @param[in]  *ingest pointer to an sgp41 ingest structure
+ * @param[in]  timeout_ms max wait, 0 does not wait
+ * @param[out] *packets pointer to a packet number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 receive failed
+ *             - 2 param is NULL
+ *             - 3 ingest is not initialized
+ * @note       everything queued on the socket is taken in batches, every device runs its samples
+ *             back to back and the results reach the sink before it returns
+ */
+uint8_t sgp41_ingest_poll(sgp41_ingest_t *ingest, int timeout_ms, uint32_t *packets);
+
+/**
+ * @brief      process one packet
+ * @param[in]  *ingest pointer to an sgp41 ingest structure
+ * @param[in]  *buf pointer to a packet
+ * @param[in]  len packet length
+ * @param[in]  received_us arrival time
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 ingest is not initialized
+ *             - 4 packet is invalid
+ *             - 5 device capacity is full
+ * @note       for packets of another transport, the results stay buffered until the next flush,
+ *             samples the device has already sent are skipped, the first sample after missing
+ *             ones steps the states by the elapsed time, a device time more than
+ *             SGP41_INGEST_RESTART_WINDOW back is a restart and its first sample is an outage step
+ */
+uint8_t sgp41_ingest_process(sgp41_ingest_t *ingest, const uint8_t *buf, uint32_t len, uint64_t received_us);
+
+/**
+ * @brief     hand the buffered results to the sink
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sink failed
+ *            - 2 ingest is NULL
+ *            - 3 ingest is not initialized
+ * @note      failed results are dropped and counted
+ */
+uint8_t sgp41_ingest_flush(sgp41_ingest_t *ingest);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *ingest pointer to an sgp41 ingest structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 ingest is not initialized
+ * @note       none
+ */
+uint8_t sgp41_ingest_get_stats(const sgp41_ingest_t *ingest, sgp41_ingest_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
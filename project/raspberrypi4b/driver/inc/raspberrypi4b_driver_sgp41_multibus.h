@@ -0,0 +1,302 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_multibus.h
+ * @brief     raspberrypi4b driver sgp41 multibus header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_SGP41_MULTIBUS_H
+#define RASPBERRYPI4B_DRIVER_SGP41_MULTIBUS_H
+
+#include "driver_sgp41.h"
+#include "driver_sgp41_mux.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_multibus sgp41 multibus function
+ * @brief    sgp41 linux multi bus acquisition modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 multibus param definition
+ */
+#define SGP41_MULTIBUS_MAX_BUSES               8           /**< max buses, one worker thread each */
+#define SGP41_MULTIBUS_MAX_SENSORS             8           /**< max sensors per bus, more than one needs a mux */
+#define SGP41_MULTIBUS_QUEUE_LEN               64          /**< samples buffered per bus */
+#define SGP41_MULTIBUS_NAME_LEN                32          /**< bus device name length */
+#define SGP41_MULTIBUS_NO_MUX                  0x00        /**< sensor wired to the bus without a mux */
+#define SGP41_MULTIBUS_DEFAULT_PERIOD_MS       1000        /**< default round period */
+
+/**
+ * @brief sgp41 multibus sample structure definition
+ */
+typedef struct sgp41_multibus_sample_s
+{
+    uint64_t timestamp_us;        /**< measure start on CLOCK_MONOTONIC */
+    uint8_t bus;                  /**< bus index */
+    uint8_t sensor;               /**< sensor index on the bus */
+    uint8_t status;               /**< 0 success, 1 measure failed */
+    uint16_t sraw_voc;            /**< voc sraw */
+    uint16_t sraw_nox;            /**< nox sraw */
+} sgp41_multibus_sample_t;
+
+/**
+ * @brief sgp41 multibus statistics structure definition
+ */
+typedef struct sgp41_multibus_stats_s
+{
+    uint64_t rounds;              /**< finished rounds */
+    uint64_t samples;             /**< good samples */
+    uint64_t errors;              /**< failed samples */
+    uint64_t dropped;             /**< samples lost on a full queue */
+    uint64_t busy_us;             /**< time inside bus transactions */
+    uint64_t elapsed_us;          /**< worker run time */
+    float utilization;            /**< busy share of the run time in percent */
+} sgp41_multibus_stats_t;
+
+/**
+ * @brief sgp41 multibus bus operation structure definition
+ */
+typedef struct sgp41_multibus_ops_s
+{
+    uint8_t (*iic_init)(char *name, int *fd);                                       /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(int fd);                                                  /**< point to an iic_deinit function address */
+    uint8_t (*iic_write_cmd)(int fd, uint8_t addr, uint8_t *buf, uint16_t len);     /**< point to an iic_write_cmd function address */
+    uint8_t (*iic_read_cmd)(int fd, uint8_t addr, uint8_t *buf, uint16_t len);      /**< point to an iic_read_cmd function address */
+} sgp41_multibus_ops_t;
+
+/**
+ * @brief sgp41 multibus bus structure definition
+ */
+typedef struct sgp41_multibus_bus_s
+{
+    struct sgp41_multibus_s *service;                                 /**< owner service */
+    char name[SGP41_MULTIBUS_NAME_LEN];                               /**< bus device name */
+    int fd;                                                           /**< bus fd, owned by the worker */
+    pthread_t thread;                                                 /**< worker thread */
+    sgp41_mux_handle_t mux;                                           /**< mux transport */
+    uint8_t mux_addr[SGP41_MUX_MAX_MUXES];                            /**< mux addresses */
+    uint8_t mux_count;                                                /**< mux number */
+    sgp41_handle_t handle[SGP41_MULTIBUS_MAX_SENSORS];                /**< sensor handles */
+    uint8_t sensor_mux[SGP41_MULTIBUS_MAX_SENSORS];                   /**< mux index of every sensor */
+    uint8_t sensor_channel[SGP41_MULTIBUS_MAX_SENSORS];               /**< mux channel of every sensor */
+    uint8_t route[SGP41_MULTIBUS_MAX_SENSORS];                        /**< mux sensor index of every sensor */
+    uint8_t sensor_count;                                             /**< sensor number */
+    sgp41_multibus_sample_t queue[SGP41_MULTIBUS_QUEUE_LEN];          /**< sample queue */
+    uint32_t head;                                                    /**< queue head */
+    uint32_t count;                                                   /**< queued samples */
+    uint64_t watermark_us;                                            /**< no later sample is older */
+    uint64_t rounds;                                                  /**< round counter */
+    uint64_t samples;                                                 /**< sample counter */
+    uint64_t errors;                                                  /**< error counter */
+    uint64_t dropped;                                                 /**< dropped counter */
+    uint64_t busy_us;                                                 /**< busy time */
+    uint64_t pending_busy_us;                                         /**< busy time not yet published, worker only */
+    uint64_t start_us;                                                /**< worker start */
+    uint64_t stop_us;                                                 /**< worker stop, 0 while running */
+    uint8_t index;                                                    /**< bus index */
+    uint8_t started;                                                  /**< thread created flag */
+    uint8_t status;                                                   /**< worker status, 0 ok, 1 bus open or sensor init failed */
+} sgp41_multibus_bus_t;
+
+/**
+ * @brief sgp41 multibus structure definition
+ */
+typedef struct sgp41_multibus_s
+{
+    sgp41_multibus_bus_t bus[SGP41_MULTIBUS_MAX_BUSES];         /**< buses */
+    uint8_t bus_count;                                          /**< bus number */
+    sgp41_multibus_ops_t ops;                                   /**< bus operations */
+    uint32_t period_ms;                                         /**< round period, 0 runs back to back */
+    uint16_t raw_humidity;                                      /**< compensation humidity raw data */
+    uint16_t raw_temperature;                                   /**< compensation temperature raw data */
+    uint16_t conditioning;                                      /**< conditioning rounds */
+    pthread_mutex_t mutex;                                      /**< queue and state lock */
+    pthread_cond_t cond;                                        /**< queue and state condition */
+    uint8_t running;                                            /**< running flag */
+    uint8_t inited;                                             /**< inited flag */
+} sgp41_multibus_t;
+
+/**
+ * @brief     initialize the multibus service
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] period_ms round period, 0 runs the rounds back to back
+ * @return    status code
+ *            - 0 success
+ *            - 1 mutex or condition init failed
+ *            - 2 service is NULL
+ * @note      the buses share their fds through the broker until sgp41_multibus_set_ops,
+ *            the compensation defaults to 50 %RH and 25 C
+ */
+uint8_t sgp41_multibus_init(sgp41_multibus_t *service, uint32_t period_ms);
+
+/**
+ * @brief     close the multibus service
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ * @note      running workers are stopped first
+ */
+uint8_t sgp41_multibus_deinit(sgp41_multibus_t *service);
+
+/**
+ * @brief     set the bus operations
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] *ops pointer to a bus operation structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 service or ops is NULL
+ *            - 3 service is not initialized
+ *            - 4 service is running
+ * @note      every function is called from the worker thread of its bus only
+ */
+uint8_t sgp41_multibus_set_ops(sgp41_multibus_t *service, const sgp41_multibus_ops_t *ops);
+
+/**
+ * @brief     set the compensation
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] raw_humidity humidity raw data
+ * @param[in] raw_temperature temperature raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ * @note      all sensors use the same compensation
+ */
+uint8_t sgp41_multibus_set_compensation(sgp41_multibus_t *service, uint16_t raw_humidity, uint16_t raw_temperature);
+
+/**
+ * @brief      add a bus
+ * @param[in]  *service pointer to an sgp41 multibus structure
+ * @param[in]  *name pointer to a bus device name
+ * @param[out] *bus pointer to a bus index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 service or name is NULL
+ *             - 3 service is not initialized
+ *             - 4 service is running
+ *             - 5 too many buses or the name is too long
+ * @note       the bus is opened by its worker
+ */
+uint8_t sgp41_multibus_add_bus(sgp41_multibus_t *service, const char *name, uint8_t *bus);
+
+/**
+ * @brief      add a sensor
+ * @param[in]  *service pointer to an sgp41 multibus structure
+ * @param[in]  bus bus index
+ * @param[in]  mux_addr mux iic address, SGP41_MULTIBUS_NO_MUX for a sensor on the bus itself
+ * @param[in]  channel mux channel
+ * @param[out] *sensor pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 service is NULL
+ *             - 3 service is not initialized
+ *             - 4 service is running
+ *             - 5 bus, channel or the sensor number is invalid
+ *             - 6 a sensor without a mux must be alone on its bus
+ * @note       none
+ */
+uint8_t sgp41_multibus_add_sensor(sgp41_multibus_t *service, uint8_t bus, uint8_t mux_addr, uint8_t channel, uint8_t *sensor);
+
+/**
+ * @brief     start the workers
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] conditioning conditioning rounds before the first sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 thread create failed
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ *            - 4 service is running
+ *            - 5 no sensor is added
+ * @note      a bus that fails to open or init ends its worker and is left out of the stream
+ */
+uint8_t sgp41_multibus_start(sgp41_multibus_t *service, uint16_t conditioning);
+
+/**
+ * @brief     stop the workers
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ * @note      the queued samples can still be read, the heaters are turned off
+ */
+uint8_t sgp41_multibus_stop(sgp41_multibus_t *service);
+
+/**
+ * @brief      read the next sample of the merged stream
+ * @param[in]  *service pointer to an sgp41 multibus structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  timeout_ms wait time in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 timeout
+ *             - 2 service or sample is NULL
+ *             - 3 service is not initialized
+ *             - 4 every worker has ended and the queues are empty
+ * @note       the samples of all buses come in timestamp order, a sample is released once
+ *             no other bus can produce an older one
+ */
+uint8_t sgp41_multibus_read(sgp41_multibus_t *service, sgp41_multibus_sample_t *sample, uint32_t timeout_ms);
+
+/**
+ * @brief      get the statistics of a bus
+ * @param[in]  *service pointer to an sgp41 multibus structure
+ * @param[in]  bus bus index
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 service or stats is NULL
+ *             - 3 service is not initialized
+ *             - 5 bus is invalid
+ * @note       none
+ */
+uint8_t sgp41_multibus_get_stats(sgp41_multibus_t *service, uint8_t bus, sgp41_multibus_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
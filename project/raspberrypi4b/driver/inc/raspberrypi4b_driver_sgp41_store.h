@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_store.h
+ * @brief     raspberrypi4b driver sgp41 store header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_SGP41_STORE_H
+#define RASPBERRYPI4B_DRIVER_SGP41_STORE_H
+
+#include "driver_sgp41_algorithm.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_store sgp41 store function
+ * @brief    sgp41 linux algorithm state store modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 store param definition
+ */
+#define SGP41_STORE_FIELDS            14                  /**< floats that carry one state between samples */
+#define SGP41_STORE_RECORD_SIZE       128                 /**< file record length */
+#define SGP41_STORE_MAX_DEVICES       0x08000000U         /**< max devices of one file */
+#define SGP41_STORE_NONE              0xFFFFFFFFU         /**< no entry */
+
+/**
+ * @brief sgp41 store record flag enumeration definition
+ */
+typedef enum
+{
+    SGP41_STORE_FLAG_VOC_ESTIMATOR = (1 << 0),        /**< voc mean variance estimator initialized */
+    SGP41_STORE_FLAG_VOC_LOWPASS   = (1 << 1),        /**< voc adaptive lowpass initialized */
+    SGP41_STORE_FLAG_VOC_TIMESTAMP = (1 << 2),        /**< voc timestamp valid */
+    SGP41_STORE_FLAG_NOX_ESTIMATOR = (1 << 3),        /**< nox mean variance estimator initialized */
+    SGP41_STORE_FLAG_NOX_LOWPASS   = (1 << 4),        /**< nox adaptive lowpass initialized */
+    SGP41_STORE_FLAG_NOX_TIMESTAMP = (1 << 5),        /**< nox timestamp valid */
+    SGP41_STORE_FLAG_STATE         = (1 << 7),        /**< record holds states */
+} sgp41_store_flag_t;
+
+/**
+ * @brief sgp41 store file header structure definition
+ */
+typedef struct sgp41_store_header_s
+{
+    char magic[4];                     /**< "SGS" 0x01 */
+    uint32_t byte_order;               /**< 0x01020304 in the writer order */
+    uint32_t record_size;              /**< record length */
+    uint32_t slots;                    /**< record number, a power of 2 */
+    uint32_t devices;                  /**< used records */
+    uint8_t reserved[108];             /**< reserved, one record long */
+} sgp41_store_header_t;
+
+/**
+ * @brief sgp41 store file record structure definition
+ * @note  the mutable part of the voc and the nox state, the rest comes from the templates
+ */
+typedef struct sgp41_store_record_s
+{
+    uint16_t id[3];                              /**< serial id */
+    uint8_t used;                                /**< used flag */
+    uint8_t flags;                               /**< sgp41_store_flag_t */
+    uint32_t voc_timestamp_ms;                   /**< voc last timestamp */
+    uint32_t nox_timestamp_ms;                   /**< nox last timestamp */
+    float voc[SGP41_STORE_FIELDS];               /**< voc state */
+    float nox[SGP41_STORE_FIELDS];               /**< nox state */
+} sgp41_store_record_t;
+
+/**
+ * @brief sgp41 store cache entry structure definition
+ */
+typedef struct sgp41_store_entry_s
+{
+    uint16_t id[3];                              /**< serial id */
+    uint8_t used;                                /**< used flag */
+    uint8_t dirty;                               /**< states differ from the file */
+    uint32_t slot;                               /**< file record */
+    uint32_t prev;                               /**< more recent entry */
+    uint32_t next;                               /**< less recent entry */
+    sgp41_gas_index_algorithm_t voc;             /**< voc state */
+    sgp41_gas_index_algorithm_t nox;             /**< nox state */
+} sgp41_store_entry_t;
+
+/**
+ * @brief sgp41 store statistics structure definition
+ */
+typedef struct sgp41_store_stats_s
+{
+    uint64_t gets;                     /**< get calls */
+    uint64_t hits;                     /**< states found in the cache */
+    uint64_t loads;                    /**< states read from the file */
+    uint64_t creates;                  /**< states started from the templates */
+    uint64_t stores;                   /**< states written to the file */
+    uint64_t evictions;                /**< entries dropped from the cache */
+    uint64_t load_ns;                  /**< time of all loads */
+    uint64_t load_ns_max;              /**< slowest load */
+    uint64_t store_ns;                 /**< time of all stores */
+    uint64_t store_ns_max;             /**< slowest store */
+    uint32_t devices;                  /**< devices in the file */
+    uint32_t cached;                   /**< devices in the cache */
+    double hit_rate;                   /**< hits of all gets */
+    size_t cache_bytes;                /**< cache and index memory */
+    size_t file_bytes;                 /**< file length */
+    size_t file_resident_bytes;        /**< file pages in memory */
+} sgp41_store_stats_t;
+
+/**
+ * @brief sgp41 store structure definition
+ */
+typedef struct sgp41_store_s
+{
+    int fd;                                                      /**< file fd */
+    uint8_t *map;                                                /**< file mapping */
+    size_t map_size;                                             /**< file length */
+    sgp41_store_header_t *header;                                /**< file header */
+    sgp41_store_record_t *record;                                /**< file records */
+    uint32_t slot_mask;                                          /**< record number - 1 */
+    uint32_t max_devices;                                        /**< device capacity */
+    sgp41_store_entry_t *entry;                                  /**< cache entries */
+    uint32_t cache_size;                                         /**< cache capacity */
+    uint32_t cache_used;                                         /**< used entries */
+    uint32_t *table;                                             /**< id hash of the cache, entry + 1 */
+    uint32_t table_mask;                                         /**< hash size - 1 */
+    uint32_t head;                                               /**< most recent entry */
+    uint32_t tail;                                               /**< least recent entry */
+    sgp41_gas_index_algorithm_t voc_template;                    /**< voc template */
+    sgp41_gas_index_algorithm_t nox_template;                    /**< nox template */
+    sgp41_store_stats_t stats;                                   /**< statistics */
+    uint8_t inited;                                              /**< inited flag */
+} sgp41_store_t;
+
+/**
+ * @brief     open the store
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] *path pointer to a state file path
+ * @param[in] max_devices device capacity of a new file
+ * @param[in] cache_size states kept in memory
+ * @return    status code
+ *            - 0 success
+ *            - 1 open or map failed
+ *            - 2 param is NULL
+ *            - 4 size is invalid, does not fit the address space or the file has another layout
+ *            - 5 no memory
+ * @note      a new file gets the next power of 2 records above twice max_devices and stays sparse
+ *            until the records are written, an existing file keeps its own capacity, the
+ *            templates are sgp41_algorithm_init states with a 1 s interval
+ */
+uint8_t sgp41_store_init(sgp41_store_t *store, const char *path, uint32_t max_devices, uint32_t cache_size);
+
+/**
+ * @brief     close the store
+ * @param[in] *store pointer to an sgp41 store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync failed
+ *            - 2 store is NULL
+ *            - 3 store is not initialized
+ * @note      the cached states are written back first
+ */
+uint8_t sgp41_store_deinit(sgp41_store_t *store);
+
+/**
+ * @brief     set the state templates
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] *voc pointer to a voc template
+ * @param[in] *nox pointer to a nox template
+ * @return    status code
+ *            - 0 success
+ *            - 2 param is NULL
+ *            - 3 store is not initialized
+ * @note      a template gives the tuning and the interval of loaded states and the start of new
+ *            ones, set it before the first get and keep it for the file
+ */
+uint8_t sgp41_store_set_template(sgp41_store_t *store, const sgp41_gas_index_algorithm_t *voc,
+                                 const sgp41_gas_index_algorithm_t *nox);
+
+/**
+ * @brief      get the states of a device
+ * @param[in]  *store pointer to an sgp41 store structure
+ * @param[in]  *id pointer to a serial id
+ * @param[out] **voc pointer to a voc state pointer buffer
+ * @param[out] **nox pointer to a nox state pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 store is not initialized
+ *             - 5 the file is full
+ * @note       the states stay valid and may be updated until the next get, a miss loads them
+ *             from the file or starts them from the templates and writes the least recently
+ *             used states back to the file
+ */
+uint8_t sgp41_store_get(sgp41_store_t *store, const uint16_t id[3],
+                        sgp41_gas_index_algorithm_t **voc, sgp41_gas_index_algorithm_t **nox);
+
+/**
+ * @brief     write the cached states to the file
+ * @param[in] *store pointer to an sgp41 store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync failed
+ *            - 2 store is NULL
+ *            - 3 store is not initialized
+ * @note      the states stay cached, the file is synced to the disk
+ */
+uint8_t sgp41_store_flush(sgp41_store_t *store);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *store pointer to an sgp41 store structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 store is not initialized
+ *             - 4 resident query failed
+ * @note       the resident file bytes walk the whole mapping
+ */
+uint8_t sgp41_store_get_stats(sgp41_store_t *store, sgp41_store_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,496 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_broker.c
+ * @brief     raspberrypi4b driver sgp41 broker source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_sgp41_broker.h"
+#include "iic.h"
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/file.h>
+#include <time.h>
+
+/**
+ * @brief sgp41 broker bus structure definition
+ */
+typedef struct sgp41_broker_bus_s
+{
+    char name[SGP41_BROKER_NAME_LEN];        /**< bus device name, empty when the slot is free */
+    int fd;                                  /**< bus fd, -1 when closed */
+    pthread_mutex_t mutex;                   /**< transaction lock */
+    uint32_t depth;                          /**< lock depth of the holding thread */
+    uint8_t flocked;                         /**< flock held flag */
+    uint64_t hold_start_us;                  /**< lock grant of the holding thread */
+    sgp41_broker_stats_t stats;              /**< counters */
+} sgp41_broker_bus_t;
+
+static pthread_rwlock_t gs_table_lock = PTHREAD_RWLOCK_INITIALIZER;        /**< open and close against transactions */
+static sgp41_broker_bus_t gs_bus[SGP41_BROKER_MAX_BUSES];                 /**< bus table */
+static uint8_t gs_keep_open = 0;                                          /**< keep idle devices open */
+static uint8_t gs_process_lock = 1;                                       /**< lock the device against other processes */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   CLOCK_MONOTONIC
+ */
+static uint64_t a_sgp41_broker_now_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);                                        /* get the time */
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);          /* return us */
+}
+
+/**
+ * @brief     find an open bus by fd
+ * @param[in] fd bus fd
+ * @return    pointer to a bus or NULL
+ * @note      the table lock must be held
+ */
+static sgp41_broker_bus_t *a_sgp41_broker_find(int fd)
+{
+    uint8_t i;
+    
+    for (i = 0; i < SGP41_BROKER_MAX_BUSES; i++)                                      /* every slot */
+    {
+        if ((gs_bus[i].name[0] != 0) && (gs_bus[i].fd == fd) && (fd >= 0))            /* found */
+        {
+            return &gs_bus[i];                                                        /* return the bus */
+        }
+    }
+    
+    return NULL;                                                                      /* not found */
+}
+
+/**
+ * @brief     lock a bus against the other threads and processes
+ * @param[in] *bus pointer to a bus
+ * @return    status code
+ *            - 0 success
+ *            - 1 process lock failed
+ * @note      the outermost lock takes a flock on the device, the kernel drops it when the holder dies
+ */
+static uint8_t a_sgp41_broker_lock(sgp41_broker_bus_t *bus)
+{
+    uint64_t start;
+    uint64_t wait;
+    int res;
+    
+    start = a_sgp41_broker_now_us();                                                  /* lock request */
+    if (pthread_mutex_trylock(&bus->mutex) != 0)                                      /* held by another thread */
+    {
+        (void)pthread_mutex_lock(&bus->mutex);                                        /* wait */
+        bus->stats.contended++;                                                       /* add contended */
+    }
+    bus->depth++;                                                                     /* add depth */
+    if (bus->depth > 1)                                                               /* nested */
+    {
+        return 0;                                                                     /* already held */
+    }
+    if (gs_process_lock != 0)                                                         /* process lock */
+    {
+        if (flock(bus->fd, LOCK_EX | LOCK_NB) != 0)                                   /* held by another process */
+        {
+            do
+            {
+                res = flock(bus->fd, LOCK_EX);                                        /* wait */
+            } while ((res != 0) && (errno == EINTR));                                 /* retry on a signal */
+            if (res != 0)                                                             /* failed */
+            {
+                bus->depth--;                                                         /* drop depth */
+                (void)pthread_mutex_unlock(&bus->mutex);                              /* unlock the bus */
+                
+                return 1;                                                             /* return error */
+            }
+            bus->stats.process_waits++;                                               /* add process wait */
+        }
+        bus->flocked = 1;                                                             /* flag flock */
+    }
+    bus->hold_start_us = a_sgp41_broker_now_us();                                     /* lock grant */
+    wait = bus->hold_start_us - start;                                                /* wait time */
+    bus->stats.acquisitions++;                                                        /* add acquisition */
+    bus->stats.wait_us += wait;                                                       /* add wait */
+    if (wait > bus->stats.wait_max_us)                                                /* longer wait */
+    {
+        bus->stats.wait_max_us = wait;                                                /* set max wait */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     unlock a bus
+ * @param[in] *bus pointer to a bus
+ * @note      the outermost unlock drops the flock
+ */
+static void a_sgp41_broker_unlock(sgp41_broker_bus_t *bus)
+{
+    uint64_t hold;
+    
+    bus->depth--;                                                                     /* drop depth */
+    if (bus->depth == 0)                                                              /* outermost */
+    {
+        if (bus->flocked != 0)                                                        /* process lock */
+        {
+            (void)flock(bus->fd, LOCK_UN);                                            /* let the other processes in */
+            bus->flocked = 0;                                                         /* clear flock */
+        }
+        hold = a_sgp41_broker_now_us() - bus->hold_start_us;                          /* hold time */
+        bus->stats.hold_us += hold;                                                   /* add hold */
+        if (hold > bus->stats.hold_max_us)                                            /* longer hold */
+        {
+            bus->stats.hold_max_us = hold;                                            /* set max hold */
+        }
+    }
+    (void)pthread_mutex_unlock(&bus->mutex);                                          /* unlock the bus */
+}
+
+/**
+ * @brief      run one transaction
+ * @param[in]  fd bus fd
+ * @param[in]  addr iic device write address
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  read read flag
+ * @return     status code
+ *             - 0 success
+ *             - 1 transaction failed or fd is not from the broker
+ * @note       none
+ */
+static uint8_t a_sgp41_broker_transfer(int fd, uint8_t addr, uint8_t *buf, uint16_t len, uint8_t read)
+{
+    sgp41_broker_bus_t *bus;
+    uint8_t res;
+    
+    (void)pthread_rwlock_rdlock(&gs_table_lock);                                      /* lock the table */
+    bus = a_sgp41_broker_find(fd);                                                    /* find the bus */
+    if (bus == NULL)                                                                  /* check the bus */
+    {
+        (void)pthread_rwlock_unlock(&gs_table_lock);                                  /* unlock the table */
+        
+        return 1;                                                                     /* return error */
+    }
+    if (a_sgp41_broker_lock(bus) != 0)                                                /* lock the bus */
+    {
+        bus->stats.errors++;                                                          /* add error */
+        (void)pthread_rwlock_unlock(&gs_table_lock);                                  /* unlock the table */
+        
+        return 1;                                                                     /* return error */
+    }
+    if (read != 0)                                                                    /* read */
+    {
+        res = iic_read_cmd(fd, addr, buf, len);                                       /* read */
+    }
+    else
+    {
+        res = iic_write_cmd(fd, addr, buf, len);                                      /* write */
+    }
+    bus->stats.transactions++;                                                        /* add transaction */
+    if (res != 0)                                                                     /* failed */
+    {
+        bus->stats.errors++;                                                          /* add error */
+    }
+    a_sgp41_broker_unlock(bus);                                                       /* unlock the bus */
+    (void)pthread_rwlock_unlock(&gs_table_lock);                                      /* unlock the table */
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief      open a bus device or share the open one
+ * @param[in]  *name pointer to a bus device name
+ * @param[out] *fd pointer to a fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed or the broker is full
+ * @note       every open needs one sgp41_broker_close
+ */
+uint8_t sgp41_broker_open(char *name, int *fd)
+{
+    pthread_mutexattr_t attr;
+    sgp41_broker_bus_t *bus;
+    uint8_t i;
+    
+    if ((name == NULL) || (fd == NULL) || (strlen(name) >= SGP41_BROKER_NAME_LEN))    /* check the name */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    (void)pthread_rwlock_wrlock(&gs_table_lock);                                      /* lock the table */
+    bus = NULL;                                                                       /* init null */
+    for (i = 0; i < SGP41_BROKER_MAX_BUSES; i++)                                      /* find the device */
+    {
+        if (strcmp(gs_bus[i].name, name) == 0)                                        /* found */
+        {
+            bus = &gs_bus[i];                                                         /* set the bus */
+            
+            break;                                                                    /* break */
+        }
+    }
+    if (bus == NULL)                                                                  /* new device */
+    {
+        for (i = 0; i < SGP41_BROKER_MAX_BUSES; i++)                                  /* find a free slot */
+        {
+            if (gs_bus[i].name[0] == 0)                                               /* free */
+            {
+                bus = &gs_bus[i];                                                     /* set the bus */
+                
+                break;                                                                /* break */
+            }
+        }
+        if (bus == NULL)                                                              /* full */
+        {
+            (void)pthread_rwlock_unlock(&gs_table_lock);                              /* unlock the table */
+            
+            return 1;                                                                 /* return error */
+        }
+        (void)pthread_mutexattr_init(&attr);                                          /* init the attr */
+        (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);              /* lock can wrap transactions */
+        if (pthread_mutex_init(&bus->mutex, &attr) != 0)                              /* init the mutex */
+        {
+            (void)pthread_mutexattr_destroy(&attr);                                   /* destroy the attr */
+            (void)pthread_rwlock_unlock(&gs_table_lock);                              /* unlock the table */
+            
+            return 1;                                                                 /* return error */
+        }
+        (void)pthread_mutexattr_destroy(&attr);                                       /* destroy the attr */
+        memset(&bus->stats, 0, sizeof(sgp41_broker_stats_t));                         /* clear the counters */
+        bus->depth = 0;                                                               /* not held */
+        bus->flocked = 0;                                                             /* no flock */
+        strcpy(bus->name, name);                                                      /* set the name */
+        bus->fd = -1;                                                                 /* closed */
+    }
+    bus->stats.opens++;                                                               /* add open */
+    if (bus->fd < 0)                                                                  /* not open */
+    {
+        bus->stats.syscalls++;                                                        /* add syscall */
+        if (iic_init(name, &bus->fd) != 0)                                            /* open the device */
+        {
+            bus->fd = -1;                                                             /* closed */
+            (void)pthread_rwlock_unlock(&gs_table_lock);                              /* unlock the table */
+            
+            return 1;                                                                 /* return error */
+        }
+    }
+    bus->stats.refs++;                                                                /* add reference */
+    *fd = bus->fd;                                                                    /* set the fd */
+    (void)pthread_rwlock_unlock(&gs_table_lock);                                      /* unlock the table */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     drop one reference of a bus device
+ * @param[in] fd bus fd
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed or fd is not from the broker
+ * @note      the device is closed with the last reference unless keep open is set
+ */
+uint8_t sgp41_broker_close(int fd)
+{
+    sgp41_broker_bus_t *bus;
+    uint8_t res;
+    
+    (void)pthread_rwlock_wrlock(&gs_table_lock);                                      /* lock the table */
+    bus = a_sgp41_broker_find(fd);                                                    /* find the bus */
+    if ((bus == NULL) || (bus->stats.refs == 0))                                      /* check the bus */
+    {
+        (void)pthread_rwlock_unlock(&gs_table_lock);                                  /* unlock the table */
+        
+        return 1;                                                                     /* return error */
+    }
+    res = 0;                                                                          /* init 0 */
+    bus->stats.refs--;                                                                /* drop reference */
+    if ((bus->stats.refs == 0) && (gs_keep_open == 0))                                /* last holder */
+    {
+        bus->stats.syscalls++;                                                        /* add syscall */
+        res = iic_deinit(bus->fd);                                                    /* close the device */
+        bus->fd = -1;                                                                 /* closed */
+    }
+    (void)pthread_rwlock_unlock(&gs_table_lock);                                      /* unlock the table */
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief     keep idle bus devices open
+ * @param[in] enable bool value
+ * @note      disabling it closes the idle devices
+ */
+void sgp41_broker_set_keep_open(uint8_t enable)
+{
+    uint8_t i;
+    
+    (void)pthread_rwlock_wrlock(&gs_table_lock);                                      /* lock the table */
+    gs_keep_open = enable;                                                            /* set keep open */
+    for (i = 0; (enable == 0) && (i < SGP41_BROKER_MAX_BUSES); i++)                   /* every slot */
+    {
+        if ((gs_bus[i].name[0] != 0) && (gs_bus[i].fd >= 0) && (gs_bus[i].stats.refs == 0))
+        {
+            gs_bus[i].stats.syscalls++;                                               /* add syscall */
+            (void)iic_deinit(gs_bus[i].fd);                                           /* close the idle device */
+            gs_bus[i].fd = -1;                                                        /* closed */
+        }
+    }
+    (void)pthread_rwlock_unlock(&gs_table_lock);                                      /* unlock the table */
+}
+
+/**
+ * @brief     lock the devices against other processes
+ * @param[in] enable bool value
+ * @note      enabled by default, a lock that is held keeps its flock until the unlock
+ */
+void sgp41_broker_set_process_lock(uint8_t enable)
+{
+    (void)pthread_rwlock_wrlock(&gs_table_lock);                                      /* no transaction in flight */
+    gs_process_lock = enable;                                                         /* set process lock */
+    (void)pthread_rwlock_unlock(&gs_table_lock);                                      /* unlock the table */
+}
+
+/**
+ * @brief     write a command on a shared bus
+ * @param[in] fd bus fd
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed or fd is not from the broker
+ * @note      one transaction at a time per bus, the lock is released before the return
+ */
+uint8_t sgp41_broker_write_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return a_sgp41_broker_transfer(fd, addr, buf, len, 0);                            /* write */
+}
+
+/**
+ * @brief      read a command on a shared bus
+ * @param[in]  fd bus fd
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed or fd is not from the broker
+ * @note       one transaction at a time per bus
+ */
+uint8_t sgp41_broker_read_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return a_sgp41_broker_transfer(fd, addr, buf, len, 1);                            /* read */
+}
+
+/**
+ * @brief      lock a shared bus for a multi transaction sequence
+ * @param[in]  fd bus fd
+ * @return     status code
+ *             - 0 success
+ *             - 1 fd is not from the broker
+ * @note       the lock is recursive, the broker transactions of the same thread go on
+ */
+uint8_t sgp41_broker_lock(int fd)
+{
+    sgp41_broker_bus_t *bus;
+    
+    (void)pthread_rwlock_rdlock(&gs_table_lock);                                      /* lock the table */
+    bus = a_sgp41_broker_find(fd);                                                    /* find the bus */
+    (void)pthread_rwlock_unlock(&gs_table_lock);                                      /* unlock the table */
+    if (bus == NULL)                                                                  /* check the bus */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    return a_sgp41_broker_lock(bus);                                                  /* lock the bus */
+}
+
+/**
+ * @brief     unlock a shared bus
+ * @param[in] fd bus fd
+ * @return    status code
+ *            - 0 success
+ *            - 1 fd is not from the broker
+ * @note      none
+ */
+uint8_t sgp41_broker_unlock(int fd)
+{
+    sgp41_broker_bus_t *bus;
+    
+    (void)pthread_rwlock_rdlock(&gs_table_lock);                                      /* lock the table */
+    bus = a_sgp41_broker_find(fd);                                                    /* find the bus */
+    (void)pthread_rwlock_unlock(&gs_table_lock);                                      /* unlock the table */
+    if (bus == NULL)                                                                  /* check the bus */
+    {
+        return 1;                                                                     /* return error */
+    }
+    a_sgp41_broker_unlock(bus);                                                       /* unlock the bus */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the counters of a bus device
+ * @param[in]  *name pointer to a bus device name
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the device was never opened
+ * @note       the counters live as long as the process
+ */
+uint8_t sgp41_broker_get_stats(const char *name, sgp41_broker_stats_t *stats)
+{
+    uint8_t i;
+    
+    if ((name == NULL) || (stats == NULL) || (name[0] == 0))                          /* check the name */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    (void)pthread_rwlock_wrlock(&gs_table_lock);                                      /* no transaction in flight */
+    for (i = 0; i < SGP41_BROKER_MAX_BUSES; i++)                                      /* every slot */
+    {
+        if (strcmp(gs_bus[i].name, name) == 0)                                        /* found */
+        {
+            *stats = gs_bus[i].stats;                                                 /* copy the counters */
+            (void)pthread_rwlock_unlock(&gs_table_lock);                              /* unlock the table */
+            
+            return 0;                                                                 /* success return 0 */
+        }
+    }
+    (void)pthread_rwlock_unlock(&gs_table_lock);                                      /* unlock the table */
+    
+    return 1;                                                                         /* return error */
+}
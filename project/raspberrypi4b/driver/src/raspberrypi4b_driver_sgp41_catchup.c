@@ -0,0 +1,377 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_catchup.c
+ * @brief     raspberrypi4b driver sgp41 catchup source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE                                  /**< pthread_setaffinity_np */
+
+#include "raspberrypi4b_driver_sgp41_catchup.h"
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_sgp41_catchup_now_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);                                        /* get the time */
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);          /* return us */
+}
+
+/**
+ * @brief     compare two jobs
+ * @param[in] *a pointer to a job pointer
+ * @param[in] *b pointer to a job pointer
+ * @return    order
+ * @note      longer jobs first
+ */
+static int a_sgp41_catchup_compare(const void *a, const void *b)
+{
+    uint32_t x = (*(sgp41_catchup_job_t * const *)a)->count;
+    uint32_t y = (*(sgp41_catchup_job_t * const *)b)->count;
+    
+    return (x < y) - (x > y);                                                         /* descending */
+}
+
+/**
+ * @brief     worker thread
+ * @param[in] *arg pointer to an sgp41 catchup worker structure
+ * @return    NULL
+ * @note      takes jobs of a run until none is left, a whole job stays on this worker
+ */
+static void *a_sgp41_catchup_worker(void *arg)
+{
+    sgp41_catchup_worker_t *w = (sgp41_catchup_worker_t *)arg;
+    sgp41_catchup_t *service = w->service;
+    
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    while (1)                                                                         /* loop */
+    {
+        uint64_t start;
+        uint64_t samples;
+        uint32_t k;
+        
+        while ((service->stop == 0) && (w->generation == service->generation))       /* wait for a run */
+        {
+            (void)pthread_cond_wait(&service->cond, &service->mutex);                 /* wait */
+        }
+        if (service->stop != 0)                                                       /* stop */
+        {
+            break;                                                                    /* break */
+        }
+        w->generation = service->generation;                                          /* take the run */
+        (void)pthread_mutex_unlock(&service->mutex);                                  /* unlock */
+        
+        start = a_sgp41_catchup_now_us();                                             /* start */
+        samples = 0;                                                                  /* init 0 */
+        while ((k = __atomic_fetch_add(&service->next, 1, __ATOMIC_RELAXED)) < service->job_count)  /* take a job */
+        {
+            sgp41_catchup_job_t *job = service->order[k];
+            
+            if (job->nox != NULL)                                                     /* voc and nox */
+            {
+                sgp41_algorithm_process_run_pair(job->voc, job->nox, job->sraw_voc, job->sraw_nox,
+                                                 job->count, job->voc_index, job->nox_index);  /* both chains on one core */
+                samples += job->count;                                                /* a pair is one sample */
+            }
+            else
+            {
+                sgp41_algorithm_process_run(job->voc, job->sraw_voc, job->count, job->voc_index);  /* voc only */
+                samples += job->count;                                                /* add the samples */
+            }
+        }
+        
+        (void)pthread_mutex_lock(&service->mutex);                                    /* lock */
+        w->samples += samples;                                                        /* add the samples */
+        w->busy_us += a_sgp41_catchup_now_us() - start;                               /* add the time */
+        service->active--;                                                            /* worker done */
+        if (service->active == 0)                                                     /* last worker */
+        {
+            (void)pthread_cond_broadcast(&service->cond);                             /* wake the caller */
+        }
+    }
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    
+    return NULL;                                                                      /* return */
+}
+
+/**
+ * @brief     stop and join the workers
+ * @param[in] *service pointer to an sgp41 catchup structure
+ * @param[in] started started worker number
+ * @note      none
+ */
+static void a_sgp41_catchup_join(sgp41_catchup_t *service, uint32_t started)
+{
+    uint32_t i;
+    
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    service->stop = 1;                                                                /* stop */
+    (void)pthread_cond_broadcast(&service->cond);                                     /* wake the workers */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    for (i = 0; i < started; i++)                                                     /* every worker */
+    {
+        (void)pthread_join(service->worker[i].thread, NULL);                          /* join */
+    }
+}
+
+/**
+ * @brief     start the catchup workers
+ * @param[in] *service pointer to an sgp41 catchup structure
+ * @param[in] workers worker number, 0 starts one per online core
+ * @return    status code
+ *            - 0 success
+ *            - 1 thread, mutex or condition init failed
+ *            - 2 service is NULL
+ *            - 4 workers is over SGP41_CATCHUP_MAX_WORKERS
+ * @note      worker n is pinned to core n modulo the online cores so a state stays in the cache
+ *            of one core for its whole run
+ */
+uint8_t sgp41_catchup_init(sgp41_catchup_t *service, uint32_t workers)
+{
+    long cores;
+    uint32_t i;
+    
+    if (service == NULL)                                                              /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (workers > SGP41_CATCHUP_MAX_WORKERS)                                          /* check workers */
+    {
+        return 4;                                                                     /* return error */
+    }
+    
+    memset(service, 0, sizeof(sgp41_catchup_t));                                     /* clear the service */
+    cores = sysconf(_SC_NPROCESSORS_ONLN);                                            /* online cores */
+    if (cores < 1)                                                                    /* unknown */
+    {
+        cores = 1;                                                                    /* one core */
+    }
+    if (workers == 0)                                                                 /* one per core */
+    {
+        workers = (cores > SGP41_CATCHUP_MAX_WORKERS) ? SGP41_CATCHUP_MAX_WORKERS : (uint32_t)cores;  /* set workers */
+    }
+    if (pthread_mutex_init(&service->mutex, NULL) != 0)                               /* mutex init */
+    {
+        return 1;                                                                     /* return error */
+    }
+    if (pthread_cond_init(&service->cond, NULL) != 0)                                 /* condition init */
+    {
+        (void)pthread_mutex_destroy(&service->mutex);                                 /* destroy the mutex */
+        
+        return 1;                                                                     /* return error */
+    }
+    for (i = 0; i < workers; i++)                                                     /* every worker */
+    {
+        cpu_set_t set;
+        
+        service->worker[i].service = service;                                         /* set the owner */
+        if (pthread_create(&service->worker[i].thread, NULL, a_sgp41_catchup_worker, &service->worker[i]) != 0)  /* create */
+        {
+            a_sgp41_catchup_join(service, i);                                         /* stop the started */
+            (void)pthread_cond_destroy(&service->cond);                               /* destroy the condition */
+            (void)pthread_mutex_destroy(&service->mutex);                             /* destroy the mutex */
+            
+            return 1;                                                                 /* return error */
+        }
+        CPU_ZERO(&set);                                                               /* clear */
+        CPU_SET((int)(i % (uint32_t)cores), &set);                                    /* one core */
+        (void)pthread_setaffinity_np(service->worker[i].thread, sizeof(set), &set);   /* pin, best effort */
+    }
+    service->workers = workers;                                                       /* set workers */
+    service->inited = 1;                                                              /* flag finish initialization */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     stop the catchup workers
+ * @param[in] *service pointer to an sgp41 catchup structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ * @note      none
+ */
+uint8_t sgp41_catchup_deinit(sgp41_catchup_t *service)
+{
+    if (service == NULL)                                                              /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    a_sgp41_catchup_join(service, service->workers);                                  /* stop the workers */
+    (void)pthread_cond_destroy(&service->cond);                                       /* destroy the condition */
+    (void)pthread_mutex_destroy(&service->mutex);                                     /* destroy the mutex */
+    free(service->order);                                                             /* free the order */
+    service->order = NULL;                                                            /* no order */
+    service->order_size = 0;                                                          /* no order */
+    service->inited = 0;                                                              /* flag close */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     process backlogs on all workers
+ * @param[in] *service pointer to an sgp41 catchup structure
+ * @param[in] *job pointer to the jobs
+ * @param[in] count job number
+ * @return    status code
+ *            - 0 success
+ *            - 2 param is NULL
+ *            - 3 service is not initialized
+ *            - 4 a job has a NULL pointer
+ *            - 5 no memory
+ * @note      every job runs sgp41_algorithm_process_run_pair on one worker, the longest jobs are taken
+ *            first so the workers finish together, no two jobs may share a state, it returns
+ *            when all jobs are done and is not reentrant
+ */
+uint8_t sgp41_catchup_run(sgp41_catchup_t *service, sgp41_catchup_job_t *job, uint32_t count)
+{
+    uint64_t start;
+    uint32_t i;
+    
+    if ((service == NULL) || (job == NULL))                                           /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    for (i = 0; i < count; i++)                                                       /* check the jobs */
+    {
+        if ((job[i].voc == NULL) ||
+            ((job[i].count != 0) && ((job[i].sraw_voc == NULL) || (job[i].voc_index == NULL))) ||
+            ((job[i].nox != NULL) && (job[i].count != 0) &&
+             ((job[i].sraw_nox == NULL) || (job[i].nox_index == NULL))))              /* check the pointers */
+        {
+            return 4;                                                                 /* return error */
+        }
+    }
+    if (count == 0)                                                                   /* nothing to do */
+    {
+        return 0;                                                                     /* success return 0 */
+    }
+    if (count > service->order_size)                                                  /* grow the order */
+    {
+        sgp41_catchup_job_t **order;
+        
+        order = realloc(service->order, sizeof(sgp41_catchup_job_t *) * count);       /* realloc */
+        if (order == NULL)                                                            /* check the memory */
+        {
+            return 5;                                                                 /* return error */
+        }
+        service->order = order;                                                       /* set the order */
+        service->order_size = count;                                                  /* set the capacity */
+    }
+    
+    start = a_sgp41_catchup_now_us();                                                 /* start */
+    for (i = 0; i < count; i++)                                                       /* every job */
+    {
+        service->order[i] = &job[i];                                                  /* set the job */
+    }
+    qsort(service->order, count, sizeof(sgp41_catchup_job_t *), a_sgp41_catchup_compare);  /* longest first */
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    service->job_count = count;                                                       /* set the jobs */
+    service->next = 0;                                                                /* first job */
+    service->active = service->workers;                                               /* all workers */
+    service->generation++;                                                            /* new run */
+    (void)pthread_cond_broadcast(&service->cond);                                     /* wake the workers */
+    while (service->active != 0)                                                      /* wait for the workers */
+    {
+        (void)pthread_cond_wait(&service->cond, &service->mutex);                     /* wait */
+    }
+    service->runs++;                                                                  /* run + 1 */
+    service->jobs += count;                                                           /* add the jobs */
+    service->elapsed_us += a_sgp41_catchup_now_us() - start;                          /* add the time */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *service pointer to an sgp41 catchup structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 service is not initialized
+ * @note       none
+ */
+uint8_t sgp41_catchup_get_stats(sgp41_catchup_t *service, sgp41_catchup_stats_t *stats)
+{
+    uint32_t i;
+    
+    if ((service == NULL) || (stats == NULL))                                         /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    memset(stats, 0, sizeof(sgp41_catchup_stats_t));                                 /* clear */
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    stats->runs = service->runs;                                                      /* set the runs */
+    stats->jobs = service->jobs;                                                      /* set the jobs */
+    stats->elapsed_us = service->elapsed_us;                                          /* set the time */
+    stats->workers = service->workers;                                                /* set the workers */
+    for (i = 0; i < service->workers; i++)                                            /* every worker */
+    {
+        stats->samples += service->worker[i].samples;                                 /* add the samples */
+        stats->busy_us += service->worker[i].busy_us;                                 /* add the time */
+    }
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    if (stats->busy_us != 0)                                                          /* check the time */
+    {
+        stats->samples_per_core = (double)stats->samples * 1000000.0 / (double)stats->busy_us;  /* per core */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
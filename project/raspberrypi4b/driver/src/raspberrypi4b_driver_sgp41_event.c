@@ -0,0 +1,530 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_event.c
+ * @brief     raspberrypi4b driver sgp41 event source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_sgp41_event.h"
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief     print an event message
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @param[in] *msg pointer to a message
+ * @note      debug_print may be unlinked at the binary and the none log level
+ */
+static void a_sgp41_event_print(sgp41_handle_t *handle, const char *msg)
+{
+    if (handle->debug_print != NULL)                                                  /* check debug_print */
+    {
+        handle->debug_print(msg);                                                     /* print the message */
+    }
+}
+
+/**
+ * @brief     arm a timerfd
+ * @param[in] fd timerfd
+ * @param[in] first_ms first expiration in ms from now, 0 disarms
+ * @param[in] interval_ms interval in ms, 0 means one shot
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the first expiration is absolute on CLOCK_MONOTONIC
+ */
+static uint8_t a_sgp41_event_arm(int fd, uint32_t first_ms, uint32_t interval_ms)
+{
+    struct itimerspec its;
+    struct timespec now;
+    
+    memset(&its, 0, sizeof(struct itimerspec));                                       /* clear the spec */
+    if (first_ms != 0)                                                                /* arm */
+    {
+        if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)                                /* get the time */
+        {
+            return 1;                                                                 /* return error */
+        }
+        its.it_value.tv_sec = now.tv_sec + (time_t)(first_ms / 1000);                 /* set the sec */
+        its.it_value.tv_nsec = now.tv_nsec + (long)(first_ms % 1000) * 1000000L;      /* set the nsec */
+        if (its.it_value.tv_nsec >= 1000000000L)                                      /* carry */
+        {
+            its.it_value.tv_sec++;                                                    /* sec + 1 */
+            its.it_value.tv_nsec -= 1000000000L;                                      /* nsec - 1s */
+        }
+        its.it_interval.tv_sec = (time_t)(interval_ms / 1000);                        /* set the interval sec */
+        its.it_interval.tv_nsec = (long)(interval_ms % 1000) * 1000000L;              /* set the interval nsec */
+    }
+    if (timerfd_settime(fd, TFD_TIMER_ABSTIME, &its, NULL) != 0)                      /* set the timer */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      read the expirations of a timerfd
+ * @param[in]  fd timerfd
+ * @param[out] *expirations pointer to an expirations buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       no expiration is not an error
+ */
+static uint8_t a_sgp41_event_expirations(int fd, uint64_t *expirations)
+{
+    ssize_t n;
+    
+    *expirations = 0;                                                                 /* init 0 */
+    n = read(fd, expirations, sizeof(uint64_t));                                      /* read the counter */
+    if (n == (ssize_t)sizeof(uint64_t))                                               /* check the length */
+    {
+        return 0;                                                                     /* success return 0 */
+    }
+    *expirations = 0;                                                                 /* no expiration */
+    if ((n < 0) && ((errno == EAGAIN) || (errno == EINTR)))                           /* not expired */
+    {
+        return 0;                                                                     /* success return 0 */
+    }
+    
+    return 1;                                                                         /* return error */
+}
+
+/**
+ * @brief     handle one schedule tick
+ * @param[in] *event pointer to an sgp41 event structure
+ * @note      none
+ */
+static void a_sgp41_event_tick(sgp41_event_t *event)
+{
+    uint8_t res;
+    uint32_t ms;
+    
+    if (event->conditioning != 0)                                                     /* conditioning */
+    {
+        res = sgp41_start_execute_conditioning(event->handle);                        /* start conditioning */
+        event->pending = SGP41_EVENT_PENDING_CONDITIONING;                            /* set pending */
+        ms = SGP41_EXECUTION_TIME_CONDITIONING_MS;                                    /* set the time */
+    }
+    else
+    {
+        res = sgp41_start_measure_raw(event->handle, event->raw_humidity,
+                                      event->raw_temperature);                        /* start measure raw */
+        event->pending = SGP41_EVENT_PENDING_MEASURE;                                 /* set pending */
+        ms = SGP41_EXECUTION_TIME_MEASURE_RAW_MS;                                     /* set the time */
+    }
+    if ((res != 0) || (a_sgp41_event_arm(event->conversion_fd, ms, 0) != 0))          /* start failed */
+    {
+        if (event->pending == SGP41_EVENT_PENDING_CONDITIONING)                       /* conditioning */
+        {
+            event->conditioning--;                                                    /* count it */
+        }
+        else
+        {
+            event->sample_callback(event->id, 1, 0, 0, 0, 0);                         /* report the error */
+        }
+        event->pending = SGP41_EVENT_PENDING_NONE;                                    /* clear pending */
+    }
+}
+
+/**
+ * @brief     handle one finished conversion
+ * @param[in] *event pointer to an sgp41 event structure
+ * @note      none
+ */
+static void a_sgp41_event_done(sgp41_event_t *event)
+{
+    uint16_t sraw_voc;
+    uint16_t sraw_nox;
+    int32_t voc_gas_index;
+    int32_t nox_gas_index;
+    
+    if (event->pending == SGP41_EVENT_PENDING_CONDITIONING)                           /* conditioning */
+    {
+        (void)sgp41_read_execute_conditioning(event->handle, &sraw_voc);              /* read and drop */
+        event->conditioning--;                                                        /* count it */
+    }
+    else if (event->pending == SGP41_EVENT_PENDING_MEASURE)                           /* measure */
+    {
+        if (sgp41_read_measure_raw(event->handle, &sraw_voc, &sraw_nox) != 0)         /* read measure raw */
+        {
+            event->sample_callback(event->id, 1, 0, 0, 0, 0);                         /* report the error */
+        }
+        else
+        {
+            sgp41_algorithm_process(&event->voc_algorithm, sraw_voc, &voc_gas_index); /* voc algorithm */
+            sgp41_algorithm_process(&event->nox_algorithm, sraw_nox, &nox_gas_index); /* nox algorithm */
+            event->samples++;                                                         /* samples++ */
+            event->sample_callback(event->id, 0, sraw_voc, sraw_nox,
+                                   voc_gas_index, nox_gas_index);                     /* report the sample */
+        }
+    }
+    else
+    {
+        /* a stale conversion tick after stop */
+    }
+    event->pending = SGP41_EVENT_PENDING_NONE;                                        /* clear pending */
+}
+
+/**
+ * @brief     initialize the event adapter
+ * @param[in] *event pointer to an sgp41 event structure
+ * @param[in] *handle pointer to an initialized sgp41 handle structure
+ * @param[in] id sensor id passed to the callback
+ * @param[in] period_ms sampling period, 0 means the default
+ * @param[in] *sample_callback pointer to a sample callback function
+ * @return    status code
+ *            - 0 success
+ *            - 1 timerfd or epoll create failed
+ *            - 2 event, handle or sample_callback is NULL
+ *            - 3 handle is not initialized
+ * @note      the gas index algorithms run with the sampling period, the
+ *            compensation defaults to 50 %RH and 25 C
+ */
+uint8_t sgp41_event_init(sgp41_event_t *event, sgp41_handle_t *handle, uint32_t id, uint32_t period_ms,
+                         void (*sample_callback)(uint32_t id, uint8_t status,
+                                                 uint16_t sraw_voc, uint16_t sraw_nox,
+                                                 int32_t voc_gas_index, int32_t nox_gas_index))
+{
+    struct epoll_event ev;
+    
+    if ((event == NULL) || (handle == NULL) || (sample_callback == NULL))            /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    memset(event, 0, sizeof(sgp41_event_t));                                          /* clear the event */
+    event->handle = handle;                                                           /* set the handle */
+    event->sample_callback = sample_callback;                                         /* set the callback */
+    event->id = id;                                                                   /* set the id */
+    event->period_ms = (period_ms != 0) ? period_ms : SGP41_EVENT_DEFAULT_PERIOD_MS;  /* set the period */
+    event->raw_humidity = 0x8000;                                                     /* 50 %RH */
+    event->raw_temperature = 0x6666;                                                  /* 25 C */
+    event->schedule_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC); /* create the schedule timer */
+    event->conversion_fd = timerfd_create(CLOCK_MONOTONIC,
+                                          TFD_NONBLOCK | TFD_CLOEXEC);                /* create the conversion timer */
+    event->epoll_fd = epoll_create1(EPOLL_CLOEXEC);                                   /* create the epoll */
+    if ((event->schedule_fd < 0) || (event->conversion_fd < 0) || (event->epoll_fd < 0))
+    {
+        goto failed;                                                                  /* create failed */
+    }
+    memset(&ev, 0, sizeof(struct epoll_event));                                       /* clear the event */
+    ev.events = EPOLLIN;                                                              /* set readable */
+    ev.data.fd = event->schedule_fd;                                                  /* set the fd */
+    if (epoll_ctl(event->epoll_fd, EPOLL_CTL_ADD, event->schedule_fd, &ev) != 0)      /* add the schedule timer */
+    {
+        goto failed;                                                                  /* add failed */
+    }
+    ev.data.fd = event->conversion_fd;                                                /* set the fd */
+    if (epoll_ctl(event->epoll_fd, EPOLL_CTL_ADD, event->conversion_fd, &ev) != 0)    /* add the conversion timer */
+    {
+        goto failed;                                                                  /* add failed */
+    }
+    sgp41_algorithm_init_with_sampling_interval(&event->voc_algorithm, SGP41_ALGORITHM_TYPE_VOC,
+                                                (float)event->period_ms / 1000.0f);   /* init the voc algorithm */
+    sgp41_algorithm_init_with_sampling_interval(&event->nox_algorithm, SGP41_ALGORITHM_TYPE_NOX,
+                                                (float)event->period_ms / 1000.0f);   /* init the nox algorithm */
+    event->inited = 1;                                                                /* flag finish initialization */
+    
+    return 0;                                                                         /* success return 0 */
+    
+    failed:
+    a_sgp41_event_print(handle, "sgp41: event create failed.\n");                     /* event create failed */
+    if (event->schedule_fd >= 0)                                                      /* check the fd */
+    {
+        (void)close(event->schedule_fd);                                              /* close the fd */
+    }
+    if (event->conversion_fd >= 0)                                                    /* check the fd */
+    {
+        (void)close(event->conversion_fd);                                            /* close the fd */
+    }
+    if (event->epoll_fd >= 0)                                                         /* check the fd */
+    {
+        (void)close(event->epoll_fd);                                                 /* close the fd */
+    }
+    
+    return 1;                                                                         /* return error */
+}
+
+/**
+ * @brief     close the event adapter
+ * @param[in] *event pointer to an sgp41 event structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      the fds are closed, the driver handle is left open
+ */
+uint8_t sgp41_event_deinit(sgp41_event_t *event)
+{
+    if (event == NULL)                                                                /* check event */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (event->inited != 1)                                                           /* check event initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    (void)close(event->epoll_fd);                                                     /* close the epoll */
+    (void)close(event->schedule_fd);                                                  /* close the schedule timer */
+    (void)close(event->conversion_fd);                                                /* close the conversion timer */
+    event->inited = 0;                                                                /* flag close */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the pollable fd
+ * @param[in]  *event pointer to an sgp41 event structure
+ * @param[out] *fd pointer to a fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 event is NULL
+ *             - 3 event is not initialized
+ * @note       an epoll fd over both timers, add it with EPOLLIN to the
+ *             application loop and call sgp41_event_dispatch when it is readable
+ */
+uint8_t sgp41_event_get_fd(sgp41_event_t *event, int *fd)
+{
+    if (event == NULL)                                                                /* check event */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (event->inited != 1)                                                           /* check event initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    *fd = event->epoll_fd;                                                            /* get the fd */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the timer fds
+ * @param[in]  *event pointer to an sgp41 event structure
+ * @param[out] *schedule_fd pointer to a schedule fd buffer
+ * @param[out] *conversion_fd pointer to a conversion fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 event is NULL
+ *             - 3 event is not initialized
+ * @note       for loops that prefer to watch the timerfds directly
+ */
+uint8_t sgp41_event_get_timer_fd(sgp41_event_t *event, int *schedule_fd, int *conversion_fd)
+{
+    if (event == NULL)                                                                /* check event */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (event->inited != 1)                                                           /* check event initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    *schedule_fd = event->schedule_fd;                                                /* get the schedule fd */
+    *conversion_fd = event->conversion_fd;                                            /* get the conversion fd */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the compensation
+ * @param[in] *event pointer to an sgp41 event structure
+ * @param[in] raw_humidity humidity raw data
+ * @param[in] raw_temperature temperature raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      used from the next sample, convert with sgp41_humidity_convert_to_register
+ *            and sgp41_temperature_convert_to_register
+ */
+uint8_t sgp41_event_set_compensation(sgp41_event_t *event, uint16_t raw_humidity, uint16_t raw_temperature)
+{
+    if (event == NULL)                                                                /* check event */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (event->inited != 1)                                                           /* check event initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    event->raw_humidity = raw_humidity;                                               /* set the humidity */
+    event->raw_temperature = raw_temperature;                                         /* set the temperature */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     start sampling
+ * @param[in] *event pointer to an sgp41 event structure
+ * @param[in] conditioning conditioning samples before the first measurement
+ * @return    status code
+ *            - 0 success
+ *            - 1 timerfd set failed
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      the schedule is an absolute CLOCK_MONOTONIC timer with the
+ *            period as interval, so the cadence does not drift with the loop
+ */
+uint8_t sgp41_event_start(sgp41_event_t *event, uint16_t conditioning)
+{
+    if (event == NULL)                                                                /* check event */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (event->inited != 1)                                                           /* check event initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    event->conditioning = conditioning;                                               /* set the conditioning */
+    event->pending = SGP41_EVENT_PENDING_NONE;                                        /* clear pending */
+    if (a_sgp41_event_arm(event->schedule_fd, 1, event->period_ms) != 0)              /* first tick at once */
+    {
+        a_sgp41_event_print(event->handle, "sgp41: event start failed.\n");           /* event start failed */
+        
+        return 1;                                                                     /* return error */
+    }
+    event->running = 1;                                                               /* set running */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     stop sampling
+ * @param[in] *event pointer to an sgp41 event structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 timerfd set failed
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      a pending conversion is dropped
+ */
+uint8_t sgp41_event_stop(sgp41_event_t *event)
+{
+    uint64_t expirations;
+    
+    if (event == NULL)                                                                /* check event */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (event->inited != 1)                                                           /* check event initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    if ((a_sgp41_event_arm(event->schedule_fd, 0, 0) != 0) ||
+        (a_sgp41_event_arm(event->conversion_fd, 0, 0) != 0))                         /* disarm the timers */
+    {
+        a_sgp41_event_print(event->handle, "sgp41: event stop failed.\n");            /* event stop failed */
+        
+        return 1;                                                                     /* return error */
+    }
+    (void)a_sgp41_event_expirations(event->schedule_fd, &expirations);                /* drain the schedule */
+    (void)a_sgp41_event_expirations(event->conversion_fd, &expirations);              /* drain the conversion */
+    event->pending = SGP41_EVENT_PENDING_NONE;                                        /* clear pending */
+    event->running = 0;                                                               /* clear running */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     handle the expired timers
+ * @param[in] *event pointer to an sgp41 event structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 timerfd read failed
+ *            - 2 event is NULL
+ *            - 3 event is not initialized
+ * @note      never blocks, a schedule tick starts a command and arms the
+ *            conversion timer, a conversion tick reads the result and calls
+ *            the sample callback, ticks that come while a conversion is
+ *            pending or that the loop slept through are counted as missed
+ */
+uint8_t sgp41_event_dispatch(sgp41_event_t *event)
+{
+    uint64_t expirations;
+    
+    if (event == NULL)                                                                /* check event */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (event->inited != 1)                                                           /* check event initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    if (a_sgp41_event_expirations(event->conversion_fd, &expirations) != 0)           /* read the conversion timer */
+    {
+        a_sgp41_event_print(event->handle, "sgp41: read conversion timer failed.\n"); /* read conversion timer failed */
+        
+        return 1;                                                                     /* return error */
+    }
+    if (expirations != 0)                                                             /* conversion done */
+    {
+        a_sgp41_event_done(event);                                                    /* read the result */
+    }
+    if (a_sgp41_event_expirations(event->schedule_fd, &expirations) != 0)             /* read the schedule timer */
+    {
+        a_sgp41_event_print(event->handle, "sgp41: read schedule timer failed.\n");   /* read schedule timer failed */
+        
+        return 1;                                                                     /* return error */
+    }
+    if ((expirations != 0) && (event->running != 0))                                  /* schedule tick */
+    {
+        event->missed += expirations - 1;                                             /* ticks the loop slept through */
+        if (event->pending != SGP41_EVENT_PENDING_NONE)                               /* conversion still pending */
+        {
+            event->missed++;                                                          /* skip this tick */
+        }
+        else
+        {
+            a_sgp41_event_tick(event);                                                /* start the next command */
+        }
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
@@ -0,0 +1,636 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_ingest.c
+ * @brief     raspberrypi4b driver sgp41 ingest source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE                                  /**< recvmmsg */
+
+#include "raspberrypi4b_driver_sgp41_ingest.h"
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief ingest packet magic definition
+ */
+static const uint8_t gs_magic[4] = {'S', 'G', 'R', 0x01};        /**< magic and version */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_sgp41_ingest_now_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);                                        /* get the time */
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);          /* return us */
+}
+
+/**
+ * @brief     get the hash slot of a serial id
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @param[in] *id pointer to a serial id
+ * @return    hash slot
+ * @note      fibonacci hashing of the 48 bit id
+ */
+static uint32_t a_sgp41_ingest_hash(const sgp41_ingest_t *ingest, const uint16_t id[3])
+{
+    uint64_t key;
+    
+    key = ((uint64_t)id[0] << 32) | ((uint64_t)id[1] << 16) | (uint64_t)id[2];       /* 48 bit key */
+    
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & ingest->mask;            /* top bits */
+}
+
+/**
+ * @brief     find or add a device
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @param[in] *id pointer to a serial id
+ * @return    device or NULL when the capacity is full
+ * @note      linear probing, devices are never removed
+ */
+static sgp41_ingest_device_t *a_sgp41_ingest_device(sgp41_ingest_t *ingest, const uint16_t id[3])
+{
+    sgp41_ingest_device_t *device;
+    uint32_t i;
+    
+    for (i = a_sgp41_ingest_hash(ingest, id); ingest->device[i].used != 0; i = (i + 1) & ingest->mask)  /* probe */
+    {
+        device = &ingest->device[i];
+        if ((device->id[0] == id[0]) && (device->id[1] == id[1]) && (device->id[2] == id[2]))           /* same id */
+        {
+            return device;                                                            /* return the device */
+        }
+    }
+    if (ingest->stats.devices >= ingest->max_devices)                                 /* capacity full */
+    {
+        return NULL;                                                                  /* return error */
+    }
+    device = &ingest->device[i];                                                      /* empty slot */
+    memcpy(device->id, id, sizeof(device->id));                                       /* copy the id */
+    device->used = 1;                                                                 /* used */
+    device->next_timestamp = 0;                                                       /* init 0 */
+    device->samples = 0;                                                              /* init 0 */
+    sgp41_algorithm_init(&device->voc, SGP41_ALGORITHM_TYPE_VOC);                     /* init voc */
+    sgp41_algorithm_init(&device->nox, SGP41_ALGORITHM_TYPE_NOX);                     /* init nox */
+    ingest->stats.devices++;                                                          /* device + 1 */
+    
+    return device;                                                                    /* return the device */
+}
+
+/**
+ * @brief     put a big endian value
+ * @param[in] *buf pointer to a buffer
+ * @param[in] value put value
+ * @param[in] bytes value length
+ * @note      none
+ */
+static void a_sgp41_ingest_put(uint8_t *buf, uint32_t value, uint8_t bytes)
+{
+    uint8_t i;
+    
+    for (i = 0; i < bytes; i++)                                                       /* high byte first */
+    {
+        buf[i] = (uint8_t)(value >> (8 * (bytes - 1 - i)));                           /* set the byte */
+    }
+}
+
+/**
+ * @brief     get a big endian value
+ * @param[in] *buf pointer to a buffer
+ * @param[in] bytes value length
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_sgp41_ingest_get(const uint8_t *buf, uint8_t bytes)
+{
+    uint32_t value = 0;
+    uint8_t i;
+    
+    for (i = 0; i < bytes; i++)                                                       /* high byte first */
+    {
+        value = (value << 8) | buf[i];                                                /* add the byte */
+    }
+    
+    return value;                                                                     /* return the value */
+}
+
+/**
+ * @brief      pack samples into a packet
+ * @param[in]  *id pointer to a serial id
+ * @param[in]  timestamp device time of the first sample
+ * @param[in]  *sraw_voc pointer to voc sraw samples
+ * @param[in]  *sraw_nox pointer to nox sraw samples
+ * @param[in]  count sample number
+ * @param[out] *buf pointer to a packet buffer of SGP41_INGEST_PACKET_MAX bytes
+ * @param[out] *len pointer to a packet length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 4 count is 0 or over SGP41_INGEST_MAX_SAMPLES
+ * @note       the node side of the service, it needs no socket
+ */
+uint8_t sgp41_ingest_pack(const uint16_t id[3], uint32_t timestamp, const uint16_t *sraw_voc, const uint16_t *sraw_nox,
+                          uint16_t count, uint8_t *buf, uint16_t *len)
+{
+    uint16_t i;
+    
+    if ((id == NULL) || (sraw_voc == NULL) || (sraw_nox == NULL) || (buf == NULL) || (len == NULL))  /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if ((count == 0) || (count > SGP41_INGEST_MAX_SAMPLES))                           /* check the count */
+    {
+        return 4;                                                                     /* return error */
+    }
+    
+    memcpy(buf, gs_magic, sizeof(gs_magic));                                          /* magic */
+    a_sgp41_ingest_put(&buf[4], id[0], 2);                                            /* id 0 */
+    a_sgp41_ingest_put(&buf[6], id[1], 2);                                            /* id 1 */
+    a_sgp41_ingest_put(&buf[8], id[2], 2);                                            /* id 2 */
+    a_sgp41_ingest_put(&buf[10], timestamp, 4);                                       /* timestamp */
+    a_sgp41_ingest_put(&buf[14], count, 2);                                           /* count */
+    for (i = 0; i < count; i++)                                                       /* samples */
+    {
+        a_sgp41_ingest_put(&buf[SGP41_INGEST_HEADER_SIZE + i * 4], sraw_voc[i], 2);   /* voc */
+        a_sgp41_ingest_put(&buf[SGP41_INGEST_HEADER_SIZE + i * 4 + 2], sraw_nox[i], 2);  /* nox */
+    }
+    *len = (uint16_t)(SGP41_INGEST_HEADER_SIZE + count * 4);                          /* packet length */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     start the service
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @param[in] *address pointer to "unix:<path>" or "udp:<port>"
+ * @param[in] max_devices device capacity
+ * @param[in] *sink pointer to a sink function
+ * @return    status code
+ *            - 0 success
+ *            - 1 socket bind failed
+ *            - 2 param is NULL
+ *            - 4 address or capacity is invalid
+ *            - 5 no memory for the devices
+ * @note      an old unix socket file is replaced, the udp socket listens on every address
+ */
+uint8_t sgp41_ingest_init(sgp41_ingest_t *ingest, const char *address, uint32_t max_devices,
+                          uint8_t (*sink)(const sgp41_ingest_result_t *result, uint32_t count))
+{
+    uint32_t size;
+    int buf_size = 4 * 1024 * 1024;
+    
+    if ((ingest == NULL) || (address == NULL) || (sink == NULL))                      /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if ((max_devices == 0) || (max_devices > 0x40000000U))                            /* check the capacity */
+    {
+        return 4;                                                                     /* return error */
+    }
+    
+    memset(ingest, 0, sizeof(sgp41_ingest_t));                                        /* clear */
+    ingest->fd = -1;                                                                  /* no socket */
+    if (strncmp(address, "unix:", 5) == 0)                                            /* unix socket */
+    {
+        struct sockaddr_un addr;
+        
+        if ((address[5] == '\0') || (strlen(&address[5]) >= sizeof(addr.sun_path)))   /* check the path */
+        {
+            return 4;                                                                 /* return error */
+        }
+        memset(&addr, 0, sizeof(addr));                                               /* clear */
+        addr.sun_family = AF_UNIX;                                                    /* unix */
+        strcpy(addr.sun_path, &address[5]);                                           /* set the path */
+        ingest->fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);                   /* datagram socket */
+        if (ingest->fd < 0)                                                           /* check the socket */
+        {
+            return 1;                                                                 /* return error */
+        }
+        (void)unlink(addr.sun_path);                                                  /* remove an old socket */
+        if (bind(ingest->fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)            /* bind */
+        {
+            (void)close(ingest->fd);                                                  /* close */
+            
+            return 1;                                                                 /* return error */
+        }
+        strcpy(ingest->path, addr.sun_path);                                          /* save the path */
+    }
+    else if (strncmp(address, "udp:", 4) == 0)                                        /* udp socket */
+    {
+        struct sockaddr_in addr;
+        char *end;
+        long port;
+        
+        port = strtol(&address[4], &end, 10);                                         /* parse the port */
+        if ((end == &address[4]) || (*end != '\0') || (port <= 0) || (port > 65535))  /* check the port */
+        {
+            return 4;                                                                 /* return error */
+        }
+        memset(&addr, 0, sizeof(addr));                                               /* clear */
+        addr.sin_family = AF_INET;                                                    /* ipv4 */
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);                                     /* every address */
+        addr.sin_port = htons((uint16_t)port);                                        /* set the port */
+        ingest->fd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);                   /* udp socket */
+        if (ingest->fd < 0)                                                           /* check the socket */
+        {
+            return 1;                                                                 /* return error */
+        }
+        if (bind(ingest->fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)            /* bind */
+        {
+            (void)close(ingest->fd);                                                  /* close */
+            
+            return 1;                                                                 /* return error */
+        }
+    }
+    else
+    {
+        return 4;                                                                     /* return error */
+    }
+    (void)setsockopt(ingest->fd, SOL_SOCKET, SO_RCVBUF, &buf_size, sizeof(buf_size)); /* room for bursts */
+    
+    for (size = 2; size < max_devices * 2; size <<= 1)                                /* at most half full */
+    {
+    }
+    ingest->device = calloc(size, sizeof(sgp41_ingest_device_t));                     /* device hash */
+    if (ingest->device == NULL)                                                       /* check the memory */
+    {
+        (void)close(ingest->fd);                                                      /* close */
+        if (ingest->path[0] != '\0')                                                  /* unix socket */
+        {
+            (void)unlink(ingest->path);                                               /* remove */
+        }
+        
+        return 5;                                                                     /* return error */
+    }
+    ingest->mask = size - 1;                                                          /* set the mask */
+    ingest->max_devices = max_devices;                                                /* set the capacity */
+    ingest->sink = sink;                                                              /* set the sink */
+    ingest->inited = 1;                                                               /* flag finish initialization */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     stop the service
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sink failed
+ *            - 2 ingest is NULL
+ *            - 3 ingest is not initialized
+ * @note      the buffered results are flushed first
+ */
+uint8_t sgp41_ingest_deinit(sgp41_ingest_t *ingest)
+{
+    uint8_t res;
+    
+    if (ingest == NULL)                                                               /* check ingest */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (ingest->inited != 1)                                                          /* check ingest initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    res = sgp41_ingest_flush(ingest);                                                 /* flush */
+    (void)close(ingest->fd);                                                          /* close */
+    if (ingest->path[0] != '\0')                                                      /* unix socket */
+    {
+        (void)unlink(ingest->path);                                                   /* remove */
+    }
+    free(ingest->device);                                                             /* free the devices */
+    ingest->device = NULL;                                                            /* no devices */
+    ingest->fd = -1;                                                                  /* no socket */
+    ingest->inited = 0;                                                               /* flag close */
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief      process one packet
+ * @param[in]  *ingest pointer to an sgp41 ingest structure
+ * @param[in]  *buf pointer to a packet
+ * @param[in]  len packet length
+ * @param[in]  received_us arrival time
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 ingest is not initialized
+ *             - 4 packet is invalid
+ *             - 5 device capacity is full
+ * @note       for packets of another transport, the results stay buffered until the next flush,
+ *             a restart or a gap feeds the first new sample through
+ *             sgp41_algorithm_process_with_elapsed
+ */
+uint8_t sgp41_ingest_process(sgp41_ingest_t *ingest, const uint8_t *buf, uint32_t len, uint64_t received_us)
+{
+    sgp41_ingest_device_t *device;
+    uint16_t id[3];
+    uint32_t timestamp;
+    uint32_t count;
+    uint32_t i;
+    uint32_t j;
+    uint32_t n;
+    uint32_t s;
+    uint8_t known;
+    float elapsed;
+    int32_t sraw_voc[SGP41_INGEST_MAX_SAMPLES];
+    int32_t sraw_nox[SGP41_INGEST_MAX_SAMPLES];
+    int32_t voc_index[SGP41_INGEST_MAX_SAMPLES];
+    int32_t nox_index[SGP41_INGEST_MAX_SAMPLES];
+    
+    if ((ingest == NULL) || (buf == NULL))                                            /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (ingest->inited != 1)                                                          /* check ingest initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    count = (len >= SGP41_INGEST_HEADER_SIZE) ? a_sgp41_ingest_get(&buf[14], 2) : 0;  /* sample number */
+    if ((count == 0) || (count > SGP41_INGEST_MAX_SAMPLES) ||
+        (len != SGP41_INGEST_HEADER_SIZE + count * 4) ||
+        (memcmp(buf, gs_magic, sizeof(gs_magic)) != 0))                               /* check the packet */
+    {
+        ingest->stats.bad_packets++;                                                  /* bad packet + 1 */
+        
+        return 4;                                                                     /* return error */
+    }
+    id[0] = (uint16_t)a_sgp41_ingest_get(&buf[4], 2);                                 /* id 0 */
+    id[1] = (uint16_t)a_sgp41_ingest_get(&buf[6], 2);                                 /* id 1 */
+    id[2] = (uint16_t)a_sgp41_ingest_get(&buf[8], 2);                                 /* id 2 */
+    timestamp = a_sgp41_ingest_get(&buf[10], 4);                                      /* timestamp */
+    device = a_sgp41_ingest_device(ingest, id);                                       /* route */
+    if (device == NULL)                                                               /* capacity full */
+    {
+        ingest->stats.rejected++;                                                     /* rejected + 1 */
+        
+        return 5;                                                                     /* return error */
+    }
+    ingest->stats.packets++;                                                          /* packet + 1 */
+    
+    /* skip samples the device state has seen */
+    i = 0;
+    elapsed = 0.0f;                                                                   /* nominal step */
+    known = (device->samples != 0) ? 1 : 0;                                           /* seen before */
+    if (known != 0)                                                                   /* known device */
+    {
+        int32_t ahead = (int32_t)(timestamp - device->next_timestamp);
+        
+        if (ahead < -SGP41_INGEST_RESTART_WINDOW)                                     /* device time restarted */
+        {
+            ingest->stats.restarts++;                                                 /* restart + 1 */
+            elapsed = SGP41_ALGORITHM_MAX_GAP + 1.0f;                                 /* unknown outage */
+            known = 0;                                                                /* new time base */
+        }
+        else if (ahead < 0)                                                           /* overlap */
+        {
+            i = ((uint32_t)(-ahead) < count) ? (uint32_t)(-ahead) : count;            /* old samples */
+            ingest->stats.duplicates += i;                                            /* duplicates */
+        }
+        else if (ahead > 0)                                                           /* missing samples */
+        {
+            ingest->stats.gaps++;                                                     /* gap + 1 */
+            elapsed = (float)ahead + 1.0f;                                            /* time since the last sample */
+        }
+    }
+    
+    /* one device runs its new samples back to back */
+    n = count - i;                                                                    /* new samples */
+    for (j = 0; j < n; j++)                                                           /* decode */
+    {
+        const uint8_t *sample = &buf[SGP41_INGEST_HEADER_SIZE + (i + j) * 4];
+        
+        sraw_voc[j] = (int32_t)a_sgp41_ingest_get(&sample[0], 2);                     /* voc */
+        sraw_nox[j] = (int32_t)a_sgp41_ingest_get(&sample[2], 2);                     /* nox */
+    }
+    s = 0;                                                                            /* no step */
+    if ((elapsed > 0.0f) && (n != 0))                                                 /* after a restart or a gap */
+    {
+        sgp41_algorithm_process_with_elapsed(&device->voc, sraw_voc[0], elapsed,
+                                             &voc_index[0]);                          /* voc */
+        sgp41_algorithm_process_with_elapsed(&device->nox, sraw_nox[0], elapsed,
+                                             &nox_index[0]);                          /* nox */
+        s = 1;                                                                        /* one step */
+    }
+    sgp41_algorithm_process_run_pair(&device->voc, &device->nox, &sraw_voc[s], &sraw_nox[s], n - s,
+                                     &voc_index[s], &nox_index[s]);                   /* voc and nox in turn */
+    for (j = 0; j < n; j++)                                                           /* hand over */
+    {
+        sgp41_ingest_result_t *result;
+        
+        if (ingest->out_len >= SGP41_INGEST_SINK_RESULTS)                             /* sink buffer full */
+        {
+            (void)sgp41_ingest_flush(ingest);                                         /* flush */
+        }
+        result = &ingest->out[ingest->out_len];                                       /* next result */
+        memcpy(result->id, id, sizeof(result->id));                                   /* copy the id */
+        result->timestamp = timestamp + i + j;                                        /* sample time */
+        result->voc_index = voc_index[j];                                             /* voc index */
+        result->nox_index = nox_index[j];                                             /* nox index */
+        result->received_us = received_us;                                            /* arrival */
+        ingest->out_len++;                                                            /* result + 1 */
+    }
+    device->samples += n;                                                             /* add the samples */
+    ingest->stats.samples += n;                                                       /* add the samples */
+    if ((known == 0) || ((int32_t)(timestamp + count - device->next_timestamp) > 0))  /* newer end */
+    {
+        device->next_timestamp = timestamp + count;                                   /* next new sample */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      wait for packets and process them
+ * @param[in]  *ingest pointer to an sgp41 ingest structure
+ * @param[in]  timeout_ms max wait, 0 does not wait
+ * @param[out] *packets pointer to a packet number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 receive failed
+ *             - 2 param is NULL
+ *             - 3 ingest is not initialized
+ * @note       everything queued on the socket is taken in batches, every device runs its samples
+ *             back to back and the results reach the sink before it returns
+ */
+uint8_t sgp41_ingest_poll(sgp41_ingest_t *ingest, int timeout_ms, uint32_t *packets)
+{
+    struct mmsghdr msg[SGP41_INGEST_BATCH];
+    struct iovec iov[SGP41_INGEST_BATCH];
+    struct pollfd pfd;
+    uint8_t res = 0;
+    int n;
+    int i;
+    
+    if ((ingest == NULL) || (packets == NULL))                                        /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (ingest->inited != 1)                                                          /* check ingest initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    *packets = 0;                                                                     /* init 0 */
+    pfd.fd = ingest->fd;                                                              /* socket */
+    pfd.events = POLLIN;                                                              /* readable */
+    pfd.revents = 0;                                                                  /* init 0 */
+    n = poll(&pfd, 1, timeout_ms);                                                    /* wait */
+    if (n < 0)                                                                        /* check the result */
+    {
+        return (errno == EINTR) ? 0 : 1;                                              /* signal or error */
+    }
+    if (n == 0)                                                                       /* timeout */
+    {
+        return 0;                                                                     /* success return 0 */
+    }
+    for (i = 0; i < SGP41_INGEST_BATCH; i++)                                          /* receive buffers */
+    {
+        iov[i].iov_base = ingest->rx[i];                                              /* buffer */
+        iov[i].iov_len = SGP41_INGEST_PACKET_MAX;                                     /* length */
+        memset(&msg[i], 0, sizeof(msg[i]));                                           /* clear */
+        msg[i].msg_hdr.msg_iov = &iov[i];                                             /* set the iov */
+        msg[i].msg_hdr.msg_iovlen = 1;                                                /* one iov */
+    }
+    while (1)                                                                         /* drain the socket */
+    {
+        uint64_t received_us;
+        
+        n = recvmmsg(ingest->fd, msg, SGP41_INGEST_BATCH, MSG_DONTWAIT, NULL);        /* take a batch */
+        if (n < 0)                                                                    /* nothing left or error */
+        {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))      /* real error */
+            {
+                res = 1;                                                              /* receive failed */
+            }
+            
+            break;                                                                    /* break */
+        }
+        received_us = a_sgp41_ingest_now_us();                                        /* arrival */
+        for (i = 0; i < n; i++)                                                       /* every packet */
+        {
+            (void)sgp41_ingest_process(ingest, ingest->rx[i], msg[i].msg_len, received_us);  /* process */
+        }
+        *packets += (uint32_t)n;                                                      /* add the packets */
+        if (n < SGP41_INGEST_BATCH)                                                   /* socket empty */
+        {
+            break;                                                                    /* break */
+        }
+    }
+    if (sgp41_ingest_flush(ingest) != 0)                                              /* hand the results over */
+    {
+        res = 1;                                                                      /* sink failed */
+    }
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief     hand the buffered results to the sink
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sink failed
+ *            - 2 ingest is NULL
+ *            - 3 ingest is not initialized
+ * @note      failed results are dropped and counted
+ */
+uint8_t sgp41_ingest_flush(sgp41_ingest_t *ingest)
+{
+    uint8_t res;
+    
+    if (ingest == NULL)                                                               /* check ingest */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (ingest->inited != 1)                                                          /* check ingest initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (ingest->out_len == 0)                                                         /* nothing buffered */
+    {
+        return 0;                                                                     /* success return 0 */
+    }
+    
+    res = ingest->sink(ingest->out, ingest->out_len);                                 /* sink */
+    ingest->stats.flushes++;                                                          /* flush + 1 */
+    ingest->out_len = 0;                                                              /* empty the buffer */
+    if (res != 0)                                                                     /* check the result */
+    {
+        ingest->stats.sink_errors++;                                                  /* sink error + 1 */
+        
+        return 1;                                                                     /* return error */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *ingest pointer to an sgp41 ingest structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 ingest is not initialized
+ * @note       none
+ */
+uint8_t sgp41_ingest_get_stats(const sgp41_ingest_t *ingest, sgp41_ingest_stats_t *stats)
+{
+    if ((ingest == NULL) || (stats == NULL))                                          /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (ingest->inited != 1)                                                          /* check ingest initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    *stats = ingest->stats;                                                           /* copy */
+    
+    return 0;                                                                         /* success return 0 */
+}
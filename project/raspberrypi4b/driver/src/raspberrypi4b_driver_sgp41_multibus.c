@@ -0,0 +1,959 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_multibus.c
+ * @brief     raspberrypi4b driver sgp41 multibus source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_sgp41_multibus.h"
+#include "driver_sgp41_interface.h"
+#include "raspberrypi4b_driver_sgp41_broker.h"
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+static __thread sgp41_multibus_bus_t *gs_bus = NULL;        /**< bus of the calling worker */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   CLOCK_MONOTONIC
+ */
+static uint64_t a_sgp41_multibus_now_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);                                        /* get the time */
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);          /* return us */
+}
+
+/**
+ * @brief  worker iic init
+ * @return status code
+ *         - 0 success
+ *         - 1 not called from a worker
+ * @note   the worker opens the bus itself
+ */
+static uint8_t a_sgp41_multibus_iic_init(void)
+{
+    return (gs_bus != NULL) ? 0 : 1;                                                  /* the worker owns the fd */
+}
+
+/**
+ * @brief  worker iic deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 not called from a worker
+ * @note   the worker closes the bus itself
+ */
+static uint8_t a_sgp41_multibus_iic_deinit(void)
+{
+    return (gs_bus != NULL) ? 0 : 1;                                                  /* the worker owns the fd */
+}
+
+/**
+ * @brief     worker iic write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      writes the fd of the calling worker and counts the busy time
+ */
+static uint8_t a_sgp41_multibus_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    sgp41_multibus_bus_t *bus = gs_bus;
+    uint64_t start;
+    uint8_t res;
+    
+    if (bus == NULL)                                                                  /* check worker */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    start = a_sgp41_multibus_now_us();                                                /* transaction start */
+    res = bus->service->ops.iic_write_cmd(bus->fd, addr, buf, len);                   /* write */
+    bus->pending_busy_us += a_sgp41_multibus_now_us() - start;                        /* add busy time */
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief      worker iic read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       reads the fd of the calling worker and counts the busy time
+ */
+static uint8_t a_sgp41_multibus_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    sgp41_multibus_bus_t *bus = gs_bus;
+    uint64_t start;
+    uint8_t res;
+    
+    if (bus == NULL)                                                                  /* check worker */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    start = a_sgp41_multibus_now_us();                                                /* transaction start */
+    res = bus->service->ops.iic_read_cmd(bus->fd, addr, buf, len);                    /* read */
+    bus->pending_busy_us += a_sgp41_multibus_now_us() - start;                        /* add busy time */
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief     route the bus to a sensor
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] sensor sensor index
+ * @note      nothing to do without a mux
+ */
+static void a_sgp41_multibus_route(sgp41_multibus_bus_t *bus, uint8_t sensor)
+{
+    if (bus->mux_count != 0)                                                          /* muxed bus */
+    {
+        (void)sgp41_mux_route(&bus->mux, bus->route[sensor]);                         /* route */
+    }
+}
+
+/**
+ * @brief     wait until a deadline or the stop
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] deadline_us deadline on CLOCK_MONOTONIC
+ * @return    running flag
+ * @note      none
+ */
+static uint8_t a_sgp41_multibus_wait_until(sgp41_multibus_t *service, uint64_t deadline_us)
+{
+    struct timespec ts;
+    uint8_t running;
+    
+    ts.tv_sec = (time_t)(deadline_us / 1000000ULL);                                   /* set the sec */
+    ts.tv_nsec = (long)(deadline_us % 1000000ULL) * 1000L;                            /* set the nsec */
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    while ((service->running != 0) && (a_sgp41_multibus_now_us() < deadline_us))     /* wait */
+    {
+        if (pthread_cond_timedwait(&service->cond, &service->mutex, &ts) == ETIMEDOUT) /* timed out */
+        {
+            break;                                                                    /* break */
+        }
+    }
+    running = service->running;                                                       /* get running */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    
+    return running;                                                                   /* return running */
+}
+
+/**
+ * @brief     close the sensors, the muxes and the bus
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] sensors inited sensor number
+ * @note      the heaters are turned off
+ */
+static void a_sgp41_multibus_close(sgp41_multibus_bus_t *bus, uint8_t sensors)
+{
+    uint8_t i;
+    
+    for (i = 0; i < sensors; i++)                                                     /* every inited sensor */
+    {
+        a_sgp41_multibus_route(bus, i);                                               /* route */
+        (void)sgp41_deinit(&bus->handle[i]);                                          /* heater off */
+    }
+    if (bus->mux_count != 0)                                                          /* muxed bus */
+    {
+        (void)sgp41_mux_deinit(&bus->mux);                                            /* deselect all */
+    }
+    (void)bus->service->ops.iic_deinit(bus->fd);                                      /* close the bus */
+}
+
+/**
+ * @brief     open the bus, the muxes and the sensors
+ * @param[in] *bus pointer to a bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      called from the worker
+ */
+static uint8_t a_sgp41_multibus_open(sgp41_multibus_bus_t *bus)
+{
+    uint8_t index;
+    uint8_t i;
+    
+    if (bus->service->ops.iic_init(bus->name, &bus->fd) != 0)                         /* open the bus */
+    {
+        return 1;                                                                     /* return error */
+    }
+    if (bus->mux_count != 0)                                                          /* muxed bus */
+    {
+        DRIVER_SGP41_MUX_LINK_INIT(&bus->mux, sgp41_mux_handle_t);
+        DRIVER_SGP41_MUX_LINK_IIC_INIT(&bus->mux, a_sgp41_multibus_iic_init);
+        DRIVER_SGP41_MUX_LINK_IIC_DEINIT(&bus->mux, a_sgp41_multibus_iic_deinit);
+        DRIVER_SGP41_MUX_LINK_IIC_WRITE_COMMAND(&bus->mux, a_sgp41_multibus_iic_write_cmd);
+        DRIVER_SGP41_MUX_LINK_IIC_READ_COMMAND(&bus->mux, a_sgp41_multibus_iic_read_cmd);
+        if (sgp41_mux_init(&bus->mux) != 0)                                           /* mux init */
+        {
+            (void)bus->service->ops.iic_deinit(bus->fd);                              /* close the bus */
+            
+            return 1;                                                                 /* return error */
+        }
+        for (i = 0; i < bus->mux_count; i++)                                          /* every mux */
+        {
+            if (sgp41_mux_add_mux(&bus->mux, bus->mux_addr[i], &index) != 0)          /* add mux */
+            {
+                a_sgp41_multibus_close(bus, 0);                                       /* close */
+                
+                return 1;                                                             /* return error */
+            }
+        }
+        for (i = 0; i < bus->sensor_count; i++)                                       /* every sensor */
+        {
+            (void)sgp41_mux_add_sensor(&bus->mux, bus->sensor_mux[i],
+                                       bus->sensor_channel[i], &bus->route[i]);       /* add sensor */
+        }
+    }
+    for (i = 0; i < bus->sensor_count; i++)                                           /* every sensor */
+    {
+        DRIVER_SGP41_LINK_INIT(&bus->handle[i], sgp41_handle_t);
+        if (bus->mux_count != 0)                                                      /* muxed bus */
+        {
+            DRIVER_SGP41_LINK_IIC_INIT(&bus->handle[i], sgp41_mux_iic_init);
+            DRIVER_SGP41_LINK_IIC_DEINIT(&bus->handle[i], sgp41_mux_iic_deinit);
+            DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&bus->handle[i], sgp41_mux_iic_write_cmd);
+            DRIVER_SGP41_LINK_IIC_READ_COMMAND(&bus->handle[i], sgp41_mux_iic_read_cmd);
+        }
+        else
+        {
+            DRIVER_SGP41_LINK_IIC_INIT(&bus->handle[i], a_sgp41_multibus_iic_init);
+            DRIVER_SGP41_LINK_IIC_DEINIT(&bus->handle[i], a_sgp41_multibus_iic_deinit);
+            DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&bus->handle[i], a_sgp41_multibus_iic_write_cmd);
+            DRIVER_SGP41_LINK_IIC_READ_COMMAND(&bus->handle[i], a_sgp41_multibus_iic_read_cmd);
+        }
+        DRIVER_SGP41_LINK_DELAY_MS(&bus->handle[i], sgp41_interface_delay_ms);
+        DRIVER_SGP41_LINK_DEBUG_PRINT(&bus->handle[i], sgp41_interface_debug_print);
+        a_sgp41_multibus_route(bus, i);                                               /* route */
+        if (sgp41_init(&bus->handle[i]) != 0)                                         /* sensor init */
+        {
+            a_sgp41_multibus_close(bus, i);                                           /* close */
+            
+            return 1;                                                                 /* return error */
+        }
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     bus worker
+ * @param[in] *arg pointer to a bus structure
+ * @return    NULL
+ * @note      starts every sensor of the bus, waits one conversion and reads them all,
+ *            the timestamps rise inside a bus so its queue is already sorted
+ */
+static void *a_sgp41_multibus_worker(void *arg)
+{
+    sgp41_multibus_bus_t *bus = (sgp41_multibus_bus_t *)arg;
+    sgp41_multibus_t *service = bus->service;
+    sgp41_multibus_sample_t sample[SGP41_MULTIBUS_MAX_SENSORS];
+    uint8_t all[SGP41_MULTIBUS_MAX_SENSORS];
+    uint8_t order[SGP41_MULTIBUS_MAX_SENSORS];
+    uint16_t raw_humidity;
+    uint16_t raw_temperature;
+    uint16_t conditioning;
+    uint64_t next;
+    uint64_t now;
+    uint32_t tail;
+    uint8_t res;
+    uint8_t s;
+    uint8_t i;
+    
+    gs_bus = bus;                                                                     /* the callbacks use this bus */
+    if ((bus->sensor_count == 0) || (a_sgp41_multibus_open(bus) != 0))                /* open */
+    {
+        bus->status = 1;                                                              /* failed */
+        goto end;                                                                     /* end */
+    }
+    for (i = 0; i < bus->sensor_count; i++)                                           /* caller order */
+    {
+        all[i] = i;                                                                   /* set index */
+    }
+    
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    conditioning = service->conditioning;                                             /* get conditioning */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    next = a_sgp41_multibus_now_us();                                                 /* first round */
+    while (1)
+    {
+        /* one channel visit per sensor and phase */
+        if (bus->mux_count != 0)                                                      /* muxed bus */
+        {
+            (void)sgp41_mux_schedule(&bus->mux, all, bus->sensor_count, order);       /* schedule */
+        }
+        else
+        {
+            memcpy(order, all, bus->sensor_count);                                    /* keep the order */
+        }
+        
+        /* no sample of this round is older than now */
+        (void)pthread_mutex_lock(&service->mutex);                                    /* lock */
+        if (service->running == 0)                                                    /* stopped */
+        {
+            (void)pthread_mutex_unlock(&service->mutex);                              /* unlock */
+            
+            break;                                                                    /* break */
+        }
+        raw_humidity = service->raw_humidity;                                         /* get humidity */
+        raw_temperature = service->raw_temperature;                                   /* get temperature */
+        bus->watermark_us = a_sgp41_multibus_now_us();                                /* set watermark */
+        (void)pthread_mutex_unlock(&service->mutex);                                  /* unlock */
+        
+        /* start every sensor */
+        for (i = 0; i < bus->sensor_count; i++)                                       /* scheduled order */
+        {
+            s = order[i];                                                             /* get sensor */
+            a_sgp41_multibus_route(bus, s);                                           /* route */
+            sample[i].timestamp_us = a_sgp41_multibus_now_us();                       /* set timestamp */
+            sample[i].bus = bus->index;                                               /* set bus */
+            sample[i].sensor = s;                                                     /* set sensor */
+            sample[i].sraw_voc = 0;                                                   /* init 0 */
+            sample[i].sraw_nox = 0;                                                   /* init 0 */
+            if (conditioning != 0)                                                    /* conditioning */
+            {
+                res = sgp41_start_execute_conditioning(&bus->handle[s]);              /* start conditioning */
+            }
+            else
+            {
+                res = sgp41_start_measure_raw(&bus->handle[s], raw_humidity,
+                                              raw_temperature);                       /* start measure raw */
+            }
+            sample[i].status = (res != 0) ? 1 : 0;                                    /* set status */
+        }
+        
+        /* one conversion time after the last start */
+        if (a_sgp41_multibus_wait_until(service, a_sgp41_multibus_now_us() +
+                                        SGP41_EXECUTION_TIME_MEASURE_RAW_MS * 1000ULL) == 0)
+        {
+            break;                                                                    /* stopped */
+        }
+        
+        /* read every sensor in the same order */
+        for (i = 0; i < bus->sensor_count; i++)                                       /* scheduled order */
+        {
+            if (sample[i].status != 0)                                                /* start failed */
+            {
+                continue;                                                             /* next */
+            }
+            s = order[i];                                                             /* get sensor */
+            a_sgp41_multibus_route(bus, s);                                           /* route */
+            if (conditioning != 0)                                                    /* conditioning */
+            {
+                res = sgp41_read_execute_conditioning(&bus->handle[s], &sample[i].sraw_voc);
+            }
+            else
+            {
+                res = sgp41_read_measure_raw(&bus->handle[s], &sample[i].sraw_voc,
+                                             &sample[i].sraw_nox);                    /* read measure raw */
+            }
+            sample[i].status = (res != 0) ? 1 : 0;                                    /* set status */
+        }
+        
+        /* publish */
+        (void)pthread_mutex_lock(&service->mutex);                                    /* lock */
+        for (i = 0; (conditioning == 0) && (i < bus->sensor_count); i++)              /* conditioning has no sample */
+        {
+            if (sample[i].status != 0)                                                /* failed */
+            {
+                bus->errors++;                                                        /* add error */
+            }
+            else
+            {
+                bus->samples++;                                                       /* add sample */
+            }
+            if (bus->count >= SGP41_MULTIBUS_QUEUE_LEN)                               /* full */
+            {
+                bus->dropped++;                                                       /* add dropped */
+                
+                continue;                                                             /* next */
+            }
+            tail = (bus->head + bus->count) % SGP41_MULTIBUS_QUEUE_LEN;               /* get tail */
+            bus->queue[tail] = sample[i];                                             /* push */
+            bus->count++;                                                             /* add count */
+        }
+        bus->rounds++;                                                                /* add round */
+        bus->busy_us += bus->pending_busy_us;                                         /* publish busy time */
+        bus->pending_busy_us = 0;                                                     /* clear pending */
+        
+        /* the next round can not start before the next deadline */
+        now = a_sgp41_multibus_now_us();                                              /* get now */
+        next = (service->period_ms != 0) ? (next + (uint64_t)service->period_ms * 1000ULL) : now;
+        if (next < now)                                                               /* late */
+        {
+            next = now;                                                               /* skip the missed ticks */
+        }
+        bus->watermark_us = next;                                                     /* set watermark */
+        (void)pthread_cond_broadcast(&service->cond);                                 /* wake the reader */
+        (void)pthread_mutex_unlock(&service->mutex);                                  /* unlock */
+        if (conditioning != 0)                                                        /* conditioning */
+        {
+            conditioning--;                                                           /* one round less */
+        }
+        if (a_sgp41_multibus_wait_until(service, next) == 0)                          /* wait for the deadline */
+        {
+            break;                                                                    /* stopped */
+        }
+    }
+    a_sgp41_multibus_close(bus, bus->sensor_count);                                   /* close */
+    
+    end:
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    bus->busy_us += bus->pending_busy_us;                                             /* publish busy time */
+    bus->pending_busy_us = 0;                                                         /* clear pending */
+    bus->stop_us = a_sgp41_multibus_now_us();                                         /* set stop time */
+    bus->watermark_us = UINT64_MAX;                                                   /* no more samples */
+    (void)pthread_cond_broadcast(&service->cond);                                     /* wake the reader */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    gs_bus = NULL;                                                                    /* leave the bus */
+    
+    return NULL;                                                                      /* end */
+}
+
+/**
+ * @brief     initialize the multibus service
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] period_ms round period, 0 runs the rounds back to back
+ * @return    status code
+ *            - 0 success
+ *            - 1 mutex or condition init failed
+ *            - 2 service is NULL
+ * @note      the buses share their fds through the broker until sgp41_multibus_set_ops,
+ *            the compensation defaults to 50 %RH and 25 C
+ */
+uint8_t sgp41_multibus_init(sgp41_multibus_t *service, uint32_t period_ms)
+{
+    pthread_condattr_t attr;
+    
+    if (service == NULL)                                                              /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    
+    memset(service, 0, sizeof(sgp41_multibus_t));                                    /* clear the service */
+    if (pthread_mutex_init(&service->mutex, NULL) != 0)                               /* mutex init */
+    {
+        return 1;                                                                     /* return error */
+    }
+    if ((pthread_condattr_init(&attr) != 0) ||
+        (pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) != 0) ||
+        (pthread_cond_init(&service->cond, &attr) != 0))                              /* monotonic condition */
+    {
+        (void)pthread_mutex_destroy(&service->mutex);                                 /* destroy the mutex */
+        
+        return 1;                                                                     /* return error */
+    }
+    (void)pthread_condattr_destroy(&attr);                                            /* destroy the attr */
+    service->ops.iic_init = sgp41_broker_open;                                        /* shared linux i2c-dev */
+    service->ops.iic_deinit = sgp41_broker_close;                                     /* shared linux i2c-dev */
+    service->ops.iic_write_cmd = sgp41_broker_write_cmd;                              /* shared linux i2c-dev */
+    service->ops.iic_read_cmd = sgp41_broker_read_cmd;                                /* shared linux i2c-dev */
+    service->period_ms = period_ms;                                                   /* set period */
+    service->raw_humidity = 0x8000;                                                   /* 50 %RH */
+    service->raw_temperature = 0x6666;                                                /* 25 C */
+    service->inited = 1;                                                              /* flag finish initialization */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     close the multibus service
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ * @note      running workers are stopped first
+ */
+uint8_t sgp41_multibus_deinit(sgp41_multibus_t *service)
+{
+    if (service == NULL)                                                              /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    (void)sgp41_multibus_stop(service);                                               /* stop the workers */
+    (void)pthread_cond_destroy(&service->cond);                                       /* destroy the condition */
+    (void)pthread_mutex_destroy(&service->mutex);                                     /* destroy the mutex */
+    service->inited = 0;                                                              /* flag close */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the bus operations
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] *ops pointer to a bus operation structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 service or ops is NULL
+ *            - 3 service is not initialized
+ *            - 4 service is running
+ * @note      every function is called from the worker thread of its bus only
+ */
+uint8_t sgp41_multibus_set_ops(sgp41_multibus_t *service, const sgp41_multibus_ops_t *ops)
+{
+    if ((service == NULL) || (ops == NULL))                                           /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (service->running != 0)                                                        /* check running */
+    {
+        return 4;                                                                     /* return error */
+    }
+    
+    service->ops = *ops;                                                              /* set ops */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the compensation
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] raw_humidity humidity raw data
+ * @param[in] raw_temperature temperature raw data
+ * @return    status code
+ *            - 0 success
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ * @note      all sensors use the same compensation
+ */
+uint8_t sgp41_multibus_set_compensation(sgp41_multibus_t *service, uint16_t raw_humidity, uint16_t raw_temperature)
+{
+    if (service == NULL)                                                              /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    service->raw_humidity = raw_humidity;                                             /* set the humidity */
+    service->raw_temperature = raw_temperature;                                       /* set the temperature */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      add a bus
+ * @param[in]  *service pointer to an sgp41 multibus structure
+ * @param[in]  *name pointer to a bus device name
+ * @param[out] *bus pointer to a bus index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 service or name is NULL
+ *             - 3 service is not initialized
+ *             - 4 service is running
+ *             - 5 too many buses or the name is too long
+ * @note       the bus is opened by its worker
+ */
+uint8_t sgp41_multibus_add_bus(sgp41_multibus_t *service, const char *name, uint8_t *bus)
+{
+    sgp41_multibus_bus_t *b;
+    
+    if ((service == NULL) || (name == NULL))                                          /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (service->running != 0)                                                        /* check running */
+    {
+        return 4;                                                                     /* return error */
+    }
+    if ((service->bus_count >= SGP41_MULTIBUS_MAX_BUSES) ||
+        (strlen(name) >= SGP41_MULTIBUS_NAME_LEN))                                    /* check bus */
+    {
+        return 5;                                                                     /* return error */
+    }
+    
+    b = &service->bus[service->bus_count];                                            /* get bus */
+    memset(b, 0, sizeof(sgp41_multibus_bus_t));                                       /* clear the bus */
+    strcpy(b->name, name);                                                            /* set name */
+    b->service = service;                                                             /* set service */
+    b->index = service->bus_count;                                                    /* set index */
+    b->fd = -1;                                                                       /* not open */
+    b->watermark_us = UINT64_MAX;                                                     /* not running */
+    *bus = service->bus_count;                                                        /* set index */
+    service->bus_count++;                                                             /* add bus */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      add a sensor
+ * @param[in]  *service pointer to an sgp41 multibus structure
+ * @param[in]  bus bus index
+ * @param[in]  mux_addr mux iic address, SGP41_MULTIBUS_NO_MUX for a sensor on the bus itself
+ * @param[in]  channel mux channel
+ * @param[out] *sensor pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 service is NULL
+ *             - 3 service is not initialized
+ *             - 4 service is running
+ *             - 5 bus, channel or the sensor number is invalid
+ *             - 6 a sensor without a mux must be alone on its bus
+ * @note       none
+ */
+uint8_t sgp41_multibus_add_sensor(sgp41_multibus_t *service, uint8_t bus, uint8_t mux_addr, uint8_t channel, uint8_t *sensor)
+{
+    sgp41_multibus_bus_t *b;
+    uint8_t mux;
+    
+    if (service == NULL)                                                              /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (service->running != 0)                                                        /* check running */
+    {
+        return 4;                                                                     /* return error */
+    }
+    if ((bus >= service->bus_count) || (channel >= SGP41_MUX_MAX_CHANNELS))           /* check bus and channel */
+    {
+        return 5;                                                                     /* return error */
+    }
+    b = &service->bus[bus];                                                           /* get bus */
+    if (b->sensor_count >= SGP41_MULTIBUS_MAX_SENSORS)                                /* check sensor number */
+    {
+        return 5;                                                                     /* return error */
+    }
+    if ((b->sensor_count != 0) && ((mux_addr == SGP41_MULTIBUS_NO_MUX) || (b->mux_count == 0)))
+    {
+        return 6;                                                                     /* same address twice */
+    }
+    
+    if (mux_addr != SGP41_MULTIBUS_NO_MUX)                                            /* muxed sensor */
+    {
+        for (mux = 0; mux < b->mux_count; mux++)                                      /* find the mux */
+        {
+            if (b->mux_addr[mux] == mux_addr)                                         /* found */
+            {
+                break;                                                                /* break */
+            }
+        }
+        if (mux == b->mux_count)                                                      /* new mux */
+        {
+            if (b->mux_count >= SGP41_MUX_MAX_MUXES)                                  /* check mux number */
+            {
+                return 5;                                                             /* return error */
+            }
+            b->mux_addr[b->mux_count] = mux_addr;                                     /* set address */
+            b->mux_count++;                                                           /* add mux */
+        }
+        b->sensor_mux[b->sensor_count] = mux;                                         /* set mux */
+        b->sensor_channel[b->sensor_count] = channel;                                 /* set channel */
+    }
+    *sensor = b->sensor_count;                                                        /* set index */
+    b->sensor_count++;                                                                /* add sensor */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     start the workers
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @param[in] conditioning conditioning rounds before the first sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 thread create failed
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ *            - 4 service is running
+ *            - 5 no sensor is added
+ * @note      a bus that fails to open or init ends its worker and is left out of the stream
+ */
+uint8_t sgp41_multibus_start(sgp41_multibus_t *service, uint16_t conditioning)
+{
+    sgp41_multibus_bus_t *b;
+    uint64_t now;
+    uint32_t sensors;
+    uint8_t i;
+    
+    if (service == NULL)                                                              /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (service->running != 0)                                                        /* check running */
+    {
+        return 4;                                                                     /* return error */
+    }
+    sensors = 0;                                                                      /* init 0 */
+    for (i = 0; i < service->bus_count; i++)                                          /* every bus */
+    {
+        sensors += service->bus[i].sensor_count;                                      /* add sensors */
+    }
+    if (sensors == 0)                                                                 /* check sensors */
+    {
+        return 5;                                                                     /* return error */
+    }
+    
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    now = a_sgp41_multibus_now_us();                                                  /* get now */
+    for (i = 0; i < service->bus_count; i++)                                          /* every bus */
+    {
+        b = &service->bus[i];                                                         /* get bus */
+        b->head = 0;                                                                  /* clear head */
+        b->count = 0;                                                                 /* clear count */
+        b->rounds = 0;                                                                /* clear rounds */
+        b->samples = 0;                                                               /* clear samples */
+        b->errors = 0;                                                                /* clear errors */
+        b->dropped = 0;                                                               /* clear dropped */
+        b->busy_us = 0;                                                               /* clear busy */
+        b->pending_busy_us = 0;                                                       /* clear pending busy */
+        b->start_us = now;                                                            /* set start */
+        b->stop_us = 0;                                                               /* running */
+        b->status = 0;                                                                /* clear status */
+        b->watermark_us = now;                                                        /* nothing older comes */
+    }
+    service->conditioning = conditioning;                                             /* set conditioning */
+    service->running = 1;                                                             /* set running */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    for (i = 0; i < service->bus_count; i++)                                          /* every bus */
+    {
+        b = &service->bus[i];                                                         /* get bus */
+        if (pthread_create(&b->thread, NULL, a_sgp41_multibus_worker, b) != 0)        /* create the worker */
+        {
+            (void)sgp41_multibus_stop(service);                                       /* stop the started ones */
+            
+            return 1;                                                                 /* return error */
+        }
+        b->started = 1;                                                               /* flag started */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     stop the workers
+ * @param[in] *service pointer to an sgp41 multibus structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 service is NULL
+ *            - 3 service is not initialized
+ * @note      the queued samples can still be read, the heaters are turned off
+ */
+uint8_t sgp41_multibus_stop(sgp41_multibus_t *service)
+{
+    uint8_t i;
+    
+    if (service == NULL)                                                              /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    service->running = 0;                                                             /* clear running */
+    for (i = 0; i < service->bus_count; i++)                                          /* every bus */
+    {
+        if (service->bus[i].started == 0)                                             /* never started */
+        {
+            service->bus[i].watermark_us = UINT64_MAX;                                /* no samples */
+        }
+    }
+    (void)pthread_cond_broadcast(&service->cond);                                     /* wake the workers */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    for (i = 0; i < service->bus_count; i++)                                          /* every bus */
+    {
+        if (service->bus[i].started != 0)                                             /* started */
+        {
+            (void)pthread_join(service->bus[i].thread, NULL);                         /* join */
+            service->bus[i].started = 0;                                              /* flag stopped */
+        }
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      read the next sample of the merged stream
+ * @param[in]  *service pointer to an sgp41 multibus structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  timeout_ms wait time in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 timeout
+ *             - 2 service or sample is NULL
+ *             - 3 service is not initialized
+ *             - 4 every worker has ended and the queues are empty
+ * @note       the samples of all buses come in timestamp order, a sample is released once
+ *             no other bus can produce an older one
+ */
+uint8_t sgp41_multibus_read(sgp41_multibus_t *service, sgp41_multibus_sample_t *sample, uint32_t timeout_ms)
+{
+    sgp41_multibus_bus_t *b;
+    struct timespec ts;
+    uint64_t deadline;
+    uint64_t key;
+    uint64_t best_key;
+    uint8_t best;
+    uint8_t best_queued;
+    uint8_t i;
+    
+    if ((service == NULL) || (sample == NULL))                                        /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    deadline = a_sgp41_multibus_now_us() + (uint64_t)timeout_ms * 1000ULL;            /* set deadline */
+    ts.tv_sec = (time_t)(deadline / 1000000ULL);                                      /* set the sec */
+    ts.tv_nsec = (long)(deadline % 1000000ULL) * 1000L;                               /* set the nsec */
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    while (1)
+    {
+        /* the oldest head or watermark, a queued sample wins a tie */
+        best = SGP41_MULTIBUS_MAX_BUSES;                                              /* none */
+        best_key = UINT64_MAX;                                                        /* none */
+        best_queued = 0;                                                              /* none */
+        for (i = 0; i < service->bus_count; i++)                                      /* every bus */
+        {
+            b = &service->bus[i];                                                     /* get bus */
+            key = (b->count != 0) ? b->queue[b->head].timestamp_us : b->watermark_us; /* get key */
+            if ((key < best_key) || ((key == best_key) && (b->count != 0) && (best_queued == 0)))
+            {
+                best = i;                                                             /* set best */
+                best_key = key;                                                       /* set key */
+                best_queued = (b->count != 0) ? 1 : 0;                                /* set queued */
+            }
+        }
+        if ((best != SGP41_MULTIBUS_MAX_BUSES) && (best_queued != 0))                 /* release */
+        {
+            b = &service->bus[best];                                                  /* get bus */
+            *sample = b->queue[b->head];                                              /* pop */
+            b->head = (b->head + 1) % SGP41_MULTIBUS_QUEUE_LEN;                       /* next head */
+            b->count--;                                                               /* count - 1 */
+            (void)pthread_mutex_unlock(&service->mutex);                              /* unlock */
+            
+            return 0;                                                                 /* success return 0 */
+        }
+        if (best == SGP41_MULTIBUS_MAX_BUSES)                                         /* every worker ended */
+        {
+            (void)pthread_mutex_unlock(&service->mutex);                              /* unlock */
+            
+            return 4;                                                                 /* return error */
+        }
+        if (pthread_cond_timedwait(&service->cond, &service->mutex, &ts) == ETIMEDOUT) /* wait */
+        {
+            (void)pthread_mutex_unlock(&service->mutex);                              /* unlock */
+            
+            return 1;                                                                 /* return error */
+        }
+    }
+}
+
+/**
+ * @brief      get the statistics of a bus
+ * @param[in]  *service pointer to an sgp41 multibus structure
+ * @param[in]  bus bus index
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 service or stats is NULL
+ *             - 3 service is not initialized
+ *             - 5 bus is invalid
+ * @note       none
+ */
+uint8_t sgp41_multibus_get_stats(sgp41_multibus_t *service, uint8_t bus, sgp41_multibus_stats_t *stats)
+{
+    sgp41_multibus_bus_t *b;
+    uint64_t stop;
+    
+    if ((service == NULL) || (stats == NULL))                                         /* check service */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (service->inited != 1)                                                         /* check initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (bus >= service->bus_count)                                                    /* check bus */
+    {
+        return 5;                                                                     /* return error */
+    }
+    
+    b = &service->bus[bus];                                                           /* get bus */
+    (void)pthread_mutex_lock(&service->mutex);                                        /* lock */
+    stop = (b->stop_us != 0) ? b->stop_us : a_sgp41_multibus_now_us();                /* get the end */
+    stats->rounds = b->rounds;                                                        /* set rounds */
+    stats->samples = b->samples;                                                      /* set samples */
+    stats->errors = b->errors;                                                        /* set errors */
+    stats->dropped = b->dropped;                                                      /* set dropped */
+    stats->busy_us = b->busy_us;                                                      /* set busy */
+    stats->elapsed_us = (b->start_us != 0) ? (stop - b->start_us) : 0;                /* set elapsed */
+    (void)pthread_mutex_unlock(&service->mutex);                                      /* unlock */
+    stats->utilization = (stats->elapsed_us != 0) ?
+                         (float)stats->busy_us * 100.0f / (float)stats->elapsed_us : 0.0f;      /* set utilization */
+    
+    return 0;                                                                         /* success return 0 */
+}
@@ -0,0 +1,745 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_sgp41_store.c
+ * @brief     raspberrypi4b driver sgp41 store source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _DEFAULT_SOURCE                              /**< madvise and mincore */
+
+#include "raspberrypi4b_driver_sgp41_store.h"
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief store file magic definition
+ */
+static const char gs_magic[4] = {'S', 'G', 'S', 0x01};        /**< magic and version */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_sgp41_store_now_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);                                        /* get the time */
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;                /* return ns */
+}
+
+/**
+ * @brief     get the hash of a serial id
+ * @param[in] *id pointer to a serial id
+ * @return    hash
+ * @note      fibonacci hashing of the 48 bit id, mask the result to the table size
+ */
+static uint32_t a_sgp41_store_hash(const uint16_t id[3])
+{
+    uint64_t key;
+    
+    key = ((uint64_t)id[0] << 32) | ((uint64_t)id[1] << 16) | (uint64_t)id[2];       /* 48 bit key */
+    
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32);                           /* top bits */
+}
+
+/**
+ * @brief     pack one state
+ * @param[in] *state pointer to an sgp41 gas index algorithm handle structure
+ * @param[out] *field pointer to a field buffer
+ * @return    flags of the state, voc positions
+ * @note      the same fields as the c++ template, the rest is derived from the tuning
+ */
+static uint8_t a_sgp41_store_pack(const sgp41_gas_index_algorithm_t *state, float field[SGP41_STORE_FIELDS])
+{
+    uint8_t flags = 0;
+    
+    field[0] = state->m_uptime;                                                       /* uptime */
+    field[1] = state->m_sraw;                                                         /* sraw */
+    field[2] = state->m_gas_index;                                                    /* gas index */
+    field[3] = state->m_mean_variance_estimator_mean;                                 /* mean */
+    field[4] = state->m_mean_variance_estimator_sraw_offset;                          /* offset */
+    field[5] = state->m_mean_variance_estimator_std;                                  /* std */
+    field[6] = state->m_mean_variance_estimator_uptime_gamma;                         /* uptime gamma */
+    field[7] = state->m_mean_variance_estimator_uptime_gating;                        /* uptime gating */
+    field[8] = state->m_mean_variance_estimator_gating_duration_minutes;              /* gating minutes */
+    field[9] = state->m_mox_model_sraw_std;                                           /* mox std */
+    field[10] = state->m_mox_model_sraw_mean;                                         /* mox mean */
+    field[11] = state->m_adaptive_lowpass_x1;                                         /* x1 */
+    field[12] = state->m_adaptive_lowpass_x2;                                         /* x2 */
+    field[13] = state->m_adaptive_lowpass_x3;                                         /* x3 */
+    if (state->m_mean_variance_estimator_initialized != 0)                            /* estimator */
+    {
+        flags |= SGP41_STORE_FLAG_VOC_ESTIMATOR;                                      /* set the flag */
+    }
+    if (state->m_adaptive_lowpass_initialized != 0)                                   /* lowpass */
+    {
+        flags |= SGP41_STORE_FLAG_VOC_LOWPASS;                                        /* set the flag */
+    }
+    if (state->m_timestamp_valid != 0)                                                /* timestamp */
+    {
+        flags |= SGP41_STORE_FLAG_VOC_TIMESTAMP;                                      /* set the flag */
+    }
+    
+    return flags;                                                                     /* return the flags */
+}
+
+/**
+ * @brief      unpack one state
+ * @param[in]  *template pointer to a template
+ * @param[in]  *field pointer to the fields
+ * @param[in]  flags flags of the state, voc positions
+ * @param[in]  timestamp_ms last timestamp
+ * @param[out] *state pointer to an sgp41 gas index algorithm handle structure
+ * @note       none
+ */
+static void a_sgp41_store_unpack(const sgp41_gas_index_algorithm_t *template, const float field[SGP41_STORE_FIELDS],
+                                 uint8_t flags, uint32_t timestamp_ms, sgp41_gas_index_algorithm_t *state)
+{
+    *state = *template;                                                               /* tuning and interval */
+    state->m_uptime = field[0];                                                       /* uptime */
+    state->m_sraw = field[1];                                                         /* sraw */
+    state->m_gas_index = field[2];                                                    /* gas index */
+    state->m_mean_variance_estimator_mean = field[3];                                 /* mean */
+    state->m_mean_variance_estimator_sraw_offset = field[4];                          /* offset */
+    state->m_mean_variance_estimator_std = field[5];                                  /* std */
+    state->m_mean_variance_estimator_uptime_gamma = field[6];                         /* uptime gamma */
+    state->m_mean_variance_estimator_uptime_gating = field[7];                        /* uptime gating */
+    state->m_mean_variance_estimator_gating_duration_minutes = field[8];              /* gating minutes */
+    state->m_mox_model_sraw_std = field[9];                                           /* mox std */
+    state->m_mox_model_sraw_mean = field[10];                                         /* mox mean */
+    state->m_adaptive_lowpass_x1 = field[11];                                         /* x1 */
+    state->m_adaptive_lowpass_x2 = field[12];                                         /* x2 */
+    state->m_adaptive_lowpass_x3 = field[13];                                         /* x3 */
+    state->m_mean_variance_estimator_initialized = ((flags & SGP41_STORE_FLAG_VOC_ESTIMATOR) != 0) ? 1 : 0;  /* estimator */
+    state->m_adaptive_lowpass_initialized = ((flags & SGP41_STORE_FLAG_VOC_LOWPASS) != 0) ? 1 : 0;          /* lowpass */
+    state->m_timestamp_valid = ((flags & SGP41_STORE_FLAG_VOC_TIMESTAMP) != 0) ? 1 : 0;                     /* timestamp */
+    state->m_timestamp_ms = timestamp_ms;                                             /* timestamp */
+}
+
+/**
+ * @brief     find or add the file record of a serial id
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] *id pointer to a serial id
+ * @return    record or SGP41_STORE_NONE when the file is full
+ * @note      linear probing in the file, records are never removed
+ */
+static uint32_t a_sgp41_store_slot(sgp41_store_t *store, const uint16_t id[3])
+{
+    sgp41_store_record_t *r;
+    uint32_t i;
+    
+    for (i = a_sgp41_store_hash(id) & store->slot_mask; store->record[i].used != 0;
+         i = (i + 1) & store->slot_mask)                                              /* probe */
+    {
+        r = &store->record[i];
+        if ((r->id[0] == id[0]) && (r->id[1] == id[1]) && (r->id[2] == id[2]))        /* same id */
+        {
+            return i;                                                                 /* return the record */
+        }
+    }
+    if (store->header->devices >= store->max_devices)                                 /* file full */
+    {
+        return SGP41_STORE_NONE;                                                      /* return error */
+    }
+    r = &store->record[i];                                                            /* empty record */
+    memcpy(r->id, id, sizeof(r->id));                                                 /* copy the id */
+    r->flags = 0;                                                                     /* no states yet */
+    r->used = 1;                                                                      /* used */
+    store->header->devices++;                                                         /* device + 1 */
+    
+    return i;                                                                         /* return the record */
+}
+
+/**
+ * @brief     find a serial id in the cache
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] *id pointer to a serial id
+ * @return    entry or SGP41_STORE_NONE
+ * @note      linear probing up to the next empty hash slot
+ */
+static uint32_t a_sgp41_store_find(const sgp41_store_t *store, const uint16_t id[3])
+{
+    uint32_t i;
+    
+    for (i = a_sgp41_store_hash(id) & store->table_mask; store->table[i] != 0;
+         i = (i + 1) & store->table_mask)                                             /* probe */
+    {
+        const sgp41_store_entry_t *entry = &store->entry[store->table[i] - 1];
+        
+        if ((entry->id[0] == id[0]) && (entry->id[1] == id[1]) && (entry->id[2] == id[2]))  /* same id */
+        {
+            return store->table[i] - 1;                                               /* return the entry */
+        }
+    }
+    
+    return SGP41_STORE_NONE;                                                          /* unknown */
+}
+
+/**
+ * @brief     drop an entry from the cache hash
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] e entry
+ * @note      the following entries of the run are shifted back, so no probe stops early
+ */
+static void a_sgp41_store_unhash(sgp41_store_t *store, uint32_t e)
+{
+    uint32_t hole;
+    uint32_t i;
+    
+    for (hole = a_sgp41_store_hash(store->entry[e].id) & store->table_mask; store->table[hole] != e + 1;
+         hole = (hole + 1) & store->table_mask)                                       /* find the entry */
+    {
+    }
+    store->table[hole] = 0;                                                           /* make a hole */
+    for (i = (hole + 1) & store->table_mask; store->table[i] != 0; i = (i + 1) & store->table_mask)  /* rest of the run */
+    {
+        uint32_t home = a_sgp41_store_hash(store->entry[store->table[i] - 1].id) & store->table_mask;
+        uint32_t dist_home = (i - home) & store->table_mask;
+        uint32_t dist_hole = (i - hole) & store->table_mask;
+        
+        if (dist_home >= dist_hole)                                                   /* the hole is on its probe path */
+        {
+            store->table[hole] = store->table[i];                                     /* move back */
+            store->table[i] = 0;                                                      /* new hole */
+            hole = i;                                                                 /* save the hole */
+        }
+    }
+}
+
+/**
+ * @brief     unlink an entry from the lru list
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] e entry
+ * @note      none
+ */
+static void a_sgp41_store_unlink(sgp41_store_t *store, uint32_t e)
+{
+    sgp41_store_entry_t *entry = &store->entry[e];
+    
+    if (entry->prev != SGP41_STORE_NONE)                                              /* not the head */
+    {
+        store->entry[entry->prev].next = entry->next;                                 /* skip */
+    }
+    else
+    {
+        store->head = entry->next;                                                    /* new head */
+    }
+    if (entry->next != SGP41_STORE_NONE)                                              /* not the tail */
+    {
+        store->entry[entry->next].prev = entry->prev;                                 /* skip */
+    }
+    else
+    {
+        store->tail = entry->prev;                                                    /* new tail */
+    }
+}
+
+/**
+ * @brief     put an entry at the head of the lru list
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] e entry
+ * @note      none
+ */
+static void a_sgp41_store_push(sgp41_store_t *store, uint32_t e)
+{
+    store->entry[e].prev = SGP41_STORE_NONE;                                          /* no prev */
+    store->entry[e].next = store->head;                                               /* old head */
+    if (store->head != SGP41_STORE_NONE)                                              /* list not empty */
+    {
+        store->entry[store->head].prev = e;                                           /* link */
+    }
+    else
+    {
+        store->tail = e;                                                              /* first entry */
+    }
+    store->head = e;                                                                  /* new head */
+}
+
+/**
+ * @brief     write the states of an entry to its record
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] e entry
+ * @note      none
+ */
+static void a_sgp41_store_save(sgp41_store_t *store, uint32_t e)
+{
+    sgp41_store_entry_t *entry = &store->entry[e];
+    sgp41_store_record_t *r = &store->record[entry->slot];
+    uint64_t start;
+    uint64_t ns;
+    uint8_t flags;
+    
+    start = a_sgp41_store_now_ns();                                                   /* start */
+    flags = a_sgp41_store_pack(&entry->voc, r->voc);                                  /* voc */
+    flags |= (uint8_t)(a_sgp41_store_pack(&entry->nox, r->nox) << 3);                 /* nox */
+    r->voc_timestamp_ms = entry->voc.m_timestamp_ms;                                  /* voc timestamp */
+    r->nox_timestamp_ms = entry->nox.m_timestamp_ms;                                  /* nox timestamp */
+    r->flags = (uint8_t)(flags | SGP41_STORE_FLAG_STATE);                             /* set the flags */
+    ns = a_sgp41_store_now_ns() - start;                                              /* time */
+    entry->dirty = 0;                                                                 /* clean */
+    store->stats.stores++;                                                            /* store + 1 */
+    store->stats.store_ns += ns;                                                      /* add the time */
+    if (ns > store->stats.store_ns_max)                                               /* slowest */
+    {
+        store->stats.store_ns_max = ns;                                               /* save */
+    }
+}
+
+/**
+ * @brief     read the states of an entry from its record
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] e entry
+ * @note      a record without states starts from the templates
+ */
+static void a_sgp41_store_load(sgp41_store_t *store, uint32_t e)
+{
+    sgp41_store_entry_t *entry = &store->entry[e];
+    const sgp41_store_record_t *r = &store->record[entry->slot];
+    uint64_t start;
+    uint64_t ns;
+    
+    start = a_sgp41_store_now_ns();                                                   /* start */
+    if ((r->flags & SGP41_STORE_FLAG_STATE) == 0)                                     /* new device */
+    {
+        entry->voc = store->voc_template;                                             /* voc template */
+        entry->nox = store->nox_template;                                             /* nox template */
+        store->stats.creates++;                                                       /* create + 1 */
+        
+        return;                                                                       /* return */
+    }
+    a_sgp41_store_unpack(&store->voc_template, r->voc, r->flags, r->voc_timestamp_ms, &entry->voc);               /* voc */
+    a_sgp41_store_unpack(&store->nox_template, r->nox, (uint8_t)(r->flags >> 3), r->nox_timestamp_ms, &entry->nox);  /* nox */
+    ns = a_sgp41_store_now_ns() - start;                                              /* time */
+    store->stats.loads++;                                                             /* load + 1 */
+    store->stats.load_ns += ns;                                                       /* add the time */
+    if (ns > store->stats.load_ns_max)                                                /* slowest */
+    {
+        store->stats.load_ns_max = ns;                                                /* save */
+    }
+}
+
+/**
+ * @brief     open the store
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] *path pointer to a state file path
+ * @param[in] max_devices device capacity of a new file
+ * @param[in] cache_size states kept in memory
+ * @return    status code
+ *            - 0 success
+ *            - 1 open or map failed
+ *            - 2 param is NULL
+ *            - 4 size is invalid, does not fit the address space or the file has another layout
+ *            - 5 no memory
+ * @note      a new file gets the next power of 2 records above twice max_devices and stays sparse
+ *            until the records are written, an existing file keeps its own capacity, the
+ *            templates are sgp41_algorithm_init states with a 1 s interval
+ */
+uint8_t sgp41_store_init(sgp41_store_t *store, const char *path, uint32_t max_devices, uint32_t cache_size)
+{
+    struct stat st;
+    sgp41_store_header_t header;
+    uint64_t bytes;
+    uint32_t size;
+    uint32_t i;
+    uint8_t res;
+    
+    if ((store == NULL) || (path == NULL))                                            /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if ((max_devices == 0) || (max_devices > SGP41_STORE_MAX_DEVICES) ||
+        (cache_size == 0) || (cache_size > SGP41_STORE_MAX_DEVICES))                  /* check the sizes */
+    {
+        return 4;                                                                     /* return error */
+    }
+    
+    memset(store, 0, sizeof(sgp41_store_t));                                          /* clear */
+    store->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);                       /* open */
+    if (store->fd < 0)                                                                /* check the fd */
+    {
+        return 1;                                                                     /* return error */
+    }
+    if (fstat(store->fd, &st) != 0)                                                   /* get the length */
+    {
+        res = 1;                                                                      /* stat failed */
+        
+        goto failed;                                                                  /* close */
+    }
+    if (st.st_size == 0)                                                              /* new file */
+    {
+        memset(&header, 0, sizeof(header));                                           /* clear */
+        memcpy(header.magic, gs_magic, sizeof(gs_magic));                             /* magic */
+        header.byte_order = 0x01020304U;                                              /* this host */
+        header.record_size = SGP41_STORE_RECORD_SIZE;                                 /* record length */
+        for (size = 2; size < max_devices * 2; size <<= 1)                            /* at most half full */
+        {
+        }
+        header.slots = size;                                                          /* records */
+        bytes = ((uint64_t)size + 1) * SGP41_STORE_RECORD_SIZE;                       /* file length */
+        if (bytes > SIZE_MAX)                                                         /* check the address space */
+        {
+            res = 4;                                                                  /* too large */
+            
+            goto failed;                                                              /* close */
+        }
+        if ((pwrite(store->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) ||
+            (ftruncate(store->fd, (off_t)bytes) != 0))                                /* sparse file */
+        {
+            res = 1;                                                                  /* write failed */
+            
+            goto failed;                                                              /* close */
+        }
+    }
+    else
+    {
+        if ((pread(store->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) ||
+            (memcmp(header.magic, gs_magic, sizeof(gs_magic)) != 0) ||
+            (header.byte_order != 0x01020304U) || (header.record_size != SGP41_STORE_RECORD_SIZE) ||
+            (header.slots < 2) || ((header.slots & (header.slots - 1)) != 0) ||
+            (header.slots > SGP41_STORE_MAX_DEVICES * 2) ||
+            ((uint64_t)st.st_size != ((uint64_t)header.slots + 1) * SGP41_STORE_RECORD_SIZE))  /* check the layout */
+        {
+            res = 4;                                                                  /* another layout */
+            
+            goto failed;                                                              /* close */
+        }
+        bytes = (uint64_t)st.st_size;                                                 /* file length */
+        if (bytes > SIZE_MAX)                                                         /* check the address space */
+        {
+            res = 4;                                                                  /* too large */
+            
+            goto failed;                                                              /* close */
+        }
+    }
+    store->map_size = (size_t)bytes;                                                  /* map length */
+    store->map = mmap(NULL, store->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, store->fd, 0);  /* map */
+    if (store->map == MAP_FAILED)                                                     /* check the map */
+    {
+        store->map = NULL;                                                            /* no map */
+        res = 1;                                                                      /* map failed */
+        
+        goto failed;                                                                  /* close */
+    }
+    (void)madvise(store->map, store->map_size, MADV_RANDOM);                          /* no readahead */
+    store->header = (sgp41_store_header_t *)store->map;                               /* header */
+    store->record = (sgp41_store_record_t *)(store->map + SGP41_STORE_RECORD_SIZE);   /* records */
+    store->slot_mask = header.slots - 1;                                              /* set the mask */
+    store->max_devices = header.slots / 2;                                            /* at most half full */
+    
+    for (size = 2; size < cache_size * 2; size <<= 1)                                 /* at most half full */
+    {
+    }
+    store->entry = calloc(cache_size, sizeof(sgp41_store_entry_t));                   /* entries */
+    store->table = calloc(size, sizeof(uint32_t));                                    /* cache hash */
+    if ((store->entry == NULL) || (store->table == NULL))                             /* check the memory */
+    {
+        res = 5;                                                                      /* no memory */
+        
+        goto failed;                                                                  /* close */
+    }
+    store->table_mask = size - 1;                                                     /* set the mask */
+    store->cache_size = cache_size;                                                   /* set the capacity */
+    store->head = SGP41_STORE_NONE;                                                   /* empty list */
+    store->tail = SGP41_STORE_NONE;                                                   /* empty list */
+    for (i = 0; i < cache_size; i++)                                                  /* every entry */
+    {
+        store->entry[i].prev = SGP41_STORE_NONE;                                      /* no prev */
+        store->entry[i].next = SGP41_STORE_NONE;                                      /* no next */
+    }
+    sgp41_algorithm_init(&store->voc_template, SGP41_ALGORITHM_TYPE_VOC);             /* voc template */
+    sgp41_algorithm_init(&store->nox_template, SGP41_ALGORITHM_TYPE_NOX);             /* nox template */
+    store->inited = 1;                                                                /* flag finish initialization */
+    
+    return 0;                                                                         /* success return 0 */
+    
+    failed:
+    free(store->entry);                                                               /* free the entries */
+    free(store->table);                                                               /* free the hash */
+    if (store->map != NULL)                                                           /* mapped */
+    {
+        (void)munmap(store->map, store->map_size);                                    /* unmap */
+    }
+    (void)close(store->fd);                                                           /* close */
+    memset(store, 0, sizeof(sgp41_store_t));                                          /* clear */
+    
+    return res;                                                                       /* return error */
+}
+
+/**
+ * @brief     close the store
+ * @param[in] *store pointer to an sgp41 store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync failed
+ *            - 2 store is NULL
+ *            - 3 store is not initialized
+ * @note      the cached states are written back first
+ */
+uint8_t sgp41_store_deinit(sgp41_store_t *store)
+{
+    uint8_t res;
+    
+    if (store == NULL)                                                                /* check store */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (store->inited != 1)                                                           /* check store initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    res = sgp41_store_flush(store);                                                   /* write back */
+    (void)munmap(store->map, store->map_size);                                        /* unmap */
+    (void)close(store->fd);                                                           /* close */
+    free(store->entry);                                                               /* free the entries */
+    free(store->table);                                                               /* free the hash */
+    store->entry = NULL;                                                              /* no entries */
+    store->table = NULL;                                                              /* no hash */
+    store->map = NULL;                                                                /* no map */
+    store->inited = 0;                                                                /* flag close */
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief     set the state templates
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] *voc pointer to a voc template
+ * @param[in] *nox pointer to a nox template
+ * @return    status code
+ *            - 0 success
+ *            - 2 param is NULL
+ *            - 3 store is not initialized
+ * @note      a template gives the tuning and the interval of loaded states and the start of new
+ *            ones, set it before the first get and keep it for the file
+ */
+uint8_t sgp41_store_set_template(sgp41_store_t *store, const sgp41_gas_index_algorithm_t *voc,
+                                 const sgp41_gas_index_algorithm_t *nox)
+{
+    if ((store == NULL) || (voc == NULL) || (nox == NULL))                            /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (store->inited != 1)                                                           /* check store initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    store->voc_template = *voc;                                                       /* voc template */
+    store->nox_template = *nox;                                                       /* nox template */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the states of a device
+ * @param[in]  *store pointer to an sgp41 store structure
+ * @param[in]  *id pointer to a serial id
+ * @param[out] **voc pointer to a voc state pointer buffer
+ * @param[out] **nox pointer to a nox state pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 store is not initialized
+ *             - 5 the file is full
+ * @note       the states stay valid and may be updated until the next get, a miss loads them
+ *             from the file or starts them from the templates and writes the least recently
+ *             used states back to the file
+ */
+uint8_t sgp41_store_get(sgp41_store_t *store, const uint16_t id[3],
+                        sgp41_gas_index_algorithm_t **voc, sgp41_gas_index_algorithm_t **nox)
+{
+    uint32_t e;
+    uint32_t slot;
+    uint32_t h;
+    
+    if ((store == NULL) || (id == NULL) || (voc == NULL) || (nox == NULL))            /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (store->inited != 1)                                                           /* check store initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    store->stats.gets++;                                                              /* get + 1 */
+    e = a_sgp41_store_find(store, id);                                                /* cached */
+    if (e != SGP41_STORE_NONE)                                                        /* hit */
+    {
+        store->stats.hits++;                                                          /* hit + 1 */
+        if (store->head != e)                                                         /* not the most recent */
+        {
+            a_sgp41_store_unlink(store, e);                                           /* unlink */
+            a_sgp41_store_push(store, e);                                             /* most recent */
+        }
+    }
+    else
+    {
+        slot = a_sgp41_store_slot(store, id);                                         /* file record */
+        if (slot == SGP41_STORE_NONE)                                                 /* file full */
+        {
+            return 5;                                                                 /* return error */
+        }
+        if (store->cache_used < store->cache_size)                                    /* free entry */
+        {
+            e = store->cache_used++;                                                  /* take it */
+        }
+        else
+        {
+            e = store->tail;                                                          /* least recent */
+            if (store->entry[e].dirty != 0)                                           /* changed */
+            {
+                a_sgp41_store_save(store, e);                                         /* write back */
+            }
+            a_sgp41_store_unlink(store, e);                                           /* unlink */
+            a_sgp41_store_unhash(store, e);                                           /* unhash */
+            store->stats.evictions++;                                                 /* eviction + 1 */
+        }
+        memcpy(store->entry[e].id, id, sizeof(store->entry[e].id));                   /* copy the id */
+        store->entry[e].used = 1;                                                     /* used */
+        store->entry[e].slot = slot;                                                  /* set the record */
+        a_sgp41_store_load(store, e);                                                 /* read the states */
+        for (h = a_sgp41_store_hash(id) & store->table_mask; store->table[h] != 0;
+             h = (h + 1) & store->table_mask)                                         /* next empty slot */
+        {
+        }
+        store->table[h] = e + 1;                                                      /* hash */
+        a_sgp41_store_push(store, e);                                                 /* most recent */
+    }
+    store->entry[e].dirty = 1;                                                        /* handed out for update */
+    *voc = &store->entry[e].voc;                                                      /* voc state */
+    *nox = &store->entry[e].nox;                                                      /* nox state */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     write the cached states to the file
+ * @param[in] *store pointer to an sgp41 store structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync failed
+ *            - 2 store is NULL
+ *            - 3 store is not initialized
+ * @note      the states stay cached, the file is synced to the disk
+ */
+uint8_t sgp41_store_flush(sgp41_store_t *store)
+{
+    uint32_t e;
+    
+    if (store == NULL)                                                                /* check store */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (store->inited != 1)                                                           /* check store initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    for (e = 0; e < store->cache_used; e++)                                           /* every entry */
+    {
+        if (store->entry[e].dirty != 0)                                               /* changed */
+        {
+            a_sgp41_store_save(store, e);                                             /* write back */
+        }
+    }
+    if (msync(store->map, store->map_size, MS_SYNC) != 0)                             /* sync */
+    {
+        return 1;                                                                     /* return error */
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *store pointer to an sgp41 store structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 param is NULL
+ *             - 3 store is not initialized
+ *             - 4 resident query failed
+ * @note       the resident file bytes walk the whole mapping
+ */
+uint8_t sgp41_store_get_stats(sgp41_store_t *store, sgp41_store_stats_t *stats)
+{
+    unsigned char *vec;
+    size_t page;
+    size_t pages;
+    size_t i;
+    
+    if ((store == NULL) || (stats == NULL))                                           /* check the params */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (store->inited != 1)                                                           /* check store initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    *stats = store->stats;                                                            /* copy */
+    stats->devices = store->header->devices;                                          /* file devices */
+    stats->cached = store->cache_used;                                                /* cached devices */
+    stats->hit_rate = (stats->gets != 0) ? ((double)stats->hits / (double)stats->gets) : 0.0;  /* hit rate */
+    stats->cache_bytes = (size_t)store->cache_size * sizeof(sgp41_store_entry_t) +
+                         (size_t)(store->table_mask + 1) * sizeof(uint32_t);         /* cache memory */
+    stats->file_bytes = store->map_size;                                              /* file length */
+    page = (size_t)sysconf(_SC_PAGESIZE);                                             /* page size */
+    pages = (store->map_size + page - 1) / page;                                      /* page number */
+    vec = malloc(pages);                                                              /* page vector */
+    if ((vec == NULL) || (mincore(store->map, store->map_size, vec) != 0))            /* resident pages */
+    {
+        free(vec);                                                                    /* free */
+        
+        return 4;                                                                     /* return error */
+    }
+    for (i = 0; i < pages; i++)                                                       /* every page */
+    {
+        if ((vec[i] & 1) != 0)                                                        /* resident */
+        {
+            stats->file_resident_bytes += page;                                       /* add the page */
+        }
+    }
+    free(vec);                                                                        /* free */
+    
+    return 0;                                                                         /* success return 0 */
+}
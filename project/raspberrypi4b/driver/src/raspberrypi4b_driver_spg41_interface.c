@@ -35,8 +35,11 @@
  */
 
 #include "driver_sgp41_interface.h"
-#include "iic.h"
+#include "raspberrypi4b_driver_sgp41_broker.h"
 #include <stdarg.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
 
 /**
  * @brief iic device name definition
@@ -53,11 +56,11 @@ static int gs_fd;                           /**< iic handle */
  * @return status code
  *         - 0 success
  *         - 1 iic init failed
- * @note   none
+ * @note   every handle shares one fd of the device
  */
 uint8_t sgp41_interface_iic_init(void)
 {
-    return iic_init(IIC_DEVICE_NAME, &gs_fd);
+    return sgp41_broker_open(IIC_DEVICE_NAME, &gs_fd);
 }
 
 /**
@@ -69,7 +72,7 @@ uint8_t sgp41_interface_iic_init(void)
  */
 uint8_t sgp41_interface_iic_deinit(void)
 {
-    return iic_deinit(gs_fd);
+    return sgp41_broker_close(gs_fd);
 }
 
 /**
@@ -84,7 +87,7 @@ uint8_t sgp41_interface_iic_deinit(void)
  */
 uint8_t sgp41_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
 {
-    return iic_write_cmd(gs_fd, addr, buf, len);
+    return sgp41_broker_write_cmd(gs_fd, addr, buf, len);
 }
 
 /**
@@ -99,7 +102,7 @@ uint8_t sgp41_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
  */
 uint8_t sgp41_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
 {
-    return iic_read_cmd(gs_fd, addr, buf, len);
+    return sgp41_broker_read_cmd(gs_fd, addr, buf, len);
 }
 
 /**
@@ -112,6 +115,37 @@ void sgp41_interface_delay_ms(uint32_t ms)
     usleep(1000 * ms);
 }
 
+/**
+ * @brief  interface get the monotonic time
+ * @return time in us
+ * @note   CLOCK_MONOTONIC
+ */
+uint64_t sgp41_interface_get_time_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     interface delay until an absolute time
+ * @param[in] deadline_us deadline on the sgp41_interface_get_time_us clock
+ * @note      clock_nanosleep with TIMER_ABSTIME, a signal does not shift the deadline
+ */
+void sgp41_interface_delay_until_us(uint64_t deadline_us)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = (time_t)(deadline_us / 1000000ULL);
+    ts.tv_nsec = (long)(deadline_us % 1000000ULL) * 1000L;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+        /* sleep again to the same deadline */
+    }
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -35,10 +35,61 @@
  */
 
 #include "driver_sgp41_basic.h"
+#include "driver_sgp41_sampler.h"
+#include "driver_sgp41_low_power.h"
 #include "driver_sgp41_register_test.h"
 #include "driver_sgp41_read_test.h"
+#include "driver_sgp41_rollup_test.h"
+#include "driver_sgp41_compress_test.h"
+#include "driver_sgp41_timestep_test.h"
+#include "driver_sgp41_rate_test.h"
+#include "driver_sgp41_power_test.h"
+#include "driver_sgp41_mux_test.h"
+#include "driver_sgp41_trace_test.h"
+#include "driver_sgp41_log_test.h"
+#include "driver_sgp41_registry_test.h"
+#include "raspberrypi4b_driver_sgp41_event.h"
+#include "raspberrypi4b_driver_sgp41_multibus.h"
+#include "raspberrypi4b_driver_sgp41_broker.h"
+#include <errno.h>
 #include <getopt.h>
 #include <stdlib.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+static uint32_t gs_event_count;         /**< event example sample count */
+static uint32_t gs_event_times;         /**< event example sample number */
+static uint8_t gs_event_error;          /**< event example error flag */
+
+/**
+ * @brief     event example sample callback
+ * @param[in] id sensor id
+ * @param[in] status sample status
+ * @param[in] sraw_voc raw voc
+ * @param[in] sraw_nox raw nox
+ * @param[in] voc_gas_index voc gas index
+ * @param[in] nox_gas_index nox gas index
+ * @note      none
+ */
+static void a_sgp41_event_callback(uint32_t id, uint8_t status,
+                                   uint16_t sraw_voc, uint16_t sraw_nox,
+                                   int32_t voc_gas_index, int32_t nox_gas_index)
+{
+    (void)id;
+    (void)sraw_voc;
+    (void)sraw_nox;
+    
+    if (status != 0)
+    {
+        gs_event_error = 1;
+        
+        return;
+    }
+    gs_event_count++;
+    sgp41_interface_debug_print("sgp41: %d/%d.\n", gs_event_count, gs_event_times);
+    sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+    sgp41_interface_debug_print("sgp41: nox gas index is %d.\n", nox_gas_index);
+}
 
 /**
  * @brief     sgp41 full function
@@ -65,12 +116,15 @@ uint8_t sgp41(uint8_t argc, char **argv)
         {"humidity", required_argument, NULL, 1},
         {"temperature", required_argument, NULL, 2},
         {"times", required_argument, NULL, 3},
+        {"bus", required_argument, NULL, 4},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
     float rh = 50.0f;
     float temp = 25.0f;
+    char *bus[SGP41_MULTIBUS_MAX_BUSES];
+    uint8_t bus_count = 0;
 
     /* if no params */
     if (argc == 1)
@@ -166,6 +220,20 @@ uint8_t sgp41(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* bus */
+            case 4 :
+            {
+                /* add the bus */
+                if (bus_count >= SGP41_MULTIBUS_MAX_BUSES)
+                {
+                    return 5;
+                }
+                bus[bus_count] = optarg;
+                bus_count++;
+                
+                break;
+            } 
+            
             /* the end */
             case -1 :
             {
@@ -201,6 +269,96 @@ uint8_t sgp41(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_rollup", type) == 0)
+    {
+        /* run rollup test */
+        if (sgp41_rollup_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_compress", type) == 0)
+    {
+        /* run compress test */
+        if (sgp41_compress_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_timestep", type) == 0)
+    {
+        /* run timestep test */
+        if (sgp41_timestep_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_rate", type) == 0)
+    {
+        /* run rate test */
+        if (sgp41_rate_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_power", type) == 0)
+    {
+        /* run power test */
+        if (sgp41_power_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_mux", type) == 0)
+    {
+        /* run mux test */
+        if (sgp41_mux_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_trace", type) == 0)
+    {
+        /* run trace test */
+        if (sgp41_trace_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_log", type) == 0)
+    {
+        /* run log test */
+        if (sgp41_log_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_registry", type) == 0)
+    {
+        /* run registry test */
+        if (sgp41_registry_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
@@ -310,6 +468,278 @@ uint8_t sgp41(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_event", type) == 0)
+    {
+        uint8_t res;
+        int fd;
+        int epfd;
+        int n;
+        uint16_t reg_rh;
+        uint16_t reg_temp;
+        struct epoll_event ev;
+        sgp41_handle_t handle;
+        sgp41_event_t event;
+        
+        /* link the interface */
+        DRIVER_SGP41_LINK_INIT(&handle, sgp41_handle_t);
+        DRIVER_SGP41_LINK_IIC_INIT(&handle, sgp41_interface_iic_init);
+        DRIVER_SGP41_LINK_IIC_DEINIT(&handle, sgp41_interface_iic_deinit);
+        DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&handle, sgp41_interface_iic_write_cmd);
+        DRIVER_SGP41_LINK_IIC_READ_COMMAND(&handle, sgp41_interface_iic_read_cmd);
+        DRIVER_SGP41_LINK_DELAY_MS(&handle, sgp41_interface_delay_ms);
+        DRIVER_SGP41_LINK_DEBUG_PRINT(&handle, sgp41_interface_debug_print);
+        
+        /* init */
+        res = sgp41_init(&handle);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* convert the compensation */
+        (void)sgp41_humidity_convert_to_register(&handle, rh, &reg_rh);
+        (void)sgp41_temperature_convert_to_register(&handle, temp, &reg_temp);
+        
+        /* event init */
+        res = sgp41_event_init(&event, &handle, 0, SGP41_EVENT_DEFAULT_PERIOD_MS, a_sgp41_event_callback);
+        if (res != 0)
+        {
+            (void)sgp41_deinit(&handle);
+            
+            return 1;
+        }
+        (void)sgp41_event_set_compensation(&event, reg_rh, reg_temp);
+        
+        /* add the sensor fd to the application loop */
+        (void)sgp41_event_get_fd(&event, &fd);
+        epfd = epoll_create1(0);
+        memset(&ev, 0, sizeof(struct epoll_event));
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        if ((epfd < 0) || (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) != 0))
+        {
+            if (epfd >= 0)
+            {
+                (void)close(epfd);
+            }
+            (void)sgp41_event_deinit(&event);
+            (void)sgp41_deinit(&handle);
+            
+            return 1;
+        }
+        
+        /* start with the default conditioning */
+        gs_event_count = 0;
+        gs_event_times = times;
+        gs_event_error = 0;
+        res = sgp41_event_start(&event, SGP41_EVENT_DEFAULT_CONDITIONING);
+        
+        /* loop, the loop could watch any other fd as well */
+        while ((res == 0) && (gs_event_count < times) && (gs_event_error == 0))
+        {
+            n = epoll_wait(epfd, &ev, 1, -1);
+            if ((n < 0) && (errno != EINTR))
+            {
+                res = 1;
+            }
+            else if (n > 0)
+            {
+                res = sgp41_event_dispatch(&event);
+            }
+            else
+            {
+                /* interrupted */
+            }
+        }
+        sgp41_interface_debug_print("sgp41: event missed %d ticks.\n", (uint32_t)event.missed);
+        
+        /* deinit */
+        (void)sgp41_event_stop(&event);
+        (void)sgp41_event_deinit(&event);
+        (void)close(epfd);
+        (void)sgp41_deinit(&handle);
+        
+        return ((res != 0) || (gs_event_error != 0)) ? 1 : 0;
+    }
+    else if (strcmp("e_sampler", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        int32_t nox_gas_index;
+        sgp41_sampler_stats_t stats;
+        sgp41_broker_stats_t bus_stats;
+        
+        /* init */
+        res = sgp41_sampler_init(SGP41_SAMPLER_DEFAULT_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* read data at the next deadline */
+            res = sgp41_sampler_read(temp, rh, &voc_gas_index, &nox_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_sampler_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+            sgp41_interface_debug_print("sgp41: nox gas index is %d.\n", nox_gas_index);
+        }
+        
+        /* output the jitter */
+        (void)sgp41_sampler_get_stats(&stats);
+        sgp41_interface_debug_print("sgp41: period jitter min %dus max %dus mean %0.1fus std %0.1fus.\n",
+                                    stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us, stats.jitter_std_us);
+        sgp41_interface_debug_print("sgp41: max lateness %dus, %d slips.\n", stats.late_max_us, stats.slips);
+        if (sgp41_broker_get_stats("/dev/i2c-1", &bus_stats) == 0)
+        {
+            sgp41_interface_debug_print("sgp41: bus lock %d times, %d waits for other processes, wait max %dus, hold mean %0.1fus max %dus.\n",
+                                        (uint32_t)bus_stats.acquisitions, (uint32_t)bus_stats.process_waits, (uint32_t)bus_stats.wait_max_us,
+                                        (bus_stats.acquisitions != 0) ? (float)bus_stats.hold_us / (float)bus_stats.acquisitions : 0.0f,
+                                        (uint32_t)bus_stats.hold_max_us);
+        }
+        
+        /* deinit */
+        (void)sgp41_sampler_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_low-power", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        sgp41_low_power_energy_t energy;
+        
+        /* init */
+        res = sgp41_low_power_init(SGP41_LOW_POWER_DEFAULT_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* read data with the heater off between samples */
+            res = sgp41_low_power_read(temp, rh, &voc_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_low_power_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+        }
+        
+        /* output the energy */
+        (void)sgp41_low_power_get_energy(&energy);
+        sgp41_interface_debug_print("sgp41: heater on %dms of %dms, heater duty %0.2f%%.\n",
+                                    (uint32_t)energy.heater_on_ms, (uint32_t)energy.elapsed_ms, energy.duty * 100.0f);
+        sgp41_interface_debug_print("sgp41: %0.3fmAh per hour against %0.3fmAh per hour continuous.\n",
+                                    energy.mah_per_hour, energy.continuous_mah_per_hour);
+        
+        /* deinit */
+        (void)sgp41_low_power_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_multibus", type) == 0)
+    {
+        uint8_t res;
+        uint8_t i;
+        uint8_t index;
+        uint8_t sensor;
+        uint32_t count;
+        sgp41_multibus_t service;
+        sgp41_multibus_sample_t sample;
+        sgp41_multibus_stats_t stats;
+        
+        /* one sensor on every bus */
+        if (bus_count == 0)
+        {
+            bus[0] = "/dev/i2c-1";
+            bus_count = 1;
+        }
+        
+        /* init */
+        res = sgp41_multibus_init(&service, SGP41_MULTIBUS_DEFAULT_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        (void)sgp41_multibus_set_compensation(&service, (uint16_t)(rh / 100.0f * 65535.0f),
+                                              (uint16_t)((temp + 45.0f) / 175.0f * 65535.0f));
+        for (i = 0; i < bus_count; i++)
+        {
+            if ((sgp41_multibus_add_bus(&service, bus[i], &index) != 0) ||
+                (sgp41_multibus_add_sensor(&service, index, SGP41_MULTIBUS_NO_MUX, 0, &sensor) != 0))
+            {
+                sgp41_interface_debug_print("sgp41: add bus %s failed.\n", bus[i]);
+                (void)sgp41_multibus_deinit(&service);
+                
+                return 1;
+            }
+        }
+        
+        /* start the workers */
+        res = sgp41_multibus_start(&service, 10);
+        if (res != 0)
+        {
+            (void)sgp41_multibus_deinit(&service);
+            
+            return 1;
+        }
+        
+        /* read the merged stream */
+        for (count = 0; count < times * bus_count; count++)
+        {
+            res = sgp41_multibus_read(&service, &sample, SGP41_MULTIBUS_DEFAULT_PERIOD_MS * 3);
+            if (res != 0)
+            {
+                break;
+            }
+            
+            /* output */
+            if (sample.status != 0)
+            {
+                sgp41_interface_debug_print("sgp41: %s read failed.\n", bus[sample.bus]);
+            }
+            else
+            {
+                sgp41_interface_debug_print("sgp41: %d.%06ds %s sraw voc %d sraw nox %d.\n",
+                                            (uint32_t)(sample.timestamp_us / 1000000ULL),
+                                            (uint32_t)(sample.timestamp_us % 1000000ULL),
+                                            bus[sample.bus], sample.sraw_voc, sample.sraw_nox);
+            }
+        }
+        (void)sgp41_multibus_stop(&service);
+        
+        /* output the utilization */
+        for (i = 0; i < bus_count; i++)
+        {
+            (void)sgp41_multibus_get_stats(&service, i, &stats);
+            sgp41_interface_debug_print("sgp41: %s %d rounds %d samples %d errors, bus busy %0.2f%%.\n",
+                                        bus[i], stats.rounds, stats.samples, stats.errors, stats.utilization);
+        }
+        
+        /* deinit */
+        (void)sgp41_multibus_deinit(&service);
+        
+        return (res != 0) ? 1 : 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -319,19 +749,34 @@ uint8_t sgp41(uint8_t argc, char **argv)
         sgp41_interface_debug_print("  sgp41 (-p | --port)\n");
         sgp41_interface_debug_print("  sgp41 (-t reg | --test=reg)\n");
         sgp41_interface_debug_print("  sgp41 (-t read | --test=read) [--times=<num>]\n");
+        sgp41_interface_debug_print("  sgp41 (-t rollup | --test=rollup)\n");
+        sgp41_interface_debug_print("  sgp41 (-t compress | --test=compress)\n");
+        sgp41_interface_debug_print("  sgp41 (-t timestep | --test=timestep)\n");
+        sgp41_interface_debug_print("  sgp41 (-t rate | --test=rate)\n");
+        sgp41_interface_debug_print("  sgp41 (-t power | --test=power)\n");
+        sgp41_interface_debug_print("  sgp41 (-t mux | --test=mux)\n");
+        sgp41_interface_debug_print("  sgp41 (-t trace | --test=trace)\n");
+        sgp41_interface_debug_print("  sgp41 (-t log | --test=log)\n");
+        sgp41_interface_debug_print("  sgp41 (-t registry | --test=registry)\n");
         sgp41_interface_debug_print("  sgp41 (-e read | --example=read) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
         sgp41_interface_debug_print("  sgp41 (-e read-without-compensation | --example=read-without-compensation) [--times=<num>]\n");
         sgp41_interface_debug_print("  sgp41 (-e serial-id | --example=serial-id)\n");
+        sgp41_interface_debug_print("  sgp41 (-e event | --example=event) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e sampler | --example=sampler) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e low-power | --example=low-power) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e multibus | --example=multibus) [--bus=<dev>]... [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
         sgp41_interface_debug_print("\n");
         sgp41_interface_debug_print("Options:\n");
-        sgp41_interface_debug_print("  -e <read | read-without-compensation | serial-id>, --example=<read | read-without-compensation | serial-id>\n");
+        sgp41_interface_debug_print("      --bus=<dev>                         Add an iic bus with one sensor, repeat it for more buses.([default: /dev/i2c-1])\n");
+        sgp41_interface_debug_print("  -e <read | read-without-compensation | serial-id | event | sampler | low-power | multibus>, --example=<read | read-without-compensation | serial-id | event | sampler | low-power | multibus>\n");
         sgp41_interface_debug_print("                                          Run the driver example.\n");
         sgp41_interface_debug_print("  -h, --help                              Show the help.\n");
         sgp41_interface_debug_print("      --humidity=<rh>                     Set the humidity.([default: 50.0f])\n");
         sgp41_interface_debug_print("      --temperature=<temp>                Set the temperature.([default: 25.0f])\n");
         sgp41_interface_debug_print("  -i, --information                       Show the chip information.\n");
         sgp41_interface_debug_print("  -p, --port                              Display the pin connections of the current board.\n");
-        sgp41_interface_debug_print("  -t <reg | read>, --test=<reg | read>    Run the driver test.\n");
+        sgp41_interface_debug_print("  -t <reg | read | rollup | compress | timestep | rate | power | mux | trace | log | registry>, --test=<reg | read | rollup | compress | timestep | rate | power | mux | trace | log | registry>\n");
+        sgp41_interface_debug_print("                                          Run the driver test.\n");
         sgp41_interface_debug_print("      --times=<num>                       Set the running times.([default: 3])\n");
         
         return 0;
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      simulator_driver_sgp41_interface.c
+ * @brief     simulator driver sgp41 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_interface.h"
+#include "sim.h"
+#include <errno.h>
+#include <stdarg.h>
+#include <time.h>
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   none
+ */
+uint8_t sgp41_interface_iic_init(void)
+{
+    return sim_init();
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 iic deinit failed
+ * @note   none
+ */
+uint8_t sgp41_interface_iic_deinit(void)
+{
+    return sim_deinit();
+}
+
+/**
+ * @brief     interface iic bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t sgp41_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return sim_write_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t sgp41_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return sim_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the simulated device can skip the sleep, see sim_set_delay
+ */
+void sgp41_interface_delay_ms(uint32_t ms)
+{
+    sim_delay_ms(ms);
+}
+
+/**
+ * @brief  interface get the monotonic time
+ * @return time in us
+ * @note   CLOCK_MONOTONIC in the real delay mode, the simulated clock otherwise
+ */
+uint64_t sgp41_interface_get_time_us(void)
+{
+    struct timespec ts;
+    
+    if (sim_get_delay() != SIM_DELAY_REAL)
+    {
+        return sim_get_time_ms() * 1000U;
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     interface delay until an absolute time
+ * @param[in] deadline_us deadline on the sgp41_interface_get_time_us clock
+ * @note      clock_nanosleep with TIMER_ABSTIME in the real delay mode, the
+ *            simulated clock jumps to the deadline otherwise
+ */
+void sgp41_interface_delay_until_us(uint64_t deadline_us)
+{
+    struct timespec ts;
+    uint64_t now;
+    
+    if (sim_get_delay() != SIM_DELAY_REAL)
+    {
+        now = sim_get_time_ms() * 1000U;
+        if (deadline_us > now)
+        {
+            sim_delay_ms((uint32_t)((deadline_us - now + 999U) / 1000U));
+        }
+        
+        return;
+    }
+    ts.tv_sec = (time_t)(deadline_us / 1000000ULL);
+    ts.tv_nsec = (long)(deadline_us % 1000000ULL) * 1000L;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+        /* sleep again to the same deadline */
+    }
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void sgp41_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
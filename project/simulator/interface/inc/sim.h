@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim.h
+ * @brief     sim header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sim sim function
+ * @brief    simulated sgp41 device modules
+ * @{
+ */
+
+/**
+ * @brief sim delay enumeration definition
+ */
+typedef enum
+{
+    SIM_DELAY_REAL = 0x00,        /**< sleep like the real chip */
+    SIM_DELAY_NONE = 0x01,        /**< return at once, only the virtual clock moves */
+} sim_delay_t;
+
+/**
+ * @brief  sim device init
+ * @return status code
+ *         - 0 success
+ * @note   the device model is reset to the power up state
+ */
+uint8_t sim_init(void);
+
+/**
+ * @brief  sim device deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t sim_deinit(void);
+
+/**
+ * @brief     sim device write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 nack, unknown address, command or crc error
+ * @note      addr = device_address_7bits << 1, the general call 0x00 with 0x06 is a soft reset
+ */
+uint8_t sim_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      sim device read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 nack, no response is pending or the length is too long
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t sim_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     sim delay ms
+ * @param[in] ms time
+ * @note      the virtual clock always moves, the thread sleeps only in the real mode
+ */
+void sim_delay_ms(uint32_t ms);
+
+/**
+ * @brief     sim set the delay mode
+ * @param[in] delay delay mode
+ * @note      none
+ */
+void sim_set_delay(sim_delay_t delay);
+
+/**
+ * @brief  sim get the delay mode
+ * @return delay mode
+ * @note   none
+ */
+sim_delay_t sim_get_delay(void);
+
+/**
+ * @brief  sim get the virtual clock
+ * @return virtual time in ms
+ * @note   none
+ */
+uint64_t sim_get_time_ms(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
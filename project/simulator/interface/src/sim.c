@@ -0,0 +1,381 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim.c
+ * @brief     sim source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "sim.h"
+#include <time.h>
+
+/**
+ * @brief sim device definition
+ */
+#define SIM_ADDRESS                 (0x59 << 1)        /**< simulated chip address */
+#define SIM_SERIAL_ID_0             0x0000U            /**< serial id word 0 */
+#define SIM_SERIAL_ID_1             0x0415U            /**< serial id word 1 */
+#define SIM_SERIAL_ID_2             0x9B3CU            /**< serial id word 2 */
+#define SIM_SELF_TEST_OK            0xD400U            /**< self test passed */
+#define SIM_SRAW_VOC_BASE           30000              /**< voc sraw baseline */
+#define SIM_SRAW_NOX_BASE           16000              /**< nox sraw baseline */
+#define SIM_HEATER_SETTLE_MS        200                /**< hotplate settling time after the heater turns on */
+#define SIM_HEATER_COLD_OFFSET      2000               /**< sraw offset of a cold hotplate */
+
+/**
+ * @brief sim device state structure definition
+ */
+typedef struct sim_device_s
+{
+    uint8_t response[9];           /**< pending response */
+    uint8_t response_len;          /**< pending response length */
+    uint64_t ready_ms;             /**< time when the response is ready */
+    uint64_t time_ms;              /**< virtual clock */
+    uint64_t base_ms;              /**< monotonic time at init */
+    uint32_t seed;                 /**< noise seed */
+    uint32_t samples;              /**< measured samples */
+    uint8_t heater;                /**< heater on flag */
+    uint64_t heater_ms;            /**< time when the heater turned on */
+} sim_device_t;
+
+static sim_device_t gs_device;                    /**< simulated device */
+static sim_delay_t gs_delay = SIM_DELAY_REAL;     /**< delay mode */
+
+/**
+ * @brief     generate the crc
+ * @param[in] *data pointer to a data buffer
+ * @param[in] count data length
+ * @return    crc
+ * @note      same polynomial as the chip, 0x31 with init 0xFF
+ */
+static uint8_t a_sim_crc(const uint8_t *data, uint8_t count)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < count; i++)
+    {
+        crc ^= data[i];
+        for (j = 0; j < 8; j++)
+        {
+            crc = ((crc & 0x80) != 0) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief     put one word with crc into the response
+ * @param[in] index word index
+ * @param[in] word response word
+ * @note      none
+ */
+static void a_sim_put_word(uint8_t index, uint16_t word)
+{
+    uint8_t *p = &gs_device.response[index * 3];
+
+    p[0] = (uint8_t)((word >> 8) & 0xFF);
+    p[1] = (uint8_t)(word & 0xFF);
+    p[2] = a_sim_crc(p, 2);
+    gs_device.response_len = (uint8_t)((index + 1) * 3);
+}
+
+/**
+ * @brief  get the next noise value
+ * @return noise in -16 - 15
+ * @note   none
+ */
+static int32_t a_sim_noise(void)
+{
+    gs_device.seed = gs_device.seed * 1103515245U + 12345U;
+
+    return (int32_t)((gs_device.seed >> 16) & 0x1F) - 16;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ms
+ * @note   none
+ */
+static uint64_t a_sim_monotonic_ms(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000U + (uint64_t)(ts.tv_nsec / 1000000L);
+}
+
+/**
+ * @brief  follow the wall clock
+ * @note   in the real mode the chip also ages while the caller waits without
+ *         sim_delay_ms, for example on a timerfd, the clock never goes back
+ */
+static void a_sim_sync_clock(void)
+{
+    uint64_t now;
+
+    if (gs_delay != SIM_DELAY_REAL)
+    {
+        return;
+    }
+    now = a_sim_monotonic_ms() - gs_device.base_ms;
+    if (now > gs_device.time_ms)
+    {
+        gs_device.time_ms = now;
+    }
+}
+
+/**
+ * @brief     make one measurement
+ * @param[in] raw_humidity humidity ticks
+ * @param[in] raw_temperature temperature ticks
+ * @param[in] nox nox channel flag
+ * @note      a slow drift plus noise, the compensation ticks shift the voc baseline a little,
+ *            a hotplate that is still warming up reads high
+ */
+static void a_sim_measure(uint16_t raw_humidity, uint16_t raw_temperature, uint8_t nox)
+{
+    int32_t drift;
+    int32_t voc;
+    int32_t cold;
+    uint64_t warm;
+
+    if (gs_device.heater == 0)
+    {
+        gs_device.heater = 1;
+        gs_device.heater_ms = gs_device.time_ms;
+    }
+    warm = gs_device.time_ms - gs_device.heater_ms;
+    cold = (warm < SIM_HEATER_SETTLE_MS) ?
+           (int32_t)((SIM_HEATER_SETTLE_MS - warm) * SIM_HEATER_COLD_OFFSET / SIM_HEATER_SETTLE_MS) : 0;
+    drift = (int32_t)((gs_device.samples % 3600U) / 60U) - 30;
+    voc = SIM_SRAW_VOC_BASE + drift + cold + a_sim_noise() - ((int32_t)raw_humidity - 0x8000) / 2048 -
+          ((int32_t)raw_temperature - 0x6666) / 4096;
+    a_sim_put_word(0, (uint16_t)voc);
+    if (nox != 0)
+    {
+        a_sim_put_word(1, (uint16_t)(SIM_SRAW_NOX_BASE + cold / 4 + a_sim_noise() / 4));
+    }
+    gs_device.samples++;
+}
+
+/**
+ * @brief  sim device init
+ * @return status code
+ *         - 0 success
+ * @note   the device model is reset to the power up state
+ */
+uint8_t sim_init(void)
+{
+    memset(&gs_device, 0, sizeof(sim_device_t));
+    gs_device.seed = 0x5347;
+    gs_device.base_ms = a_sim_monotonic_ms();
+
+    return 0;
+}
+
+/**
+ * @brief  sim device deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t sim_deinit(void)
+{
+    gs_device.response_len = 0;
+    gs_device.heater = 0;
+
+    return 0;
+}
+
+/**
+ * @brief     sim device write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 nack, unknown address, command or crc error
+ * @note      addr = device_address_7bits << 1, the general call 0x00 with 0x06 is a soft reset
+ */
+uint8_t sim_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint16_t command;
+
+    a_sim_sync_clock();
+    if ((addr == 0x00) && (len == 1) && (buf[0] == 0x06))                          /* general call reset */
+    {
+        gs_device.response_len = 0;
+        gs_device.heater = 0;
+
+        return 0;
+    }
+    if ((addr != SIM_ADDRESS) || (len < 2))                                        /* check address */
+    {
+        return 1;
+    }
+    if ((len == 8) && ((buf[4] != a_sim_crc(&buf[2], 2)) || (buf[7] != a_sim_crc(&buf[5], 2))))        /* check param crc */
+    {
+        return 1;
+    }
+
+    command = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+    gs_device.response_len = 0;
+    switch (command)
+    {
+        case 0x2619 :                                                              /* measure raw */
+        {
+            if (len != 8)
+            {
+                return 1;
+            }
+            a_sim_measure((uint16_t)((buf[2] << 8) | buf[3]), (uint16_t)((buf[5] << 8) | buf[6]), 1);
+            gs_device.ready_ms = gs_device.time_ms + 50;
+
+            return 0;
+        }
+        case 0x2612 :                                                              /* execute conditioning */
+        {
+            if (len != 8)
+            {
+                return 1;
+            }
+            a_sim_measure((uint16_t)((buf[2] << 8) | buf[3]), (uint16_t)((buf[5] << 8) | buf[6]), 0);
+            gs_device.ready_ms = gs_device.time_ms + 50;
+
+            return 0;
+        }
+        case 0x280E :                                                              /* execute self test */
+        {
+            a_sim_put_word(0, SIM_SELF_TEST_OK);
+            gs_device.ready_ms = gs_device.time_ms + 320;
+
+            return 0;
+        }
+        case 0x3615 :                                                              /* turn heater off */
+        {
+            gs_device.heater = 0;
+
+            return 0;
+        }
+        case 0x3682 :                                                              /* get serial id */
+        {
+            a_sim_put_word(0, SIM_SERIAL_ID_0);
+            a_sim_put_word(1, SIM_SERIAL_ID_1);
+            a_sim_put_word(2, SIM_SERIAL_ID_2);
+            gs_device.ready_ms = gs_device.time_ms + 1;
+
+            return 0;
+        }
+        default :
+        {
+            return 1;
+        }
+    }
+}
+
+/**
+ * @brief      sim device read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 nack, no response is pending or the length is too long
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t sim_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    a_sim_sync_clock();
+    if ((addr != SIM_ADDRESS) || (len > gs_device.response_len))        /* check response */
+    {
+        return 1;
+    }
+    if (gs_device.time_ms < gs_device.ready_ms)                        /* still busy */
+    {
+        return 1;
+    }
+    memcpy(buf, gs_device.response, len);
+    gs_device.response_len = 0;
+
+    return 0;
+}
+
+/**
+ * @brief     sim delay ms
+ * @param[in] ms time
+ * @note      the virtual clock always moves, the thread sleeps only in the real mode
+ */
+void sim_delay_ms(uint32_t ms)
+{
+    gs_device.time_ms += ms;
+    if (gs_delay == SIM_DELAY_REAL)
+    {
+        struct timespec ts;
+
+        ts.tv_sec = ms / 1000;
+        ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+        (void)nanosleep(&ts, NULL);
+    }
+}
+
+/**
+ * @brief     sim set the delay mode
+ * @param[in] delay delay mode
+ * @note      none
+ */
+void sim_set_delay(sim_delay_t delay)
+{
+    gs_delay = delay;
+}
+
+/**
+ * @brief  sim get the delay mode
+ * @return delay mode
+ * @note   none
+ */
+sim_delay_t sim_get_delay(void)
+{
+    return gs_delay;
+}
+
+/**
+ * @brief  sim get the virtual clock
+ * @return virtual time in ms
+ * @note   none
+ */
+uint64_t sim_get_time_ms(void)
+{
+    return gs_device.time_ms;
+}
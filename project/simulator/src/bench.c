@@ -0,0 +1,730 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench.c
+ * @brief     bench source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41.h"
+#include "driver_sgp41_algorithm.h"
+#include "driver_sgp41_basic.h"
+#include "driver_sgp41_trace.h"
+#include "sim.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_REPEATS          5           /**< timed runs per case, the median is reported */
+#define BENCH_TRACE_LEN        4096        /**< sraw trace length */
+#define BENCH_REPLAY_SAMPLES   256         /**< recorded measurements */
+#define BENCH_REPLAY_SIZE      16384       /**< recording buffer */
+
+/**
+ * @brief bench case structure definition
+ */
+typedef struct bench_case_s
+{
+    const char *name;                          /**< case name */
+    uint32_t iterations;                       /**< default iterations */
+    uint8_t (*setup)(void);                    /**< point to a setup function address */
+    void (*run)(uint32_t iterations);          /**< point to a run function address */
+} bench_case_t;
+
+/**
+ * @brief bench result structure definition
+ */
+typedef struct bench_result_s
+{
+    double ns_per_op;                 /**< median ns per op */
+    double ns_per_op_min;             /**< min ns per op */
+    double instructions_per_op;       /**< instructions per op, < 0 means no counter */
+} bench_result_t;
+
+static int32_t gs_voc_trace[BENCH_TRACE_LEN];                   /**< voc sraw trace */
+static int32_t gs_nox_trace[BENCH_TRACE_LEN];                   /**< nox sraw trace */
+static sgp41_gas_index_algorithm_t gs_algorithm;                /**< algorithm state */
+static sgp41_handle_t gs_handle;                                /**< canned transport handle */
+static uint8_t gs_frame[9];                                     /**< canned response frame */
+static volatile int32_t gs_sink;                                /**< keeps results alive */
+static int gs_perf_fd = -1;                                     /**< perf counter fd */
+static uint8_t gs_basic_inited;                                 /**< basic example inited flag */
+static sgp41_handle_t gs_replay_handle;                         /**< replayed handle */
+static sgp41_trace_handle_t gs_trace;                           /**< trace handle */
+static uint8_t gs_replay[BENCH_REPLAY_SIZE];                    /**< recording */
+static uint32_t gs_replay_len;                                  /**< recording length */
+
+/**
+ * @brief     canned transport write, accepts every frame
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_bench_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    gs_sink += buf[len - 1];
+
+    return 0;
+}
+
+/**
+ * @brief      canned transport read, returns the prepared frame
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_bench_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    memcpy(buf, gs_frame, len);
+
+    return 0;
+}
+
+/**
+ * @brief  canned transport init and deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_bench_iic_none(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     canned transport delay, never sleeps
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_bench_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     put one word with crc into the canned frame
+ * @param[in] index word index
+ * @param[in] word frame word
+ * @note      none
+ */
+static void a_bench_put_word(uint8_t index, uint16_t word)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+    uint8_t j;
+    uint8_t *p = &gs_frame[index * 3];
+
+    p[0] = (uint8_t)(word >> 8);
+    p[1] = (uint8_t)(word & 0xFF);
+    for (i = 0; i < 2; i++)
+    {
+        crc ^= p[i];
+        for (j = 0; j < 8; j++)
+        {
+            crc = ((crc & 0x80) != 0) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    p[2] = crc;
+}
+
+/**
+ * @brief  trace setup
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_bench_setup_trace(void)
+{
+    uint32_t i;
+
+    srand(0x5347);
+    for (i = 0; i < BENCH_TRACE_LEN; i++)
+    {
+        gs_voc_trace[i] = 30000 + (int32_t)(i % 512) - 256 + (rand() % 33) - 16;
+        gs_nox_trace[i] = 16000 + (rand() % 9) - 4;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  voc algorithm setup
+ * @return status code
+ *         - 0 success
+ * @note   the state is warmed past the initial blackout so the full path runs
+ */
+static uint8_t a_bench_setup_voc(void)
+{
+    uint32_t i;
+    int32_t index;
+
+    (void)a_bench_setup_trace();
+    sgp41_algorithm_init(&gs_algorithm, SGP41_ALGORITHM_TYPE_VOC);
+    for (i = 0; i < 100; i++)
+    {
+        sgp41_algorithm_process(&gs_algorithm, gs_voc_trace[i], &index);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  nox algorithm setup
+ * @return status code
+ *         - 0 success
+ * @note   the state is warmed past the initial blackout so the full path runs
+ */
+static uint8_t a_bench_setup_nox(void)
+{
+    uint32_t i;
+    int32_t index;
+
+    (void)a_bench_setup_trace();
+    sgp41_algorithm_init(&gs_algorithm, SGP41_ALGORITHM_TYPE_NOX);
+    for (i = 0; i < 100; i++)
+    {
+        sgp41_algorithm_process(&gs_algorithm, gs_nox_trace[i], &index);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  canned transport setup
+ * @return status code
+ *         - 0 success
+ *         - 1 setup failed
+ * @note   none
+ */
+static uint8_t a_bench_setup_frame(void)
+{
+    DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, a_bench_iic_none);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, a_bench_iic_none);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, a_bench_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, a_bench_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, a_bench_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle, sgp41_interface_debug_print);
+    a_bench_put_word(0, 30000);
+    a_bench_put_word(1, 16000);
+    a_bench_put_word(2, 0x9B3C);
+
+    return sgp41_init(&gs_handle);
+}
+
+/**
+ * @brief  simulated device setup
+ * @return status code
+ *         - 0 success
+ *         - 1 setup failed
+ * @note   none
+ */
+static uint8_t a_bench_setup_basic(void)
+{
+    sim_set_delay(SIM_DELAY_NONE);
+    if (gs_basic_inited != 0)
+    {
+        return 0;
+    }
+    if (sgp41_basic_init() != 0)
+    {
+        return 1;
+    }
+    gs_basic_inited = 1;
+
+    return 0;
+}
+
+/**
+ * @brief     recording write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 recording is full
+ * @note      none
+ */
+static uint8_t a_bench_write_file(const uint8_t *buf, uint16_t len)
+{
+    if (gs_replay_len + len > BENCH_REPLAY_SIZE)
+    {
+        return 1;
+    }
+    memcpy(&gs_replay[gs_replay_len], buf, len);
+    gs_replay_len += len;
+
+    return 0;
+}
+
+/**
+ * @brief  replay setup
+ * @return status code
+ *         - 0 success
+ *         - 1 setup failed
+ * @note   records measurements of the simulated device, the init is left out of the recording
+ */
+static uint8_t a_bench_setup_replay(void)
+{
+    uint32_t i;
+    uint16_t voc;
+    uint16_t nox;
+
+    sim_set_delay(SIM_DELAY_NONE);
+    DRIVER_SGP41_TRACE_LINK_INIT(&gs_trace, sgp41_trace_handle_t);
+    DRIVER_SGP41_TRACE_LINK_IIC_INIT(&gs_trace, sgp41_interface_iic_init);
+    DRIVER_SGP41_TRACE_LINK_IIC_DEINIT(&gs_trace, sgp41_interface_iic_deinit);
+    DRIVER_SGP41_TRACE_LINK_IIC_WRITE_COMMAND(&gs_trace, sgp41_interface_iic_write_cmd);
+    DRIVER_SGP41_TRACE_LINK_IIC_READ_COMMAND(&gs_trace, sgp41_interface_iic_read_cmd);
+    DRIVER_SGP41_TRACE_LINK_DELAY_MS(&gs_trace, sgp41_interface_delay_ms);
+    DRIVER_SGP41_TRACE_LINK_GET_TIME_US(&gs_trace, sgp41_interface_get_time_us);
+    DRIVER_SGP41_TRACE_LINK_WRITE_FILE(&gs_trace, a_bench_write_file);
+    DRIVER_SGP41_LINK_INIT(&gs_replay_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_replay_handle, sgp41_trace_iic_init);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_replay_handle, sgp41_trace_iic_deinit);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_replay_handle, sgp41_trace_iic_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_replay_handle, sgp41_trace_iic_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_replay_handle, sgp41_trace_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_replay_handle, sgp41_interface_debug_print);
+    if ((sgp41_trace_record(&gs_trace) != 0) || (sgp41_init(&gs_replay_handle) != 0))
+    {
+        return 1;
+    }
+    gs_replay_len = 0;
+    (void)sgp41_trace_record(&gs_trace);
+    for (i = 0; i < BENCH_REPLAY_SAMPLES; i++)
+    {
+        if (sgp41_get_measure_raw(&gs_replay_handle, 0x8000, 0x6666, &voc, &nox) != 0)
+        {
+            return 1;
+        }
+    }
+    if (sgp41_trace_deinit(&gs_trace) != 0)
+    {
+        return 1;
+    }
+    sgp41_algorithm_init(&gs_algorithm, SGP41_ALGORITHM_TYPE_VOC);
+
+    return 0;
+}
+
+/**
+ * @brief     algorithm init case
+ * @param[in] iterations iteration number
+ * @note      none
+ */
+static void a_bench_run_init(uint32_t iterations)
+{
+    uint32_t i;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sgp41_algorithm_init(&gs_algorithm, (int32_t)(i & 1));
+        gs_sink += (int32_t)gs_algorithm.m_index_offset;
+    }
+}
+
+/**
+ * @brief     voc algorithm process case
+ * @param[in] iterations iteration number
+ * @note      none
+ */
+static void a_bench_run_voc(uint32_t iterations)
+{
+    uint32_t i;
+    int32_t index;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sgp41_algorithm_process(&gs_algorithm, gs_voc_trace[i % BENCH_TRACE_LEN], &index);
+        gs_sink += index;
+    }
+}
+
+/**
+ * @brief     nox algorithm process case
+ * @param[in] iterations iteration number
+ * @note      none
+ */
+static void a_bench_run_nox(uint32_t iterations)
+{
+    uint32_t i;
+    int32_t index;
+
+    for (i = 0; i < iterations; i++)
+    {
+        sgp41_algorithm_process(&gs_algorithm, gs_nox_trace[i % BENCH_TRACE_LEN], &index);
+        gs_sink += index;
+    }
+}
+
+/**
+ * @brief     measure raw frame case, compensation words, two tx crc and two rx crc checks
+ * @param[in] iterations iteration number
+ * @note      none
+ */
+static void a_bench_run_measure_raw(uint32_t iterations)
+{
+    uint32_t i;
+    uint16_t rh;
+    uint16_t t;
+    uint16_t voc;
+    uint16_t nox;
+
+    for (i = 0; i < iterations; i++)
+    {
+        (void)sgp41_humidity_convert_to_register(&gs_handle, 50.0f, &rh);
+        (void)sgp41_temperature_convert_to_register(&gs_handle, 25.0f, &t);
+        (void)sgp41_get_measure_raw(&gs_handle, (uint16_t)(rh + (i & 7)), t, &voc, &nox);
+        gs_sink += voc + nox;
+    }
+}
+
+/**
+ * @brief     serial id frame case, three rx crc checks
+ * @param[in] iterations iteration number
+ * @note      none
+ */
+static void a_bench_run_serial_id(uint32_t iterations)
+{
+    uint32_t i;
+    uint16_t id[3];
+
+    for (i = 0; i < iterations; i++)
+    {
+        (void)sgp41_get_serial_id(&gs_handle, id);
+        gs_sink += id[2];
+    }
+}
+
+/**
+ * @brief     basic read case, full cycle through the simulated device
+ * @param[in] iterations iteration number
+ * @note      none
+ */
+static void a_bench_run_basic_read(uint32_t iterations)
+{
+    uint32_t i;
+    int32_t voc;
+    int32_t nox;
+
+    for (i = 0; i < iterations; i++)
+    {
+        (void)sgp41_basic_read(25.0f, 50.0f, &voc, &nox);
+        gs_sink += voc + nox;
+    }
+}
+
+/**
+ * @brief     replay case, measure raw and the voc algorithm answered from a recording
+ * @param[in] iterations iteration number
+ * @note      none
+ */
+static void a_bench_run_replay(uint32_t iterations)
+{
+    uint32_t i;
+    uint16_t voc;
+    uint16_t nox;
+    int32_t index;
+
+    for (i = 0; i < iterations; i++)
+    {
+        if ((i % BENCH_REPLAY_SAMPLES) == 0)
+        {
+            (void)sgp41_trace_replay(&gs_trace, gs_replay, gs_replay_len, SGP41_TRACE_MODE_REPLAY);
+        }
+        (void)sgp41_get_measure_raw(&gs_replay_handle, 0x8000, 0x6666, &voc, &nox);
+        sgp41_algorithm_process(&gs_algorithm, voc, &index);
+        gs_sink += index + nox;
+    }
+}
+
+/**
+ * @brief bench case list
+ */
+static const bench_case_t gs_cases[] =
+{
+    {"algorithm_init", 200000, a_bench_setup_trace, a_bench_run_init},
+    {"algorithm_process_voc", 1000000, a_bench_setup_voc, a_bench_run_voc},
+    {"algorithm_process_nox", 1000000, a_bench_setup_nox, a_bench_run_nox},
+    {"frame_measure_raw", 1000000, a_bench_setup_frame, a_bench_run_measure_raw},
+    {"frame_serial_id", 1000000, a_bench_setup_frame, a_bench_run_serial_id},
+    {"basic_read", 200000, a_bench_setup_basic, a_bench_run_basic_read},
+    {"replay_measure_raw", 200000, a_bench_setup_replay, a_bench_run_replay},
+};
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  open the user space instruction counter
+ * @note   the counter is optional, containers and vms often block it
+ */
+static void a_bench_perf_open(void)
+{
+#ifdef __linux__
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    gs_perf_fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+/**
+ * @brief     run one bench case
+ * @param[in] *c pointer to a bench case
+ * @param[in] iterations iteration number
+ * @param[out] *result pointer to a result buffer
+ * @note      none
+ */
+static void a_bench_run_case(const bench_case_t *c, uint32_t iterations, bench_result_t *result)
+{
+    double ns[BENCH_REPEATS];
+    long long count;
+    uint32_t i;
+    uint32_t j;
+
+    /* warm up */
+    c->run(iterations / 10 + 1);
+
+    /* timed runs */
+    for (i = 0; i < BENCH_REPEATS; i++)
+    {
+        uint64_t start;
+
+        start = a_bench_now_ns();
+        c->run(iterations);
+        ns[i] = (double)(a_bench_now_ns() - start) / (double)iterations;
+    }
+
+    /* sort for the median */
+    for (i = 1; i < BENCH_REPEATS; i++)
+    {
+        for (j = i; (j > 0) && (ns[j - 1] > ns[j]); j--)
+        {
+            double t = ns[j];
+
+            ns[j] = ns[j - 1];
+            ns[j - 1] = t;
+        }
+    }
+    result->ns_per_op = ns[BENCH_REPEATS / 2];
+    result->ns_per_op_min = ns[0];
+
+    /* counted run */
+    result->instructions_per_op = -1.0;
+#ifdef __linux__
+    if (gs_perf_fd >= 0)
+    {
+        (void)ioctl(gs_perf_fd, PERF_EVENT_IOC_RESET, 0);
+        (void)ioctl(gs_perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+        c->run(iterations);
+        (void)ioctl(gs_perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(gs_perf_fd, &count, sizeof(count)) == (ssize_t)sizeof(count))
+        {
+            result->instructions_per_op = (double)count / (double)iterations;
+        }
+    }
+#else
+    (void)count;
+#endif
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint8_t json = 0;
+    uint32_t iterations = 0;
+    const char *filter = NULL;
+    const char short_options[] = "hj";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"json", no_argument, NULL, 'j'},
+        {"iterations", required_argument, NULL, 1},
+        {"filter", required_argument, NULL, 2},
+        {NULL, 0, NULL, 0},
+    };
+    uint32_t i;
+    uint32_t ran;
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'j' :
+            {
+                json = 1;
+
+                break;
+            }
+            case 1 :
+            {
+                iterations = (uint32_t)atol(optarg);
+
+                break;
+            }
+            case 2 :
+            {
+                filter = optarg;
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench [-j | --json] [--iterations=<num>] [--filter=<name>]\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("      --filter=<name>                     Run only the cases whose name contains the string.\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("      --iterations=<num>                  Set the iterations of every case.([default: per case])\n");
+                printf("  -j, --json                              Print the results as json.\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+
+    a_bench_perf_open();
+    if (json != 0)
+    {
+        printf("{\n  \"benchmark\": \"sgp41\",\n  \"instructions_counter\": %s,\n  \"results\": [",
+               (gs_perf_fd >= 0) ? "true" : "false");
+    }
+    else
+    {
+        printf("%-24s %12s %12s %12s %14s\n", "case", "iterations", "ns/op", "min ns/op", "instructions/op");
+    }
+    ran = 0;
+    for (i = 0; i < sizeof(gs_cases) / sizeof(gs_cases[0]); i++)
+    {
+        const bench_case_t *b = &gs_cases[i];
+        bench_result_t result;
+        uint32_t n;
+
+        if ((filter != NULL) && (strstr(b->name, filter) == NULL))
+        {
+            continue;
+        }
+        if (b->setup() != 0)
+        {
+            fprintf(stderr, "sgp41_bench: %s setup failed.\n", b->name);
+
+            return 1;
+        }
+        n = (iterations != 0) ? iterations : b->iterations;
+        a_bench_run_case(b, n, &result);
+        if (json != 0)
+        {
+            printf("%s\n    {\"name\": \"%s\", \"iterations\": %u, \"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, ",
+                   (ran == 0) ? "" : ",", b->name, n, result.ns_per_op, result.ns_per_op_min);
+            if (result.instructions_per_op < 0.0)
+            {
+                printf("\"instructions_per_op\": null}");
+            }
+            else
+            {
+                printf("\"instructions_per_op\": %.1f}", result.instructions_per_op);
+            }
+        }
+        else
+        {
+            printf("%-24s %12u %12.2f %12.2f ", b->name, n, result.ns_per_op, result.ns_per_op_min);
+            if (result.instructions_per_op < 0.0)
+            {
+                printf("%14s\n", "n/a");
+            }
+            else
+            {
+                printf("%14.1f\n", result.instructions_per_op);
+            }
+        }
+        ran++;
+    }
+    if (json != 0)
+    {
+        printf("\n  ]\n}\n");
+    }
+    if (gs_perf_fd >= 0)
+    {
+        (void)close(gs_perf_fd);
+    }
+    if (gs_basic_inited != 0)
+    {
+        (void)sgp41_basic_deinit();
+    }
+
+    return (ran == 0) ? 1 : 0;
+}
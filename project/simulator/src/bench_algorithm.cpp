@@ -0,0 +1,359 @@
+#include "driver_sgp41_algorithm.hpp"
+#include <getopt.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_REPEATS          5                 /**< timed runs per case, the median is reported */
+#define BENCH_TRACE_LEN        4096              /**< timing trace length */
+#define CHECK_SAMPLES          (3 * 86400)       /**< three days of samples per check */
+
+/**
+ * @brief custom tuning used by the identity check
+ */
+struct check_tuning
+{
+    static constexpr int32_t index_offset = 150;                       /**< index offset */
+    static constexpr int32_t learning_time_offset_hours = 24;          /**< learning time offset hours */
+    static constexpr int32_t learning_time_gain_hours = 6;             /**< learning time gain hours */
+    static constexpr int32_t gating_max_duration_minutes = 60;         /**< gating max duration minutes */
+    static constexpr int32_t std_initial = 80;                         /**< std initial */
+    static constexpr int32_t gain_factor = 200;                        /**< gain factor */
+};
+
+static int32_t gs_voc_trace[BENCH_TRACE_LEN];        /**< voc sraw trace */
+static int32_t gs_nox_trace[BENCH_TRACE_LEN];        /**< nox sraw trace */
+static volatile int32_t gs_sink;                     /**< keeps results alive */
+
+/**
+ * @brief     synthetic sraw
+ * @param[in] i sample index
+ * @param[in] nox nox flag
+ * @return    sraw
+ * @note      slow drift, noise, events and a few invalid samples
+ */
+static int32_t a_bench_sraw(uint32_t i, bool nox)
+{
+    int32_t v;
+
+    if ((i % 50000U) == 49999U)
+    {
+        return 0;
+    }
+    v = nox ? 16000 : 30000;
+    v += (int32_t)((i % 7200U) / 30U) - 120;
+    v += (rand() % 41) - 20;
+    if ((i % 5400U) < 600U)
+    {
+        v += nox ? (int32_t)(i % 5400U) : -(int32_t)((i % 5400U) * 8U);
+    }
+
+    return v;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     compare the template against the c version
+ * @param[in] *name pointer to a check name
+ * @param[in] &c reference to an initialized c state
+ * @param[in] &cpp reference to a template state
+ * @param[in] nox nox trace flag
+ * @return    mismatch count
+ * @note      none
+ */
+template <class Algorithm>
+static uint32_t a_bench_check(const char *name, sgp41_gas_index_algorithm_t &c, Algorithm &cpp, bool nox)
+{
+    uint32_t i;
+    uint32_t errors;
+    float c0;
+    float c1;
+    float p0;
+    float p1;
+
+    srand(0x5347);
+    errors = 0;
+    for (i = 0; i < CHECK_SAMPLES; i++)
+    {
+        int32_t sraw;
+        int32_t a;
+        int32_t b;
+
+        sraw = a_bench_sraw(i, nox);
+        sgp41_algorithm_process(&c, sraw, &a);
+        b = cpp.process(sraw);
+        if (a != b)
+        {
+            if (errors == 0)
+            {
+                printf("sgp41_bench_cpp: %s sample %u c %d c++ %d.\n", name, i, a, b);
+            }
+            errors++;
+        }
+    }
+    sgp41_algorithm_get_states(&c, &c0, &c1);
+    cpp.get_states(p0, p1);
+    if ((c0 != p0) || (c1 != p1))
+    {
+        printf("sgp41_bench_cpp: %s states differ.\n", name);
+        errors++;
+    }
+    printf("sgp41_bench_cpp: check %-16s %u samples, %u mismatches.\n", name, CHECK_SAMPLES, errors);
+
+    return errors;
+}
+
+/**
+ * @brief  run all identity checks
+ * @return mismatch count
+ * @note   none
+ */
+static uint32_t a_bench_check_all(void)
+{
+    sgp41_gas_index_algorithm_t c;
+    uint32_t errors = 0;
+
+    {
+        sgp41::voc_algorithm cpp;
+
+        sgp41_algorithm_init(&c, SGP41_ALGORITHM_TYPE_VOC);
+        errors += a_bench_check("voc", c, cpp, false);
+    }
+    {
+        sgp41::nox_algorithm cpp;
+
+        sgp41_algorithm_init(&c, SGP41_ALGORITHM_TYPE_NOX);
+        errors += a_bench_check("nox", c, cpp, true);
+    }
+    {
+        sgp41::gas_index_algorithm<SGP41_ALGORITHM_TYPE_VOC, 10000> cpp;
+
+        sgp41_algorithm_init_with_sampling_interval(&c, SGP41_ALGORITHM_TYPE_VOC, 10.f);
+        errors += a_bench_check("voc 10 s", c, cpp, false);
+    }
+    {
+        sgp41::gas_index_algorithm<SGP41_ALGORITHM_TYPE_NOX, 500, check_tuning> cpp;
+
+        sgp41_algorithm_init_with_sampling_interval(&c, SGP41_ALGORITHM_TYPE_NOX, 0.5f);
+        sgp41_algorithm_set_tuning_parameters(&c, 150, 24, 6, 60, 80, 200);
+        errors += a_bench_check("nox tuned 0.5 s", c, cpp, true);
+    }
+    {
+        sgp41::voc_algorithm cpp;
+
+        sgp41_algorithm_init(&c, SGP41_ALGORITHM_TYPE_VOC);
+        sgp41_algorithm_set_states(&c, 30100.f, 60.f);
+        cpp.set_states(30100.f, 60.f);
+        errors += a_bench_check("voc states", c, cpp, false);
+    }
+
+    return errors;
+}
+
+/**
+ * @brief     time one run function
+ * @param[in] run run function
+ * @param[in] iterations iteration number
+ * @return    median ns per op
+ * @note      none
+ */
+template <class Run>
+static double a_bench_time(Run run, uint32_t iterations)
+{
+    double ns[BENCH_REPEATS];
+    uint32_t i;
+    uint32_t j;
+
+    run(iterations / 10 + 1);
+    for (i = 0; i < BENCH_REPEATS; i++)
+    {
+        uint64_t start = a_bench_now_ns();
+
+        run(iterations);
+        ns[i] = (double)(a_bench_now_ns() - start) / (double)iterations;
+    }
+    for (i = 1; i < BENCH_REPEATS; i++)
+    {
+        for (j = i; (j > 0) && (ns[j - 1] > ns[j]); j--)
+        {
+            double t = ns[j];
+
+            ns[j] = ns[j - 1];
+            ns[j - 1] = t;
+        }
+    }
+
+    return ns[BENCH_REPEATS / 2];
+}
+
+/**
+ * @brief     time the c and the template path of one gas
+ * @param[in] *name pointer to a case name
+ * @param[in] type algorithm type
+ * @param[in] *trace pointer to a sraw trace
+ * @param[in] iterations iteration number
+ * @param[in] json json output flag
+ * @param[in] first first json item flag
+ * @note      both states are warmed past the blackout first
+ */
+template <class Algorithm>
+static void a_bench_compare(const char *name, int32_t type, const int32_t *trace, uint32_t iterations, bool json, bool first)
+{
+    sgp41_gas_index_algorithm_t c;
+    Algorithm cpp;
+    double c_ns;
+    double cpp_ns;
+    uint32_t i;
+    int32_t index;
+
+    sgp41_algorithm_init(&c, type);
+    for (i = 0; i < 100; i++)
+    {
+        sgp41_algorithm_process(&c, trace[i], &index);
+        gs_sink += cpp.process(trace[i]);
+    }
+    c_ns = a_bench_time([&](uint32_t n) {
+        for (uint32_t k = 0; k < n; k++)
+        {
+            int32_t v;
+
+            sgp41_algorithm_process(&c, trace[k % BENCH_TRACE_LEN], &v);
+            gs_sink += v;
+        }
+    }, iterations);
+    cpp_ns = a_bench_time([&](uint32_t n) {
+        for (uint32_t k = 0; k < n; k++)
+        {
+            gs_sink += cpp.process(trace[k % BENCH_TRACE_LEN]);
+        }
+    }, iterations);
+    if (json)
+    {
+        printf("%s\n    {\"name\": \"%s\", \"iterations\": %u, \"c_ns_per_op\": %.3f, \"cpp_ns_per_op\": %.3f, "
+               "\"speedup\": %.3f, \"c_state_bytes\": %u, \"cpp_state_bytes\": %u}",
+               first ? "" : ",", name, iterations, c_ns, cpp_ns, c_ns / cpp_ns,
+               (unsigned)sizeof(sgp41_gas_index_algorithm_t), (unsigned)sizeof(Algorithm));
+    }
+    else
+    {
+        printf("%-24s %12u %12.2f %12.2f %8.2fx %8u %8u\n", name, iterations, c_ns, cpp_ns, c_ns / cpp_ns,
+               (unsigned)sizeof(sgp41_gas_index_algorithm_t), (unsigned)sizeof(Algorithm));
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    bool json = false;
+    bool check = false;
+    uint32_t iterations = 1000000;
+    const char short_options[] = "hjc";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"json", no_argument, NULL, 'j'},
+        {"check", no_argument, NULL, 'c'},
+        {"iterations", required_argument, NULL, 1},
+        {NULL, 0, NULL, 0},
+    };
+    uint32_t i;
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'j' :
+            {
+                json = true;
+
+                break;
+            }
+            case 'c' :
+            {
+                check = true;
+
+                break;
+            }
+            case 1 :
+            {
+                iterations = (uint32_t)atol(optarg);
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_cpp [-j | --json] [--iterations=<num>]\n");
+                printf("  sgp41_bench_cpp (-c | --check)\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -c, --check                             Check the c++ output is identical to the c output.\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("      --iterations=<num>                  Set the iterations of every case.([default: 1000000])\n");
+                printf("  -j, --json                              Print the results as json.\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    if ((iterations == 0) && !check)
+    {
+        return 1;
+    }
+
+    /* identity check */
+    if (check)
+    {
+        return (a_bench_check_all() == 0) ? 0 : 1;
+    }
+
+    /* timing */
+    srand(0x5347);
+    for (i = 0; i < BENCH_TRACE_LEN; i++)
+    {
+        gs_voc_trace[i] = a_bench_sraw(i, false);
+        gs_nox_trace[i] = a_bench_sraw(i, true);
+    }
+    if (json)
+    {
+        printf("{\n  \"benchmark\": \"sgp41_cpp\",\n  \"results\": [");
+    }
+    else
+    {
+        printf("%-24s %12s %12s %12s %9s %8s %8s\n", "case", "iterations", "c ns/op", "c++ ns/op", "speedup", "c bytes", "c++ bytes");
+    }
+    a_bench_compare<sgp41::voc_algorithm>("algorithm_process_voc", SGP41_ALGORITHM_TYPE_VOC, gs_voc_trace, iterations, json, true);
+    a_bench_compare<sgp41::nox_algorithm>("algorithm_process_nox", SGP41_ALGORITHM_TYPE_NOX, gs_nox_trace, iterations, json, false);
+    if (json)
+    {
+        printf("\n  ]\n}\n");
+    }
+
+    return 0;
+}
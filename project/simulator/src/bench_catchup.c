@@ -0,0 +1,418 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench_catchup.c
+ * @brief     sgp41 catchup benchmark
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_sgp41_catchup.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief bench backlog structure definition
+ */
+typedef struct bench_backlog_s
+{
+    uint32_t devices;                               /**< device number */
+    uint32_t samples;                               /**< samples per device */
+    int32_t *sraw;                                  /**< sraw of every job, voc then nox per device */
+    int32_t *reference;                             /**< per sample indices */
+    int32_t *index;                                 /**< indices under test */
+    sgp41_gas_index_algorithm_t *start;             /**< states at the outage */
+    sgp41_gas_index_algorithm_t *expect;            /**< per sample states after the backlog */
+    sgp41_gas_index_algorithm_t *state;             /**< states under test */
+    sgp41_catchup_job_t *job;                       /**< one job per device */
+} bench_backlog_t;
+
+static bench_backlog_t gs_backlog;        /**< backlog */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_bench_now_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     sraw of one sample
+ * @param[in] job job index
+ * @param[in] t sample time in s
+ * @return    sraw
+ * @note      a daily cycle with a per device offset and some noise
+ */
+static int32_t a_bench_sraw(uint32_t job, uint32_t t)
+{
+    int32_t base = ((job & 1) != 0) ? 16000 : 27000;
+    uint32_t noise = (t * 2654435761U + job * 40503U) >> 27;
+
+    return base + (int32_t)((job / 2) % 97) * 10 + (int32_t)((t % 86400) / 144) + (int32_t)noise;
+}
+
+/**
+ * @brief  build the backlog
+ * @return status code
+ *         - 0 success
+ *         - 1 no memory
+ * @note   every state learns one hour before the outage, the backlog follows it
+ */
+static uint8_t a_bench_setup(void)
+{
+    uint32_t jobs = gs_backlog.devices * 2;
+    uint32_t i;
+    uint32_t t;
+    int32_t index;
+
+    gs_backlog.sraw = malloc(sizeof(int32_t) * jobs * gs_backlog.samples);
+    gs_backlog.reference = malloc(sizeof(int32_t) * jobs * gs_backlog.samples);
+    gs_backlog.index = malloc(sizeof(int32_t) * jobs * gs_backlog.samples);
+    gs_backlog.start = malloc(sizeof(sgp41_gas_index_algorithm_t) * jobs);
+    gs_backlog.expect = malloc(sizeof(sgp41_gas_index_algorithm_t) * jobs);
+    gs_backlog.state = malloc(sizeof(sgp41_gas_index_algorithm_t) * jobs);
+    gs_backlog.job = malloc(sizeof(sgp41_catchup_job_t) * gs_backlog.devices);
+    if ((gs_backlog.sraw == NULL) || (gs_backlog.reference == NULL) || (gs_backlog.index == NULL) ||
+        (gs_backlog.start == NULL) || (gs_backlog.expect == NULL) || (gs_backlog.state == NULL) ||
+        (gs_backlog.job == NULL))
+    {
+        return 1;
+    }
+    for (i = 0; i < jobs; i++)
+    {
+        sgp41_algorithm_init(&gs_backlog.start[i], (int32_t)(i & 1));
+        for (t = 0; t < 3600; t++)
+        {
+            sgp41_algorithm_process(&gs_backlog.start[i], a_bench_sraw(i, t), &index);
+        }
+        for (t = 0; t < gs_backlog.samples; t++)
+        {
+            gs_backlog.sraw[(size_t)i * gs_backlog.samples + t] = a_bench_sraw(i, 3600 + t);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  free the backlog
+ * @note   none
+ */
+static void a_bench_free(void)
+{
+    free(gs_backlog.sraw);
+    free(gs_backlog.reference);
+    free(gs_backlog.index);
+    free(gs_backlog.start);
+    free(gs_backlog.expect);
+    free(gs_backlog.state);
+    free(gs_backlog.job);
+}
+
+/**
+ * @brief     per sample path
+ * @param[in] *state pointer to the states
+ * @param[in] *out pointer to an index buffer
+ * @note      one sgp41_algorithm_process call per sample, voc and nox of a device interleaved
+ *            like a live stream
+ */
+static void a_bench_per_sample(sgp41_gas_index_algorithm_t *state, int32_t *out)
+{
+    uint32_t d;
+    uint32_t t;
+
+    for (d = 0; d < gs_backlog.devices; d++)
+    {
+        const int32_t *voc = &gs_backlog.sraw[(size_t)(2 * d) * gs_backlog.samples];
+        const int32_t *nox = &gs_backlog.sraw[(size_t)(2 * d + 1) * gs_backlog.samples];
+        int32_t *voc_out = &out[(size_t)(2 * d) * gs_backlog.samples];
+        int32_t *nox_out = &out[(size_t)(2 * d + 1) * gs_backlog.samples];
+
+        for (t = 0; t < gs_backlog.samples; t++)
+        {
+            sgp41_algorithm_process(&state[2 * d], voc[t], &voc_out[t]);
+            sgp41_algorithm_process(&state[2 * d + 1], nox[t], &nox_out[t]);
+        }
+    }
+}
+
+/**
+ * @brief  compare the results with the per sample path
+ * @return error count
+ * @note   indices and states must be identical
+ */
+static uint32_t a_bench_compare(void)
+{
+    uint32_t jobs = gs_backlog.devices * 2;
+    uint32_t errors = 0;
+
+    if (memcmp(gs_backlog.index, gs_backlog.reference, sizeof(int32_t) * jobs * gs_backlog.samples) != 0)
+    {
+        errors++;
+    }
+    if (memcmp(gs_backlog.state, gs_backlog.expect, sizeof(sgp41_gas_index_algorithm_t) * jobs) != 0)
+    {
+        errors++;
+    }
+
+    return errors;
+}
+
+/**
+ * @brief     print one row
+ * @param[in] *name pointer to a case name
+ * @param[in] workers worker number
+ * @param[in] samples processed samples, a voc and nox pair is one sample
+ * @param[in] elapsed_us wall time
+ * @param[in] busy_us cpu time of all workers
+ * @note      none
+ */
+static void a_bench_print(const char *name, uint32_t workers, uint64_t samples, uint64_t elapsed_us, uint64_t busy_us)
+{
+    printf("%-12s %8u %12llu %10.1f %14.0f %16.0f\n", name, workers, (unsigned long long)samples, (double)elapsed_us / 1000.0,
+           (double)samples * 1000000.0 / (double)elapsed_us, (double)samples * 1000000.0 / (double)busy_us);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    static sgp41_catchup_t service;
+    sgp41_catchup_stats_t stats;
+    int c;
+    int longindex = 0;
+    uint8_t check = 0;
+    uint32_t hours = 6;
+    uint32_t errors = 0;
+    uint32_t jobs;
+    uint32_t workers;
+    uint32_t cores;
+    uint32_t i;
+    uint64_t start;
+    uint64_t elapsed;
+    const char short_options[] = "hc";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"check", no_argument, NULL, 'c'},
+        {"devices", required_argument, NULL, 1},
+        {"hours", required_argument, NULL, 2},
+        {NULL, 0, NULL, 0},
+    };
+
+    gs_backlog.devices = 64;
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'c' :
+            {
+                check = 1;
+
+                break;
+            }
+            case 1 :
+            {
+                gs_backlog.devices = (uint32_t)atol(optarg);
+
+                break;
+            }
+            case 2 :
+            {
+                hours = (uint32_t)atol(optarg);
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_catchup [--devices=<num>] [--hours=<num>]\n");
+                printf("  sgp41_bench_catchup (-c | --check)\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -c, --check                             Check the run and the worker results against the per sample path.\n");
+                printf("      --devices=<num>                     Set the device number.([default: 64])\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("      --hours=<num>                       Set the backlog of every device in hours.([default: 6])\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    if (check != 0)
+    {
+        gs_backlog.devices = 12;
+        hours = 1;
+    }
+    if ((gs_backlog.devices == 0) || (gs_backlog.devices > 4096) || (hours == 0) || (hours > 48))
+    {
+        printf("sgp41_bench_catchup: devices must be 1 to 4096 and hours 1 to 48.\n");
+
+        return 1;
+    }
+    gs_backlog.samples = hours * 3600;
+    jobs = gs_backlog.devices * 2;
+    if (a_bench_setup() != 0)
+    {
+        printf("sgp41_bench_catchup: no memory.\n");
+        a_bench_free();
+
+        return 1;
+    }
+
+    printf("%-12s %8s %12s %10s %14s %16s\n", "case", "workers", "samples", "ms", "samples/s", "samples/s/core");
+
+    /* per sample reference */
+    memcpy(gs_backlog.expect, gs_backlog.start, sizeof(sgp41_gas_index_algorithm_t) * jobs);
+    start = a_bench_now_us();
+    a_bench_per_sample(gs_backlog.expect, gs_backlog.reference);
+    elapsed = a_bench_now_us() - start;
+    a_bench_print("per_sample", 1, (uint64_t)gs_backlog.devices * gs_backlog.samples, elapsed, elapsed);
+
+    /* voc and nox runs one after the other on this thread */
+    memcpy(gs_backlog.state, gs_backlog.start, sizeof(sgp41_gas_index_algorithm_t) * jobs);
+    start = a_bench_now_us();
+    for (i = 0; i < jobs; i++)
+    {
+        sgp41_algorithm_process_run(&gs_backlog.state[i], &gs_backlog.sraw[(size_t)i * gs_backlog.samples],
+                                    gs_backlog.samples, &gs_backlog.index[(size_t)i * gs_backlog.samples]);
+    }
+    elapsed = a_bench_now_us() - start;
+    a_bench_print("run", 1, (uint64_t)gs_backlog.devices * gs_backlog.samples, elapsed, elapsed);
+    if (a_bench_compare() != 0)
+    {
+        printf("sgp41_bench_catchup: run differs from the per sample path.\n");
+        errors++;
+    }
+
+    /* voc and nox of a device stepped in turn on this thread */
+    memcpy(gs_backlog.state, gs_backlog.start, sizeof(sgp41_gas_index_algorithm_t) * jobs);
+    memset(gs_backlog.index, 0, sizeof(int32_t) * jobs * gs_backlog.samples);
+    start = a_bench_now_us();
+    for (i = 0; i < gs_backlog.devices; i++)
+    {
+        sgp41_algorithm_process_run_pair(&gs_backlog.state[2 * i], &gs_backlog.state[2 * i + 1],
+                                         &gs_backlog.sraw[(size_t)(2 * i) * gs_backlog.samples],
+                                         &gs_backlog.sraw[(size_t)(2 * i + 1) * gs_backlog.samples], gs_backlog.samples,
+                                         &gs_backlog.index[(size_t)(2 * i) * gs_backlog.samples],
+                                         &gs_backlog.index[(size_t)(2 * i + 1) * gs_backlog.samples]);
+    }
+    elapsed = a_bench_now_us() - start;
+    a_bench_print("run_pair", 1, (uint64_t)gs_backlog.devices * gs_backlog.samples, elapsed, elapsed);
+    if (a_bench_compare() != 0)
+    {
+        printf("sgp41_bench_catchup: run_pair differs from the per sample path.\n");
+        errors++;
+    }
+
+    /* the worker pool, 1, 2, 4 ... up to one worker per core */
+    cores = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    if ((cores < 1) || (cores > SGP41_CATCHUP_MAX_WORKERS))
+    {
+        cores = (cores < 1) ? 1 : SGP41_CATCHUP_MAX_WORKERS;
+    }
+    for (workers = 1; workers <= cores; workers = (workers * 2 > cores && workers != cores) ? cores : workers * 2)
+    {
+        if (sgp41_catchup_init(&service, workers) != 0)
+        {
+            printf("sgp41_bench_catchup: init failed.\n");
+            errors++;
+
+            break;
+        }
+        memcpy(gs_backlog.state, gs_backlog.start, sizeof(sgp41_gas_index_algorithm_t) * jobs);
+        memset(gs_backlog.index, 0, sizeof(int32_t) * jobs * gs_backlog.samples);
+        for (i = 0; i < gs_backlog.devices; i++)
+        {
+            gs_backlog.job[i].voc = &gs_backlog.state[2 * i];
+            gs_backlog.job[i].nox = &gs_backlog.state[2 * i + 1];
+            gs_backlog.job[i].sraw_voc = &gs_backlog.sraw[(size_t)(2 * i) * gs_backlog.samples];
+            gs_backlog.job[i].sraw_nox = &gs_backlog.sraw[(size_t)(2 * i + 1) * gs_backlog.samples];
+            gs_backlog.job[i].voc_index = &gs_backlog.index[(size_t)(2 * i) * gs_backlog.samples];
+            gs_backlog.job[i].nox_index = &gs_backlog.index[(size_t)(2 * i + 1) * gs_backlog.samples];
+            gs_backlog.job[i].count = gs_backlog.samples - (i % 7) * 60;
+        }
+        if (sgp41_catchup_run(&service, gs_backlog.job, gs_backlog.devices) != 0)
+        {
+            printf("sgp41_bench_catchup: run failed.\n");
+            errors++;
+        }
+        (void)sgp41_catchup_get_stats(&service, &stats);
+        (void)sgp41_catchup_deinit(&service);
+        a_bench_print("pool", workers, stats.samples, stats.elapsed_us, stats.busy_us);
+
+        /* the uneven jobs stop early, finish them on this thread before comparing */
+        for (i = 0; i < gs_backlog.devices; i++)
+        {
+            uint32_t done = gs_backlog.job[i].count;
+
+            sgp41_algorithm_process_run_pair(gs_backlog.job[i].voc, gs_backlog.job[i].nox,
+                                             &gs_backlog.job[i].sraw_voc[done], &gs_backlog.job[i].sraw_nox[done],
+                                             gs_backlog.samples - done, &gs_backlog.job[i].voc_index[done],
+                                             &gs_backlog.job[i].nox_index[done]);
+        }
+        if (a_bench_compare() != 0)
+        {
+            printf("sgp41_bench_catchup: %u workers differ from the per sample path.\n", workers);
+            errors++;
+        }
+        if (workers == cores)
+        {
+            break;
+        }
+    }
+    if (check != 0)
+    {
+        printf("sgp41_bench_catchup: check %u errors.\n", errors);
+    }
+    a_bench_free();
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,662 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench_compress.c
+ * @brief     bench compress source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_algorithm.h"
+#include "driver_sgp41_compress.h"
+#include "driver_sgp41_trace.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_REPEATS              5               /**< timed runs per series, the median is reported */
+#define BENCH_SYNTHETIC_SAMPLES    86400           /**< one day of 1 s samples */
+#define BENCH_LINE_SIZE            128             /**< csv line buffer */
+#define BENCH_MEASURE_RAW          0x2619U         /**< measure raw command of the recordings */
+
+/**
+ * @brief bench trace structure definition
+ */
+typedef struct bench_trace_s
+{
+    uint32_t *timestamp;        /**< timestamps in s */
+    int32_t *voc_sraw;          /**< voc sraw */
+    int32_t *nox_sraw;          /**< nox sraw */
+    int32_t *voc_index;         /**< voc index */
+    int32_t *nox_index;         /**< nox index */
+    uint32_t count;             /**< sample number */
+    uint32_t size;              /**< allocated sample number */
+    uint8_t nox;                /**< the trace has nox sraw */
+} bench_trace_t;
+
+/**
+ * @brief bench result structure definition
+ */
+typedef struct bench_result_s
+{
+    uint32_t bytes;                    /**< stream length */
+    uint32_t blocks;                   /**< block number */
+    double bits_per_sample;            /**< stream bits per sample */
+    double encode_msamples;            /**< median encode rate in Msamples/s */
+    double decode_msamples;            /**< median decode rate in Msamples/s */
+} bench_result_t;
+
+static bench_trace_t gs_trace;        /**< trace */
+static uint8_t *gs_stream;            /**< stream buffer */
+static uint32_t gs_stream_size;       /**< stream buffer size */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     append a sample to the trace
+ * @param[in] timestamp timestamp in s
+ * @param[in] voc voc sraw
+ * @param[in] nox nox sraw
+ * @return    status code
+ *            - 0 success
+ *            - 1 out of memory or out of order
+ * @note      none
+ */
+static uint8_t a_bench_append(uint32_t timestamp, int32_t voc, int32_t nox)
+{
+    bench_trace_t *t = &gs_trace;
+
+    if ((t->count != 0) && (timestamp < t->timestamp[t->count - 1]))
+    {
+        fprintf(stderr, "sgp41_bench_compress: timestamp %u is out of order.\n", (unsigned)timestamp);
+
+        return 1;
+    }
+    if (t->count == t->size)
+    {
+        uint32_t size = (t->size != 0) ? t->size * 2 : 4096;
+        uint32_t *ts = (uint32_t *)realloc(t->timestamp, size * sizeof(uint32_t));
+        int32_t *v = (int32_t *)realloc(t->voc_sraw, size * sizeof(int32_t));
+        int32_t *n = (int32_t *)realloc(t->nox_sraw, size * sizeof(int32_t));
+
+        if (ts != NULL)
+        {
+            t->timestamp = ts;
+        }
+        if (v != NULL)
+        {
+            t->voc_sraw = v;
+        }
+        if (n != NULL)
+        {
+            t->nox_sraw = n;
+        }
+        if ((ts == NULL) || (v == NULL) || (n == NULL))
+        {
+            return 1;
+        }
+        t->size = size;
+    }
+    t->timestamp[t->count] = timestamp;
+    t->voc_sraw[t->count] = voc;
+    t->nox_sraw[t->count] = nox;
+    t->count++;
+
+    return 0;
+}
+
+/**
+ * @brief  build a one day trace
+ * @return status code
+ *         - 0 success
+ *         - 1 out of memory
+ * @note   voc sraw with a slow drift, sensor noise and a few events and a
+ *         few missed samples, the trace of the compress test
+ */
+static uint8_t a_bench_synthetic(void)
+{
+    uint32_t t;
+    uint32_t i;
+
+    srand(0x5347);
+    t = 1700000000U;
+    for (i = 0; i < BENCH_SYNTHETIC_SAMPLES; i++)
+    {
+        int32_t sraw;
+
+        sraw = 30000 + (int32_t)((i % 43200U) / 80U) - 270;
+        sraw += (int32_t)(rand() % 21) - 10;
+        if ((i % 7200U) < 300U)
+        {
+            sraw -= (int32_t)((i % 7200U) * 10U);
+        }
+        if (a_bench_append(t, sraw, 0) != 0)
+        {
+            return 1;
+        }
+        t += ((rand() % 1000) == 0) ? 2U : 1U;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     load a csv file
+ * @param[in] *f pointer to an open file
+ * @return    status code
+ *            - 0 success
+ *            - 1 load failed
+ * @note      one sample per line, "sraw_voc", "timestamp,sraw_voc" or
+ *            "timestamp,sraw_voc,sraw_nox" with the timestamp in s,
+ *            lines that do not start with a number are skipped
+ */
+static uint8_t a_bench_load_csv(FILE *f)
+{
+    char line[BENCH_LINE_SIZE];
+    unsigned long a;
+    long b;
+    long c;
+    int n;
+    int columns = 0;
+
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        n = sscanf(line, "%lu , %ld , %ld", &a, &b, &c);
+        if (n <= 0)
+        {
+            continue;
+        }
+        if (columns == 0)
+        {
+            columns = n;
+            gs_trace.nox = (uint8_t)(columns == 3);
+        }
+        if (n != columns)
+        {
+            fprintf(stderr, "sgp41_bench_compress: line %u has %d columns, not %d.\n",
+                    (unsigned)(gs_trace.count + 1), n, columns);
+
+            return 1;
+        }
+        if (((n == 1) && (a_bench_append(gs_trace.count, (int32_t)a, 0) != 0)) ||
+            ((n == 2) && (a_bench_append((uint32_t)a, (int32_t)b, 0) != 0)) ||
+            ((n == 3) && (a_bench_append((uint32_t)a, (int32_t)b, (int32_t)c) != 0)))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      take a varint of a recording
+ * @param[in]  *data pointer to a recording
+ * @param[in]  size recording length
+ * @param[in]  *pos pointer to the position
+ * @param[out] *value pointer to a value
+ * @return     status code
+ *             - 0 success
+ *             - 1 truncated recording
+ * @note       none
+ */
+static uint8_t a_bench_varint(const uint8_t *data, uint32_t size, uint32_t *pos, uint64_t *value)
+{
+    uint8_t shift = 0;
+
+    *value = 0;
+    while ((*pos < size) && (shift < 64))
+    {
+        uint8_t byte = data[(*pos)++];
+
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return 0;
+        }
+        shift += 7;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief     load a transaction recording
+ * @param[in] *data pointer to a recording
+ * @param[in] size recording length
+ * @return    status code
+ *            - 0 success
+ *            - 1 load failed
+ * @note      every good 6 byte read after a measure raw write is a sample,
+ *            the timestamp is the record time in s since the recording start
+ */
+static uint8_t a_bench_load_recording(const uint8_t *data, uint32_t size)
+{
+    uint32_t pos = SGP41_TRACE_HEADER_SIZE;
+    uint64_t now_us = 0;
+    uint8_t measure = 0;
+
+    gs_trace.nox = 1;
+    while (pos < size)
+    {
+        uint8_t tag = data[pos++];
+        uint8_t type = tag & 0x07;
+        uint8_t failed = (uint8_t)((tag & 0x80) != 0);
+        uint64_t dt;
+        uint64_t len;
+
+        if (a_bench_varint(data, size, &pos, &dt) != 0)
+        {
+            return 1;
+        }
+        now_us += dt;
+        if ((type == SGP41_TRACE_TYPE_WRITE) || (type == SGP41_TRACE_TYPE_READ))
+        {
+            const uint8_t *d;
+
+            pos++;
+            if ((a_bench_varint(data, size, &pos, &len) != 0) || (pos > size))
+            {
+                return 1;
+            }
+            if ((type == SGP41_TRACE_TYPE_READ) && (failed != 0))
+            {
+                len = 0;
+            }
+            if (len > size - pos)
+            {
+                return 1;
+            }
+            d = &data[pos];
+            pos += (uint32_t)len;
+            if (type == SGP41_TRACE_TYPE_WRITE)
+            {
+                measure = (uint8_t)((failed == 0) && (len >= 2) && ((((uint16_t)d[0] << 8) | d[1]) == BENCH_MEASURE_RAW));
+            }
+            else if ((measure != 0) && (failed == 0) && (len == 6))
+            {
+                if (a_bench_append((uint32_t)(now_us / 1000000ULL),
+                                   (int32_t)(((uint16_t)d[0] << 8) | d[1]),
+                                   (int32_t)(((uint16_t)d[3] << 8) | d[4])) != 0)
+                {
+                    return 1;
+                }
+                measure = 0;
+            }
+            else
+            {
+                measure = 0;
+            }
+        }
+        else if (type == SGP41_TRACE_TYPE_DELAY)
+        {
+            if (a_bench_varint(data, size, &pos, &len) != 0)
+            {
+                return 1;
+            }
+        }
+        else if ((type != SGP41_TRACE_TYPE_INIT) && (type != SGP41_TRACE_TYPE_DEINIT))
+        {
+            fprintf(stderr, "sgp41_bench_compress: unknown record type %u.\n", (unsigned)type);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     load a trace file
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 load failed
+ * @note      a file with the sgp41_trace header is a recording, any other a csv
+ */
+static uint8_t a_bench_load(const char *path)
+{
+    FILE *f;
+    uint8_t header[SGP41_TRACE_HEADER_SIZE];
+    uint8_t res;
+
+    f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        fprintf(stderr, "sgp41_bench_compress: open %s failed.\n", path);
+
+        return 1;
+    }
+    if ((fread(header, 1, sizeof(header), f) == sizeof(header)) &&
+        (header[0] == 'S') && (header[1] == 'G') && (header[2] == 'T') && (header[3] == 0x01))
+    {
+        uint8_t *data;
+        long size;
+
+        (void)fseek(f, 0, SEEK_END);
+        size = ftell(f);
+        data = (uint8_t *)malloc((size_t)size);
+        (void)fseek(f, 0, SEEK_SET);
+        if ((data == NULL) || (fread(data, 1, (size_t)size, f) != (size_t)size))
+        {
+            free(data);
+            (void)fclose(f);
+
+            return 1;
+        }
+        res = a_bench_load_recording(data, (uint32_t)size);
+        free(data);
+    }
+    else
+    {
+        (void)fseek(f, 0, SEEK_SET);
+        res = a_bench_load_csv(f);
+    }
+    (void)fclose(f);
+
+    return res;
+}
+
+/**
+ * @brief  run the gas index algorithm over the trace
+ * @return status code
+ *         - 0 success
+ *         - 1 out of memory
+ * @note   the index series of a recorded trace are the ones the node would store
+ */
+static uint8_t a_bench_index(void)
+{
+    sgp41_gas_index_algorithm_t voc;
+    sgp41_gas_index_algorithm_t nox;
+    uint32_t i;
+
+    gs_trace.voc_index = (int32_t *)malloc(gs_trace.count * sizeof(int32_t));
+    gs_trace.nox_index = (int32_t *)malloc(gs_trace.count * sizeof(int32_t));
+    if ((gs_trace.voc_index == NULL) || (gs_trace.nox_index == NULL))
+    {
+        return 1;
+    }
+    sgp41_algorithm_init(&voc, SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&nox, SGP41_ALGORITHM_TYPE_NOX);
+    for (i = 0; i < gs_trace.count; i++)
+    {
+        sgp41_algorithm_process(&voc, gs_trace.voc_sraw[i], &gs_trace.voc_index[i]);
+        sgp41_algorithm_process(&nox, gs_trace.nox_sraw[i], &gs_trace.nox_index[i]);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     sort the timed runs
+ * @param[in] *ns pointer to the run times
+ * @return    median
+ * @note      none
+ */
+static double a_bench_median(double *ns)
+{
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 1; i < BENCH_REPEATS; i++)
+    {
+        for (j = i; (j > 0) && (ns[j - 1] > ns[j]); j--)
+        {
+            double t = ns[j];
+
+            ns[j] = ns[j - 1];
+            ns[j - 1] = t;
+        }
+    }
+
+    return ns[BENCH_REPEATS / 2];
+}
+
+/**
+ * @brief      compress one series
+ * @param[in]  *name pointer to a series name
+ * @param[in]  *value pointer to a series buffer
+ * @param[out] *result pointer to a bench result structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 encode failed or the round trip differs
+ * @note       none
+ */
+static uint8_t a_bench_series(const char *name, const int32_t *value, bench_result_t *result)
+{
+    sgp41_compress_encoder_t encoder;
+    sgp41_compress_decoder_t decoder;
+    double encode_ns[BENCH_REPEATS];
+    double decode_ns[BENCH_REPEATS];
+    uint32_t n = gs_trace.count;
+    uint32_t len = 0;
+    uint32_t r;
+    uint32_t i;
+    uint32_t ts;
+    int32_t v;
+
+    for (r = 0; r < BENCH_REPEATS; r++)
+    {
+        uint64_t start;
+        uint32_t errors = 0;
+
+        start = a_bench_now_ns();
+        (void)sgp41_compress_encoder_init(&encoder, gs_stream, gs_stream_size, 0);
+        for (i = 0; i < n; i++)
+        {
+            errors += sgp41_compress_encoder_append(&encoder, gs_trace.timestamp[i], value[i]);
+        }
+        (void)sgp41_compress_encoder_finish(&encoder, &len);
+        encode_ns[r] = (double)(a_bench_now_ns() - start);
+        if (errors != 0)
+        {
+            fprintf(stderr, "sgp41_bench_compress: %s encode failed.\n", name);
+
+            return 1;
+        }
+
+        start = a_bench_now_ns();
+        (void)sgp41_compress_decoder_init(&decoder, gs_stream, len);
+        for (i = 0; i < n; i++)
+        {
+            errors += sgp41_compress_decoder_next(&decoder, &ts, &v);
+            errors += (uint32_t)((ts != gs_trace.timestamp[i]) || (v != value[i]));
+        }
+        decode_ns[r] = (double)(a_bench_now_ns() - start);
+        if (errors != 0)
+        {
+            fprintf(stderr, "sgp41_bench_compress: %s round trip differs.\n", name);
+
+            return 1;
+        }
+    }
+    result->bytes = len;
+    result->blocks = encoder.blocks;
+    result->bits_per_sample = (double)len * 8.0 / (double)n;
+    result->encode_msamples = (double)n * 1000.0 / a_bench_median(encode_ns);
+    result->decode_msamples = (double)n * 1000.0 / a_bench_median(decode_ns);
+
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint8_t json = 0;
+    const char *path = NULL;
+    const char short_options[] = "hj";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"json", no_argument, NULL, 'j'},
+        {"trace", required_argument, NULL, 1},
+        {NULL, 0, NULL, 0},
+    };
+    const char *names[4] = {"voc_sraw", "voc_index", "nox_sraw", "nox_index"};
+    const int32_t *series[4];
+    uint32_t count;
+    uint32_t i;
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'j' :
+            {
+                json = 1;
+
+                break;
+            }
+            case 1 :
+            {
+                path = optarg;
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_compress [-j | --json] [--trace=<file>]\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("  -j, --json                              Print the results as json.\n");
+                printf("      --trace=<file>                      Set a sgp41_trace recording or a csv of sraw values.([default: synthetic day])\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+
+    /* load the trace */
+    if (((path != NULL) ? a_bench_load(path) : a_bench_synthetic()) != 0)
+    {
+        fprintf(stderr, "sgp41_bench_compress: load failed.\n");
+
+        return 1;
+    }
+    if (gs_trace.count == 0)
+    {
+        fprintf(stderr, "sgp41_bench_compress: no samples.\n");
+
+        return 1;
+    }
+    if (a_bench_index() != 0)
+    {
+        return 1;
+    }
+    gs_stream_size = gs_trace.count * SGP41_COMPRESS_SAMPLE_MAX_SIZE +
+                     (gs_trace.count / SGP41_COMPRESS_DEFAULT_BLOCK_SAMPLES + 1) * SGP41_COMPRESS_BLOCK_HEADER_SIZE;
+    gs_stream = (uint8_t *)malloc(gs_stream_size);
+    if (gs_stream == NULL)
+    {
+        return 1;
+    }
+    series[0] = gs_trace.voc_sraw;
+    series[1] = gs_trace.voc_index;
+    series[2] = gs_trace.nox_sraw;
+    series[3] = gs_trace.nox_index;
+    count = (gs_trace.nox != 0) ? 4 : 2;
+
+    /* run every series */
+    if (json != 0)
+    {
+        printf("{\n  \"benchmark\": \"sgp41_compress\",\n  \"trace\": \"%s\",\n  \"samples\": %u,\n  \"seconds\": %u,\n  \"results\": [",
+               (path != NULL) ? path : "synthetic", (unsigned)gs_trace.count,
+               (unsigned)(gs_trace.timestamp[gs_trace.count - 1] - gs_trace.timestamp[0]));
+    }
+    else
+    {
+        printf("trace %s, %u samples over %u s.\n", (path != NULL) ? path : "synthetic", (unsigned)gs_trace.count,
+               (unsigned)(gs_trace.timestamp[gs_trace.count - 1] - gs_trace.timestamp[0]));
+        printf("%-10s %10s %8s %12s %16s %16s\n", "series", "bytes", "blocks", "bits/sample", "encode Msample/s", "decode Msample/s");
+    }
+    for (i = 0; i < count; i++)
+    {
+        bench_result_t result;
+
+        if (a_bench_series(names[i], series[i], &result) != 0)
+        {
+            return 1;
+        }
+        if (json != 0)
+        {
+            printf("%s\n    {\"series\": \"%s\", \"bytes\": %u, \"blocks\": %u, \"bits_per_sample\": %.3f, "
+                   "\"encode_msamples_per_s\": %.2f, \"decode_msamples_per_s\": %.2f}",
+                   (i == 0) ? "" : ",", names[i], (unsigned)result.bytes, (unsigned)result.blocks,
+                   result.bits_per_sample, result.encode_msamples, result.decode_msamples);
+        }
+        else
+        {
+            printf("%-10s %10u %8u %12.2f %16.1f %16.1f\n", names[i], (unsigned)result.bytes, (unsigned)result.blocks,
+                   result.bits_per_sample, result.encode_msamples, result.decode_msamples);
+        }
+    }
+    if (json != 0)
+    {
+        printf("\n  ]\n}\n");
+    }
+    free(gs_stream);
+    free(gs_trace.timestamp);
+    free(gs_trace.voc_sraw);
+    free(gs_trace.nox_sraw);
+    free(gs_trace.voc_index);
+    free(gs_trace.nox_index);
+
+    return 0;
+}
@@ -0,0 +1,425 @@
+#include "driver_sgp41_coroutine.hpp"
+#include "driver_sgp41_algorithm.hpp"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <memory>
+#include <time.h>
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_CONDITIONING_S        10        /**< conditioning seconds per sensor */
+#define BENCH_DEFAULT_SECONDS       60        /**< default measured seconds per sensor */
+#define BENCH_REAL_SECONDS          3         /**< measured seconds per sensor in real time mode */
+
+/**
+ * @brief bench sensor definition
+ */
+struct bench_sensor
+{
+    sgp41_handle_t handle;                 /**< driver handle */
+    sgp41::voc_algorithm voc;              /**< voc algorithm */
+    sgp41::nox_algorithm nox;              /**< nox algorithm */
+    uint32_t measurements;                 /**< good measurements */
+    uint32_t errors;                       /**< failed commands */
+    uint16_t self_test;                    /**< self test result */
+    std::array<uint16_t, 3> id;            /**< serial id */
+    int64_t late_max_ns;                   /**< max wake up lateness */
+    int64_t late_sum_ns;                   /**< wake up lateness sum */
+    int32_t voc_index;                     /**< last voc index */
+    int32_t nox_index;                     /**< last nox index */
+};
+
+static uint32_t gs_frame;                  /**< canned frame counter */
+static uint32_t gs_done;                   /**< finished sensors */
+static volatile int32_t gs_sink;           /**< keeps results alive */
+
+/**
+ * @brief     crc8 of the sensirion frames
+ * @param[in] *data pointer to a data buffer
+ * @param[in] count data length
+ * @return    crc
+ * @note      none
+ */
+static uint8_t a_bench_crc(const uint8_t *data, uint8_t count)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+    uint8_t bit;
+
+    for (i = 0; i < count; i++)
+    {
+        crc ^= data[i];
+        for (bit = 8; bit > 0; --bit)
+        {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief     put one crc protected word
+ * @param[in] *buf pointer to a frame buffer
+ * @param[in] word data word
+ * @note      none
+ */
+static void a_bench_word(uint8_t *buf, uint16_t word)
+{
+    buf[0] = (uint8_t)(word >> 8);
+    buf[1] = (uint8_t)(word & 0xFF);
+    buf[2] = a_bench_crc(buf, 2);
+}
+
+static uint8_t a_bench_iic_init(void)
+{
+    return 0;
+}
+
+static uint8_t a_bench_iic_deinit(void)
+{
+    return 0;
+}
+
+static uint8_t a_bench_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    (void)len;
+
+    return 0;
+}
+
+/**
+ * @brief     canned iic read
+ * @param[in] addr iic device address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ * @note      the answer is picked by length, 3 bytes is the self test pass
+ *            word, 6 bytes is a drifting raw pair and 9 bytes is a serial id
+ */
+static uint8_t a_bench_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint32_t n;
+
+    (void)addr;
+    n = gs_frame++;
+    if (len == 3)
+    {
+        a_bench_word(buf, 0xD400);
+    }
+    else if (len == 6)
+    {
+        a_bench_word(&buf[0], (uint16_t)(30000 + (int32_t)(n % 401U) - 200));
+        a_bench_word(&buf[3], (uint16_t)(16000 + (int32_t)(n % 101U) - 50));
+    }
+    else if (len == 9)
+    {
+        a_bench_word(&buf[0], 0x0000);
+        a_bench_word(&buf[3], 0x0415);
+        a_bench_word(&buf[6], 0x9B3C);
+    }
+    else
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  get the process cpu time
+ * @return time in ns
+ * @note   sleeping in real time mode is not counted
+ */
+static uint64_t a_bench_cpu_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void a_bench_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+static void a_bench_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     one sensor as sequential code
+ * @param[in] &queue reference to a timer queue
+ * @param[in] &s reference to a bench sensor
+ * @param[in] start first sample time
+ * @param[in] seconds measured seconds
+ * @return    task
+ * @note      conditioning, self test and serial id, then 1 hz measurements
+ */
+static sgp41::task a_bench_sensor(sgp41::timer_queue &queue, bench_sensor &s,
+                                  sgp41::timer_queue::time_point start, uint32_t seconds)
+{
+    sgp41::async_device dev(&s.handle, queue);
+    sgp41::timer_queue::time_point next = start;
+    uint32_t i;
+
+    for (i = 0; i < BENCH_CONDITIONING_S; i++)
+    {
+        sgp41::conditioning_result c = co_await dev.execute_conditioning();
+
+        s.errors += (c.status != 0) ? 1 : 0;
+        next += std::chrono::seconds(1);
+        co_await queue.sleep_until(next);
+    }
+    sgp41::self_test_result t = co_await dev.self_test();
+    s.errors += (t.status != 0) ? 1 : 0;
+    s.self_test = t.result;
+    sgp41::serial_id_result id = co_await dev.serial_id();
+    s.errors += (id.status != 0) ? 1 : 0;
+    s.id = id.id;
+    next += std::chrono::seconds(1);
+    co_await queue.sleep_until(next);
+    for (i = 0; i < seconds; i++)
+    {
+        int64_t late = std::chrono::duration_cast<std::chrono::nanoseconds>(queue.now() - next).count();
+        sgp41::measure_raw_result r;
+
+        s.late_max_ns = std::max(s.late_max_ns, late);
+        s.late_sum_ns += late;
+        r = co_await dev.measure_raw();
+        if (r.status == 0)
+        {
+            s.voc_index = s.voc.process(r.sraw_voc);
+            s.nox_index = s.nox.process(r.sraw_nox);
+            s.measurements++;
+        }
+        else
+        {
+            s.errors++;
+        }
+        next += std::chrono::seconds(1);
+        co_await queue.sleep_until(next);
+    }
+    gs_done++;
+}
+
+/**
+ * @brief     run one sensor count
+ * @param[in] sensors sensor number
+ * @param[in] seconds measured seconds per sensor
+ * @param[in] real real time mode flag
+ * @param[in] json json output flag
+ * @param[in] first first json item flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      sensor starts are spread over one second like a real fleet
+ */
+static int a_bench_run(uint32_t sensors, uint32_t seconds, bool real, bool json, bool first)
+{
+    std::unique_ptr<bench_sensor[]> s(new bench_sensor[sensors]);
+    sgp41::timer_queue queue(!real);
+    sgp41::timer_queue::time_point start;
+    uint64_t t0;
+    double cpu_ns;
+    double ns;
+    uint64_t measurements = 0;
+    uint64_t errors = 0;
+    int64_t late_max = 0;
+    int64_t late_sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < sensors; i++)
+    {
+        DRIVER_SGP41_LINK_INIT(&s[i].handle, sgp41_handle_t);
+        DRIVER_SGP41_LINK_IIC_INIT(&s[i].handle, a_bench_iic_init);
+        DRIVER_SGP41_LINK_IIC_DEINIT(&s[i].handle, a_bench_iic_deinit);
+        DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&s[i].handle, a_bench_iic_write_cmd);
+        DRIVER_SGP41_LINK_IIC_READ_COMMAND(&s[i].handle, a_bench_iic_read_cmd);
+        DRIVER_SGP41_LINK_DELAY_MS(&s[i].handle, a_bench_delay_ms);
+        DRIVER_SGP41_LINK_DEBUG_PRINT(&s[i].handle, a_bench_debug_print);
+        if (sgp41_init(&s[i].handle) != 0)
+        {
+            return 1;
+        }
+        s[i].measurements = 0;
+        s[i].errors = 0;
+        s[i].self_test = 0;
+        s[i].id = {0, 0, 0};
+        s[i].late_max_ns = 0;
+        s[i].late_sum_ns = 0;
+        s[i].voc_index = 0;
+        s[i].nox_index = 0;
+    }
+    gs_done = 0;
+    t0 = a_bench_cpu_ns();
+    start = queue.now();
+    for (i = 0; i < sensors; i++)
+    {
+        (void)a_bench_sensor(queue, s[i], start + std::chrono::microseconds((1000000ULL * i) / sensors), seconds);
+    }
+    (void)queue.run();
+    cpu_ns = (double)(a_bench_cpu_ns() - t0);
+    for (i = 0; i < sensors; i++)
+    {
+        measurements += s[i].measurements;
+        errors += s[i].errors;
+        late_max = std::max(late_max, s[i].late_max_ns);
+        late_sum += s[i].late_sum_ns;
+        if ((s[i].self_test != 0xD400) || (s[i].id[1] != 0x0415) || (s[i].id[2] != 0x9B3C))
+        {
+            errors++;
+        }
+        gs_sink = gs_sink + s[i].voc_index + s[i].nox_index;
+    }
+    if ((gs_done != sensors) || (errors != 0) || (measurements != (uint64_t)sensors * seconds))
+    {
+        fprintf(stderr, "sgp41_bench_coroutine: %u sensors, %u done, %llu errors.\n",
+                sensors, gs_done, (unsigned long long)errors);
+
+        return 1;
+    }
+
+    /* cpu time per measurement, conditioning and setup are included */
+    ns = cpu_ns / (double)measurements;
+    if (json)
+    {
+        printf("%s\n    {\"sensors\": %u, \"mode\": \"%s\", \"seconds\": %u, \"measurements\": %llu, "
+               "\"ns_per_measurement\": %.1f, \"sensors_per_core_1hz\": %.0f, \"late_mean_us\": %.1f, "
+               "\"late_max_us\": %.1f, \"sensor_bytes\": %u}",
+               first ? "" : ",", sensors, real ? "real" : "virtual", seconds, (unsigned long long)measurements,
+               ns, 1e9 / ns, (double)late_sum / (double)measurements / 1000.0,
+               (double)late_max / 1000.0, (unsigned)sizeof(bench_sensor));
+    }
+    else
+    {
+        printf("%10u %8s %8u %12llu %12.1f %14.0f %12.1f %12.1f\n", sensors, real ? "real" : "virtual",
+               seconds, (unsigned long long)measurements, ns, 1e9 / ns,
+               (double)late_sum / (double)measurements / 1000.0, (double)late_max / 1000.0);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    bool json = false;
+    bool real = false;
+    uint32_t seconds = 0;
+    uint32_t only = 0;
+    const char short_options[] = "hjr";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"json", no_argument, NULL, 'j'},
+        {"real", no_argument, NULL, 'r'},
+        {"seconds", required_argument, NULL, 1},
+        {"sensors", required_argument, NULL, 2},
+        {NULL, 0, NULL, 0},
+    };
+    const uint32_t counts[] = {1, 100, 1000, 10000};
+    bool first = true;
+    uint32_t i;
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'j' :
+            {
+                json = true;
+
+                break;
+            }
+            case 'r' :
+            {
+                real = true;
+
+                break;
+            }
+            case 1 :
+            {
+                seconds = (uint32_t)atol(optarg);
+
+                break;
+            }
+            case 2 :
+            {
+                only = (uint32_t)atol(optarg);
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_coroutine [-j | --json] [-r | --real] [--seconds=<num>] [--sensors=<num>]\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("  -j, --json                              Print the results as json.\n");
+                printf("  -r, --real                              Sleep on the steady clock and report the wake up lateness.\n");
+                printf("      --seconds=<num>                     Set the measured seconds per sensor.([default: 60, real: 3])\n");
+                printf("      --sensors=<num>                     Run only one sensor count.([default: 1, 100, 1000, 10000])\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    if (seconds == 0)
+    {
+        seconds = real ? BENCH_REAL_SECONDS : BENCH_DEFAULT_SECONDS;
+    }
+
+    if (json)
+    {
+        printf("{\"benchmarks\": [");
+    }
+    else
+    {
+        printf("%10s %8s %8s %12s %12s %14s %12s %12s\n", "sensors", "mode", "seconds", "measurements",
+               "ns/meas", "sensors/core", "late_us", "late_max_us");
+    }
+    for (i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+    {
+        if ((only != 0) && (i > 0))
+        {
+            break;
+        }
+        if (a_bench_run((only != 0) ? only : counts[i], seconds, real, json, first) != 0)
+        {
+            return 1;
+        }
+        first = false;
+    }
+    if (json)
+    {
+        printf("\n]}\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,613 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench_ingest.c
+ * @brief     sgp41 ingest benchmark
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_sgp41_ingest.h"
+#include <arpa/inet.h>
+#include <getopt.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_UDP_PORT        47341         /**< loopback port */
+#define BENCH_WINDOW          64            /**< packets in flight */
+
+/**
+ * @brief bench run structure definition
+ */
+typedef struct bench_run_s
+{
+    int fd;                                 /**< sender socket */
+    struct sockaddr_storage addr;           /**< service address */
+    socklen_t addr_len;                     /**< service address length */
+    uint32_t devices;                       /**< device number */
+    uint32_t samples;                       /**< samples per device */
+    uint32_t batch;                         /**< samples per packet */
+    uint32_t packets;                       /**< packet number */
+    uint64_t *send_us;                      /**< send time per packet */
+    uint32_t *latency_us;                   /**< send to sink time per packet */
+    uint32_t latencies;                     /**< measured packets */
+    volatile uint32_t sent;                 /**< sent packets */
+    volatile uint32_t received;             /**< received packets */
+    volatile uint32_t stop;                 /**< stop flag of the sender */
+    uint32_t send_errors;                   /**< failed sends */
+    uint8_t check;                          /**< check mode flag */
+    sgp41_gas_index_algorithm_t *voc;       /**< reference voc states */
+    sgp41_gas_index_algorithm_t *nox;       /**< reference nox states */
+    uint32_t *next;                         /**< next timestamp per device */
+    uint64_t results;                       /**< sink results */
+    uint32_t mismatches;                    /**< results that differ from the reference */
+} bench_run_t;
+
+static bench_run_t gs_run;                                        /**< active run */
+static sgp41_ingest_result_t gs_seq[SGP41_INGEST_MAX_SAMPLES];    /**< results of the sequence check */
+static uint32_t gs_seq_len;                                       /**< results of the sequence check */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   same clock as the service
+ */
+static uint64_t a_bench_now_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief     device sraw of one sample
+ * @param[in] device device index
+ * @param[in] timestamp sample time
+ * @param[in] nox nox flag
+ * @return    sraw
+ * @note      a slow drift with a per device offset
+ */
+static uint16_t a_bench_sraw(uint32_t device, uint32_t timestamp, uint8_t nox)
+{
+    uint32_t base = (nox != 0) ? 16000 : 27000;
+
+    return (uint16_t)(base + (device % 97) * 10 + (timestamp % 600) + ((timestamp / 600) % 2) * 300);
+}
+
+/**
+ * @brief     device serial id
+ * @param[in] device device index
+ * @param[out] *id pointer to an id buffer
+ * @note      none
+ */
+static void a_bench_id(uint32_t device, uint16_t id[3])
+{
+    id[0] = 0x0000;
+    id[1] = (uint16_t)(device >> 16);
+    id[2] = (uint16_t)device;
+}
+
+/**
+ * @brief     sink of the service
+ * @param[in] *result pointer to the results
+ * @param[in] count result number
+ * @return    status code
+ *            - 0 success
+ * @note      the first sample of a packet gives its latency, the check mode runs a reference state
+ */
+static uint8_t a_bench_sink(const sgp41_ingest_result_t *result, uint32_t count)
+{
+    uint64_t now = a_bench_now_us();
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint32_t device = ((uint32_t)result[i].id[1] << 16) | result[i].id[2];
+        uint32_t packet;
+        int32_t voc;
+        int32_t nox;
+
+        if (device >= gs_run.devices)
+        {
+            gs_run.mismatches++;
+
+            continue;
+        }
+        if ((result[i].timestamp % gs_run.batch) == 0)
+        {
+            packet = (result[i].timestamp / gs_run.batch) * gs_run.devices + device;
+            if ((packet < gs_run.packets) && (gs_run.latencies < gs_run.packets))
+            {
+                gs_run.latency_us[gs_run.latencies++] = (uint32_t)(now - gs_run.send_us[packet]);
+            }
+        }
+        if (gs_run.check != 0)
+        {
+            sgp41_algorithm_process(&gs_run.voc[device], a_bench_sraw(device, result[i].timestamp, 0), &voc);
+            sgp41_algorithm_process(&gs_run.nox[device], a_bench_sraw(device, result[i].timestamp, 1), &nox);
+            if ((result[i].timestamp != gs_run.next[device]) || (voc != result[i].voc_index) || (nox != result[i].nox_index))
+            {
+                if (gs_run.mismatches == 0)
+                {
+                    printf("sgp41_bench_ingest: device %u timestamp %u differs.\n", device, result[i].timestamp);
+                }
+                gs_run.mismatches++;
+            }
+            gs_run.next[device] = result[i].timestamp + 1;
+        }
+        gs_run.results++;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     sender thread
+ * @param[in] *arg unused
+ * @return    NULL
+ * @note      every round sends one packet per device, at most BENCH_WINDOW packets wait in the service
+ */
+static void *a_bench_sender(void *arg)
+{
+    static uint8_t buf[SGP41_INGEST_PACKET_MAX];
+    static uint16_t voc[SGP41_INGEST_MAX_SAMPLES];
+    static uint16_t nox[SGP41_INGEST_MAX_SAMPLES];
+    uint16_t id[3];
+    uint16_t len;
+    uint32_t timestamp;
+    uint32_t device;
+    uint32_t packet;
+    uint32_t i;
+
+    (void)arg;
+    packet = 0;
+    for (timestamp = 0; timestamp < gs_run.samples; timestamp += gs_run.batch)
+    {
+        for (device = 0; device < gs_run.devices; device++)
+        {
+            for (i = 0; i < gs_run.batch; i++)
+            {
+                voc[i] = a_bench_sraw(device, timestamp + i, 0);
+                nox[i] = a_bench_sraw(device, timestamp + i, 1);
+            }
+            a_bench_id(device, id);
+            (void)sgp41_ingest_pack(id, timestamp, voc, nox, (uint16_t)gs_run.batch, buf, &len);
+            while (packet - __atomic_load_n(&gs_run.received, __ATOMIC_ACQUIRE) >= BENCH_WINDOW)
+            {
+                if (__atomic_load_n(&gs_run.stop, __ATOMIC_ACQUIRE) != 0)
+                {
+                    return NULL;
+                }
+                (void)sched_yield();
+            }
+            gs_run.send_us[packet] = a_bench_now_us();
+            if (sendto(gs_run.fd, buf, len, 0, (struct sockaddr *)&gs_run.addr, gs_run.addr_len) != (ssize_t)len)
+            {
+                gs_run.send_errors++;
+            }
+            packet++;
+            __atomic_store_n(&gs_run.sent, packet, __ATOMIC_RELEASE);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief     compare two latencies
+ * @param[in] *a pointer to a latency
+ * @param[in] *b pointer to a latency
+ * @return    order
+ * @note      none
+ */
+static int a_bench_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     run one transport
+ * @param[in] *name pointer to a transport name
+ * @return    error count
+ * @note      prints one line
+ */
+static uint32_t a_bench_run(const char *name)
+{
+    static sgp41_ingest_t ingest;
+    sgp41_ingest_stats_t stats;
+    char address[SGP41_INGEST_ADDRESS_LEN + 8];
+    pthread_t thread;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t packets;
+    uint32_t errors;
+    uint32_t i;
+    uint8_t res;
+
+    errors = 0;
+    gs_run.sent = 0;
+    gs_run.received = 0;
+    gs_run.stop = 0;
+    gs_run.latencies = 0;
+    gs_run.send_errors = 0;
+    gs_run.results = 0;
+    gs_run.mismatches = 0;
+    memset(&gs_run.addr, 0, sizeof(gs_run.addr));
+    if (strcmp(name, "unix") == 0)
+    {
+        struct sockaddr_un *addr = (struct sockaddr_un *)&gs_run.addr;
+
+        addr->sun_family = AF_UNIX;
+        (void)snprintf(addr->sun_path, sizeof(addr->sun_path), "/tmp/sgp41_bench_ingest.%ld.sock", (long)getpid());
+        (void)snprintf(address, sizeof(address), "unix:%s", addr->sun_path);
+        gs_run.addr_len = sizeof(struct sockaddr_un);
+        gs_run.fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    }
+    else
+    {
+        struct sockaddr_in *addr = (struct sockaddr_in *)&gs_run.addr;
+
+        addr->sin_family = AF_INET;
+        addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr->sin_port = htons(BENCH_UDP_PORT);
+        (void)snprintf(address, sizeof(address), "udp:%u", BENCH_UDP_PORT);
+        gs_run.addr_len = sizeof(struct sockaddr_in);
+        gs_run.fd = socket(AF_INET, SOCK_DGRAM, 0);
+    }
+    if (gs_run.fd < 0)
+    {
+        printf("sgp41_bench_ingest: %s socket failed.\n", name);
+
+        return 1;
+    }
+    res = sgp41_ingest_init(&ingest, address, gs_run.devices, a_bench_sink);
+    if (res != 0)
+    {
+        printf("sgp41_bench_ingest: %s init returned %u.\n", address, res);
+        (void)close(gs_run.fd);
+
+        return 1;
+    }
+    for (i = 0; i < gs_run.devices; i++)
+    {
+        sgp41_algorithm_init(&gs_run.voc[i], SGP41_ALGORITHM_TYPE_VOC);
+        sgp41_algorithm_init(&gs_run.nox[i], SGP41_ALGORITHM_TYPE_NOX);
+        gs_run.next[i] = 0;
+    }
+
+    start = a_bench_now_us();
+    if (pthread_create(&thread, NULL, a_bench_sender, NULL) != 0)
+    {
+        printf("sgp41_bench_ingest: thread failed.\n");
+        (void)sgp41_ingest_deinit(&ingest);
+        (void)close(gs_run.fd);
+
+        return 1;
+    }
+
+    /* take packets until all are in or the socket stays quiet for a second */
+    while (gs_run.received < gs_run.packets)
+    {
+        if (sgp41_ingest_poll(&ingest, 1000, &packets) != 0)
+        {
+            errors++;
+
+            break;
+        }
+        if (packets == 0)
+        {
+            break;
+        }
+        __atomic_store_n(&gs_run.received, gs_run.received + packets, __ATOMIC_RELEASE);
+    }
+    elapsed = a_bench_now_us() - start;
+    __atomic_store_n(&gs_run.stop, 1, __ATOMIC_RELEASE);
+    (void)pthread_join(thread, NULL);
+    (void)sgp41_ingest_get_stats(&ingest, &stats);
+    (void)sgp41_ingest_deinit(&ingest);
+    (void)close(gs_run.fd);
+
+    qsort(gs_run.latency_us, gs_run.latencies, sizeof(uint32_t), a_bench_compare);
+    printf("%-6s %8u %8u %10llu %12.0f %8u %8u\n", name, gs_run.devices, gs_run.received,
+           (unsigned long long)stats.samples, (double)stats.samples * 1000000.0 / (double)elapsed,
+           (gs_run.latencies != 0) ? gs_run.latency_us[gs_run.latencies / 2] : 0,
+           (gs_run.latencies != 0) ? gs_run.latency_us[(gs_run.latencies * 99) / 100] : 0);
+    if (gs_run.check != 0)
+    {
+        if ((gs_run.received != gs_run.packets) || (gs_run.send_errors != 0) ||
+            (gs_run.results != (uint64_t)gs_run.devices * gs_run.samples) ||
+            (stats.bad_packets != 0) || (stats.duplicates != 0) || (stats.gaps != 0) || (stats.rejected != 0))
+        {
+            printf("sgp41_bench_ingest: %s received %u of %u packets, %llu results, %u send errors.\n",
+                   name, gs_run.received, gs_run.packets, (unsigned long long)gs_run.results, gs_run.send_errors);
+            errors++;
+        }
+        errors += gs_run.mismatches;
+    }
+
+    return errors;
+}
+
+/**
+ * @brief     sink of the sequence check
+ * @param[in] *result pointer to the results
+ * @param[in] count result number
+ * @return    status code
+ *            - 0 success
+ *            - 1 too many results
+ * @note      none
+ */
+static uint8_t a_bench_sequence_sink(const sgp41_ingest_result_t *result, uint32_t count)
+{
+    if (gs_seq_len + count > SGP41_INGEST_MAX_SAMPLES)
+    {
+        return 1;
+    }
+    memcpy(&gs_seq[gs_seq_len], result, count * sizeof(sgp41_ingest_result_t));
+    gs_seq_len += count;
+
+    return 0;
+}
+
+/**
+ * @brief     send one packet of device 0 through the service and check the indices
+ * @param[in] *ingest pointer to an sgp41 ingest structure
+ * @param[in] timestamp device time of the first sample
+ * @param[in] count sample number
+ * @param[in] elapsed step of the first sample of the reference, 0 is a nominal step
+ * @param[in] expect expected results
+ * @return    error count
+ * @note      the reference states run the same samples one by one
+ */
+static uint32_t a_bench_sequence_packet(sgp41_ingest_t *ingest, uint32_t timestamp, uint16_t count,
+                                        float elapsed, uint32_t expect)
+{
+    static uint8_t buf[SGP41_INGEST_PACKET_MAX];
+    uint16_t voc[SGP41_INGEST_MAX_SAMPLES];
+    uint16_t nox[SGP41_INGEST_MAX_SAMPLES];
+    uint16_t id[3];
+    uint16_t len;
+    uint32_t errors = 0;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        voc[i] = a_bench_sraw(0, timestamp + i, 0);
+        nox[i] = a_bench_sraw(0, timestamp + i, 1);
+    }
+    a_bench_id(0, id);
+    (void)sgp41_ingest_pack(id, timestamp, voc, nox, count, buf, &len);
+    gs_seq_len = 0;
+    if ((sgp41_ingest_process(ingest, buf, len, 0) != 0) || (sgp41_ingest_flush(ingest) != 0) || (gs_seq_len != expect))
+    {
+        return 1;
+    }
+    for (i = 0; i < expect; i++)
+    {
+        uint32_t k = count - expect + i;
+        int32_t v;
+        int32_t n;
+
+        if ((i == 0) && (elapsed > 0.0f))
+        {
+            sgp41_algorithm_process_with_elapsed(&gs_run.voc[0], voc[k], elapsed, &v);
+            sgp41_algorithm_process_with_elapsed(&gs_run.nox[0], nox[k], elapsed, &n);
+        }
+        else
+        {
+            sgp41_algorithm_process(&gs_run.voc[0], voc[k], &v);
+            sgp41_algorithm_process(&gs_run.nox[0], nox[k], &n);
+        }
+        if ((gs_seq[i].timestamp != timestamp + k) || (gs_seq[i].voc_index != v) || (gs_seq[i].nox_index != n))
+        {
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+/**
+ * @brief  check retransmits, gaps and restarts of one device
+ * @return error count
+ * @note   the packets go straight to sgp41_ingest_process
+ */
+static uint32_t a_bench_sequence(void)
+{
+    static sgp41_ingest_t ingest;
+    sgp41_ingest_stats_t stats;
+    char address[SGP41_INGEST_ADDRESS_LEN];
+    uint32_t errors;
+
+    (void)snprintf(address, sizeof(address), "unix:/tmp/sgp41_bench_ingest.%ld.seq.sock", (long)getpid());
+    if (sgp41_ingest_init(&ingest, address, 16, a_bench_sequence_sink) != 0)
+    {
+        return 1;
+    }
+    sgp41_algorithm_init(&gs_run.voc[0], SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_run.nox[0], SGP41_ALGORITHM_TYPE_NOX);
+
+    /* a retransmit, a 90 s gap, a gap of almost two hours and a restart of the device time */
+    errors = 0;
+    errors += a_bench_sequence_packet(&ingest, 0, 240, 0.0f, 240);
+    errors += a_bench_sequence_packet(&ingest, 240, 240, 0.0f, 240);
+    errors += a_bench_sequence_packet(&ingest, 480, 240, 0.0f, 240);
+    errors += a_bench_sequence_packet(&ingest, 600, 240, 0.0f, 120);
+    errors += a_bench_sequence_packet(&ingest, 930, 240, 91.0f, 240);
+    errors += a_bench_sequence_packet(&ingest, 7200, 240, 6031.0f, 240);
+    errors += a_bench_sequence_packet(&ingest, 0, 240, SGP41_ALGORITHM_MAX_GAP + 1.0f, 240);
+    errors += a_bench_sequence_packet(&ingest, 240, 240, 0.0f, 240);
+    (void)sgp41_ingest_get_stats(&ingest, &stats);
+    (void)sgp41_ingest_deinit(&ingest);
+    printf("sgp41_bench_ingest: sequence %llu duplicates, %llu gaps, %llu restarts, %u errors.\n",
+           (unsigned long long)stats.duplicates, (unsigned long long)stats.gaps,
+           (unsigned long long)stats.restarts, errors);
+    if ((stats.duplicates != 120) || (stats.gaps != 2) || (stats.restarts != 1))
+    {
+        errors++;
+    }
+
+    return errors;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint32_t errors;
+    const char short_options[] = "hc";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"check", no_argument, NULL, 'c'},
+        {"devices", required_argument, NULL, 1},
+        {"samples", required_argument, NULL, 2},
+        {"batch", required_argument, NULL, 3},
+        {NULL, 0, NULL, 0},
+    };
+
+    gs_run.devices = 1000;
+    gs_run.samples = 600;
+    gs_run.batch = 60;
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'c' :
+            {
+                gs_run.check = 1;
+
+                break;
+            }
+            case 1 :
+            {
+                gs_run.devices = (uint32_t)atol(optarg);
+
+                break;
+            }
+            case 2 :
+            {
+                gs_run.samples = (uint32_t)atol(optarg);
+
+                break;
+            }
+            case 3 :
+            {
+                gs_run.batch = (uint32_t)atol(optarg);
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_ingest [--devices=<num>] [--samples=<num>] [--batch=<num>]\n");
+                printf("  sgp41_bench_ingest (-c | --check)\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("      --batch=<num>                       Set the samples per packet.([default: 60])\n");
+                printf("  -c, --check                             Check every index against a local algorithm and fail on a lost packet.\n");
+                printf("      --devices=<num>                     Set the device number.([default: 1000])\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("      --samples=<num>                     Set the samples per device.([default: 600])\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    if (gs_run.check != 0)
+    {
+        gs_run.devices = 256;
+        gs_run.samples = 120;
+        gs_run.batch = 30;
+    }
+    if ((gs_run.devices == 0) || (gs_run.devices > 0x10000) || (gs_run.batch == 0) ||
+        (gs_run.batch > SGP41_INGEST_MAX_SAMPLES) || (gs_run.samples == 0) || ((gs_run.samples % gs_run.batch) != 0))
+    {
+        printf("sgp41_bench_ingest: samples must be a multiple of a batch of 1 to %u.\n", SGP41_INGEST_MAX_SAMPLES);
+
+        return 1;
+    }
+    gs_run.packets = gs_run.devices * (gs_run.samples / gs_run.batch);
+    gs_run.send_us = calloc(gs_run.packets, sizeof(uint64_t));
+    gs_run.latency_us = calloc(gs_run.packets, sizeof(uint32_t));
+    gs_run.voc = calloc(gs_run.devices, sizeof(sgp41_gas_index_algorithm_t));
+    gs_run.nox = calloc(gs_run.devices, sizeof(sgp41_gas_index_algorithm_t));
+    gs_run.next = calloc(gs_run.devices, sizeof(uint32_t));
+    if ((gs_run.send_us == NULL) || (gs_run.latency_us == NULL) || (gs_run.voc == NULL) ||
+        (gs_run.nox == NULL) || (gs_run.next == NULL))
+    {
+        printf("sgp41_bench_ingest: no memory.\n");
+
+        return 1;
+    }
+
+    printf("%-6s %8s %8s %10s %12s %8s %8s\n", "socket", "devices", "packets", "samples", "samples/s", "p50_us", "p99_us");
+    errors = a_bench_run("unix");
+    errors += a_bench_run("udp");
+    if (gs_run.check != 0)
+    {
+        errors += a_bench_sequence();
+        printf("sgp41_bench_ingest: check %u errors.\n", errors);
+    }
+    free(gs_run.send_us);
+    free(gs_run.latency_us);
+    free(gs_run.voc);
+    free(gs_run.nox);
+    free(gs_run.next);
+
+    return (errors == 0) ? 0 : 1;
+}
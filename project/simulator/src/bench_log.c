@@ -0,0 +1,459 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench_log.c
+ * @brief     bench log source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41.h"
+#include "driver_sgp41_log.h"
+#include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_REPEATS          5             /**< timed runs per case, the median is reported */
+#define BENCH_DRAIN            64            /**< calls between two drains of the ring */
+#define BENCH_TEXT_SIZE        128           /**< text buffer, the one of the raspberrypi4b debug_print */
+#define CHECK_CALLS            200000        /**< failed calls of the check */
+#define CHECK_BURST            128           /**< failed calls before the producer yields */
+
+/**
+ * @brief bench case structure definition
+ */
+typedef struct bench_case_s
+{
+    const char *name;                                 /**< case name */
+    void (*debug_log)(uint8_t id, uint16_t arg);      /**< point to a debug_log function address */
+    uint8_t drain;                                    /**< drain the ring, 2 also decodes */
+} bench_case_t;
+
+static sgp41_handle_t gs_handle;                  /**< sgp41 handle */
+static sgp41_log_handle_t gs_log;                 /**< log handle */
+static uint8_t gs_frame[6];                       /**< canned response frame */
+static char gs_text[BENCH_TEXT_SIZE];             /**< text buffer */
+static volatile int32_t gs_sink;                  /**< keeps results alive */
+static volatile uint8_t gs_done;                  /**< producer finished flag */
+
+/**
+ * @brief     canned transport write, accepts every frame
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_bench_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    gs_sink += buf[len - 1];
+
+    return 0;
+}
+
+/**
+ * @brief      canned transport read, returns the prepared frame
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_bench_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    memcpy(buf, gs_frame, len);
+
+    return 0;
+}
+
+/**
+ * @brief  canned transport init and deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_bench_iic_none(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     canned transport delay, never sleeps
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_bench_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_bench_now_us(void)
+{
+    return a_bench_now_ns() / 1000ULL;
+}
+
+/**
+ * @brief     no log
+ * @param[in] id message id
+ * @param[in] arg message argument
+ * @note      the driver cost alone
+ */
+static void a_bench_log_none(uint8_t id, uint16_t arg)
+{
+    gs_sink += id + arg;
+}
+
+/**
+ * @brief     formatted log
+ * @param[in] id message id
+ * @param[in] arg message argument
+ * @note      formats at the call like the text level, the terminal write is left out
+ */
+static void a_bench_log_text(uint8_t id, uint16_t arg)
+{
+    sgp41_log_record_t record;
+
+    record.time_us = 0;
+    record.id = id;
+    record.reserved = 0;
+    record.arg = arg;
+    (void)sgp41_log_decode(&record, gs_text, BENCH_TEXT_SIZE);
+    gs_sink += gs_text[7];
+}
+
+/**
+ * @brief bench case list
+ */
+static const bench_case_t gs_cases[] =
+{
+    {"none", a_bench_log_none, 0},
+    {"text", a_bench_log_text, 0},
+    {"binary", sgp41_log_write, 1},
+    {"binary_decode", sgp41_log_write, 2},
+};
+
+/**
+ * @brief     drain the ring
+ * @param[in] decode decode flag
+ * @return    records read
+ * @note      none
+ */
+static uint32_t a_bench_drain(uint8_t decode)
+{
+    sgp41_log_record_t record;
+    uint32_t count = 0;
+
+    while (sgp41_log_read(&gs_log, &record) == 0)
+    {
+        if (decode != 0)
+        {
+            (void)sgp41_log_decode(&record, gs_text, BENCH_TEXT_SIZE);
+            gs_sink += gs_text[7];
+        }
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief     run failed measurements
+ * @param[in] *c pointer to a bench case
+ * @param[in] iterations iteration number
+ * @note      every read has a bad voc crc
+ */
+static void a_bench_run(const bench_case_t *c, uint32_t iterations)
+{
+    uint32_t i;
+    uint16_t voc;
+    uint16_t nox;
+
+    for (i = 0; i < iterations; i++)
+    {
+        gs_sink += sgp41_get_measure_raw(&gs_handle, 0x8000, 0x6666, &voc, &nox);
+        if ((c->drain != 0) && ((i % BENCH_DRAIN) == (BENCH_DRAIN - 1)))
+        {
+            (void)a_bench_drain(c->drain == 2);
+        }
+    }
+    if (c->drain != 0)
+    {
+        (void)a_bench_drain(c->drain == 2);
+    }
+}
+
+/**
+ * @brief     time one case
+ * @param[in] *c pointer to a bench case
+ * @param[in] iterations iteration number
+ * @return    median ns per op
+ * @note      none
+ */
+static double a_bench_time(const bench_case_t *c, uint32_t iterations)
+{
+    double ns[BENCH_REPEATS];
+    uint32_t i;
+    uint32_t j;
+
+    gs_handle.debug_log = c->debug_log;
+    a_bench_run(c, iterations / 10 + 1);
+    for (i = 0; i < BENCH_REPEATS; i++)
+    {
+        uint64_t start = a_bench_now_ns();
+
+        a_bench_run(c, iterations);
+        ns[i] = (double)(a_bench_now_ns() - start) / (double)iterations;
+    }
+    for (i = 1; i < BENCH_REPEATS; i++)
+    {
+        for (j = i; (j > 0) && (ns[j - 1] > ns[j]); j--)
+        {
+            double t = ns[j];
+
+            ns[j] = ns[j - 1];
+            ns[j - 1] = t;
+        }
+    }
+
+    return ns[BENCH_REPEATS / 2];
+}
+
+/**
+ * @brief     check consumer thread
+ * @param[in] *arg pointer to an error counter
+ * @return    records read
+ * @note      decodes every record beside the producer
+ */
+static void *a_bench_consumer(void *arg)
+{
+    uint32_t *errors = (uint32_t *)arg;
+    sgp41_log_record_t record;
+    uint32_t count = 0;
+    uint32_t last_us = 0;
+
+    while (1)
+    {
+        uint8_t done = gs_done;
+
+        if (sgp41_log_read(&gs_log, &record) != 0)
+        {
+            if (done != 0)
+            {
+                break;
+            }
+            (void)sched_yield();
+            continue;
+        }
+        if ((sgp41_log_decode(&record, gs_text, BENCH_TEXT_SIZE) != 0) ||
+            (strcmp(gs_text, SGP41_LOG_TEXT_SRAW_VOC_CRC_ERROR) != 0) ||
+            ((count != 0) && ((int32_t)(record.time_us - last_us) < 0)))
+        {
+            (*errors)++;
+        }
+        last_us = record.time_us;
+        count++;
+    }
+
+    return (void *)(uintptr_t)count;
+}
+
+/**
+ * @brief  check the log beside a running consumer
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   every failed call must be read back once or counted as dropped,
+ *         the producer yields between bursts so one core also runs the consumer
+ */
+static uint8_t a_bench_check(void)
+{
+    pthread_t thread;
+    void *ret;
+    uint32_t errors = 0;
+    uint32_t read;
+    uint32_t i;
+    uint16_t voc;
+    uint16_t nox;
+    sgp41_log_stats_t stats;
+
+    gs_handle.debug_log = sgp41_log_write;
+    gs_done = 0;
+    if (pthread_create(&thread, NULL, a_bench_consumer, &errors) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < CHECK_CALLS; i++)
+    {
+        (void)sgp41_get_measure_raw(&gs_handle, 0x8000, 0x6666, &voc, &nox);
+        if ((i % CHECK_BURST) == (CHECK_BURST - 1))
+        {
+            (void)sched_yield();
+        }
+    }
+    gs_done = 1;
+    (void)pthread_join(thread, &ret);
+    read = (uint32_t)(uintptr_t)ret;
+    (void)sgp41_log_get_stats(&gs_log, &stats);
+    printf("sgp41_bench_log: check %u calls, %u read, %u dropped, %u errors.\n",
+           (unsigned)CHECK_CALLS, (unsigned)read, (unsigned)stats.dropped, (unsigned)errors);
+
+    return ((errors == 0) && (stats.records == read) && (read + stats.dropped == CHECK_CALLS)) ? 0 : 1;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint8_t check = 0;
+    uint32_t iterations = 1000000;
+    const char short_options[] = "hc";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"check", no_argument, NULL, 'c'},
+        {"iterations", required_argument, NULL, 1},
+        {NULL, 0, NULL, 0},
+    };
+    double none_ns = 0.0;
+    uint32_t i;
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'c' :
+            {
+                check = 1;
+
+                break;
+            }
+            case 1 :
+            {
+                iterations = (uint32_t)atol(optarg);
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_log [--iterations=<num>]\n");
+                printf("  sgp41_bench_log (-c | --check)\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -c, --check                             Check every record is read back or counted as dropped.\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("      --iterations=<num>                  Set the iterations of every case.([default: 1000000])\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    if (iterations == 0)
+    {
+        return 1;
+    }
+
+    /* a handle whose reads always fail the voc crc */
+    DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, a_bench_iic_none);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, a_bench_iic_none);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, a_bench_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, a_bench_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, a_bench_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_LOG(&gs_handle, a_bench_log_none);
+    DRIVER_SGP41_LOG_LINK_INIT(&gs_log, sgp41_log_handle_t);
+    DRIVER_SGP41_LOG_LINK_GET_TIME_US(&gs_log, a_bench_now_us);
+    if ((sgp41_init(&gs_handle) != 0) || (sgp41_log_init(&gs_log) != 0))
+    {
+        return 1;
+    }
+    memset(gs_frame, 0x55, sizeof(gs_frame));
+
+    /* check */
+    if (check != 0)
+    {
+        return a_bench_check();
+    }
+
+    /* timing */
+    printf("%-16s %12s %12s %12s\n", "case", "iterations", "ns/op", "log ns/op");
+    for (i = 0; i < sizeof(gs_cases) / sizeof(gs_cases[0]); i++)
+    {
+        double ns = a_bench_time(&gs_cases[i], iterations);
+
+        if (i == 0)
+        {
+            none_ns = ns;
+        }
+        printf("%-16s %12u %12.2f %12.2f\n", gs_cases[i].name, (unsigned)iterations, ns, ns - none_ns);
+    }
+
+    return 0;
+}
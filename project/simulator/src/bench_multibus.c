@@ -0,0 +1,404 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench_multibus.c
+ * @brief     sgp41 multibus benchmark
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_sgp41_multibus.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_SENSORS          8                 /**< sensors behind the mux of every bus */
+#define BENCH_BYTE_NS          90000             /**< one byte with its ack at 100 kHz */
+#define BENCH_MUX_ADDRESS      SGP41_MUX_ADDRESS(0)          /**< mux address on every bus */
+#define BENCH_SGP41_ADDRESS    (0x59 << 1)                   /**< sgp41 address */
+
+/**
+ * @brief fake bus structure definition
+ */
+typedef struct bench_bus_s
+{
+    uint32_t transactions;        /**< transaction count */
+    uint32_t faults;              /**< unexpected transaction count */
+} bench_bus_t;
+
+static bench_bus_t gs_bench_bus[SGP41_MULTIBUS_MAX_BUSES];        /**< fake buses */
+
+/**
+ * @brief     crc of one word
+ * @param[in] *data pointer to a word
+ * @return    crc
+ * @note      same polynomial as the chip
+ */
+static uint8_t a_bench_crc(const uint8_t *data)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < 2; i++)
+    {
+        crc ^= data[i];
+        for (j = 0; j < 8; j++)
+        {
+            crc = ((crc & 0x80) != 0) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief     hold the bus for a transfer
+ * @param[in] len data length
+ * @note      the address byte is counted too
+ */
+static void a_bench_transfer(uint16_t len)
+{
+    struct timespec ts;
+    uint64_t ns;
+
+    ns = (uint64_t)(len + 1) * BENCH_BYTE_NS;
+    ts.tv_sec = (time_t)(ns / 1000000000ULL);
+    ts.tv_nsec = (long)(ns % 1000000000ULL);
+    (void)nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_bench_now_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief      fake bus open
+ * @param[in]  *name pointer to a bus name
+ * @param[out] *fd pointer to a fd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the name is the bus index
+ */
+static uint8_t a_bench_iic_init(char *name, int *fd)
+{
+    *fd = atoi(name);
+    if ((*fd < 0) || (*fd >= SGP41_MULTIBUS_MAX_BUSES))
+    {
+        return 1;
+    }
+    memset(&gs_bench_bus[*fd], 0, sizeof(bench_bus_t));
+
+    return 0;
+}
+
+/**
+ * @brief     fake bus close
+ * @param[in] fd bus fd
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_bench_iic_deinit(int fd)
+{
+    (void)fd;
+
+    return 0;
+}
+
+/**
+ * @brief     fake bus write
+ * @param[in] fd bus fd
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      only the mux and the sensor answer
+ */
+static uint8_t a_bench_iic_write_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)buf;
+    a_bench_transfer(len);
+    gs_bench_bus[fd].transactions++;
+    if ((addr != BENCH_MUX_ADDRESS) && (addr != BENCH_SGP41_ADDRESS))
+    {
+        gs_bench_bus[fd].faults++;
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      fake bus read
+ * @param[in]  fd bus fd
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       every word is the bus number with a valid crc
+ */
+static uint8_t a_bench_iic_read_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+
+    a_bench_transfer(len);
+    gs_bench_bus[fd].transactions++;
+    if (addr != BENCH_SGP41_ADDRESS)
+    {
+        gs_bench_bus[fd].faults++;
+
+        return 1;
+    }
+    for (i = 0; i + 3 <= len; i += 3)
+    {
+        buf[i + 0] = 0x70;
+        buf[i + 1] = (uint8_t)fd;
+        buf[i + 2] = a_bench_crc(&buf[i]);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      run one bus count
+ * @param[in]  buses bus number
+ * @param[in]  ms run time in ms
+ * @param[in]  check check mode flag
+ * @param[out] *rate pointer to a samples per second buffer
+ * @return     error count
+ * @note       prints one line per bus, the stream is read while the workers run
+ */
+static uint32_t a_bench_run(uint8_t buses, uint32_t ms, uint8_t check, double *rate)
+{
+    static sgp41_multibus_t service;
+    const sgp41_multibus_ops_t ops = {a_bench_iic_init, a_bench_iic_deinit, a_bench_iic_write_cmd, a_bench_iic_read_cmd};
+    sgp41_multibus_sample_t sample;
+    sgp41_multibus_stats_t stats;
+    uint64_t start;
+    uint64_t last;
+    uint32_t errors;
+    uint32_t samples;
+    char name[4];
+    uint8_t bus;
+    uint8_t sensor;
+    uint8_t i;
+    uint8_t j;
+    uint8_t stopped;
+    uint8_t res;
+
+    errors = 0;
+    samples = 0;
+    last = 0;
+    (void)sgp41_multibus_init(&service, 0);
+    (void)sgp41_multibus_set_ops(&service, &ops);
+    for (i = 0; i < buses; i++)
+    {
+        (void)snprintf(name, sizeof(name), "%u", i);
+        (void)sgp41_multibus_add_bus(&service, name, &bus);
+        for (j = 0; j < BENCH_SENSORS; j++)
+        {
+            (void)sgp41_multibus_add_sensor(&service, bus, BENCH_MUX_ADDRESS, j, &sensor);
+        }
+    }
+    if (sgp41_multibus_start(&service, 0) != 0)
+    {
+        printf("sgp41_bench_multibus: start failed.\n");
+
+        return 1;
+    }
+    start = a_bench_now_us();
+    stopped = 0;
+
+    /* read the merged stream while the workers run, then drain it */
+    while ((res = sgp41_multibus_read(&service, &sample, 1000)) == 0)
+    {
+        if (sample.timestamp_us < last)
+        {
+            if (errors == 0)
+            {
+                printf("sgp41_bench_multibus: bus %u sensor %u out of order.\n", sample.bus, sample.sensor);
+            }
+            errors++;
+        }
+        if ((sample.status != 0) || (sample.sraw_voc != (uint16_t)(0x7000 | sample.bus)))
+        {
+            errors++;
+        }
+        last = sample.timestamp_us;
+        samples++;
+        if ((stopped == 0) && (a_bench_now_us() - start >= (uint64_t)ms * 1000ULL))
+        {
+            (void)sgp41_multibus_stop(&service);
+            stopped = 1;
+        }
+    }
+    if (res != 4)
+    {
+        printf("sgp41_bench_multibus: read returned %u.\n", res);
+        errors++;
+    }
+
+    *rate = 0.0;
+    for (i = 0; i < buses; i++)
+    {
+        (void)sgp41_multibus_get_stats(&service, i, &stats);
+        *rate += (double)stats.samples * 1000000.0 / (double)stats.elapsed_us;
+        errors += stats.errors + stats.dropped + gs_bench_bus[i].faults;
+        if (check == 0)
+        {
+            printf("%8u %6u %10llu %10llu %12.1f %10.1f\n", buses, i, (unsigned long long)stats.rounds,
+                   (unsigned long long)stats.samples,
+                   (double)stats.samples * 1000000.0 / (double)stats.elapsed_us, stats.utilization);
+        }
+    }
+    (void)sgp41_multibus_deinit(&service);
+    if (samples == 0)
+    {
+        errors++;
+    }
+
+    return errors;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint8_t check = 0;
+    uint32_t ms = 2000;
+    uint32_t errors;
+    double rate[4];
+    const uint8_t buses[4] = {1, 2, 4, 8};
+    const char short_options[] = "hc";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"check", no_argument, NULL, 'c'},
+        {"ms", required_argument, NULL, 1},
+        {NULL, 0, NULL, 0},
+    };
+    uint8_t i;
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'c' :
+            {
+                check = 1;
+
+                break;
+            }
+            case 1 :
+            {
+                ms = (uint32_t)atol(optarg);
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_multibus [--ms=<num>]\n");
+                printf("  sgp41_bench_multibus (-c | --check)\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -c, --check                             Check the merged order and the parallel scaling.\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("      --ms=<num>                          Set the run time of every bus count.([default: 2000])\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    if (ms == 0)
+    {
+        return 1;
+    }
+    if (check != 0)
+    {
+        ms = 1000;
+    }
+
+    errors = 0;
+    if (check == 0)
+    {
+        printf("%8s %6s %10s %10s %12s %10s\n", "buses", "bus", "rounds", "samples", "samples/s", "util_%");
+    }
+    for (i = 0; i < 4; i++)
+    {
+        errors += a_bench_run(buses[i], ms, check, &rate[i]);
+    }
+    printf("\n%8s %12s %10s\n", "buses", "samples/s", "scaling");
+    for (i = 0; i < 4; i++)
+    {
+        printf("%8u %12.1f %9.2fx\n", buses[i], rate[i], rate[i] / rate[0]);
+        if ((check != 0) && (rate[i] < rate[0] * 0.5 * buses[i]))
+        {
+            printf("sgp41_bench_multibus: %u buses scale %.2fx only.\n", buses[i], rate[i] / rate[0]);
+            errors++;
+        }
+    }
+    if (check != 0)
+    {
+        printf("sgp41_bench_multibus: check %u errors.\n", errors);
+    }
+
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench_profile.c
+ * @brief     bench profile source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_algorithm.h"
+#include "driver_sgp41_algorithm_profile.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_SAMPLES        (3 * 86400)        /**< three days of samples per gas */
+
+/**
+ * @brief     synthetic sraw
+ * @param[in] i sample index
+ * @param[in] nox nox flag
+ * @return    sraw
+ * @note      slow drift, noise, events and a few invalid samples
+ */
+static int32_t a_bench_sraw(uint32_t i, uint8_t nox)
+{
+    int32_t v;
+
+    if ((i % 50000U) == 49999U)
+    {
+        return 0;
+    }
+    v = (nox != 0) ? 16000 : 30000;
+    v += (int32_t)((i % 7200U) / 30U) - 120;
+    v += (rand() % 41) - 20;
+    if ((i % 5400U) < 600U)
+    {
+        v += (nox != 0) ? (int32_t)(i % 5400U) : -(int32_t)((i % 5400U) * 8U);
+    }
+
+    return v;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns, wraps every 4.29 s
+ * @note   none
+ */
+static uint32_t a_bench_clock_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+/**
+ * @brief     run one gas with the profile attached
+ * @param[in] *name pointer to a gas name
+ * @param[in] type algorithm type
+ * @param[in] *profile pointer to a profile structure
+ * @param[in] check check mode flag
+ * @return    error count
+ * @note      the check mode runs a detached state next to the profiled one and
+ *            checks the counters add up
+ */
+static uint32_t a_bench_gas(const char *name, int32_t type, sgp41_algorithm_profile_t *profile, uint8_t check)
+{
+    sgp41_gas_index_algorithm_t profiled;
+    sgp41_gas_index_algorithm_t plain;
+    sgp41_algorithm_profile_counter_t counter;
+    uint64_t sum;
+    uint32_t errors;
+    uint32_t mean;
+    uint32_t i;
+    uint8_t stage;
+
+    sgp41_algorithm_init(&profiled, type);
+    sgp41_algorithm_init(&plain, type);
+    (void)sgp41_algorithm_profile_clear(profile);
+    srand(0x5347);
+    errors = 0;
+    for (i = 0; i < BENCH_SAMPLES; i++)
+    {
+        int32_t sraw;
+        int32_t a;
+        int32_t b;
+
+        sraw = a_bench_sraw(i, (uint8_t)(type == SGP41_ALGORITHM_TYPE_NOX));
+        (void)sgp41_algorithm_profile_attach(profile);
+        sgp41_algorithm_process(&profiled, sraw, &a);
+        (void)sgp41_algorithm_profile_attach(NULL);
+        if (check != 0)
+        {
+            sgp41_algorithm_process(&plain, sraw, &b);
+            if (a != b)
+            {
+                if (errors == 0)
+                {
+                    printf("sgp41_bench_profile: %s sample %u profiled %d plain %d.\n", name, i, a, b);
+                }
+                errors++;
+            }
+        }
+    }
+
+    printf("%s, %u samples, probe overhead %u ns\n", name, BENCH_SAMPLES, profile->overhead);
+    printf("%-10s %10s %10s %10s %10s\n", "stage", "count", "min_ns", "mean_ns", "max_ns");
+    sum = 0;
+    for (stage = 0; stage < SGP41_ALGORITHM_PROFILE_COUNTERS; stage++)
+    {
+        (void)sgp41_algorithm_profile_get_counter(profile, stage, &counter, &mean);
+        printf("%-10s %10u %10u %10u %10u\n", sgp41_algorithm_profile_stage_name(stage),
+               counter.count, counter.min, mean, counter.max);
+        if (stage < SGP41_ALGORITHM_STAGE_END)
+        {
+            sum += counter.sum;
+        }
+    }
+    if (check != 0)
+    {
+        (void)sgp41_algorithm_profile_get_counter(profile, SGP41_ALGORITHM_STAGE_END, &counter, &mean);
+        if ((counter.count != BENCH_SAMPLES) || (counter.sum != sum))
+        {
+            printf("sgp41_bench_profile: %s total %u processes %llu ns, stages %llu ns.\n", name,
+                   counter.count, (unsigned long long)counter.sum, (unsigned long long)sum);
+            errors++;
+        }
+        (void)sgp41_algorithm_profile_get_counter(profile, SGP41_ALGORITHM_STAGE_INPUT, &counter, &mean);
+        if (counter.count != BENCH_SAMPLES)
+        {
+            printf("sgp41_bench_profile: %s input ran %u times.\n", name, counter.count);
+            errors++;
+        }
+        (void)sgp41_algorithm_profile_get_counter(profile, SGP41_ALGORITHM_STAGE_GAMMA, &counter, &mean);
+        if (counter.count == 0)
+        {
+            printf("sgp41_bench_profile: %s gamma never ran.\n", name);
+            errors++;
+        }
+        printf("sgp41_bench_profile: check %s %u errors.\n", name, errors);
+    }
+    printf("\n");
+
+    return errors;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint8_t check = 0;
+    uint32_t errors;
+    sgp41_algorithm_profile_t profile;
+    const char short_options[] = "hc";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"check", no_argument, NULL, 'c'},
+        {NULL, 0, NULL, 0},
+    };
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'c' :
+            {
+                check = 1;
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_profile [-c | --check]\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -c, --check                             Check the profiled output and the counters.\n");
+                printf("  -h, --help                              Show the help.\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+
+    /* init the profile on the monotonic clock */
+    if (sgp41_algorithm_profile_init(&profile, a_bench_clock_ns) != 0)
+    {
+        return 1;
+    }
+
+    /* run both gases */
+    errors = a_bench_gas("voc", SGP41_ALGORITHM_TYPE_VOC, &profile, check);
+    errors += a_bench_gas("nox", SGP41_ALGORITHM_TYPE_NOX, &profile, check);
+
+    return (errors == 0) ? 0 : 1;
+}
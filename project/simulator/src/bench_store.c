@@ -0,0 +1,379 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench_store.c
+ * @brief     sgp41 store benchmark
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_sgp41_store.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief bench param definition
+ */
+#define BENCH_HOT_SHARE        2             /**< percent of the devices that report often */
+#define BENCH_HOT_GETS         90            /**< percent of the reports from the hot devices */
+
+static uint64_t gs_seed = 0x9E3779B97F4A7C15ULL;        /**< random state */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  get a random number
+ * @return random number
+ * @note   xorshift64
+ */
+static uint32_t a_bench_random(void)
+{
+    gs_seed ^= gs_seed << 13;
+    gs_seed ^= gs_seed >> 7;
+    gs_seed ^= gs_seed << 17;
+
+    return (uint32_t)(gs_seed >> 32);
+}
+
+/**
+ * @brief     pick the next reporting device
+ * @param[in] devices device number
+ * @return    device index
+ * @note      most reports come from a small hot set, the rest from all devices
+ */
+static uint32_t a_bench_pick(uint32_t devices)
+{
+    uint32_t hot = (devices * BENCH_HOT_SHARE) / 100;
+
+    if ((hot != 0) && ((a_bench_random() % 100) < BENCH_HOT_GETS))
+    {
+        return a_bench_random() % hot;
+    }
+
+    return a_bench_random() % devices;
+}
+
+/**
+ * @brief     device serial id
+ * @param[in] device device index
+ * @param[out] *id pointer to an id buffer
+ * @note      none
+ */
+static void a_bench_id(uint32_t device, uint16_t id[3])
+{
+    id[0] = 0x0000;
+    id[1] = (uint16_t)(device >> 16);
+    id[2] = (uint16_t)device;
+}
+
+/**
+ * @brief     device sraw
+ * @param[in] device device index
+ * @param[in] step report number
+ * @param[in] nox nox flag
+ * @return    sraw
+ * @note      none
+ */
+static int32_t a_bench_sraw(uint32_t device, uint32_t step, uint8_t nox)
+{
+    return ((nox != 0) ? 16000 : 27000) + (int32_t)(device % 97) * 10 + (int32_t)(step % 1000);
+}
+
+/**
+ * @brief     run reports through the store
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] devices device number
+ * @param[in] steps report number
+ * @param[in] first first report number
+ * @param[in] *voc_ref pointer to reference voc states, NULL skips the check
+ * @param[in] *nox_ref pointer to reference nox states
+ * @return    error count
+ * @note      every report gets the states of one device and runs one voc and one nox sample
+ */
+static uint32_t a_bench_steps(sgp41_store_t *store, uint32_t devices, uint32_t steps, uint32_t first,
+                              sgp41_gas_index_algorithm_t *voc_ref, sgp41_gas_index_algorithm_t *nox_ref)
+{
+    sgp41_gas_index_algorithm_t *voc;
+    sgp41_gas_index_algorithm_t *nox;
+    uint32_t errors = 0;
+    uint32_t i;
+
+    for (i = first; i < first + steps; i++)
+    {
+        uint32_t d = a_bench_pick(devices);
+        uint16_t id[3];
+        int32_t voc_index;
+        int32_t nox_index;
+        int32_t voc_expect;
+        int32_t nox_expect;
+
+        a_bench_id(d, id);
+        if (sgp41_store_get(store, id, &voc, &nox) != 0)
+        {
+            errors++;
+
+            continue;
+        }
+        sgp41_algorithm_process(voc, a_bench_sraw(d, i, 0), &voc_index);
+        sgp41_algorithm_process(nox, a_bench_sraw(d, i, 1), &nox_index);
+        if (voc_ref != NULL)
+        {
+            sgp41_algorithm_process(&voc_ref[d], a_bench_sraw(d, i, 0), &voc_expect);
+            sgp41_algorithm_process(&nox_ref[d], a_bench_sraw(d, i, 1), &nox_expect);
+            if ((voc_index != voc_expect) || (nox_index != nox_expect))
+            {
+                if (errors == 0)
+                {
+                    printf("sgp41_bench_store: device %u report %u differs.\n", d, i);
+                }
+                errors++;
+            }
+        }
+    }
+
+    return errors;
+}
+
+/**
+ * @brief     print the statistics
+ * @param[in] *store pointer to an sgp41 store structure
+ * @param[in] devices device number
+ * @param[in] elapsed_ns run time
+ * @note      none
+ */
+static void a_bench_print(sgp41_store_t *store, uint32_t devices, uint64_t elapsed_ns)
+{
+    sgp41_store_stats_t stats;
+
+    if (sgp41_store_get_stats(store, &stats) != 0)
+    {
+        printf("sgp41_bench_store: stats failed.\n");
+
+        return;
+    }
+    printf("devices %u, cache %u, gets %llu, %.1f ns/get.\n", devices, store->cache_size,
+           (unsigned long long)stats.gets, (double)elapsed_ns / (double)stats.gets);
+    printf("hit rate %.2f%%, %llu loads, %llu creates, %llu stores, %llu evictions.\n", stats.hit_rate * 100.0,
+           (unsigned long long)stats.loads, (unsigned long long)stats.creates,
+           (unsigned long long)stats.stores, (unsigned long long)stats.evictions);
+    printf("load %.1f ns mean %llu ns max, store %.1f ns mean %llu ns max.\n",
+           (stats.loads != 0) ? (double)stats.load_ns / (double)stats.loads : 0.0, (unsigned long long)stats.load_ns_max,
+           (stats.stores != 0) ? (double)stats.store_ns / (double)stats.stores : 0.0, (unsigned long long)stats.store_ns_max);
+    printf("cache %.1f MiB, file %.1f MiB with %.1f MiB resident, all states in memory %.1f MiB.\n",
+           (double)stats.cache_bytes / 1048576.0, (double)stats.file_bytes / 1048576.0,
+           (double)stats.file_resident_bytes / 1048576.0,
+           (double)devices * 2.0 * sizeof(sgp41_gas_index_algorithm_t) / 1048576.0);
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    static sgp41_store_t store;
+    sgp41_gas_index_algorithm_t *voc_ref = NULL;
+    sgp41_gas_index_algorithm_t *nox_ref = NULL;
+    char path[64];
+    int c;
+    int longindex = 0;
+    uint8_t check = 0;
+    uint8_t res;
+    uint32_t devices = 1000000;
+    uint32_t cache = 50000;
+    uint32_t steps = 2000000;
+    uint32_t errors = 0;
+    uint32_t i;
+    uint64_t start;
+    const char short_options[] = "hc";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"check", no_argument, NULL, 'c'},
+        {"devices", required_argument, NULL, 1},
+        {"cache", required_argument, NULL, 2},
+        {"steps", required_argument, NULL, 3},
+        {NULL, 0, NULL, 0},
+    };
+
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'c' :
+            {
+                check = 1;
+
+                break;
+            }
+            case 1 :
+            {
+                devices = (uint32_t)atol(optarg);
+
+                break;
+            }
+            case 2 :
+            {
+                cache = (uint32_t)atol(optarg);
+
+                break;
+            }
+            case 3 :
+            {
+                steps = (uint32_t)atol(optarg);
+
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  sgp41_bench_store [--devices=<num>] [--cache=<num>] [--steps=<num>]\n");
+                printf("  sgp41_bench_store (-c | --check)\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("      --cache=<num>                       Set the states kept in memory.([default: 50000])\n");
+                printf("  -c, --check                             Check every index against states that never leave memory.\n");
+                printf("      --devices=<num>                     Set the device number.([default: 1000000])\n");
+                printf("  -h, --help                              Show the help.\n");
+                printf("      --steps=<num>                       Set the report number.([default: 2000000])\n");
+
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    if (check != 0)
+    {
+        devices = 4000;
+        cache = 200;
+        steps = 200000;
+    }
+    if ((devices == 0) || (devices > SGP41_STORE_MAX_DEVICES) || (cache == 0) || (steps == 0))
+    {
+        printf("sgp41_bench_store: devices, cache and steps must not be 0.\n");
+
+        return 1;
+    }
+    (void)snprintf(path, sizeof(path), "/tmp/sgp41_bench_store.%ld.bin", (long)getpid());
+    (void)unlink(path);
+    if (check != 0)
+    {
+        voc_ref = malloc(sizeof(sgp41_gas_index_algorithm_t) * devices);
+        nox_ref = malloc(sizeof(sgp41_gas_index_algorithm_t) * devices);
+        if ((voc_ref == NULL) || (nox_ref == NULL))
+        {
+            printf("sgp41_bench_store: no memory.\n");
+            free(voc_ref);
+            free(nox_ref);
+
+            return 1;
+        }
+        for (i = 0; i < devices; i++)
+        {
+            sgp41_algorithm_init(&voc_ref[i], SGP41_ALGORITHM_TYPE_VOC);
+            sgp41_algorithm_init(&nox_ref[i], SGP41_ALGORITHM_TYPE_NOX);
+        }
+    }
+
+    res = sgp41_store_init(&store, path, devices, cache);
+    if (res != 0)
+    {
+        printf("sgp41_bench_store: init returned %u.\n", res);
+        free(voc_ref);
+        free(nox_ref);
+
+        return 1;
+    }
+    start = a_bench_now_ns();
+    errors += a_bench_steps(&store, devices, steps, 0, voc_ref, nox_ref);
+    a_bench_print(&store, devices, a_bench_now_ns() - start);
+
+    /* close and reopen, the states must come back from the file */
+    if (check != 0)
+    {
+        if (sgp41_store_deinit(&store) != 0)
+        {
+            printf("sgp41_bench_store: deinit failed.\n");
+            errors++;
+        }
+        res = sgp41_store_init(&store, path, 1, 1);
+        if (res != 0)
+        {
+            printf("sgp41_bench_store: reopen returned %u.\n", res);
+            errors++;
+        }
+        else
+        {
+            uint32_t seen = 0;
+
+            for (i = 0; i < devices; i++)
+            {
+                seen += (voc_ref[i].m_uptime > 0.f) ? 1 : 0;
+            }
+            if (store.header->devices != seen)
+            {
+                printf("sgp41_bench_store: %u devices in the file, %u reported.\n", store.header->devices, seen);
+                errors++;
+            }
+            errors += a_bench_steps(&store, devices, steps / 4, steps, voc_ref, nox_ref);
+        }
+        printf("sgp41_bench_store: check %u errors.\n", errors);
+    }
+    if (store.inited != 0)
+    {
+        (void)sgp41_store_deinit(&store);
+    }
+    (void)unlink(path);
+    free(voc_ref);
+    free(nox_ref);
+
+    return (errors == 0) ? 0 : 1;
+}
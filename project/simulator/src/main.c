@@ -0,0 +1,755 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_basic.h"
+#include "driver_sgp41_sampler.h"
+#include "driver_sgp41_low_power.h"
+#include "driver_sgp41_register_test.h"
+#include "driver_sgp41_read_test.h"
+#include "driver_sgp41_rollup_test.h"
+#include "driver_sgp41_compress_test.h"
+#include "driver_sgp41_timestep_test.h"
+#include "driver_sgp41_rate_test.h"
+#include "driver_sgp41_power_test.h"
+#include "driver_sgp41_mux_test.h"
+#include "driver_sgp41_trace_test.h"
+#include "driver_sgp41_log_test.h"
+#include "driver_sgp41_registry_test.h"
+#include "raspberrypi4b_driver_sgp41_event.h"
+#include "sim.h"
+#include <errno.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <sys/epoll.h>
+
+static uint32_t gs_event_count;         /**< event example sample count */
+static uint32_t gs_event_times;         /**< event example sample number */
+static uint8_t gs_event_error;          /**< event example error flag */
+
+/**
+ * @brief     event example sample callback
+ * @param[in] id sensor id
+ * @param[in] status sample status
+ * @param[in] sraw_voc raw voc
+ * @param[in] sraw_nox raw nox
+ * @param[in] voc_gas_index voc gas index
+ * @param[in] nox_gas_index nox gas index
+ * @note      none
+ */
+static void a_sgp41_event_callback(uint32_t id, uint8_t status,
+                                   uint16_t sraw_voc, uint16_t sraw_nox,
+                                   int32_t voc_gas_index, int32_t nox_gas_index)
+{
+    (void)id;
+    (void)sraw_voc;
+    (void)sraw_nox;
+    
+    if (status != 0)
+    {
+        gs_event_error = 1;
+        
+        return;
+    }
+    gs_event_count++;
+    sgp41_interface_debug_print("sgp41: %d/%d.\n", gs_event_count, gs_event_times);
+    sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+    sgp41_interface_debug_print("sgp41: nox gas index is %d.\n", nox_gas_index);
+}
+
+/**
+ * @brief     sgp41 full function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t sgp41(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "hipe:t:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"information", no_argument, NULL, 'i'},
+        {"port", no_argument, NULL, 'p'},
+        {"example", required_argument, NULL, 'e'},
+        {"test", required_argument, NULL, 't'},
+        {"humidity", required_argument, NULL, 1},
+        {"temperature", required_argument, NULL, 2},
+        {"times", required_argument, NULL, 3},
+        {"delay", required_argument, NULL, 4},
+        {NULL, 0, NULL, 0},
+    };
+    char type[33] = "unknown";
+    uint32_t times = 3;
+    float rh = 50.0f;
+    float temp = 25.0f;
+
+    /* if no params */
+    if (argc == 1)
+    {
+        /* goto the help */
+        goto help;
+    }
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "h");
+                
+                break;
+            }
+            
+            /* information */
+            case 'i' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "i");
+                
+                break;
+            }
+            
+            /* port */
+            case 'p' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "p");
+                
+                break;
+            }
+            
+            /* example */
+            case 'e' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "e_%s", optarg);
+                
+                break;
+            }
+            
+            /* test */
+            case 't' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "t_%s", optarg);
+                
+                break;
+            }
+            
+            /* rh */
+            case 1 :
+            {
+                rh = atof(optarg);
+                
+                break;
+            }
+             
+            /* temperature */
+            case 2 :
+            {
+                temp = atof(optarg);
+                
+                break;
+            }
+            
+            /* running times */
+            case 3 :
+            {
+                /* set the times */
+                times = atol(optarg);
+                
+                break;
+            } 
+            
+            /* delay mode */
+            case 4 :
+            {
+                /* set the delay */
+                if (strcmp("real", optarg) == 0)
+                {
+                    sim_set_delay(SIM_DELAY_REAL);
+                }
+                else if (strcmp("none", optarg) == 0)
+                {
+                    sim_set_delay(SIM_DELAY_NONE);
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            } 
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+
+    /* run the function */
+    if (strcmp("t_reg", type) == 0)
+    {
+        /* run reg test */
+        if (sgp41_register_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_read", type) == 0)
+    {
+        /* run read test */
+        if (sgp41_read_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_rollup", type) == 0)
+    {
+        /* run rollup test */
+        if (sgp41_rollup_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_compress", type) == 0)
+    {
+        /* run compress test */
+        if (sgp41_compress_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_timestep", type) == 0)
+    {
+        /* run timestep test */
+        if (sgp41_timestep_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_rate", type) == 0)
+    {
+        /* run rate test */
+        if (sgp41_rate_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_power", type) == 0)
+    {
+        /* run power test */
+        if (sgp41_power_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_mux", type) == 0)
+    {
+        /* run mux test */
+        if (sgp41_mux_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_trace", type) == 0)
+    {
+        /* run trace test */
+        if (sgp41_trace_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_log", type) == 0)
+    {
+        /* run log test */
+        if (sgp41_log_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_registry", type) == 0)
+    {
+        /* run registry test */
+        if (sgp41_registry_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_read", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        int32_t nox_gas_index;
+        
+        /* init */
+        res = sgp41_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay 1000ms */
+            sgp41_interface_delay_ms(1000);
+            
+            /* read data */
+            res = sgp41_basic_read(temp, rh, &voc_gas_index, &nox_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_basic_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+            sgp41_interface_debug_print("sgp41: nox gas index is %d.\n", nox_gas_index);
+        }
+        
+        /* deinit */
+        (void)sgp41_basic_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_read-without-compensation", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        int32_t nox_gas_index;
+        
+        /* init */
+        res = sgp41_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay 1000ms */
+            sgp41_interface_delay_ms(1000);
+            
+            /* read data */
+            res = sgp41_basic_read_without_compensation(&voc_gas_index, &nox_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_basic_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+            sgp41_interface_debug_print("sgp41: nox gas index is %d.\n", nox_gas_index);
+        }
+        
+        /* deinit */
+        (void)sgp41_basic_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_serial-id", type) == 0)
+    {
+        uint8_t res;
+        uint16_t id[3];
+        
+        /* init */
+        res = sgp41_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* get serial id */
+        res = sgp41_basic_get_serial_id(id);
+        if (res != 0)
+        {
+            (void)sgp41_basic_deinit();
+            
+            return 1;
+        }
+        
+        /* output */
+        sgp41_interface_debug_print("sgp41: serial id 0x%04X 0x%04X 0x%04X.\n", (uint16_t)(id[0]), (uint16_t)(id[1]), (uint16_t)(id[2]));
+        
+        /* deinit */
+        (void)sgp41_basic_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_event", type) == 0)
+    {
+        uint8_t res;
+        int fd;
+        int epfd;
+        int n;
+        uint16_t reg_rh;
+        uint16_t reg_temp;
+        struct epoll_event ev;
+        sgp41_handle_t handle;
+        sgp41_event_t event;
+        
+        /* link the interface */
+        DRIVER_SGP41_LINK_INIT(&handle, sgp41_handle_t);
+        DRIVER_SGP41_LINK_IIC_INIT(&handle, sgp41_interface_iic_init);
+        DRIVER_SGP41_LINK_IIC_DEINIT(&handle, sgp41_interface_iic_deinit);
+        DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&handle, sgp41_interface_iic_write_cmd);
+        DRIVER_SGP41_LINK_IIC_READ_COMMAND(&handle, sgp41_interface_iic_read_cmd);
+        DRIVER_SGP41_LINK_DELAY_MS(&handle, sgp41_interface_delay_ms);
+        DRIVER_SGP41_LINK_DEBUG_PRINT(&handle, sgp41_interface_debug_print);
+        
+        /* init */
+        res = sgp41_init(&handle);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* convert the compensation */
+        (void)sgp41_humidity_convert_to_register(&handle, rh, &reg_rh);
+        (void)sgp41_temperature_convert_to_register(&handle, temp, &reg_temp);
+        
+        /* event init */
+        res = sgp41_event_init(&event, &handle, 0, SGP41_EVENT_DEFAULT_PERIOD_MS, a_sgp41_event_callback);
+        if (res != 0)
+        {
+            (void)sgp41_deinit(&handle);
+            
+            return 1;
+        }
+        (void)sgp41_event_set_compensation(&event, reg_rh, reg_temp);
+        
+        /* add the sensor fd to the application loop */
+        (void)sgp41_event_get_fd(&event, &fd);
+        epfd = epoll_create1(0);
+        memset(&ev, 0, sizeof(struct epoll_event));
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        if ((epfd < 0) || (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) != 0))
+        {
+            if (epfd >= 0)
+            {
+                (void)close(epfd);
+            }
+            (void)sgp41_event_deinit(&event);
+            (void)sgp41_deinit(&handle);
+            
+            return 1;
+        }
+        
+        /* start with the default conditioning */
+        gs_event_count = 0;
+        gs_event_times = times;
+        gs_event_error = 0;
+        res = sgp41_event_start(&event, SGP41_EVENT_DEFAULT_CONDITIONING);
+        
+        /* loop, the loop could watch any other fd as well */
+        while ((res == 0) && (gs_event_count < times) && (gs_event_error == 0))
+        {
+            n = epoll_wait(epfd, &ev, 1, -1);
+            if ((n < 0) && (errno != EINTR))
+            {
+                res = 1;
+            }
+            else if (n > 0)
+            {
+                res = sgp41_event_dispatch(&event);
+            }
+            else
+            {
+                /* interrupted */
+            }
+        }
+        sgp41_interface_debug_print("sgp41: event missed %d ticks.\n", (uint32_t)event.missed);
+        
+        /* deinit */
+        (void)sgp41_event_stop(&event);
+        (void)sgp41_event_deinit(&event);
+        (void)close(epfd);
+        (void)sgp41_deinit(&handle);
+        
+        return ((res != 0) || (gs_event_error != 0)) ? 1 : 0;
+    }
+    else if (strcmp("e_sampler", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        int32_t nox_gas_index;
+        sgp41_sampler_stats_t stats;
+        
+        /* init */
+        res = sgp41_sampler_init(SGP41_SAMPLER_DEFAULT_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* read data at the next deadline */
+            res = sgp41_sampler_read(temp, rh, &voc_gas_index, &nox_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_sampler_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+            sgp41_interface_debug_print("sgp41: nox gas index is %d.\n", nox_gas_index);
+        }
+        
+        /* output the jitter */
+        (void)sgp41_sampler_get_stats(&stats);
+        sgp41_interface_debug_print("sgp41: period jitter min %dus max %dus mean %0.1fus std %0.1fus.\n",
+                                    stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us, stats.jitter_std_us);
+        sgp41_interface_debug_print("sgp41: max lateness %dus, %d slips.\n", stats.late_max_us, stats.slips);
+        
+        /* deinit */
+        (void)sgp41_sampler_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_low-power", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        sgp41_low_power_energy_t energy;
+        
+        /* init */
+        res = sgp41_low_power_init(SGP41_LOW_POWER_DEFAULT_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* read data with the heater off between samples */
+            res = sgp41_low_power_read(temp, rh, &voc_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_low_power_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+        }
+        
+        /* output the energy */
+        (void)sgp41_low_power_get_energy(&energy);
+        sgp41_interface_debug_print("sgp41: heater on %dms of %dms, heater duty %0.2f%%.\n",
+                                    (uint32_t)energy.heater_on_ms, (uint32_t)energy.elapsed_ms, energy.duty * 100.0f);
+        sgp41_interface_debug_print("sgp41: %0.3fmAh per hour against %0.3fmAh per hour continuous.\n",
+                                    energy.mah_per_hour, energy.continuous_mah_per_hour);
+        
+        /* deinit */
+        (void)sgp41_low_power_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("h", type) == 0)
+    {
+        help:
+        sgp41_interface_debug_print("Usage:\n");
+        sgp41_interface_debug_print("  sgp41 (-i | --information)\n");
+        sgp41_interface_debug_print("  sgp41 (-h | --help)\n");
+        sgp41_interface_debug_print("  sgp41 (-p | --port)\n");
+        sgp41_interface_debug_print("  sgp41 (-t reg | --test=reg) [--delay=<real | none>]\n");
+        sgp41_interface_debug_print("  sgp41 (-t read | --test=read) [--times=<num>] [--delay=<real | none>]\n");
+        sgp41_interface_debug_print("  sgp41 (-t rollup | --test=rollup)\n");
+        sgp41_interface_debug_print("  sgp41 (-t compress | --test=compress)\n");
+        sgp41_interface_debug_print("  sgp41 (-t timestep | --test=timestep)\n");
+        sgp41_interface_debug_print("  sgp41 (-t rate | --test=rate)\n");
+        sgp41_interface_debug_print("  sgp41 (-t power | --test=power)\n");
+        sgp41_interface_debug_print("  sgp41 (-t mux | --test=mux)\n");
+        sgp41_interface_debug_print("  sgp41 (-t trace | --test=trace)\n");
+        sgp41_interface_debug_print("  sgp41 (-t log | --test=log)\n");
+        sgp41_interface_debug_print("  sgp41 (-t registry | --test=registry)\n");
+        sgp41_interface_debug_print("  sgp41 (-e read | --example=read) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>] [--delay=<real | none>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e read-without-compensation | --example=read-without-compensation) [--times=<num>] [--delay=<real | none>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e serial-id | --example=serial-id) [--delay=<real | none>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e event | --example=event) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>] [--delay=<real | none>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e sampler | --example=sampler) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>] [--delay=<real | none>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e low-power | --example=low-power) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>] [--delay=<real | none>]\n");
+        sgp41_interface_debug_print("\n");
+        sgp41_interface_debug_print("Options:\n");
+        sgp41_interface_debug_print("  -e <read | read-without-compensation | serial-id | event | sampler | low-power>, --example=<read | read-without-compensation | serial-id | event | sampler | low-power>\n");
+        sgp41_interface_debug_print("                                          Run the driver example.\n");
+        sgp41_interface_debug_print("      --delay=<real | none>               Set the simulated delay mode.([default: real])\n");
+        sgp41_interface_debug_print("  -h, --help                              Show the help.\n");
+        sgp41_interface_debug_print("      --humidity=<rh>                     Set the humidity.([default: 50.0f])\n");
+        sgp41_interface_debug_print("      --temperature=<temp>                Set the temperature.([default: 25.0f])\n");
+        sgp41_interface_debug_print("  -i, --information                       Show the chip information.\n");
+        sgp41_interface_debug_print("  -p, --port                              Display the pin connections of the current board.\n");
+        sgp41_interface_debug_print("  -t <reg | read | rollup | compress | timestep | rate | power | mux | trace | log | registry>, --test=<reg | read | rollup | compress | timestep | rate | power | mux | trace | log | registry>\n");
+        sgp41_interface_debug_print("                                          Run the driver test.\n");
+        sgp41_interface_debug_print("      --times=<num>                       Set the running times.([default: 3])\n");
+        
+        return 0;
+    }
+    else if (strcmp("i", type) == 0)
+    {
+        sgp41_info_t info;
+        
+        /* print sgp41 info */
+        sgp41_info(&info);
+        sgp41_interface_debug_print("sgp41: chip is %s.\n", info.chip_name);
+        sgp41_interface_debug_print("sgp41: manufacturer is %s.\n", info.manufacturer_name);
+        sgp41_interface_debug_print("sgp41: interface is %s.\n", info.interface);
+        sgp41_interface_debug_print("sgp41: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        sgp41_interface_debug_print("sgp41: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        sgp41_interface_debug_print("sgp41: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        sgp41_interface_debug_print("sgp41: max current is %0.2fmA.\n", info.max_current_ma);
+        sgp41_interface_debug_print("sgp41: max temperature is %0.1fC.\n", info.temperature_max);
+        sgp41_interface_debug_print("sgp41: min temperature is %0.1fC.\n", info.temperature_min);
+        
+        return 0;
+    }
+    else if (strcmp("p", type) == 0)
+    {
+        /* print pin connection */
+        sgp41_interface_debug_print("sgp41: no pin, the chip is simulated at address 0x59.\n");
+        
+        return 0;
+    }
+    else
+    {
+        return 5;
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ * @note      none
+ */
+int main(uint8_t argc, char **argv)
+{
+    uint8_t res;
+
+    res = sgp41(argc, argv);
+    if (res == 0)
+    {
+        /* run success */
+    }
+    else if (res == 1)
+    {
+        sgp41_interface_debug_print("sgp41: run failed.\n");
+    }
+    else if (res == 5)
+    {
+        sgp41_interface_debug_print("sgp41: param is invalid.\n");
+    }
+    else
+    {
+        sgp41_interface_debug_print("sgp41: unknown status code.\n");
+    }
+
+    return 0;
+}
@@ -36,10 +36,20 @@
 
 #include "driver_sgp41_interface.h"
 #include "delay.h"
+#include "timer.h"
+#include "power.h"
 #include "uart.h"
 #include "iic.h"
+#include "iic_dma.h"
 #include <stdarg.h>
 
+/**
+ * @brief iic transport definition, 1 runs i2c1 with dma and interrupts, 0 runs the bit banged bus
+ */
+#ifndef SGP41_INTERFACE_IIC_DMA
+    #define SGP41_INTERFACE_IIC_DMA    1
+#endif
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -49,7 +59,11 @@
  */
 uint8_t sgp41_interface_iic_init(void)
 {
+#if (SGP41_INTERFACE_IIC_DMA == 1)
+    return iic_dma_init();
+#else
     return iic_init();
+#endif
 }
 
 /**
@@ -61,7 +75,11 @@ uint8_t sgp41_interface_iic_init(void)
  */
 uint8_t sgp41_interface_iic_deinit(void)
 {
+#if (SGP41_INTERFACE_IIC_DMA == 1)
+    return iic_dma_deinit();
+#else
     return iic_deinit();
+#endif
 }
 
 /**
@@ -72,11 +90,15 @@ uint8_t sgp41_interface_iic_deinit(void)
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      with the dma transport the write is posted and its failure is returned by the next transfer
  */
 uint8_t sgp41_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
 {
+#if (SGP41_INTERFACE_IIC_DMA == 1)
+    return iic_dma_write_cmd(addr, buf, len);
+#else
     return iic_write_cmd(addr, buf, len);
+#endif
 }
 
 /**
@@ -91,7 +113,11 @@ uint8_t sgp41_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
  */
 uint8_t sgp41_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
 {
+#if (SGP41_INTERFACE_IIC_DMA == 1)
+    return iic_dma_read_cmd(addr, buf, len);
+#else
     return iic_read_cmd(addr, buf, len);
+#endif
 }
 
 /**
@@ -101,7 +127,27 @@ uint8_t sgp41_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
  */
 void sgp41_interface_delay_ms(uint32_t ms)
 {
-    delay_ms(ms);
+    power_delay_ms(ms);
+}
+
+/**
+ * @brief  interface get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+uint64_t sgp41_interface_get_time_us(void)
+{
+    return timer_get_us();
+}
+
+/**
+ * @brief     interface delay until an absolute time
+ * @param[in] deadline_us deadline on the sgp41_interface_get_time_us clock
+ * @note      returns at once when the deadline has passed
+ */
+void sgp41_interface_delay_until_us(uint64_t deadline_us)
+{
+    power_delay_until_us(deadline_us);
 }
 
 /**
@@ -55,6 +55,12 @@ extern "C"{
  */
 void clock_init(void);
 
+/**
+ * @brief chip clock restore
+ * @note  stop mode wakes up on the hsi, this turns the hse and the pll on again
+ */
+void clock_restore(void);
+
 /**
  * @}
  */
@@ -67,7 +67,7 @@ void delay_us(uint32_t us);
 /**
  * @brief     delay ms
  * @param[in] ms time
- * @note      none
+ * @note      the core sleeps between the systick interrupts
  */
 void delay_ms(uint32_t ms);
 
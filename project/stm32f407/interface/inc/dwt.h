@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      dwt.h
+ * @brief     dwt header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DWT_H
+#define DWT_H
+
+#include "stm32f4xx_hal.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup dwt dwt function
+ * @brief    dwt cycle counter modules
+ * @{
+ */
+
+/**
+ * @brief  dwt init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   enables the cycle counter of the debug watchpoint unit
+ */
+uint8_t dwt_init(void);
+
+/**
+ * @brief  dwt get the cycle counter
+ * @return core cycles, wraps after about 25 s at 168 MHz
+ * @note   none
+ */
+uint32_t dwt_get_cycles(void);
+
+/**
+ * @brief  dwt get the slept cycles
+ * @return cycles spent in dwt_sleep
+ * @note   busy cycles of a section are the counter difference minus the slept difference,
+ *         this holds whether or not the counter runs while the core sleeps
+ */
+uint32_t dwt_get_sleep_cycles(void);
+
+/**
+ * @brief dwt sleep until the next interrupt
+ * @note  the interrupt runs after the sleep end is taken, so its cycles count as busy
+ */
+void dwt_sleep(void);
+
+/**
+ * @brief     dwt convert cycles to us
+ * @param[in] cycles core cycles
+ * @return    time in us
+ * @note      none
+ */
+uint32_t dwt_cycles_to_us(uint32_t cycles);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
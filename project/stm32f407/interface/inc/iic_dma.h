@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_dma.h
+ * @brief     iic dma header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef IIC_DMA_H
+#define IIC_DMA_H
+
+#include "stm32f4xx_hal.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup iic_dma iic dma function
+ * @brief    iic dma function modules
+ * @{
+ */
+
+/**
+ * @brief iic dma param definition
+ */
+#define IIC_DMA_MAX_LEN           32          /**< max transfer length */
+#define IIC_DMA_TIMEOUT_MS        20          /**< transfer timeout */
+
+/**
+ * @brief  iic dma bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   SCL is PB8 and SDA is PB9 on i2c1 at 100 kHz, tx is dma1 stream6 and rx is dma1 stream0
+ */
+uint8_t iic_dma_init(void);
+
+/**
+ * @brief  iic dma bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t iic_dma_deinit(void);
+
+/**
+ * @brief     iic dma set the completion callback
+ * @param[in] *callback pointer to a callback function, it can be NULL
+ * @note      the callback runs in the interrupt with 0 on success and 1 on a bus error
+ */
+void iic_dma_set_callback(void (*callback)(uint8_t status));
+
+/**
+ * @brief     iic dma start a write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the data is copied, the call returns while the transfer runs
+ */
+uint8_t iic_dma_start_write(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     iic dma start a read
+ * @param[in] addr iic device write address
+ * @param[in] len length of the data
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      get the data with iic_dma_get_data after iic_dma_wait
+ */
+uint8_t iic_dma_start_read(uint8_t addr, uint16_t len);
+
+/**
+ * @brief  iic dma check the bus
+ * @return 1 when a transfer runs, 0 when the bus is idle
+ * @note   none
+ */
+uint8_t iic_dma_busy(void);
+
+/**
+ * @brief  iic dma wait for the running transfer
+ * @return status code
+ *         - 0 success
+ *         - 1 the transfer failed or timed out
+ * @note   the core sleeps until the completion interrupt
+ */
+uint8_t iic_dma_wait(void);
+
+/**
+ * @brief      iic dma get the read data
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @note       none
+ */
+void iic_dma_get_data(uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     iic dma bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a posted write, a failure of it is returned by the next transfer
+ */
+uint8_t iic_dma_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      iic dma bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the core sleeps while the data is received
+ */
+uint8_t iic_dma_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief  iic dma get the i2c handle
+ * @return pointer to the i2c handle
+ * @note   none
+ */
+I2C_HandleTypeDef *iic_dma_get_handle(void);
+
+/**
+ * @brief  iic dma get the tx dma handle
+ * @return pointer to the tx dma handle
+ * @note   none
+ */
+DMA_HandleTypeDef *iic_dma_get_tx_dma_handle(void);
+
+/**
+ * @brief  iic dma get the rx dma handle
+ * @return pointer to the rx dma handle
+ * @note   none
+ */
+DMA_HandleTypeDef *iic_dma_get_rx_dma_handle(void);
+
+/**
+ * @brief     iic dma irq handler
+ * @param[in] status transfer status
+ * @note      called by the hal completion and error callbacks
+ */
+void iic_dma_irq_handler(uint8_t status);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      power.h
+ * @brief     power header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef POWER_H
+#define POWER_H
+
+#include "stm32f4xx_hal.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup power power function
+ * @brief    power function modules
+ * @{
+ */
+
+/**
+ * @brief power param definition
+ */
+#define POWER_STOP_MIN_US              2000         /**< shorter waits sleep instead of entering stop mode */
+#define POWER_STOP_WAKEUP_US           2000         /**< wakeup latency guess before the first stop */
+#define POWER_STOP_EXIT_US             20           /**< regulator wakeup time of the stop mode */
+#define POWER_CALIBRATION_TICKS        1600         /**< lsi calibration length in rtc wakeup ticks */
+
+/**
+ * @brief power stats structure definition
+ */
+typedef struct power_stats_s
+{
+    uint64_t run_us;                 /**< time the core ran */
+    uint64_t sleep_us;               /**< time the core slept with the clocks on */
+    uint64_t stop_us;                /**< time spent in stop mode and on the clock restore */
+    uint32_t stops;                  /**< stop mode entries */
+    uint32_t wakeup_us;              /**< last measured wakeup latency */
+    float tick_us;                   /**< calibrated rtc wakeup tick */
+} power_stats_t;
+
+/**
+ * @brief  power init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the rtc wakeup timer runs from the lsi and is calibrated against the timer clock,
+ *         timer_init and dwt_init must run first
+ */
+uint8_t power_init(void);
+
+/**
+ * @brief  power deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t power_deinit(void);
+
+/**
+ * @brief     power delay until an absolute time
+ * @param[in] deadline_us deadline on the timer_get_us clock
+ * @note      the core stops until the wakeup latency before the deadline and sleeps the rest,
+ *            it only sleeps when power_init was not called
+ */
+void power_delay_until_us(uint64_t deadline_us);
+
+/**
+ * @brief     power delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+void power_delay_ms(uint32_t ms);
+
+/**
+ * @brief      power get the stats
+ * @param[out] *stats pointer to a stats structure
+ * @note       none
+ */
+void power_get_stats(power_stats_t *stats);
+
+/**
+ * @brief power clear the stats
+ * @note  none
+ */
+void power_clear_stats(void);
+
+/**
+ * @brief  power get the rtc handle
+ * @return pointer to the rtc handle
+ * @note   none
+ */
+RTC_HandleTypeDef *power_get_rtc_handle(void);
+
+/**
+ * @brief power irq handler
+ * @note  called by the rtc wakeup timer callback
+ */
+void power_irq_handler(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
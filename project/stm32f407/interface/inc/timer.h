@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      timer.h
+ * @brief     timer header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#include "stm32f4xx_hal.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup timer timer function
+ * @brief    timer function modules
+ * @{
+ */
+
+/**
+ * @brief  timer init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   TIM2 runs free at 1 MHz, the update interrupt extends it to 64 bits
+ */
+uint8_t timer_init(void);
+
+/**
+ * @brief  timer deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t timer_deinit(void);
+
+/**
+ * @brief  timer get the time
+ * @return time in us since timer_init
+ * @note   none
+ */
+uint64_t timer_get_us(void);
+
+/**
+ * @brief     timer wait until an absolute time
+ * @param[in] deadline_us deadline on the timer_get_us clock
+ * @note      the core sleeps with wfi and the compare interrupt wakes it at the deadline
+ */
+void timer_wait_until_us(uint64_t deadline_us);
+
+/**
+ * @brief timer freeze
+ * @note  stops the counter before the core enters stop mode
+ */
+void timer_freeze(void);
+
+/**
+ * @brief     timer resume
+ * @param[in] skipped_us time passed while the counter was frozen
+ * @note      the skipped time is added to the timer_get_us clock
+ */
+void timer_resume(uint64_t skipped_us);
+
+/**
+ * @brief timer irq handler
+ * @note  none
+ */
+void timer_irq_handler(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -90,3 +90,29 @@ void clock_init(void)
         while(1);
     }
 }
+
+/**
+ * @brief chip clock restore
+ * @note  stop mode wakes up on the hsi, this turns the hse and the pll on again
+ */
+void clock_restore(void)
+{
+    /* the pll and the flash settings are kept in stop mode */
+    __HAL_RCC_HSE_CONFIG(RCC_HSE_ON);
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_HSERDY) == RESET)
+    {
+        
+    }
+    __HAL_RCC_PLL_ENABLE();
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY) == RESET)
+    {
+        
+    }
+    
+    /* switch the system clock back to the pll */
+    __HAL_RCC_SYSCLK_CONFIG(RCC_SYSCLKSOURCE_PLLCLK);
+    while (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_PLLCLK)
+    {
+        
+    }
+}
@@ -35,6 +35,7 @@
  */
 
 #include "delay.h"
+#include "dwt.h"
 
 static volatile uint32_t gs_fac_us = 0;        /**< fac cnt */
 
@@ -100,10 +101,16 @@ void delay_us(uint32_t us)
 /**
  * @brief     delay ms
  * @param[in] ms time
- * @note      none
+ * @note      the core sleeps between the systick interrupts
  */
 void delay_ms(uint32_t ms)
 {
-    /* use the hal delay */
-    HAL_Delay(ms);
+    uint32_t start;
+    
+    /* one more tick like the hal delay, so at least ms passes */
+    start = HAL_GetTick();
+    while ((HAL_GetTick() - start) < (ms + 1))
+    {
+        dwt_sleep();
+    }
 }
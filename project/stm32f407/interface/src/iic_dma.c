@@ -0,0 +1,338 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      iic_dma.c
+ * @brief     iic dma source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "iic_dma.h"
+#include "dwt.h"
+#include <string.h>
+
+static I2C_HandleTypeDef gs_i2c_handle;                    /**< i2c handle */
+static DMA_HandleTypeDef gs_tx_dma_handle;                 /**< tx dma handle */
+static DMA_HandleTypeDef gs_rx_dma_handle;                 /**< rx dma handle */
+static uint8_t gs_tx_buf[IIC_DMA_MAX_LEN];                 /**< tx buffer */
+static uint8_t gs_rx_buf[IIC_DMA_MAX_LEN];                 /**< rx buffer */
+static volatile uint8_t gs_busy = 0;                       /**< transfer running flag */
+static volatile uint8_t gs_error = 0;                      /**< last transfer error flag */
+static void (*gs_callback)(uint8_t status) = NULL;         /**< completion callback */
+
+/**
+ * @brief  iic dma bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   SCL is PB8 and SDA is PB9 on i2c1 at 100 kHz, tx is dma1 stream6 and rx is dma1 stream0
+ */
+uint8_t iic_dma_init(void)
+{
+    gs_i2c_handle.Instance = I2C1;
+    gs_i2c_handle.Init.ClockSpeed = 100000;
+    gs_i2c_handle.Init.DutyCycle = I2C_DUTYCYCLE_2;
+    gs_i2c_handle.Init.OwnAddress1 = 0;
+    gs_i2c_handle.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+    gs_i2c_handle.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+    gs_i2c_handle.Init.OwnAddress2 = 0;
+    gs_i2c_handle.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+    gs_i2c_handle.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+    gs_busy = 0;
+    gs_error = 0;
+    
+    /* the gpio and the dma streams are set up in the msp init */
+    if (HAL_I2C_Init(&gs_i2c_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  iic dma bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t iic_dma_deinit(void)
+{
+    (void)iic_dma_wait();
+    if (HAL_I2C_DeInit(&gs_i2c_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     iic dma set the completion callback
+ * @param[in] *callback pointer to a callback function, it can be NULL
+ * @note      the callback runs in the interrupt with 0 on success and 1 on a bus error
+ */
+void iic_dma_set_callback(void (*callback)(uint8_t status))
+{
+    gs_callback = callback;
+}
+
+/**
+ * @brief     iic dma start a write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the data is copied, the call returns while the transfer runs
+ */
+uint8_t iic_dma_start_write(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    HAL_StatusTypeDef res;
+    
+    if ((gs_busy != 0) || (len == 0) || (len > IIC_DMA_MAX_LEN))
+    {
+        return 1;
+    }
+    memcpy(gs_tx_buf, buf, len);
+    gs_error = 0;
+    gs_busy = 1;
+    
+    /* the dma needs at least two bytes on this i2c */
+    if (len < 2)
+    {
+        res = HAL_I2C_Master_Transmit_IT(&gs_i2c_handle, addr, gs_tx_buf, len);
+    }
+    else
+    {
+        res = HAL_I2C_Master_Transmit_DMA(&gs_i2c_handle, addr, gs_tx_buf, len);
+    }
+    if (res != HAL_OK)
+    {
+        gs_busy = 0;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     iic dma start a read
+ * @param[in] addr iic device write address
+ * @param[in] len length of the data
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      get the data with iic_dma_get_data after iic_dma_wait
+ */
+uint8_t iic_dma_start_read(uint8_t addr, uint16_t len)
+{
+    HAL_StatusTypeDef res;
+    
+    if ((gs_busy != 0) || (len == 0) || (len > IIC_DMA_MAX_LEN))
+    {
+        return 1;
+    }
+    gs_error = 0;
+    gs_busy = 1;
+    
+    /* the dma needs at least two bytes on this i2c */
+    if (len < 2)
+    {
+        res = HAL_I2C_Master_Receive_IT(&gs_i2c_handle, addr, gs_rx_buf, len);
+    }
+    else
+    {
+        res = HAL_I2C_Master_Receive_DMA(&gs_i2c_handle, addr, gs_rx_buf, len);
+    }
+    if (res != HAL_OK)
+    {
+        gs_busy = 0;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  iic dma check the bus
+ * @return 1 when a transfer runs, 0 when the bus is idle
+ * @note   none
+ */
+uint8_t iic_dma_busy(void)
+{
+    return gs_busy;
+}
+
+/**
+ * @brief  iic dma wait for the running transfer
+ * @return status code
+ *         - 0 success
+ *         - 1 the transfer failed or timed out
+ * @note   the core sleeps until the completion interrupt
+ */
+uint8_t iic_dma_wait(void)
+{
+    uint32_t start;
+    
+    /* the systick wakes the core every 1 ms for the timeout */
+    start = HAL_GetTick();
+    while (gs_busy != 0)
+    {
+        if ((HAL_GetTick() - start) > IIC_DMA_TIMEOUT_MS)
+        {
+            (void)HAL_I2C_Master_Abort_IT(&gs_i2c_handle, 0);
+            gs_busy = 0;
+            gs_error = 1;
+            
+            break;
+        }
+        dwt_sleep();
+    }
+    
+    return gs_error;
+}
+
+/**
+ * @brief      iic dma get the read data
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @note       none
+ */
+void iic_dma_get_data(uint8_t *buf, uint16_t len)
+{
+    memcpy(buf, gs_rx_buf, (len > IIC_DMA_MAX_LEN) ? IIC_DMA_MAX_LEN : len);
+}
+
+/**
+ * @brief     iic dma bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a posted write, a failure of it is returned by the next transfer
+ */
+uint8_t iic_dma_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    /* finish the last posted write */
+    if (iic_dma_wait() != 0)
+    {
+        gs_error = 0;
+        
+        return 1;
+    }
+    
+    return iic_dma_start_write(addr, buf, len);
+}
+
+/**
+ * @brief      iic dma bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the core sleeps while the data is received
+ */
+uint8_t iic_dma_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    /* finish the last posted write */
+    if (iic_dma_wait() != 0)
+    {
+        gs_error = 0;
+        
+        return 1;
+    }
+    if (iic_dma_start_read(addr, len) != 0)
+    {
+        return 1;
+    }
+    if (iic_dma_wait() != 0)
+    {
+        gs_error = 0;
+        
+        return 1;
+    }
+    iic_dma_get_data(buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief  iic dma get the i2c handle
+ * @return pointer to the i2c handle
+ * @note   none
+ */
+I2C_HandleTypeDef *iic_dma_get_handle(void)
+{
+    return &gs_i2c_handle;
+}
+
+/**
+ * @brief  iic dma get the tx dma handle
+ * @return pointer to the tx dma handle
+ * @note   none
+ */
+DMA_HandleTypeDef *iic_dma_get_tx_dma_handle(void)
+{
+    return &gs_tx_dma_handle;
+}
+
+/**
+ * @brief  iic dma get the rx dma handle
+ * @return pointer to the rx dma handle
+ * @note   none
+ */
+DMA_HandleTypeDef *iic_dma_get_rx_dma_handle(void)
+{
+    return &gs_rx_dma_handle;
+}
+
+/**
+ * @brief     iic dma irq handler
+ * @param[in] status transfer status
+ * @note      called by the hal completion and error callbacks
+ */
+void iic_dma_irq_handler(uint8_t status)
+{
+    gs_error = status;
+    gs_busy = 0;
+    if (gs_callback != NULL)
+    {
+        gs_callback(status);
+    }
+}
@@ -0,0 +1,300 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      power.c
+ * @brief     power source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "power.h"
+#include "clock.h"
+#include "timer.h"
+#include "dwt.h"
+#include "iic_dma.h"
+
+static RTC_HandleTypeDef gs_rtc_handle;              /**< rtc handle */
+static volatile uint8_t gs_wakeup = 0;               /**< rtc wakeup flag */
+static uint8_t gs_inited = 0;                        /**< inited flag */
+static float gs_tick_us = 61.035f;                   /**< rtc wakeup tick */
+static uint32_t gs_wakeup_us = POWER_STOP_WAKEUP_US; /**< measured wakeup latency */
+static uint64_t gs_start_us = 0;                     /**< stats start time */
+static uint32_t gs_start_sleep_cycles = 0;           /**< stats start slept cycles */
+static uint64_t gs_sleep_us = 0;                     /**< slept time up to the last counter read */
+static uint64_t gs_stop_us = 0;                      /**< stopped time */
+static uint32_t gs_stops = 0;                        /**< stop entries */
+
+/**
+ * @brief     start the rtc wakeup timer
+ * @param[in] ticks wakeup ticks
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      none
+ */
+static uint8_t a_power_wakeup_start(uint32_t ticks)
+{
+    gs_wakeup = 0;
+    if (HAL_RTCEx_SetWakeUpTimer_IT(&gs_rtc_handle, ticks - 1, RTC_WAKEUPCLOCK_RTCCLK_DIV2) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief fold the slept cycles into the slept time
+ * @note  the cycle counter wraps after about 25 s
+ */
+static void a_power_fold_sleep(void)
+{
+    uint32_t cycles;
+    
+    cycles = dwt_get_sleep_cycles();
+    gs_sleep_us += dwt_cycles_to_us(cycles - gs_start_sleep_cycles);
+    gs_start_sleep_cycles = cycles;
+}
+
+/**
+ * @brief  power init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the rtc wakeup timer runs from the lsi and is calibrated against the timer clock,
+ *         timer_init and dwt_init must run first
+ */
+uint8_t power_init(void)
+{
+    RCC_OscInitTypeDef RCC_OscInitStructure = {0};
+    RCC_PeriphCLKInitTypeDef RCC_PeriphClkInitStructure = {0};
+    uint64_t start;
+    
+    /* lsi on */
+    RCC_OscInitStructure.OscillatorType = RCC_OSCILLATORTYPE_LSI;
+    RCC_OscInitStructure.LSIState = RCC_LSI_ON;
+    RCC_OscInitStructure.PLL.PLLState = RCC_PLL_NONE;
+    if (HAL_RCC_OscConfig(&RCC_OscInitStructure) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    /* rtc clocked by the lsi */
+    __HAL_RCC_PWR_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+    RCC_PeriphClkInitStructure.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+    RCC_PeriphClkInitStructure.RTCClockSelection = RCC_RTCCLKSOURCE_LSI;
+    if (HAL_RCCEx_PeriphCLKConfig(&RCC_PeriphClkInitStructure) != HAL_OK)
+    {
+        return 1;
+    }
+    __HAL_RCC_RTC_ENABLE();
+    
+    /* rtc init */
+    gs_rtc_handle.Instance = RTC;
+    gs_rtc_handle.Init.HourFormat = RTC_HOURFORMAT_24;
+    gs_rtc_handle.Init.AsynchPrediv = 127;
+    gs_rtc_handle.Init.SynchPrediv = 249;
+    gs_rtc_handle.Init.OutPut = RTC_OUTPUT_DISABLE;
+    gs_rtc_handle.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
+    gs_rtc_handle.Init.OutPutType = RTC_OUTPUT_TYPE_OPENDRAIN;
+    if (HAL_RTC_Init(&gs_rtc_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    /* enable the wakeup interrupt */
+    HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+    
+    /* the lsi is only good to 10 %, time it against the timer */
+    if (a_power_wakeup_start(POWER_CALIBRATION_TICKS) != 0)
+    {
+        return 1;
+    }
+    start = timer_get_us();
+    while (gs_wakeup == 0)
+    {
+        dwt_sleep();
+    }
+    gs_tick_us = (float)(timer_get_us() - start) / (float)POWER_CALIBRATION_TICKS;
+    (void)HAL_RTCEx_DeactivateWakeUpTimer(&gs_rtc_handle);
+    
+    /* clear the stats */
+    gs_wakeup_us = POWER_STOP_WAKEUP_US;
+    gs_inited = 1;
+    power_clear_stats();
+    
+    return 0;
+}
+
+/**
+ * @brief  power deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t power_deinit(void)
+{
+    gs_inited = 0;
+    HAL_NVIC_DisableIRQ(RTC_WKUP_IRQn);
+    if (HAL_RTCEx_DeactivateWakeUpTimer(&gs_rtc_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     power delay until an absolute time
+ * @param[in] deadline_us deadline on the timer_get_us clock
+ * @note      the core stops until the wakeup latency before the deadline and sleeps the rest,
+ *            it only sleeps when power_init was not called
+ */
+void power_delay_until_us(uint64_t deadline_us)
+{
+    uint64_t now;
+    uint64_t stop_us;
+    uint32_t ticks;
+    uint32_t cycles;
+    uint32_t restore_us;
+    
+    /* the i2c clock stops in stop mode, let a posted write finish */
+    if (gs_inited != 0)
+    {
+        (void)iic_dma_wait();
+        a_power_fold_sleep();
+    }
+    
+    now = timer_get_us();
+    while ((gs_inited != 0) && (deadline_us > now) &&
+           ((deadline_us - now) >= (uint64_t)gs_wakeup_us + POWER_STOP_MIN_US))
+    {
+        /* the wakeup timer counts at most 65536 ticks */
+        ticks = (uint32_t)((float)(deadline_us - now - gs_wakeup_us) / gs_tick_us);
+        if (ticks > 65536)
+        {
+            ticks = 65536;
+        }
+        if ((ticks < 2) || (a_power_wakeup_start(ticks) != 0))
+        {
+            break;
+        }
+        
+        /* stop with the low power regulator, only the rtc wakes the core up */
+        __disable_irq();
+        HAL_SuspendTick();
+        timer_freeze();
+        HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+        
+        /* the core runs on the hsi now, time the restore with the cycle counter */
+        cycles = dwt_get_cycles();
+        clock_restore();
+        restore_us = (dwt_get_cycles() - cycles) / (HSI_VALUE / 1000000U);
+        
+        /* account the stop time and let the clocks catch up */
+        stop_us = (uint64_t)((float)ticks * gs_tick_us) + POWER_STOP_EXIT_US + restore_us;
+        gs_wakeup_us = POWER_STOP_EXIT_US + restore_us + (uint32_t)gs_tick_us;
+        gs_stop_us += stop_us;
+        gs_stops++;
+        timer_resume(stop_us);
+        uwTick += (uint32_t)(stop_us / 1000);
+        HAL_ResumeTick();
+        __enable_irq();
+        (void)HAL_RTCEx_DeactivateWakeUpTimer(&gs_rtc_handle);
+        now = timer_get_us();
+    }
+    
+    /* sleep the rest on the timer compare */
+    timer_wait_until_us(deadline_us);
+}
+
+/**
+ * @brief     power delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+void power_delay_ms(uint32_t ms)
+{
+    power_delay_until_us(timer_get_us() + (uint64_t)ms * 1000);
+}
+
+/**
+ * @brief      power get the stats
+ * @param[out] *stats pointer to a stats structure
+ * @note       none
+ */
+void power_get_stats(power_stats_t *stats)
+{
+    uint64_t total_us;
+    
+    a_power_fold_sleep();
+    total_us = timer_get_us() - gs_start_us;
+    stats->sleep_us = gs_sleep_us;
+    stats->stop_us = gs_stop_us;
+    stats->run_us = (total_us > (gs_sleep_us + gs_stop_us)) ? (total_us - gs_sleep_us - gs_stop_us) : 0;
+    stats->stops = gs_stops;
+    stats->wakeup_us = gs_wakeup_us;
+    stats->tick_us = gs_tick_us;
+}
+
+/**
+ * @brief power clear the stats
+ * @note  none
+ */
+void power_clear_stats(void)
+{
+    gs_start_us = timer_get_us();
+    gs_start_sleep_cycles = dwt_get_sleep_cycles();
+    gs_sleep_us = 0;
+    gs_stop_us = 0;
+    gs_stops = 0;
+}
+
+/**
+ * @brief  power get the rtc handle
+ * @return pointer to the rtc handle
+ * @note   none
+ */
+RTC_HandleTypeDef *power_get_rtc_handle(void)
+{
+    return &gs_rtc_handle;
+}
+
+/**
+ * @brief power irq handler
+ * @note  called by the rtc wakeup timer callback
+ */
+void power_irq_handler(void)
+{
+    gs_wakeup = 1;
+}
@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      timer.c
+ * @brief     timer source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "timer.h"
+#include "dwt.h"
+
+static TIM_HandleTypeDef gs_tim_handle;        /**< timer handle */
+static volatile uint32_t gs_high = 0;          /**< overflow count */
+static volatile uint64_t gs_offset = 0;        /**< time skipped while frozen */
+
+/**
+ * @brief  timer init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   TIM2 runs free at 1 MHz, the update interrupt extends it to 64 bits
+ */
+uint8_t timer_init(void)
+{
+    uint32_t clk;
+    
+    /* the timer clock is doubled when apb1 is divided */
+    clk = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+    {
+        clk *= 2;
+    }
+    
+    /* enable the clock */
+    __HAL_RCC_TIM2_CLK_ENABLE();
+    
+    /* 1 MHz free running 32 bits counter */
+    gs_tim_handle.Instance = TIM2;
+    gs_tim_handle.Init.Prescaler = (clk / 1000000U) - 1;
+    gs_tim_handle.Init.CounterMode = TIM_COUNTERMODE_UP;
+    gs_tim_handle.Init.Period = 0xFFFFFFFFU;
+    gs_tim_handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    gs_tim_handle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&gs_tim_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    /* the prescaler is loaded by the update event, drop that first flag */
+    __HAL_TIM_CLEAR_FLAG(&gs_tim_handle, TIM_FLAG_UPDATE | TIM_FLAG_CC1);
+    gs_high = 0;
+    gs_offset = 0;
+    
+    /* enable the interrupt */
+    HAL_NVIC_SetPriority(TIM2_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+    
+    /* start the timer */
+    if (HAL_TIM_Base_Start_IT(&gs_tim_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  timer deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t timer_deinit(void)
+{
+    HAL_NVIC_DisableIRQ(TIM2_IRQn);
+    if (HAL_TIM_Base_Stop_IT(&gs_tim_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    if (HAL_TIM_Base_DeInit(&gs_tim_handle) != HAL_OK)
+    {
+        return 1;
+    }
+    __HAL_RCC_TIM2_CLK_DISABLE();
+    
+    return 0;
+}
+
+/**
+ * @brief  timer get the time
+ * @return time in us since timer_init
+ * @note   none
+ */
+uint64_t timer_get_us(void)
+{
+    uint32_t high;
+    uint32_t low;
+    
+    /* read again when the counter wrapped in between */
+    do
+    {
+        high = gs_high;
+        low = TIM2->CNT;
+    } while (high != gs_high);
+    
+    return (((uint64_t)high << 32) | low) + gs_offset;
+}
+
+/**
+ * @brief     timer wait until an absolute time
+ * @param[in] deadline_us deadline on the timer_get_us clock
+ * @note      the core sleeps with wfi and the compare interrupt wakes it at the deadline
+ */
+void timer_wait_until_us(uint64_t deadline_us)
+{
+    uint64_t now;
+    
+    while (1)
+    {
+        now = timer_get_us();
+        if (now >= deadline_us)
+        {
+            break;
+        }
+        
+        /* arm the compare when the deadline is inside this counter turn */
+        if ((deadline_us - now) < 0x80000000ULL)
+        {
+            __HAL_TIM_SET_COMPARE(&gs_tim_handle, TIM_CHANNEL_1, (uint32_t)(deadline_us - gs_offset));
+            __HAL_TIM_CLEAR_FLAG(&gs_tim_handle, TIM_FLAG_CC1);
+            __HAL_TIM_ENABLE_IT(&gs_tim_handle, TIM_IT_CC1);
+            if (timer_get_us() >= deadline_us)
+            {
+                break;
+            }
+        }
+        
+        /* any interrupt wakes the core, the systick does every 1 ms */
+        dwt_sleep();
+    }
+    __HAL_TIM_DISABLE_IT(&gs_tim_handle, TIM_IT_CC1);
+}
+
+/**
+ * @brief timer freeze
+ * @note  stops the counter before the core enters stop mode
+ */
+void timer_freeze(void)
+{
+    TIM2->CR1 &= ~TIM_CR1_CEN;
+}
+
+/**
+ * @brief     timer resume
+ * @param[in] skipped_us time passed while the counter was frozen
+ * @note      the skipped time is added to the timer_get_us clock
+ */
+void timer_resume(uint64_t skipped_us)
+{
+    gs_offset += skipped_us;
+    TIM2->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+ * @brief timer irq handler
+ * @note  none
+ */
+void timer_irq_handler(void)
+{
+    if (__HAL_TIM_GET_FLAG(&gs_tim_handle, TIM_FLAG_UPDATE) != RESET)
+    {
+        __HAL_TIM_CLEAR_FLAG(&gs_tim_handle, TIM_FLAG_UPDATE);
+        gs_high++;
+    }
+    if (__HAL_TIM_GET_FLAG(&gs_tim_handle, TIM_FLAG_CC1) != RESET)
+    {
+        /* only a wake up source */
+        __HAL_TIM_CLEAR_FLAG(&gs_tim_handle, TIM_FLAG_CC1);
+    }
+}
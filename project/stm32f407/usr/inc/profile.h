@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      profile.h
+ * @brief     profile header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "stm32f4xx_hal.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup profile profile function
+ * @brief    profile function modules
+ * @{
+ */
+
+/**
+ * @brief profile param definition
+ */
+#define PROFILE_TRACE_LEN          256         /**< embedded sraw trace length */
+#define PROFILE_SAMPLES            3600        /**< processed samples per gas, one hour at 1 s */
+#define PROFILE_DRIVER_RUNS        1000        /**< runs per driver call on the canned bus */
+
+/**
+ * @brief  profile the gas index algorithm
+ * @return status code
+ *         - 0 success
+ * @note   runs the embedded trace through the voc and the nox algorithm and prints the cycles per stage,
+ *         the stages and the fast expf column need the SGP41_ALGORITHM_PROFILE build
+ */
+uint8_t profile_algorithm(void);
+
+/**
+ * @brief     profile the driver calls
+ * @param[in] times real bus measurement times
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the frame and crc cost is taken on a canned bus, the real bus rows are busy cycles
+ */
+uint8_t profile_driver(uint32_t times);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -35,11 +35,18 @@
  */
 
 #include "driver_sgp41_basic.h"
+#include "driver_sgp41_sampler.h"
+#include "driver_sgp41_low_power.h"
+#include "driver_sgp41_algorithm.h"
 #include "driver_sgp41_register_test.h"
 #include "driver_sgp41_read_test.h"
 #include "shell.h"
+#include "profile.h"
 #include "clock.h"
 #include "delay.h"
+#include "timer.h"
+#include "dwt.h"
+#include "power.h"
 #include "uart.h"
 #include "getopt.h"
 #include <stdlib.h>
@@ -49,6 +56,8 @@
  */
 uint8_t g_buf[256];        /**< uart buffer */
 volatile uint16_t g_len;   /**< uart buffer length */
+static sgp41_handle_t gs_handle;                         /**< sgp41 handle */
+static sgp41_gas_index_algorithm_t gs_voc_handle;        /**< voc algorithm handle */
 
 /**
  * @brief     sgp41 full function
@@ -320,6 +329,257 @@ uint8_t sgp41(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_sampler", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        int32_t nox_gas_index;
+        sgp41_sampler_stats_t stats;
+        
+        /* init */
+        res = sgp41_sampler_init(SGP41_SAMPLER_DEFAULT_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* read data at the next deadline */
+            res = sgp41_sampler_read(temp, rh, &voc_gas_index, &nox_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_sampler_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+            sgp41_interface_debug_print("sgp41: nox gas index is %d.\n", nox_gas_index);
+        }
+        
+        /* output the jitter */
+        (void)sgp41_sampler_get_stats(&stats);
+        sgp41_interface_debug_print("sgp41: period jitter min %dus max %dus mean %0.1fus std %0.1fus.\n",
+                                    stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us, stats.jitter_std_us);
+        sgp41_interface_debug_print("sgp41: max lateness %dus, %d slips.\n", stats.late_max_us, stats.slips);
+        
+        /* deinit */
+        (void)sgp41_sampler_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_low-power", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        sgp41_low_power_energy_t energy;
+        
+        /* init */
+        res = sgp41_low_power_init(SGP41_LOW_POWER_DEFAULT_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* read data with the heater off between samples */
+            res = sgp41_low_power_read(temp, rh, &voc_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_low_power_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+        }
+        
+        /* output the energy */
+        (void)sgp41_low_power_get_energy(&energy);
+        sgp41_interface_debug_print("sgp41: heater on %dms of %dms, heater duty %0.2f%%.\n",
+                                    (uint32_t)energy.heater_on_ms, (uint32_t)energy.elapsed_ms, energy.duty * 100.0f);
+        sgp41_interface_debug_print("sgp41: %0.3fmAh per hour against %0.3fmAh per hour continuous.\n",
+                                    energy.mah_per_hour, energy.continuous_mah_per_hour);
+        
+        /* deinit */
+        (void)sgp41_low_power_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_busy", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint16_t raw_humidity;
+        uint16_t raw_temperature;
+        uint16_t sraw_voc;
+        uint16_t sraw_nox;
+        int32_t voc_gas_index;
+        uint32_t cycles;
+        uint32_t sleep_cycles;
+        uint32_t busy_us;
+        uint32_t busy_max_us;
+        uint64_t busy_sum_us;
+        uint64_t deadline_us;
+        
+        /* link functions */
+        DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+        DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, sgp41_interface_iic_init);
+        DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, sgp41_interface_iic_deinit);
+        DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, sgp41_interface_iic_write_cmd);
+        DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, sgp41_interface_iic_read_cmd);
+        DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, sgp41_interface_delay_ms);
+        DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle, sgp41_interface_debug_print);
+        
+        /* init */
+        res = sgp41_init(&gs_handle);
+        if (res != 0)
+        {
+            return 1;
+        }
+        res = sgp41_soft_reset(&gs_handle);
+        if (res != 0)
+        {
+            (void)sgp41_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = sgp41_humidity_convert_to_register(&gs_handle, rh, &raw_humidity);
+        res |= sgp41_temperature_convert_to_register(&gs_handle, temp, &raw_temperature);
+        if (res != 0)
+        {
+            (void)sgp41_deinit(&gs_handle);
+            
+            return 1;
+        }
+        sgp41_algorithm_init(&gs_voc_handle, SGP41_ALGORITHM_TYPE_VOC);
+        
+        /* loop */
+        busy_max_us = 0;
+        busy_sum_us = 0;
+        deadline_us = timer_get_us();
+        for (i = 0; i < times; i++)
+        {
+            deadline_us += 1000000;
+            timer_wait_until_us(deadline_us);
+            
+            /* the core sleeps while the bus and the chip work */
+            cycles = dwt_get_cycles();
+            sleep_cycles = dwt_get_sleep_cycles();
+            res = sgp41_start_measure_raw(&gs_handle, raw_humidity, raw_temperature);
+            if (res != 0)
+            {
+                (void)sgp41_deinit(&gs_handle);
+                
+                return 1;
+            }
+            timer_wait_until_us(deadline_us + SGP41_EXECUTION_TIME_MEASURE_RAW_MS * 1000);
+            res = sgp41_read_measure_raw(&gs_handle, &sraw_voc, &sraw_nox);
+            if (res != 0)
+            {
+                (void)sgp41_deinit(&gs_handle);
+                
+                return 1;
+            }
+            sgp41_algorithm_process(&gs_voc_handle, (int32_t)sraw_voc, &voc_gas_index);
+            busy_us = dwt_cycles_to_us((dwt_get_cycles() - cycles) - (dwt_get_sleep_cycles() - sleep_cycles));
+            busy_sum_us += busy_us;
+            busy_max_us = (busy_us > busy_max_us) ? busy_us : busy_max_us;
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+            sgp41_interface_debug_print("sgp41: cpu busy %dus.\n", busy_us);
+        }
+        
+        /* output the busy time */
+        if (times != 0)
+        {
+            sgp41_interface_debug_print("sgp41: cpu busy mean %dus max %dus per sample.\n",
+                                        (uint32_t)(busy_sum_us / times), busy_max_us);
+        }
+        
+        /* deinit */
+        (void)sgp41_deinit(&gs_handle);
+        
+        return 0;
+    }
+    else if (strcmp("e_duty", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int32_t voc_gas_index;
+        int32_t nox_gas_index;
+        power_stats_t stats;
+        uint64_t total_us;
+        
+        /* init */
+        res = sgp41_sampler_init(SGP41_SAMPLER_DEFAULT_PERIOD_MS);
+        if (res != 0)
+        {
+            return 1;
+        }
+        power_clear_stats();
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* the core stops between the samples and during the conversion */
+            res = sgp41_sampler_read(temp, rh, &voc_gas_index, &nox_gas_index);
+            if (res != 0)
+            {
+                (void)sgp41_sampler_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            sgp41_interface_debug_print("sgp41: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            sgp41_interface_debug_print("sgp41: voc gas index is %d.\n", voc_gas_index);
+            sgp41_interface_debug_print("sgp41: nox gas index is %d.\n", nox_gas_index);
+        }
+        
+        /* output the duty cycle */
+        power_get_stats(&stats);
+        total_us = stats.run_us + stats.sleep_us + stats.stop_us;
+        if (total_us != 0)
+        {
+            sgp41_interface_debug_print("sgp41: run %dms sleep %dms stop %dms.\n", (uint32_t)(stats.run_us / 1000),
+                                        (uint32_t)(stats.sleep_us / 1000), (uint32_t)(stats.stop_us / 1000));
+            sgp41_interface_debug_print("sgp41: run duty %0.2f%%, stop duty %0.2f%%.\n",
+                                        (float)stats.run_us * 100.0f / (float)total_us, (float)stats.stop_us * 100.0f / (float)total_us);
+            sgp41_interface_debug_print("sgp41: %d stops, wakeup latency %dus, rtc tick %0.2fus.\n",
+                                        stats.stops, stats.wakeup_us, stats.tick_us);
+        }
+        
+        /* deinit */
+        (void)sgp41_sampler_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_profile", type) == 0)
+    {
+        /* algorithm stages on the embedded trace */
+        (void)profile_algorithm();
+        
+        /* driver calls */
+        if (profile_driver(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -332,9 +592,14 @@ uint8_t sgp41(uint8_t argc, char **argv)
         sgp41_interface_debug_print("  sgp41 (-e read | --example=read) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
         sgp41_interface_debug_print("  sgp41 (-e read-without-compensation | --example=read-without-compensation) [--times=<num>]\n");
         sgp41_interface_debug_print("  sgp41 (-e serial-id | --example=serial-id)\n");
+        sgp41_interface_debug_print("  sgp41 (-e sampler | --example=sampler) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e low-power | --example=low-power) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e busy | --example=busy) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e duty | --example=duty) [--times=<num>] [--temperature=<temp>] [--humidity=<rh>]\n");
+        sgp41_interface_debug_print("  sgp41 (-e profile | --example=profile) [--times=<num>]\n");
         sgp41_interface_debug_print("\n");
         sgp41_interface_debug_print("Options:\n");
-        sgp41_interface_debug_print("  -e <read | read-without-compensation | serial-id>, --example=<read | read-without-compensation | serial-id>\n");
+        sgp41_interface_debug_print("  -e <read | read-without-compensation | serial-id | sampler | low-power | busy | duty | profile>, --example=<read | read-without-compensation | serial-id | sampler | low-power | busy | duty | profile>\n");
         sgp41_interface_debug_print("                                          Run the driver example.\n");
         sgp41_interface_debug_print("  -h, --help                              Show the help.\n");
         sgp41_interface_debug_print("      --humidity=<rh>                     Set the humidity.([default: 50.0f])\n");
@@ -392,6 +657,15 @@ int main(void)
     /* delay init */
     delay_init();
     
+    /* timer init */
+    (void)timer_init();
+    
+    /* dwt init */
+    (void)dwt_init();
+    
+    /* power init */
+    (void)power_init();
+    
     /* uart init */
     uart_init(115200);
     
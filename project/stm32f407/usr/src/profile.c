@@ -0,0 +1,537 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      profile.c
+ * @brief     profile source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "profile.h"
+#include "driver_sgp41.h"
+#include "driver_sgp41_algorithm.h"
+#include "driver_sgp41_algorithm_profile.h"
+#include "driver_sgp41_interface.h"
+#include "dwt.h"
+
+/**
+ * @brief profile stat structure definition
+ */
+typedef struct profile_stat_s
+{
+    uint32_t min;          /**< min cycles */
+    uint32_t max;          /**< max cycles */
+    uint64_t sum;          /**< cycle sum */
+    uint32_t count;        /**< sample count */
+} profile_stat_t;
+
+static const uint16_t gs_voc_trace[PROFILE_TRACE_LEN] =        /**< voc sraw trace */
+{
+    29980, 30001, 29990, 30002, 29991, 29989, 30017, 30011, 30002, 29997, 30029, 30001,
+    30007, 30034, 30002, 30017, 30023, 30025, 30006, 30030, 30028, 30046, 30033, 30050,
+    30020, 30018, 30033, 30040, 30020, 30026, 30050, 30046, 30034, 30045, 30045, 30029,
+    30028, 30050, 30068, 30061, 30058, 30066, 30037, 30044, 30059, 30072, 30072, 30050,
+    30041, 30042, 30063, 30061, 30064, 30062, 30072, 30076, 30065, 30051, 30062, 30051,
+    30047, 30041, 30055, 30044, 30040, 30054, 30061, 30055, 30077, 30057, 30044, 30071,
+    30055, 30076, 30042, 30073, 30059, 30073, 30040, 30053, 30044, 30063, 30056, 30069,
+    30038, 30034, 30063, 30047, 30055, 30046, 30059, 30040, 30051, 30029, 30042, 30046,
+    30035, 30056, 30034, 30055, 30048, 30026, 30034, 30016, 30025, 30036, 30035, 30033,
+    30045, 30021, 30034, 30036, 30027, 30029, 30003, 30017, 30032, 29993, 30018, 30022,
+    30000, 30019, 30024, 29990, 30008, 29997, 30012, 30017, 29998, 29980, 29990, 29995,
+    29985, 30005, 29988, 29979, 29986, 29971, 29997, 29979, 29998, 29979, 29964, 29959,
+    29975, 29984, 29971, 29977, 29963, 29976, 29576, 29409, 29269, 29096, 28886, 28659,
+    28427, 28176, 27990, 27822, 27661, 27572, 27553, 27600, 27661, 27812, 27961, 28199,
+    28427, 28622, 28838, 29066, 29255, 29400, 29526, 29655, 29724, 29774, 29862, 29867,
+    29912, 29921, 29905, 29947, 29944, 29953, 29920, 29927, 29943, 29921, 29928, 29944,
+    29931, 29925, 29942, 29946, 29936, 29930, 29936, 29962, 29941, 29941, 29960, 29963,
+    29934, 29927, 29950, 29945, 29933, 29952, 29937, 29970, 29931, 29934, 29944, 29941,
+    29964, 29940, 29967, 29944, 29959, 29971, 29952, 29972, 29949, 29965, 29960, 29958,
+    29987, 29981, 29955, 29989, 29993, 29962, 29981, 29964, 29970, 29991, 29991, 29968,
+    29988, 29980, 29971, 30008, 29985, 29974, 29996, 29981, 30016, 30009, 30012, 30009,
+    30001, 29998, 30003, 30011
+};
+
+static const uint16_t gs_nox_trace[PROFILE_TRACE_LEN] =        /**< nox sraw trace */
+{
+    16001, 16003, 16000, 16006, 16011, 16006, 16009, 15997, 15993, 16006, 16000, 16009,
+    15998, 16003, 15998, 16003, 15998, 16007, 16002, 16016, 16004, 16017, 16002, 16015,
+    16010, 16013, 16004, 16011, 16004, 16012, 16005, 16014, 16007, 16013, 16019, 16007,
+    16022, 16004, 16018, 16006, 16018, 16011, 16007, 16023, 16024, 16016, 16024, 16021,
+    16006, 16018, 16024, 16010, 16013, 16021, 16010, 16007, 16016, 16026, 16015, 16023,
+    16026, 16011, 16024, 16019, 16012, 16021, 16012, 16009, 16018, 16025, 16028, 16026,
+    16024, 16027, 16025, 16021, 16014, 16011, 16027, 16028, 16015, 16009, 16026, 16014,
+    16027, 16017, 16009, 16028, 16027, 16019, 16013, 16011, 16021, 16026, 16015, 16028,
+    16023, 16023, 16021, 16017, 16016, 16018, 16011, 16029, 16017, 16008, 16009, 16016,
+    16012, 16015, 16020, 16028, 16013, 16027, 16019, 16018, 16015, 16021, 16018, 16007,
+    16025, 16022, 16019, 16011, 16017, 16022, 16012, 16021, 16012, 16010, 16023, 16013,
+    16003, 16014, 16007, 16008, 16019, 16013, 16003, 16001, 16021, 16009, 16013, 16014,
+    16004, 16001, 16013, 16017, 16008, 16000, 16060, 16062, 16072, 16101, 16127, 16158,
+    16179, 16209, 16249, 16284, 16320, 16348, 16370, 16387, 16394, 16405, 16396, 16378,
+    16365, 16346, 16320, 16279, 16236, 16208, 16184, 16137, 16125, 16103, 16067, 16057,
+    16037, 16038, 16019, 16009, 15997, 15995, 15994, 15990, 15997, 15992, 15991, 15992,
+    15986, 16002, 15989, 15983, 15993, 15992, 15988, 15992, 15987, 15992, 16000, 15998,
+    15984, 15982, 15983, 15991, 15983, 15998, 15981, 15996, 15989, 15989, 15985, 15991,
+    15981, 15988, 15986, 15992, 15986, 15991, 15978, 15990, 15975, 15992, 15985, 15980,
+    15990, 15990, 15993, 15992, 15973, 15976, 15978, 15980, 15979, 15973, 15986, 15983,
+    15981, 15992, 15978, 15976, 15989, 15975, 15990, 15974, 15975, 15982, 15990, 15988,
+    15987, 15972, 15987, 15983
+};
+
+static sgp41_algorithm_profile_t gs_newlib_profile;                      /**< newlib expf stage counters */
+static sgp41_algorithm_profile_t gs_fast_profile;                        /**< fast expf stage counters */
+static sgp41_gas_index_algorithm_t gs_newlib_handle;                     /**< newlib expf algorithm */
+static sgp41_gas_index_algorithm_t gs_fast_handle;                       /**< fast expf algorithm */
+static sgp41_handle_t gs_handle;                                         /**< sgp41 handle */
+static uint8_t gs_canned[9];                                             /**< canned read data */
+
+/**
+ * @brief     add a sample to a stat
+ * @param[in] *stat pointer to a stat
+ * @param[in] cycles sample cycles
+ * @note      none
+ */
+static void a_profile_add(profile_stat_t *stat, uint32_t cycles)
+{
+    if ((stat->count == 0) || (cycles < stat->min))
+    {
+        stat->min = cycles;
+    }
+    if ((stat->count == 0) || (cycles > stat->max))
+    {
+        stat->max = cycles;
+    }
+    stat->sum += cycles;
+    stat->count++;
+}
+
+/**
+ * @brief     get the mean of a stat
+ * @param[in] *stat pointer to a stat
+ * @return    mean cycles
+ * @note      none
+ */
+static uint32_t a_profile_mean(const profile_stat_t *stat)
+{
+    return (stat->count != 0) ? (uint32_t)(stat->sum / stat->count) : 0;
+}
+
+/**
+ * @brief     fast expf
+ * @param[in] x exponent
+ * @return    e to the power of x
+ * @note      2^x with the integer part in the exponent bits and a taylor polynomial
+ *            for the fraction, the relative error is below 2e-5
+ */
+static float a_profile_fast_expf(float x)
+{
+    union
+    {
+        float f;
+        uint32_t u;
+    } v;
+    float t;
+    float f;
+    float p;
+    int32_t i;
+    
+    if (x < -87.0f)
+    {
+        return 0.0f;
+    }
+    if (x > 88.0f)
+    {
+        x = 88.0f;
+    }
+    
+    /* e^x = 2^i * 2^f with 0 <= f < 1 */
+    t = x * 1.44269504f;
+    i = (int32_t)t;
+    if ((float)i > t)
+    {
+        i--;
+    }
+    f = t - (float)i;
+    p = 1.0f + f * (0.693147181f + f * (0.240226507f + f * (0.0555041087f +
+        f * (0.00961812911f + f * (0.00133335581f + f * 0.000154035304f)))));
+    v.u = (uint32_t)(i + 127) << 23;
+    
+    return p * v.f;
+}
+
+
+/**
+ * @brief     run one gas through the algorithm
+ * @param[in] *name pointer to a gas name
+ * @param[in] type algorithm type
+ * @param[in] *trace pointer to an sraw trace
+ * @note      none
+ */
+static void a_profile_gas(const char *name, int32_t type, const uint16_t *trace)
+{
+    sgp41_algorithm_profile_counter_t newlib;
+    sgp41_algorithm_profile_counter_t fast;
+    uint32_t newlib_mean;
+    uint32_t fast_mean;
+    uint32_t i;
+    uint8_t s;
+    int32_t sraw;
+    int32_t index;
+    int32_t fast_index;
+    int32_t diff;
+    int32_t max_diff;
+    
+    /* init */
+    (void)sgp41_algorithm_profile_clear(&gs_newlib_profile);
+    (void)sgp41_algorithm_profile_clear(&gs_fast_profile);
+    sgp41_algorithm_init(&gs_newlib_handle, type);
+    sgp41_algorithm_init(&gs_fast_handle, type);
+    max_diff = 0;
+    
+    for (i = 0; i < PROFILE_SAMPLES; i++)
+    {
+        /* the trace repeats with a slow drift */
+        sraw = (int32_t)trace[i % PROFILE_TRACE_LEN] + (int32_t)(i / PROFILE_TRACE_LEN) * 8;
+        
+#ifdef SGP41_ALGORITHM_PROFILE
+        /* the probes fill the attached profile */
+        (void)sgp41_algorithm_profile_attach(&gs_newlib_profile);
+        sgp41_algorithm_process(&gs_newlib_handle, sraw, &index);
+        (void)sgp41_algorithm_profile_attach(&gs_fast_profile);
+        sgp41_algorithm_process(&gs_fast_handle, sraw, &fast_index);
+        (void)sgp41_algorithm_profile_attach(NULL);
+#else
+        /* only the whole process can be timed, the begin and end probes are called by hand */
+        (void)sgp41_algorithm_profile_attach(&gs_newlib_profile);
+        sgp41_algorithm_profile_probe(SGP41_ALGORITHM_STAGE_INPUT);
+        sgp41_algorithm_process(&gs_newlib_handle, sraw, &index);
+        sgp41_algorithm_profile_probe(SGP41_ALGORITHM_STAGE_END);
+        (void)sgp41_algorithm_profile_attach(NULL);
+        fast_index = index;
+#endif
+        diff = (index > fast_index) ? (index - fast_index) : (fast_index - index);
+        max_diff = (diff > max_diff) ? diff : max_diff;
+    }
+    
+    /* output */
+#ifdef SGP41_ALGORITHM_PROFILE
+    sgp41_interface_debug_print("sgp41: %-10s %8s %8s %8s %8s %8s %8s\n", name, "min", "avg", "max", "fast min", "fast avg", "fast max");
+#else
+    sgp41_interface_debug_print("sgp41: %-10s %8s %8s %8s\n", name, "min", "avg", "max");
+#endif
+    for (s = 0; s < SGP41_ALGORITHM_PROFILE_COUNTERS; s++)
+    {
+        (void)sgp41_algorithm_profile_get_counter(&gs_newlib_profile, s, &newlib, &newlib_mean);
+        (void)sgp41_algorithm_profile_get_counter(&gs_fast_profile, s, &fast, &fast_mean);
+        if (newlib.count == 0)
+        {
+            continue;
+        }
+#ifdef SGP41_ALGORITHM_PROFILE
+        sgp41_interface_debug_print("sgp41: %-10s %8d %8d %8d %8d %8d %8d\n", sgp41_algorithm_profile_stage_name(s),
+                                    newlib.min, newlib_mean, newlib.max, fast.min, fast_mean, fast.max);
+#else
+        sgp41_interface_debug_print("sgp41: %-10s %8d %8d %8d\n", sgp41_algorithm_profile_stage_name(s),
+                                    newlib.min, newlib_mean, newlib.max);
+#endif
+    }
+#ifdef SGP41_ALGORITHM_PROFILE
+    sgp41_interface_debug_print("sgp41: %s fast expf max index difference %d.\n", name, max_diff);
+#else
+    (void)max_diff;
+#endif
+}
+
+/**
+ * @brief  profile the gas index algorithm
+ * @return status code
+ *         - 0 success
+ *         - 1 profile failed
+ * @note   runs the embedded trace through the voc and the nox algorithm and prints the cycles per stage,
+ *         the stages and the fast expf column need the SGP41_ALGORITHM_PROFILE build
+ */
+uint8_t profile_algorithm(void)
+{
+    if (sgp41_algorithm_profile_init(&gs_newlib_profile, dwt_get_cycles) != 0)
+    {
+        return 1;
+    }
+    if (sgp41_algorithm_profile_init(&gs_fast_profile, dwt_get_cycles) != 0)
+    {
+        return 1;
+    }
+    if (sgp41_algorithm_profile_set_exp_backend(&gs_fast_profile, a_profile_fast_expf) != 0)
+    {
+        return 1;
+    }
+#ifdef SGP41_ALGORITHM_PROFILE
+    sgp41_interface_debug_print("sgp41: %d samples per gas, probe overhead %d cycles removed.\n", PROFILE_SAMPLES, gs_newlib_profile.overhead);
+#else
+    sgp41_interface_debug_print("sgp41: %d samples per gas, build the profile target for the stages and the fast expf.\n", PROFILE_SAMPLES);
+#endif
+    a_profile_gas("voc", SGP41_ALGORITHM_TYPE_VOC, gs_voc_trace);
+    a_profile_gas("nox", SGP41_ALGORITHM_TYPE_NOX, gs_nox_trace);
+    
+    return 0;
+}
+
+/**
+ * @brief     canned crc
+ * @param[in] *data pointer to a data buffer
+ * @return    crc
+ * @note      the sgp41 crc8, polynomial 0x31 and init 0xff
+ */
+static uint8_t a_profile_crc(const uint8_t *data)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+    uint8_t bit;
+    
+    for (i = 0; i < 2; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = ((crc & 0x80) != 0) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    
+    return crc;
+}
+
+/**
+ * @brief  canned iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_profile_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  canned iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_profile_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     canned iic bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_profile_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    (void)len;
+    
+    return 0;
+}
+
+/**
+ * @brief      canned iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_profile_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    memcpy(buf, gs_canned, (len > 9) ? 9 : len);
+    
+    return 0;
+}
+
+/**
+ * @brief     canned delay ms
+ * @param[in] ms time
+ * @note      no wait, the frame cost only
+ */
+static void a_profile_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     time one canned driver call
+ * @param[in] *name pointer to a call name
+ * @param[in] call call index
+ * @return    mean cycles
+ * @note      none
+ */
+static uint32_t a_profile_call(const char *name, uint8_t call)
+{
+    profile_stat_t stat;
+    uint32_t i;
+    uint32_t cycles;
+    uint16_t sraw_voc;
+    uint16_t sraw_nox;
+    uint16_t id[3];
+    uint16_t reg;
+    
+    memset(&stat, 0, sizeof(stat));
+    for (i = 0; i < PROFILE_DRIVER_RUNS; i++)
+    {
+        cycles = dwt_get_cycles();
+        switch (call)
+        {
+            case 0 :
+            {
+                (void)sgp41_start_measure_raw(&gs_handle, 0x8000, 0x6666);
+                
+                break;
+            }
+            case 1 :
+            {
+                (void)sgp41_read_measure_raw(&gs_handle, &sraw_voc, &sraw_nox);
+                
+                break;
+            }
+            case 2 :
+            {
+                (void)sgp41_get_measure_raw(&gs_handle, 0x8000, 0x6666, &sraw_voc, &sraw_nox);
+                
+                break;
+            }
+            case 3 :
+            {
+                (void)sgp41_read_serial_id(&gs_handle, id);
+                
+                break;
+            }
+            default :
+            {
+                (void)sgp41_humidity_convert_to_register(&gs_handle, 50.0f, &reg);
+                (void)sgp41_temperature_convert_to_register(&gs_handle, 25.0f, &reg);
+                
+                break;
+            }
+        }
+        a_profile_add(&stat, dwt_get_cycles() - cycles);
+    }
+    sgp41_interface_debug_print("sgp41: %-24s %8d %8d %8d\n", name, stat.min, a_profile_mean(&stat), stat.max);
+    
+    return a_profile_mean(&stat);
+}
+
+/**
+ * @brief     profile the driver calls
+ * @param[in] times real bus measurement times
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the frame and crc cost is taken on a canned bus, the real bus rows are busy cycles
+ */
+uint8_t profile_driver(uint32_t times)
+{
+    profile_stat_t busy;
+    uint32_t i;
+    uint32_t cycles;
+    uint32_t sleep_cycles;
+    uint32_t measure;
+    uint32_t serial;
+    uint16_t sraw_voc;
+    uint16_t sraw_nox;
+    
+    /* crc valid canned words */
+    for (i = 0; i < 3; i++)
+    {
+        gs_canned[i * 3 + 0] = (uint8_t)(0x66 + i * 0x11);
+        gs_canned[i * 3 + 1] = (uint8_t)(0x66 + i * 0x11);
+        gs_canned[i * 3 + 2] = a_profile_crc(&gs_canned[i * 3]);
+    }
+    
+    /* canned bus */
+    DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, a_profile_iic_init);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, a_profile_iic_deinit);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, a_profile_iic_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, a_profile_iic_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, a_profile_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle, sgp41_interface_debug_print);
+    if (sgp41_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: %-24s %8s %8s %8s\n", "canned bus cycles", "min", "avg", "max");
+    (void)a_profile_call("start_measure_raw", 0);
+    measure = a_profile_call("read_measure_raw", 1);
+    (void)a_profile_call("get_measure_raw", 2);
+    serial = a_profile_call("read_serial_id", 3);
+    (void)a_profile_call("convert_to_register", 4);
+    sgp41_interface_debug_print("sgp41: crc check about %d cycles per word.\n", (serial > measure) ? (serial - measure) : 0);
+    (void)sgp41_deinit(&gs_handle);
+    
+    /* real bus */
+    DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, sgp41_interface_iic_init);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, sgp41_interface_iic_deinit);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, sgp41_interface_iic_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, sgp41_interface_iic_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, sgp41_interface_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle, sgp41_interface_debug_print);
+    if (sgp41_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    memset(&busy, 0, sizeof(busy));
+    for (i = 0; i < times; i++)
+    {
+        cycles = dwt_get_cycles();
+        sleep_cycles = dwt_get_sleep_cycles();
+        if (sgp41_get_measure_raw(&gs_handle, 0x8000, 0x6666, &sraw_voc, &sraw_nox) != 0)
+        {
+            (void)sgp41_deinit(&gs_handle);
+            
+            return 1;
+        }
+        a_profile_add(&busy, (dwt_get_cycles() - cycles) - (dwt_get_sleep_cycles() - sleep_cycles));
+    }
+    if (times != 0)
+    {
+        sgp41_interface_debug_print("sgp41: %-24s %8d %8d %8d\n", "bus get_measure_raw busy", busy.min, a_profile_mean(&busy), busy.max);
+    }
+    (void)sgp41_deinit(&gs_handle);
+    
+    return 0;
+}
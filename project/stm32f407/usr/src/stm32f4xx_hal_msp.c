@@ -35,6 +35,7 @@
  */
 
 #include "stm32f4xx_hal.h"
+#include "iic_dma.h"
 
 /** 
  * @defgroup msp HAL_MSP_Private_Functions
@@ -147,6 +148,106 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* huart)
     }
 }
 
+/**
+ * @brief     i2c hal init
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      none
+ */
+void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
+{
+    GPIO_InitTypeDef GPIO_InitStruct;
+    DMA_HandleTypeDef *tx;
+    DMA_HandleTypeDef *rx;
+    
+    if (hi2c->Instance == I2C1)
+    {
+        /* enable i2c gpio clock */
+        __HAL_RCC_GPIOB_CLK_ENABLE();
+        
+        /* enable i2c1 and dma1 clock */
+        __HAL_RCC_I2C1_CLK_ENABLE();
+        __HAL_RCC_DMA1_CLK_ENABLE();
+        
+        /**
+         * PB8 ------> I2C1_SCL
+         * PB9 ------> I2C1_SDA 
+         */
+        GPIO_InitStruct.Pin = GPIO_PIN_8 | GPIO_PIN_9;
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_OD;
+        GPIO_InitStruct.Pull = GPIO_PULLUP;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF4_I2C1;
+        HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+        
+        /* i2c1 tx is dma1 stream6 channel1 */
+        tx = iic_dma_get_tx_dma_handle();
+        tx->Instance = DMA1_Stream6;
+        tx->Init.Channel = DMA_CHANNEL_1;
+        tx->Init.Direction = DMA_MEMORY_TO_PERIPH;
+        tx->Init.PeriphInc = DMA_PINC_DISABLE;
+        tx->Init.MemInc = DMA_MINC_ENABLE;
+        tx->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        tx->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+        tx->Init.Mode = DMA_NORMAL;
+        tx->Init.Priority = DMA_PRIORITY_LOW;
+        tx->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+        (void)HAL_DMA_Init(tx);
+        __HAL_LINKDMA(hi2c, hdmatx, *tx);
+        
+        /* i2c1 rx is dma1 stream0 channel1 */
+        rx = iic_dma_get_rx_dma_handle();
+        rx->Instance = DMA1_Stream0;
+        rx->Init.Channel = DMA_CHANNEL_1;
+        rx->Init.Direction = DMA_PERIPH_TO_MEMORY;
+        rx->Init.PeriphInc = DMA_PINC_DISABLE;
+        rx->Init.MemInc = DMA_MINC_ENABLE;
+        rx->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        rx->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+        rx->Init.Mode = DMA_NORMAL;
+        rx->Init.Priority = DMA_PRIORITY_LOW;
+        rx->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+        (void)HAL_DMA_Init(rx);
+        __HAL_LINKDMA(hi2c, hdmarx, *rx);
+        
+        /* enable nvic */
+        HAL_NVIC_SetPriority(I2C1_EV_IRQn, 1, 0);
+        HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+        HAL_NVIC_SetPriority(I2C1_ER_IRQn, 1, 0);
+        HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+        HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, 1, 0);
+        HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+        HAL_NVIC_SetPriority(DMA1_Stream0_IRQn, 1, 0);
+        HAL_NVIC_EnableIRQ(DMA1_Stream0_IRQn);
+    }
+}
+
+/**
+ * @brief     i2c hal deinit
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      none
+ */
+void HAL_I2C_MspDeInit(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* disable nvic */
+        HAL_NVIC_DisableIRQ(I2C1_EV_IRQn);
+        HAL_NVIC_DisableIRQ(I2C1_ER_IRQn);
+        HAL_NVIC_DisableIRQ(DMA1_Stream6_IRQn);
+        HAL_NVIC_DisableIRQ(DMA1_Stream0_IRQn);
+        
+        /* dma deinit */
+        (void)HAL_DMA_DeInit(hi2c->hdmatx);
+        (void)HAL_DMA_DeInit(hi2c->hdmarx);
+        
+        /* disable i2c1 clock */
+        __HAL_RCC_I2C1_CLK_DISABLE();
+        
+        /* i2c gpio deinit */
+        HAL_GPIO_DeInit(GPIOB, GPIO_PIN_8 | GPIO_PIN_9);
+    }
+}
+
 /**
  * @}
  */
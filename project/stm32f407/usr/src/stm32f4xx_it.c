@@ -36,6 +36,9 @@
 
 #include "stm32f4xx_it.h"
 #include "uart.h"
+#include "timer.h"
+#include "iic_dma.h"
+#include "power.h"
 
 /**
  * @brief nmi handler
@@ -164,6 +167,60 @@ void USART2_IRQHandler(void)
     HAL_UART_IRQHandler(uart2_get_handle());
 }
 
+/**
+ * @brief tim2 irq handler
+ * @note  none
+ */
+void TIM2_IRQHandler(void)
+{
+    timer_irq_handler();
+}
+
+/**
+ * @brief rtc wakeup irq handler
+ * @note  none
+ */
+void RTC_WKUP_IRQHandler(void)
+{
+    HAL_RTCEx_WakeUpTimerIRQHandler(power_get_rtc_handle());
+}
+
+/**
+ * @brief i2c1 event irq handler
+ * @note  none
+ */
+void I2C1_EV_IRQHandler(void)
+{
+    HAL_I2C_EV_IRQHandler(iic_dma_get_handle());
+}
+
+/**
+ * @brief i2c1 error irq handler
+ * @note  none
+ */
+void I2C1_ER_IRQHandler(void)
+{
+    HAL_I2C_ER_IRQHandler(iic_dma_get_handle());
+}
+
+/**
+ * @brief dma1 stream0 irq handler
+ * @note  none
+ */
+void DMA1_Stream0_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(iic_dma_get_rx_dma_handle());
+}
+
+/**
+ * @brief dma1 stream6 irq handler
+ * @note  none
+ */
+void DMA1_Stream6_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(iic_dma_get_tx_dma_handle());
+}
+
 /**
  * @brief     uart error callback
  * @param[in] *huart pointer to a uart handle
@@ -211,3 +268,56 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
         uart2_set_tx_done();
     }
 }
+
+/**
+ * @brief     i2c master tx finished callback
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      none
+ */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* set the transfer done */
+        iic_dma_irq_handler(0);
+    }
+}
+
+/**
+ * @brief     i2c master rx finished callback
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      none
+ */
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* set the transfer done */
+        iic_dma_irq_handler(0);
+    }
+}
+
+/**
+ * @brief     i2c error callback
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      none
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* set the transfer failed */
+        iic_dma_irq_handler(1);
+    }
+}
+
+/**
+ * @brief     rtc wakeup timer callback
+ * @param[in] *hrtc pointer to an rtc handle
+ * @note      none
+ */
+void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc)
+{
+    /* set the wakeup */
+    power_irq_handler();
+}
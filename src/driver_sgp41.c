@@ -35,6 +35,7 @@
  */
 
 #include "driver_sgp41.h"
+#include "driver_sgp41_log.h"
 
 /**
  * @brief chip information definition
@@ -69,6 +70,20 @@
 #define SGP41_CRC8_POLYNOMIAL        0x31
 #define SGP41_CRC8_INIT              0xFF
 
+/**
+ * @brief debug message definition
+ * @note  SGP41_LOG_LEVEL prints the message, writes its id or leaves it out,
+ *        debug_log is optional and an unlinked one drops the message
+ */
+#if (SGP41_LOG_LEVEL >= SGP41_LOG_LEVEL_TEXT)
+    #define SGP41_DEBUG(HANDLE, ID, ARG)        (HANDLE)->debug_print(SGP41_LOG_TEXT_##ID, (int)(ARG))
+#elif (SGP41_LOG_LEVEL == SGP41_LOG_LEVEL_BINARY)
+    #define SGP41_DEBUG(HANDLE, ID, ARG)        (((HANDLE)->debug_log != NULL) ? \
+                                                 (HANDLE)->debug_log(SGP41_LOG_##ID, (uint16_t)(ARG)) : (void)0)
+#else
+    #define SGP41_DEBUG(HANDLE, ID, ARG)        (void)(HANDLE)
+#endif
+
 /**
  * @brief      read bytes with param
  * @param[in]  *handle pointer to an sgp41 handle structure
@@ -313,13 +328,13 @@ uint8_t sgp41_get_execute_conditioning(sgp41_handle_t *handle, uint16_t *sraw_vo
                                       buf, 3);                                                         /* read measure raw */
     if (res != 0)                                                                                      /* check result */
     {
-        handle->debug_print("sgp41: read measure raw failed.\n");                                      /* read measure failed */
+        SGP41_DEBUG(handle, READ_MEASURE_RAW_FAILED, 0);                                               /* read measure failed */
        
         return 1;                                                                                      /* return error */
     }
     if (buf[2] != a_sgp41_generate_crc((uint8_t *)buf, 2))                                             /* check 1st crc */
     {
-        handle->debug_print("sgp41: sraw voc crc check error.\n");                                     /* sraw voc crc check error */
+        SGP41_DEBUG(handle, SRAW_VOC_CRC_ERROR, 0);                                                    /* sraw voc crc check error */
        
         return 1;                                                                                      /* return error */
     }
@@ -368,19 +383,19 @@ uint8_t sgp41_get_measure_raw(sgp41_handle_t *handle, uint16_t raw_humidity, uin
     res = a_sgp41_iic_read_with_param(handle, SGP41_COMMAND_MEASURE_RAW, input, 6, 50, buf, 6);        /* read measure raw */
     if (res != 0)                                                                                      /* check result */
     {
-        handle->debug_print("sgp41: read measure raw failed.\n");                                      /* read measure failed */
+        SGP41_DEBUG(handle, READ_MEASURE_RAW_FAILED, 0);                                               /* read measure failed */
        
         return 1;                                                                                      /* return error */
     }
     if (buf[2] != a_sgp41_generate_crc((uint8_t *)buf, 2))                                             /* check 1st crc */
     {
-        handle->debug_print("sgp41: sraw voc crc check error.\n");                                     /* sraw voc crc check error */
+        SGP41_DEBUG(handle, SRAW_VOC_CRC_ERROR, 0);                                                    /* sraw voc crc check error */
        
         return 1;                                                                                      /* return error */
     }
     if (buf[5] != a_sgp41_generate_crc((uint8_t *)&buf[3], 2))                                         /* check 2nd crc */
     {
-        handle->debug_print("sgp41: sraw nox crc check error.\n");                                     /* sraw nox crc check error */
+        SGP41_DEBUG(handle, SRAW_NOX_CRC_ERROR, 0);                                                    /* sraw nox crc check error */
        
         return 1;                                                                                      /* return error */
     }
@@ -427,19 +442,19 @@ uint8_t sgp41_get_measure_raw_without_compensation(sgp41_handle_t *handle, uint1
     res = a_sgp41_iic_read_with_param(handle, SGP41_COMMAND_MEASURE_RAW, input, 6, 50, buf, 6);        /* read measure raw */
     if (res != 0)                                                                                      /* check result */
     {
-        handle->debug_print("sgp41: read measure raw failed.\n");                                      /* read measure failed */
+        SGP41_DEBUG(handle, READ_MEASURE_RAW_FAILED, 0);                                               /* read measure failed */
        
         return 1;                                                                                      /* return error */
     }
     if (buf[2] != a_sgp41_generate_crc((uint8_t *)buf, 2))                                             /* check 1st crc */
     {
-        handle->debug_print("sgp41: sraw voc crc check error.\n");                                     /* sraw voc crc check error */
+        SGP41_DEBUG(handle, SRAW_VOC_CRC_ERROR, 0);                                                    /* sraw voc crc check error */
        
         return 1;                                                                                      /* return error */
     }
     if (buf[5] != a_sgp41_generate_crc((uint8_t *)&buf[3], 2))                                         /* check 2nd crc */
     {
-        handle->debug_print("sgp41: sraw nox crc check error.\n");                                     /* sraw nox crc check error */
+        SGP41_DEBUG(handle, SRAW_NOX_CRC_ERROR, 0);                                                    /* sraw nox crc check error */
        
         return 1;                                                                                      /* return error */
     }
@@ -478,13 +493,13 @@ uint8_t sgp41_get_measure_test(sgp41_handle_t *handle, uint16_t *result)
     res = a_sgp41_iic_read(handle, SGP41_COMMAND_EXECUTE_SELF_TEST, (uint8_t *)buf, 3, 320);     /* read measure test */
     if (res != 0)                                                                                /* check result */
     {
-        handle->debug_print("sgp41: read measure test failed.\n");                               /* read measure test failed */
+        SGP41_DEBUG(handle, READ_MEASURE_TEST_FAILED, 0);                                        /* read measure test failed */
        
         return 1;                                                                                /* return error */
     }
     if (buf[2] != a_sgp41_generate_crc((uint8_t *)buf, 2))                                       /* check crc */
     {
-        handle->debug_print("sgp41: measure test check error.\n");                               /* measure test check error */
+        SGP41_DEBUG(handle, MEASURE_TEST_CHECK_ERROR, 0);                                        /* measure test check error */
        
         return 1;                                                                                /* return error */
     }
@@ -521,7 +536,7 @@ uint8_t sgp41_soft_reset(sgp41_handle_t *handle)
     res = handle->iic_write_cmd(0x00, (uint8_t *)&reg, 1);               /* write reset config */
     if (res != 0)                                                        /* check result */
     {
-        handle->debug_print("sgp41: write soft reset failed.\n");        /* write soft reset failed */
+        SGP41_DEBUG(handle, WRITE_SOFT_RESET_FAILED, 0);                 /* write soft reset failed */
        
         return 1;                                                        /* return error */
     }
@@ -556,7 +571,7 @@ uint8_t sgp41_turn_heater_off(sgp41_handle_t *handle)
     res = a_sgp41_iic_write(handle, SGP41_COMMAND_TURN_HEATER_OFF, NULL, 0);        /* write turn heater off command */
     if (res != 0)                                                                   /* check result */
     {
-        handle->debug_print("sgp41: write turn heater off failed.\n");              /* write turn heater off failed */
+        SGP41_DEBUG(handle, WRITE_TURN_HEATER_OFF_FAILED, 0);                       /* write turn heater off failed */
        
         return 1;                                                                   /* return error */
     }
@@ -594,25 +609,25 @@ uint8_t sgp41_get_serial_id(sgp41_handle_t *handle, uint16_t id[3])
     res = a_sgp41_iic_read(handle, SGP41_COMMAND_GET_SERIAL_ID, (uint8_t *)buf, 9, 1);        /* read config */
     if (res != 0)                                                                             /* check result */
     {
-        handle->debug_print("sgp41: read serial id failed.\n");                               /* read serial id failed */
+        SGP41_DEBUG(handle, READ_SERIAL_ID_FAILED, 0);                                        /* read serial id failed */
        
         return 1;                                                                             /* return error */
     }
     if (buf[2] != a_sgp41_generate_crc((uint8_t *)&buf[0], 2))                                /* check 1st crc */
     {
-        handle->debug_print("sgp41: crc 1 check failed.\n");                                  /* crc 1 check failed */
+        SGP41_DEBUG(handle, SERIAL_ID_CRC_ERROR, 1);                                          /* crc 1 check failed */
        
         return 1;                                                                             /* return error */
     }
     if (buf[5] != a_sgp41_generate_crc((uint8_t *)&buf[3], 2))                                /* check 2nd crc */
     {
-        handle->debug_print("sgp41: crc 2 check failed.\n");                                  /* crc 2 check failed */
+        SGP41_DEBUG(handle, SERIAL_ID_CRC_ERROR, 2);                                          /* crc 2 check failed */
        
         return 1;                                                                             /* return error */
     }    
     if (buf[8] != a_sgp41_generate_crc((uint8_t *)&buf[6], 2))                                /* check 3rd crc */
     {
-        handle->debug_print("sgp41: crc 3 check failed.\n");                                  /* crc 3 check failed */
+        SGP41_DEBUG(handle, SERIAL_ID_CRC_ERROR, 3);                                          /* crc 3 check failed */
        
         return 1;                                                                             /* return error */
     }
@@ -623,6 +638,330 @@ uint8_t sgp41_get_serial_id(sgp41_handle_t *handle, uint16_t id[3])
     return 0;                                                                                 /* success return 0 */
 }
 
+/**
+ * @brief     start the execute conditioning command
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start execute conditioning failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      read the result with sgp41_read_execute_conditioning after
+ *            SGP41_EXECUTION_TIME_CONDITIONING_MS
+ */
+uint8_t sgp41_start_execute_conditioning(sgp41_handle_t *handle)
+{
+    uint8_t input[6];
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    input[0] = 0x80;                                                                               /* index 0 */
+    input[1] = 0x00;                                                                               /* index 1 */
+    input[2] = 0xA2;                                                                               /* index 2 */
+    input[3] = 0x66;                                                                               /* index 3 */
+    input[4] = 0x66;                                                                               /* index 4 */
+    input[5] = 0x93;                                                                               /* index 5 */
+    if (a_sgp41_iic_write(handle, SGP41_COMMAND_EXECUTE_CONDITIONING, input, 6) != 0)              /* write command */
+    {
+        SGP41_DEBUG(handle, WRITE_EXECUTE_CONDITIONING_FAILED, 0);                                 /* write execute conditioning failed */
+       
+        return 1;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      read the execute conditioning result
+ * @param[in]  *handle pointer to an sgp41 handle structure
+ * @param[out] *sraw_voc pointer to a raw tvoc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read execute conditioning failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_read_execute_conditioning(sgp41_handle_t *handle, uint16_t *sraw_voc)
+{
+    uint8_t buf[3];
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    memset(buf, 0, sizeof(uint8_t) * 3);                                                           /* clear the buffer */
+    if (handle->iic_read_cmd(SGP41_ADDRESS, buf, 3) != 0)                                          /* read data */
+    {
+        SGP41_DEBUG(handle, READ_EXECUTE_CONDITIONING_FAILED, 0);                                  /* read execute conditioning failed */
+       
+        return 1;                                                                                  /* return error */
+    }
+    if (buf[2] != a_sgp41_generate_crc((uint8_t *)buf, 2))                                         /* check 1st crc */
+    {
+        SGP41_DEBUG(handle, SRAW_VOC_CRC_ERROR, 0);                                                /* sraw voc crc check error */
+       
+        return 1;                                                                                  /* return error */
+    }
+    *sraw_voc = (uint16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                      /* get raw voc data */
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     start the measure raw command
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @param[in] raw_humidity humidity raw data
+ * @param[in] raw_temperature temperature raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 start measure raw failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      read the result with sgp41_read_measure_raw after SGP41_EXECUTION_TIME_MEASURE_RAW_MS,
+ *            use 0x8000 and 0x6666 to measure without compensation
+ */
+uint8_t sgp41_start_measure_raw(sgp41_handle_t *handle, uint16_t raw_humidity, uint16_t raw_temperature)
+{
+    uint8_t input[6];
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    input[0] = (raw_humidity >> 8) & 0xFF;                                                         /* index 0 */
+    input[1] = (raw_humidity >> 0) & 0xFF;                                                         /* index 1 */
+    input[2] = a_sgp41_generate_crc(&input[0], 2);                                                 /* index 2 */
+    input[3] = (raw_temperature >> 8) & 0xFF;                                                      /* index 3 */
+    input[4] = (raw_temperature >> 0) & 0xFF;                                                      /* index 4 */
+    input[5] = a_sgp41_generate_crc(&input[3], 2);                                                 /* index 5 */
+    if (a_sgp41_iic_write(handle, SGP41_COMMAND_MEASURE_RAW, input, 6) != 0)                       /* write command */
+    {
+        SGP41_DEBUG(handle, WRITE_MEASURE_RAW_FAILED, 0);                                          /* write measure raw failed */
+       
+        return 1;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      read the measure raw result
+ * @param[in]  *handle pointer to an sgp41 handle structure
+ * @param[out] *sraw_voc pointer to a raw tvoc buffer
+ * @param[out] *sraw_nox pointer to a raw nox buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read measure raw failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_read_measure_raw(sgp41_handle_t *handle, uint16_t *sraw_voc, uint16_t *sraw_nox)
+{
+    uint8_t buf[6];
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    memset(buf, 0, sizeof(uint8_t) * 6);                                                           /* clear the buffer */
+    if (handle->iic_read_cmd(SGP41_ADDRESS, buf, 6) != 0)                                          /* read data */
+    {
+        SGP41_DEBUG(handle, READ_MEASURE_RAW_FAILED, 0);                                           /* read measure raw failed */
+       
+        return 1;                                                                                  /* return error */
+    }
+    if (buf[2] != a_sgp41_generate_crc((uint8_t *)buf, 2))                                         /* check 1st crc */
+    {
+        SGP41_DEBUG(handle, SRAW_VOC_CRC_ERROR, 0);                                                /* sraw voc crc check error */
+       
+        return 1;                                                                                  /* return error */
+    }
+    if (buf[5] != a_sgp41_generate_crc((uint8_t *)&buf[3], 2))                                     /* check 2nd crc */
+    {
+        SGP41_DEBUG(handle, SRAW_NOX_CRC_ERROR, 0);                                                /* sraw nox crc check error */
+       
+        return 1;                                                                                  /* return error */
+    }
+    *sraw_voc = (uint16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                      /* get raw voc data */
+    *sraw_nox = (uint16_t)(((uint16_t)buf[3]) << 8 | buf[4]);                                      /* get raw nox data */
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     start the self test command
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start measure test failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      read the result with sgp41_read_measure_test after SGP41_EXECUTION_TIME_SELF_TEST_MS
+ */
+uint8_t sgp41_start_measure_test(sgp41_handle_t *handle)
+{
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    if (a_sgp41_iic_write(handle, SGP41_COMMAND_EXECUTE_SELF_TEST, NULL, 0) != 0)                  /* write command */
+    {
+        SGP41_DEBUG(handle, WRITE_MEASURE_TEST_FAILED, 0);                                         /* write measure test failed */
+       
+        return 1;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      read the self test result
+ * @param[in]  *handle pointer to an sgp41 handle structure
+ * @param[out] *result pointer to a result buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read measure test failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_read_measure_test(sgp41_handle_t *handle, uint16_t *result)
+{
+    uint8_t buf[3];
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    memset(buf, 0, sizeof(uint8_t) * 3);                                                           /* clear the buffer */
+    if (handle->iic_read_cmd(SGP41_ADDRESS, buf, 3) != 0)                                          /* read data */
+    {
+        SGP41_DEBUG(handle, READ_MEASURE_TEST_FAILED, 0);                                          /* read measure test failed */
+       
+        return 1;                                                                                  /* return error */
+    }
+    if (buf[2] != a_sgp41_generate_crc((uint8_t *)buf, 2))                                         /* check crc */
+    {
+        SGP41_DEBUG(handle, MEASURE_TEST_CHECK_ERROR, 0);                                          /* measure test check error */
+       
+        return 1;                                                                                  /* return error */
+    }
+    *result = (uint16_t)(((uint16_t)buf[0]) << 8 | buf[1]);                                        /* combine data */
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     start the get serial id command
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start get serial id failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      read the result with sgp41_read_serial_id after SGP41_EXECUTION_TIME_SERIAL_ID_MS
+ */
+uint8_t sgp41_start_serial_id(sgp41_handle_t *handle)
+{
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    if (a_sgp41_iic_write(handle, SGP41_COMMAND_GET_SERIAL_ID, NULL, 0) != 0)                      /* write command */
+    {
+        SGP41_DEBUG(handle, WRITE_SERIAL_ID_FAILED, 0);                                            /* write serial id failed */
+       
+        return 1;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      read the serial id result
+ * @param[in]  *handle pointer to an sgp41 handle structure
+ * @param[out] *id pointer to an id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read serial id failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_read_serial_id(sgp41_handle_t *handle, uint16_t id[3])
+{
+    uint8_t buf[9];
+    uint8_t i;
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    memset(buf, 0, sizeof(uint8_t) * 9);                                                           /* clear the buffer */
+    if (handle->iic_read_cmd(SGP41_ADDRESS, buf, 9) != 0)                                          /* read data */
+    {
+        SGP41_DEBUG(handle, READ_SERIAL_ID_FAILED, 0);                                             /* read serial id failed */
+       
+        return 1;                                                                                  /* return error */
+    }
+    for (i = 0; i < 3; i++)
+    {
+        if (buf[i * 3 + 2] != a_sgp41_generate_crc((uint8_t *)&buf[i * 3], 2))                     /* check crc */
+        {
+            SGP41_DEBUG(handle, SERIAL_ID_CRC_ERROR, i + 1);                                       /* crc check failed */
+           
+            return 1;                                                                              /* return error */
+        }
+        id[i] = (uint16_t)((((uint16_t)buf[i * 3]) << 8) | buf[i * 3 + 1]);                        /* set id */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
 /**
  * @brief     initialize the chip
  * @param[in] *handle pointer to an sgp41 handle structure
@@ -639,44 +978,46 @@ uint8_t sgp41_init(sgp41_handle_t *handle)
     {
         return 2;                                                            /* return error */
     }
+#if (SGP41_LOG_LEVEL >= SGP41_LOG_LEVEL_TEXT)
     if (handle->debug_print == NULL)                                         /* check debug_print */
     {
         return 3;                                                            /* return error */
     }
+#endif
     if (handle->iic_init == NULL)                                            /* check iic_init */
     {
-        handle->debug_print("sgp41: iic_init is null.\n");                   /* iic_init is null */
+        SGP41_DEBUG(handle, IIC_INIT_NULL, 0);                               /* iic_init is null */
     
         return 3;                                                            /* return error */
     }
     if (handle->iic_deinit == NULL)                                          /* check iic_deinit */
     {
-        handle->debug_print("sgp41: iic_deinit is null.\n");                 /* iic_deinit is null */
+        SGP41_DEBUG(handle, IIC_DEINIT_NULL, 0);                             /* iic_deinit is null */
     
         return 3;                                                            /* return error */
     }
     if (handle->iic_write_cmd == NULL)                                       /* check iic_write_cmd */
     {
-        handle->debug_print("sgp41: iic_write_cmd is null.\n");              /* iic_write_cmd is null */
+        SGP41_DEBUG(handle, IIC_WRITE_CMD_NULL, 0);                          /* iic_write_cmd is null */
     
         return 3;                                                            /* return error */
     }
     if (handle->iic_read_cmd == NULL)                                        /* check iic_read_cmd */
     {
-        handle->debug_print("sgp41: iic_read_cmd is null.\n");               /* iic_read_cmd is null */
+        SGP41_DEBUG(handle, IIC_READ_CMD_NULL, 0);                           /* iic_read_cmd is null */
     
         return 3;                                                            /* return error */
     }
     if (handle->delay_ms == NULL)                                            /* check delay_ms */
     {
-        handle->debug_print("sgp41: delay_ms is null.\n");                   /* delay_ms is null */
+        SGP41_DEBUG(handle, DELAY_MS_NULL, 0);                               /* delay_ms is null */
     
         return 3;                                                            /* return error */
     }
     
     if (handle->iic_init() != 0)                                             /* iic init */
     {
-        handle->debug_print("sgp41: iic init failed.\n");                    /* iic init failed */
+        SGP41_DEBUG(handle, IIC_INIT_FAILED, 0);                             /* iic init failed */
     
         return 3;                                                            /* return error */
     }
@@ -709,13 +1050,13 @@ uint8_t sgp41_deinit(sgp41_handle_t *handle)
     
     if (sgp41_turn_heater_off(handle) != 0)                             /* turn heater off */
     {
-        handle->debug_print("sgp41: turn heater off failed.\n");        /* turn heater off failed */
+        SGP41_DEBUG(handle, TURN_HEATER_OFF_FAILED, 0);                 /* turn heater off failed */
     
         return 4;                                                       /* return error */
     }
     if (handle->iic_deinit() != 0)                                      /* iic deinit */
     {
-        handle->debug_print("sgp41: iic close failed.\n");              /* iic close failed */
+        SGP41_DEBUG(handle, IIC_CLOSE_FAILED, 0);                       /* iic close failed */
     
         return 3;                                                       /* return error */
     }
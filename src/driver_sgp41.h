@@ -67,6 +67,7 @@ typedef struct sgp41_handle_s
     uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);         /**< point to an iic_read_cmd function address */
     void (*delay_ms)(uint32_t ms);                                             /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                           /**< point to a debug_print function address */
+    void (*debug_log)(uint8_t id, uint16_t arg);                               /**< point to a debug_log function address */
     uint8_t inited;                                                            /**< inited flag */
 } sgp41_handle_t;
 
@@ -153,6 +154,15 @@ typedef struct sgp41_info_s
  */
 #define DRIVER_SGP41_LINK_DEBUG_PRINT(HANDLE, FUC)          (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link debug_log function
+ * @param[in] HANDLE pointer to an sgp41 handle structure
+ * @param[in] FUC pointer to a debug_log function address
+ * @note      used instead of debug_print when the driver is built with SGP41_LOG_LEVEL_BINARY,
+ *            optional, the messages are dropped when it is not linked
+ */
+#define DRIVER_SGP41_LINK_DEBUG_LOG(HANDLE, FUC)            (HANDLE)->debug_log = FUC
+
 /**
  * @}
  */
@@ -321,6 +331,130 @@ uint8_t sgp41_turn_heater_off(sgp41_handle_t *handle);
  */
 uint8_t sgp41_get_serial_id(sgp41_handle_t *handle, uint16_t id[3]);
 
+/**
+ * @}
+ */
+
+/**
+ * @defgroup sgp41_async_driver sgp41 async driver function
+ * @brief    sgp41 async driver modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 execution time definition
+ */
+#define SGP41_EXECUTION_TIME_CONDITIONING_MS        50         /**< execute conditioning time in ms */
+#define SGP41_EXECUTION_TIME_MEASURE_RAW_MS         50         /**< measure raw time in ms */
+#define SGP41_EXECUTION_TIME_SELF_TEST_MS           320        /**< execute self test time in ms */
+#define SGP41_EXECUTION_TIME_SERIAL_ID_MS           1          /**< get serial id time in ms */
+
+/**
+ * @brief     start the execute conditioning command
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start execute conditioning failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      read the result with sgp41_read_execute_conditioning after
+ *            SGP41_EXECUTION_TIME_CONDITIONING_MS
+ */
+uint8_t sgp41_start_execute_conditioning(sgp41_handle_t *handle);
+
+/**
+ * @brief      read the execute conditioning result
+ * @param[in]  *handle pointer to an sgp41 handle structure
+ * @param[out] *sraw_voc pointer to a raw tvoc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read execute conditioning failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_read_execute_conditioning(sgp41_handle_t *handle, uint16_t *sraw_voc);
+
+/**
+ * @brief     start the measure raw command
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @param[in] raw_humidity humidity raw data
+ * @param[in] raw_temperature temperature raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 start measure raw failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      read the result with sgp41_read_measure_raw after SGP41_EXECUTION_TIME_MEASURE_RAW_MS,
+ *            use 0x8000 and 0x6666 to measure without compensation
+ */
+uint8_t sgp41_start_measure_raw(sgp41_handle_t *handle, uint16_t raw_humidity, uint16_t raw_temperature);
+
+/**
+ * @brief      read the measure raw result
+ * @param[in]  *handle pointer to an sgp41 handle structure
+ * @param[out] *sraw_voc pointer to a raw tvoc buffer
+ * @param[out] *sraw_nox pointer to a raw nox buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read measure raw failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_read_measure_raw(sgp41_handle_t *handle, uint16_t *sraw_voc, uint16_t *sraw_nox);
+
+/**
+ * @brief     start the self test command
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start measure test failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      read the result with sgp41_read_measure_test after SGP41_EXECUTION_TIME_SELF_TEST_MS
+ */
+uint8_t sgp41_start_measure_test(sgp41_handle_t *handle);
+
+/**
+ * @brief      read the self test result
+ * @param[in]  *handle pointer to an sgp41 handle structure
+ * @param[out] *result pointer to a result buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read measure test failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_read_measure_test(sgp41_handle_t *handle, uint16_t *result);
+
+/**
+ * @brief     start the get serial id command
+ * @param[in] *handle pointer to an sgp41 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start get serial id failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      read the result with sgp41_read_serial_id after SGP41_EXECUTION_TIME_SERIAL_ID_MS
+ */
+uint8_t sgp41_start_serial_id(sgp41_handle_t *handle);
+
+/**
+ * @brief      read the serial id result
+ * @param[in]  *handle pointer to an sgp41 handle structure
+ * @param[out] *id pointer to an id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read serial id failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_read_serial_id(sgp41_handle_t *handle, uint16_t id[3]);
+
 /**
  * @}
  */
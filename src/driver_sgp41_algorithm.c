@@ -99,16 +99,12 @@
 #define MEAN_VARIANCE_ESTIMATOR_FIX16_MAX                            (32767.f)                 /**< mean variance estimator fix16 max */
 
 /**
- * @brief     mean variance estimator set parameters
+ * @brief     mean variance estimator set gamma
  * @param[in] *params pointer to an sgp41 gas index algorithm handle structure
- * @note      none
+ * @note      the gamma only depend on the sampling interval and the tuning, the states are kept
  */
-static void a_mean_variance_estimator_set_parameters(sgp41_gas_index_algorithm_t *params)
+static void a_mean_variance_estimator_set_gamma(sgp41_gas_index_algorithm_t *params)
 {
-    params->m_mean_variance_estimator_initialized = 0;                                                                                  /* init 0 */
-    params->m_mean_variance_estimator_mean = 0.f;                                                                                       /* init mean */
-    params->m_mean_variance_estimator_sraw_offset = 0.f;                                                                                /* int offset */
-    params->m_mean_variance_estimator_std = params->m_sraw_std_initial;                                                                 /* int std */
     params->m_mean_variance_estimator_gamma_mean = (((MEAN_VARIANCE_ESTIMATOR_ADDITIONAL_GAMMA_MEAN_SCALING *
                                                     MEAN_VARIANCE_ESTIMATOR_GAMMA_SCALING) *
                                                    (params->m_sampling_interval / 3600.f)) /
@@ -135,6 +131,20 @@ static void a_mean_variance_estimator_set_parameters(sgp41_gas_index_algorithm_t
     params->m_mean_variance_estimator_gamma_initial_variance = ((MEAN_VARIANCE_ESTIMATOR_GAMMA_SCALING *
                                                                 params->m_sampling_interval) /
                                                                (TAU_INITIAL_VARIANCE + params->m_sampling_interval));                   /* set variance */
+}
+
+/**
+ * @brief     mean variance estimator set parameters
+ * @param[in] *params pointer to an sgp41 gas index algorithm handle structure
+ * @note      none
+ */
+static void a_mean_variance_estimator_set_parameters(sgp41_gas_index_algorithm_t *params)
+{
+    params->m_mean_variance_estimator_initialized = 0;                                                                                  /* init 0 */
+    params->m_mean_variance_estimator_mean = 0.f;                                                                                       /* init mean */
+    params->m_mean_variance_estimator_sraw_offset = 0.f;                                                                                /* int offset */
+    params->m_mean_variance_estimator_std = params->m_sraw_std_initial;                                                                 /* int std */
+    a_mean_variance_estimator_set_gamma(params);                                                                                        /* set gamma */
     params->m_mean_variance_estimator_n_gamma_mean = 0.f;                                                                               /* init mean */
     params->m_mean_variance_estimator_n_gamma_variance = 0.f;                                                                           /* init variance */
     params->m_mean_variance_estimator_uptime_gamma = 0.f;                                                                               /* init gamma */
@@ -192,16 +202,26 @@ static void a_sigmoid_scaled_set_parameters(sgp41_gas_index_algorithm_t *params,
 }
 
 /**
- * @brief     adaptive lowpass set parameters
+ * @brief     adaptive lowpass set coefficients
  * @param[in] *params pointer to an sgp41 gas index algorithm handle structure
- * @note      none
+ * @note      the filter states are kept
  */
-static void a_adaptive_lowpass_set_parameters(sgp41_gas_index_algorithm_t *params)
+static void a_adaptive_lowpass_set_coefficients(sgp41_gas_index_algorithm_t *params)
 {
     params->m_adaptive_lowpass_a1 = (params->m_sampling_interval /
                                     (LP_TAU_FAST + params->m_sampling_interval));        /* set a1 */
     params->m_adaptive_lowpass_a2 = (params->m_sampling_interval /
                                     (LP_TAU_SLOW + params->m_sampling_interval));        /* set a2 */
+}
+
+/**
+ * @brief     adaptive lowpass set parameters
+ * @param[in] *params pointer to an sgp41 gas index algorithm handle structure
+ * @note      none
+ */
+static void a_adaptive_lowpass_set_parameters(sgp41_gas_index_algorithm_t *params)
+{
+    a_adaptive_lowpass_set_coefficients(params);                                         /* set a1 and a2 */
     params->m_adaptive_lowpass_initialized = 0;                                          /* init 0 */
 }
 
@@ -292,7 +312,7 @@ static float a_mean_variance_estimator_sigmoid_process(sgp41_gas_index_algorithm
     }
     else
     {
-        return (1.f / (1.f + expf(x)));                                  /* return sigmoid */
+        return (1.f / (1.f + SGP41_ALGORITHM_EXPF(x)));                  /* return sigmoid */
     }
 }
 
@@ -397,7 +417,9 @@ static void a_mean_variance_estimator_process(sgp41_gas_index_algorithm_t *param
             params->m_mean_variance_estimator_mean = 0.f;                                                           /* init mean */
         }
         sraw = (sraw - params->m_mean_variance_estimator_sraw_offset);                                              /* set sraw */
+        SGP41_ALGORITHM_PROBE(SGP41_ALGORITHM_STAGE_GAMMA);                                                         /* gamma stage */
         a_mean_variance_estimator_calculate_gamma(params);                                                          /* set gamma */
+        SGP41_ALGORITHM_PROBE(SGP41_ALGORITHM_STAGE_ESTIMATOR);                                                     /* back to the estimator */
         delta_sgp = ((sraw - params->m_mean_variance_estimator_mean) /
                      MEAN_VARIANCE_ESTIMATOR_GAMMA_SCALING);                                                        /* set sgp */
         if ((delta_sgp < 0.f))                                                                                      /* check sgp */
@@ -484,13 +506,13 @@ static float a_sigmoid_scaled_process(sgp41_gas_index_algorithm_t *params, float
                 shift = ((SIGMOID_L - (5.f * params->m_index_offset)) / 4.f);         /* set shift */
             }
             
-            return (((SIGMOID_L + shift) / (1.f + expf(x))) - shift);                 /* return sigmoid */
+            return (((SIGMOID_L + shift) / (1.f + SGP41_ALGORITHM_EXPF(x))) - shift); /* return sigmoid */
         }
         else
         {
             return ((params->m_index_offset /
                     params->m_sigmoid_scaled_offset_default) *
-                   (SIGMOID_L / (1.f + expf(x))));                                    /* return sigmoid */
+                   (SIGMOID_L / (1.f + SGP41_ALGORITHM_EXPF(x))));                    /* return sigmoid */
         }
     }
 }
@@ -526,7 +548,7 @@ static float a_adaptive_lowpass_process(sgp41_gas_index_algorithm_t *params, flo
     {
         abs_delta = (-1.f * abs_delta);                                                      /* get delta */
     }
-    f1 = expf((LP_ALPHA * abs_delta));                                                       /* get f1 */
+    f1 = SGP41_ALGORITHM_EXPF((LP_ALPHA * abs_delta));                                       /* get f1 */
     tau_a = (((LP_TAU_SLOW - LP_TAU_FAST) * f1) + LP_TAU_FAST);                              /* set tau a */
     a3 = (params->m_sampling_interval / (params->m_sampling_interval + tau_a));              /* set a3 */
     params->m_adaptive_lowpass_x3 = (((1.f - a3) * 
@@ -544,6 +566,7 @@ void sgp41_algorithm_reset(sgp41_gas_index_algorithm_t *params)
     params->m_uptime = 0.f;          /* init uptime */
     params->m_sraw = 0.f;            /* init sraw */
     params->m_gas_index = 0;         /* int gas index */
+    params->m_timestamp_valid = 0;   /* no timestamp */
     a_init_instances(params);        /* init instances */
 }
 
@@ -678,13 +701,15 @@ void sgp41_algorithm_get_tuning_parameters(const sgp41_gas_index_algorithm_t *pa
 }
 
 /**
- * @brief      algorithm process
+ * @brief      process one sample
  * @param[in]  *params pointer to an sgp41 gas index algorithm handle structure
  * @param[in]  sraw source raw
  * @param[out] *gas_index pointer to a gas index buffer
+ * @note       inlined into the single sample and the run entry
  */
-void sgp41_algorithm_process(sgp41_gas_index_algorithm_t *params, int32_t sraw, int32_t *gas_index)
+static inline void a_algorithm_process(sgp41_gas_index_algorithm_t *params, int32_t sraw, int32_t *gas_index)
 {
+    SGP41_ALGORITHM_PROBE(SGP41_ALGORITHM_STAGE_INPUT);                                         /* input stage */
     if ((params->m_uptime <= INITIAL_BLACKOUT))                                                 /* check time */
     {
         params->m_uptime = (params->m_uptime + params->m_sampling_interval);                    /* set time */
@@ -706,18 +731,22 @@ void sgp41_algorithm_process(sgp41_gas_index_algorithm_t *params, int32_t sraw,
         if (((params->m_algorithm_type == SGP41_ALGORITHM_TYPE_VOC) 
             || a_mean_variance_estimator_is_initialized(params)))                               /* voc */
         {
+            SGP41_ALGORITHM_PROBE(SGP41_ALGORITHM_STAGE_MOX);                                   /* mox stage */
             params->m_gas_index = a_mox_model_process(params, params->m_sraw);                  /* set ga index */
+            SGP41_ALGORITHM_PROBE(SGP41_ALGORITHM_STAGE_SIGMOID);                               /* sigmoid stage */
             params->m_gas_index = a_sigmoid_scaled_process(params, params->m_gas_index);        /* set ga index */
         }
         else
         {
             params->m_gas_index = params->m_index_offset;                                       /* set gas index */
         }
+        SGP41_ALGORITHM_PROBE(SGP41_ALGORITHM_STAGE_LOWPASS);                                   /* lowpass stage */
         params->m_gas_index = a_adaptive_lowpass_process(params, params->m_gas_index);          /* set gas index */
         if ((params->m_gas_index < 0.5f))                                                       /* check gas index */
         {
             params->m_gas_index = 0.5f;                                                         /* set gas index */
         }
+        SGP41_ALGORITHM_PROBE(SGP41_ALGORITHM_STAGE_ESTIMATOR);                                 /* estimator stage */
         if ((params->m_sraw > 0.f))                                                             /* check sraw */
         {
             a_mean_variance_estimator_process(params, params->m_sraw);                          /* sraw */
@@ -727,4 +756,140 @@ void sgp41_algorithm_process(sgp41_gas_index_algorithm_t *params, int32_t sraw,
         }
     }
     *gas_index = ((int32_t)((params->m_gas_index + 0.5f)));                                     /* get gas index */
+    SGP41_ALGORITHM_PROBE(SGP41_ALGORITHM_STAGE_END);                                           /* end */
+}
+
+/**
+ * @brief      algorithm process
+ * @param[in]  *params pointer to an sgp41 gas index algorithm handle structure
+ * @param[in]  sraw source raw
+ * @param[out] *gas_index pointer to a gas index buffer
+ */
+void sgp41_algorithm_process(sgp41_gas_index_algorithm_t *params, int32_t sraw, int32_t *gas_index)
+{
+    a_algorithm_process(params, sraw, gas_index);                                        /* process */
+}
+
+/**
+ * @brief      algorithm process a run of samples
+ * @param[in]  *params pointer to an sgp41 gas index algorithm handle structure
+ * @param[in]  *sraw pointer to source raw samples
+ * @param[in]  count sample number
+ * @param[out] *gas_index pointer to a gas index buffer of count values
+ * @note       the samples are one sampling interval apart, the state is copied to the stack for
+ *             the run so the index stores cannot alias it, the indices equal count calls of
+ *             sgp41_algorithm_process
+ */
+void sgp41_algorithm_process_run(sgp41_gas_index_algorithm_t *params, const int32_t *sraw, uint32_t count, int32_t *gas_index)
+{
+    sgp41_gas_index_algorithm_t state;
+    uint32_t i;
+    
+    state = *params;                                                                     /* local copy */
+    for (i = 0; i < count; i++)                                                          /* every sample */
+    {
+        a_algorithm_process(&state, sraw[i], &gas_index[i]);                             /* process */
+    }
+    *params = state;                                                                     /* write back */
+}
+
+/**
+ * @brief      algorithm process a voc and a nox run of samples
+ * @param[in]  *voc_params pointer to the voc sgp41 gas index algorithm handle structure
+ * @param[in]  *nox_params pointer to the nox sgp41 gas index algorithm handle structure
+ * @param[in]  *sraw_voc pointer to voc source raw samples
+ * @param[in]  *sraw_nox pointer to nox source raw samples
+ * @param[in]  count sample number of both runs
+ * @param[out] *voc_index pointer to a voc gas index buffer of count values
+ * @param[out] *nox_index pointer to a nox gas index buffer of count values
+ * @note       every sample is a long chain of dependent float operations, the two states are
+ *             independent and are stepped in turn so the cpu overlaps the two chains, the
+ *             indices equal two sgp41_algorithm_process_run calls
+ */
+void sgp41_algorithm_process_run_pair(sgp41_gas_index_algorithm_t *voc_params, sgp41_gas_index_algorithm_t *nox_params,
+                                      const int32_t *sraw_voc, const int32_t *sraw_nox, uint32_t count,
+                                      int32_t *voc_index, int32_t *nox_index)
+{
+    sgp41_gas_index_algorithm_t voc;
+    sgp41_gas_index_algorithm_t nox;
+    uint32_t i;
+    
+    voc = *voc_params;                                                                   /* local copy */
+    nox = *nox_params;                                                                   /* local copy */
+    for (i = 0; i < count; i++)                                                          /* every sample */
+    {
+        a_algorithm_process(&voc, sraw_voc[i], &voc_index[i]);                           /* voc */
+        a_algorithm_process(&nox, sraw_nox[i], &nox_index[i]);                           /* nox */
+    }
+    *voc_params = voc;                                                                   /* write back */
+    *nox_params = nox;                                                                   /* write back */
+}
+
+/**
+ * @brief      algorithm process with the elapsed time
+ * @param[in]  *params pointer to an sgp41 gas index algorithm handle structure
+ * @param[in]  sraw source raw
+ * @param[in]  elapsed time since the last processed sample in seconds
+ * @param[out] *gas_index pointer to a gas index buffer
+ * @note       every time dependent term uses elapsed for this sample only, elapsed <= 0 is a
+ *             duplicate or a backwards sample and leaves the state unchanged, elapsed equal to
+ *             the sampling interval is a nominal step, elapsed > SGP41_ALGORITHM_MAX_GAP is an
+ *             outage step
+ */
+void sgp41_algorithm_process_with_elapsed(sgp41_gas_index_algorithm_t *params, int32_t sraw, float elapsed, int32_t *gas_index)
+{
+    float sampling_interval;
+    
+    if (!(elapsed > 0.f))                                                                /* no time advance */
+    {
+        *gas_index = ((int32_t)((params->m_gas_index + 0.5f)));                          /* last gas index */
+        
+        return;
+    }
+    if ((elapsed == params->m_sampling_interval))                                        /* nominal step */
+    {
+        sgp41_algorithm_process(params, sraw, gas_index);                                /* process */
+        
+        return;
+    }
+    if ((elapsed > SGP41_ALGORITHM_MAX_GAP))                                             /* outage */
+    {
+        elapsed = SGP41_ALGORITHM_MAX_GAP;                                               /* bound the learning step */
+        params->m_adaptive_lowpass_initialized = 0;                                      /* the filtered output is stale */
+    }
+    sampling_interval = params->m_sampling_interval;                                     /* save interval */
+    params->m_sampling_interval = elapsed;                                               /* set elapsed */
+    a_mean_variance_estimator_set_gamma(params);                                         /* set gamma */
+    a_adaptive_lowpass_set_coefficients(params);                                         /* set a1 and a2 */
+    sgp41_algorithm_process(params, sraw, gas_index);                                    /* process */
+    params->m_sampling_interval = sampling_interval;                                     /* restore interval */
+    a_mean_variance_estimator_set_gamma(params);                                         /* restore gamma */
+    a_adaptive_lowpass_set_coefficients(params);                                         /* restore a1 and a2 */
+}
+
+/**
+ * @brief      algorithm process with a timestamp
+ * @param[in]  *params pointer to an sgp41 gas index algorithm handle structure
+ * @param[in]  sraw source raw
+ * @param[in]  timestamp_ms monotonic sample time in ms
+ * @param[out] *gas_index pointer to a gas index buffer
+ * @note       the first sample after init or reset is a nominal step, the counter may wrap,
+ *             a duplicate or backwards timestamp leaves the state unchanged and a backwards
+ *             one becomes the new time base
+ */
+void sgp41_algorithm_process_with_timestamp(sgp41_gas_index_algorithm_t *params, int32_t sraw, uint32_t timestamp_ms, int32_t *gas_index)
+{
+    float elapsed;
+    
+    if ((params->m_timestamp_valid == 0))                                                /* first sample */
+    {
+        params->m_timestamp_ms = timestamp_ms;                                           /* save timestamp */
+        params->m_timestamp_valid = 1;                                                   /* set valid */
+        sgp41_algorithm_process(params, sraw, gas_index);                                /* nominal step */
+        
+        return;
+    }
+    elapsed = ((float)((int32_t)(timestamp_ms - params->m_timestamp_ms)) / 1000.f);      /* wrap safe signed difference */
+    params->m_timestamp_ms = timestamp_ms;                                               /* save timestamp */
+    sgp41_algorithm_process_with_elapsed(params, sraw, elapsed, gas_index);              /* process */
 }
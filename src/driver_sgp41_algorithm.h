@@ -65,6 +65,45 @@ extern "C"{
 #define SGP41_ALGORITHM_TYPE_VOC        (0)        /**< voc type */
 #define SGP41_ALGORITHM_TYPE_NOX        (1)        /**< nox type */
 
+/**
+ * @brief sgp41 algorithm gap definition
+ */
+#ifndef SGP41_ALGORITHM_MAX_GAP
+    #define SGP41_ALGORITHM_MAX_GAP     (600.f)    /**< longest step in seconds, a longer elapsed time is an outage */
+#endif
+
+/**
+ * @brief sgp41 algorithm stage definition
+ */
+#define SGP41_ALGORITHM_STAGE_INPUT         (0)        /**< blackout and sraw clamp */
+#define SGP41_ALGORITHM_STAGE_MOX           (1)        /**< mox model */
+#define SGP41_ALGORITHM_STAGE_SIGMOID       (2)        /**< sigmoid scaling */
+#define SGP41_ALGORITHM_STAGE_LOWPASS       (3)        /**< adaptive lowpass */
+#define SGP41_ALGORITHM_STAGE_ESTIMATOR     (4)        /**< mean variance estimator */
+#define SGP41_ALGORITHM_STAGE_GAMMA         (5)        /**< mean variance estimator gamma */
+#define SGP41_ALGORITHM_STAGE_END           (6)        /**< end of the process */
+
+/**
+ * @brief sgp41 algorithm profile definition, with SGP41_ALGORITHM_PROFILE defined the process calls
+ *        sgp41_algorithm_profile_probe at the start of every stage and the exponential goes through
+ *        sgp41_algorithm_profile_expf, driver_sgp41_algorithm_profile.c provides both functions
+ */
+#ifdef SGP41_ALGORITHM_PROFILE
+    #define SGP41_ALGORITHM_PROBE(stage)    sgp41_algorithm_profile_probe(stage)
+    #ifndef SGP41_ALGORITHM_EXPF
+        #define SGP41_ALGORITHM_EXPF(x)     sgp41_algorithm_profile_expf(x)
+    #endif
+#else
+    #define SGP41_ALGORITHM_PROBE(stage)
+#endif
+
+/**
+ * @brief sgp41 algorithm math definition, define SGP41_ALGORITHM_EXPF to replace the libm expf
+ */
+#ifndef SGP41_ALGORITHM_EXPF
+    #define SGP41_ALGORITHM_EXPF(x)         expf(x)
+#endif
+
 /**
  * @brief sgp41 gas index algorithm structure definition
  */
@@ -111,6 +150,8 @@ typedef struct sgp41_gas_index_algorithm_s
     float m_adaptive_lowpass_x1;                                    /**< adaptive lowpass x1 */
     float m_adaptive_lowpass_x2;                                    /**< adaptive lowpass x2 */
     float m_adaptive_lowpass_x3;                                    /**< adaptive lowpass x3 */
+    uint32_t m_timestamp_ms;                                        /**< last sample timestamp in ms */
+    uint8_t m_timestamp_valid;                                      /**< last sample timestamp valid */
 } sgp41_gas_index_algorithm_t;
 
 /**
@@ -195,6 +236,81 @@ void sgp41_algorithm_get_tuning_parameters(const sgp41_gas_index_algorithm_t *pa
  */
 void sgp41_algorithm_process(sgp41_gas_index_algorithm_t *params, int32_t sraw, int32_t *gas_index);
 
+/**
+ * @brief      algorithm process a run of samples
+ * @param[in]  *params pointer to an sgp41 gas index algorithm handle structure
+ * @param[in]  *sraw pointer to source raw samples
+ * @param[in]  count sample number
+ * @param[out] *gas_index pointer to a gas index buffer of count values
+ * @note       for backlogs of samples one sampling interval apart, the indices equal count
+ *             calls of sgp41_algorithm_process
+ */
+void sgp41_algorithm_process_run(sgp41_gas_index_algorithm_t *params, const int32_t *sraw, uint32_t count, int32_t *gas_index);
+
+/**
+ * @brief      algorithm process a voc and a nox run of samples
+ * @param[in]  *voc_params pointer to the voc sgp41 gas index algorithm handle structure
+ * @param[in]  *nox_params pointer to the nox sgp41 gas index algorithm handle structure
+ * @param[in]  *sraw_voc pointer to voc source raw samples
+ * @param[in]  *sraw_nox pointer to nox source raw samples
+ * @param[in]  count sample number of both runs
+ * @param[out] *voc_index pointer to a voc gas index buffer of count values
+ * @param[out] *nox_index pointer to a nox gas index buffer of count values
+ * @note       the two states are stepped in turn so their dependency chains overlap, it is about
+ *             a fifth faster than two sgp41_algorithm_process_run calls with the same indices,
+ *             any two independent states work
+ */
+void sgp41_algorithm_process_run_pair(sgp41_gas_index_algorithm_t *voc_params, sgp41_gas_index_algorithm_t *nox_params,
+                                      const int32_t *sraw_voc, const int32_t *sraw_nox, uint32_t count,
+                                      int32_t *voc_index, int32_t *nox_index);
+
+/**
+ * @brief      algorithm process with the elapsed time
+ * @param[in]  *params pointer to an sgp41 gas index algorithm handle structure
+ * @param[in]  sraw source raw
+ * @param[in]  elapsed time since the last processed sample in seconds
+ * @param[out] *gas_index pointer to a gas index buffer
+ * @note       every time dependent term uses elapsed for this sample only, dropped samples are
+ *             simply not passed in and the next call carries their time, elapsed <= 0 is a
+ *             duplicate or a backwards sample: the state is left unchanged and the last gas
+ *             index is returned, elapsed equal to the sampling interval is a nominal step,
+ *             elapsed > SGP41_ALGORITHM_MAX_GAP is an outage: the learning terms advance by
+ *             SGP41_ALGORITHM_MAX_GAP only and the output lowpass restarts from this sample,
+ *             after a power loss of the sensor call sgp41_algorithm_reset instead
+ */
+void sgp41_algorithm_process_with_elapsed(sgp41_gas_index_algorithm_t *params, int32_t sraw, float elapsed, int32_t *gas_index);
+
+/**
+ * @brief      algorithm process with a timestamp
+ * @param[in]  *params pointer to an sgp41 gas index algorithm handle structure
+ * @param[in]  sraw source raw
+ * @param[in]  timestamp_ms monotonic sample time in ms
+ * @param[out] *gas_index pointer to a gas index buffer
+ * @note       the elapsed time is the difference to the last timestamp, the first sample after
+ *             init or reset is a nominal step, the counter may wrap, a timestamp equal to the
+ *             last one or up to 2^31 ms behind it leaves the state unchanged and returns the
+ *             last gas index, a backwards one also becomes the time base of the next sample
+ *             so a restarted clock does not stall the state
+ */
+void sgp41_algorithm_process_with_timestamp(sgp41_gas_index_algorithm_t *params, int32_t sraw, uint32_t timestamp_ms, int32_t *gas_index);
+
+#ifdef SGP41_ALGORITHM_PROFILE
+/**
+ * @brief     algorithm profile probe
+ * @param[in] stage stage that starts now
+ * @note      the time up to the next probe belongs to this stage
+ */
+void sgp41_algorithm_profile_probe(uint8_t stage);
+
+/**
+ * @brief     algorithm profile exponential
+ * @param[in] x exponent
+ * @return    e to the power of x
+ * @note      runs the backend of the attached profile
+ */
+float sgp41_algorithm_profile_expf(float x);
+#endif
+
 /**
  * @}
  */
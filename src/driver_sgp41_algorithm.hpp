@@ -0,0 +1,449 @@
+/**
+ * Copyright (c) 2022 - present Sensirion AG All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of Sensirion AG nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @file      driver_sgp41_algorithm.hpp
+ * @brief     driver sgp41 algorithm c++ header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_ALGORITHM_HPP
+#define DRIVER_SGP41_ALGORITHM_HPP
+
+#include "driver_sgp41_algorithm.h"
+
+/**
+ * @defgroup sgp41_algorithm_cpp sgp41 algorithm c++ function
+ * @brief    sgp41 algorithm compile time specialized modules
+ * @ingroup  sgp41_algorithm
+ * @{
+ */
+
+namespace sgp41
+{
+
+/**
+ * @brief sgp41 algorithm default tuning definition
+ * @note  the members match sgp41_algorithm_set_tuning_parameters, a custom
+ *        tuning is a struct with the same static constexpr members
+ */
+template <int32_t Type>
+struct default_tuning
+{
+    static constexpr int32_t index_offset = (Type == SGP41_ALGORITHM_TYPE_NOX) ? 1 : 100;                           /**< index offset */
+    static constexpr int32_t learning_time_offset_hours = 12;                                                       /**< learning time offset hours */
+    static constexpr int32_t learning_time_gain_hours = 12;                                                         /**< learning time gain hours */
+    static constexpr int32_t gating_max_duration_minutes = (Type == SGP41_ALGORITHM_TYPE_NOX) ? 720 : 180;          /**< gating max duration minutes */
+    static constexpr int32_t std_initial = 50;                                                                      /**< std initial */
+    static constexpr int32_t gain_factor = 230;                                                                     /**< gain factor */
+};
+
+/**
+ * @brief sgp41 gas index algorithm class definition
+ * @note  Type is SGP41_ALGORITHM_TYPE_VOC or SGP41_ALGORITHM_TYPE_NOX, the
+ *        sampling interval is given in ms, every parameter the c version keeps
+ *        in sgp41_gas_index_algorithm_t is a compile time constant here and the
+ *        result is bit identical to sgp41_algorithm_process
+ */
+template <int32_t Type, uint32_t SamplingIntervalMs = 1000, class Tuning = default_tuning<Type> >
+class gas_index_algorithm
+{
+    static_assert((Type == SGP41_ALGORITHM_TYPE_VOC) || (Type == SGP41_ALGORITHM_TYPE_NOX), "invalid algorithm type");
+    static_assert(SamplingIntervalMs > 0, "invalid sampling interval");
+
+  public:
+    /**
+     * @brief compile time parameters
+     */
+    static constexpr bool is_nox = (Type == SGP41_ALGORITHM_TYPE_NOX);                                                           /**< nox flag */
+    static constexpr float sampling_interval = (float)SamplingIntervalMs / 1000.f;                                               /**< sampling interval in s */
+    static constexpr float index_offset = (float)Tuning::index_offset;                                                           /**< index offset */
+    static constexpr int32_t sraw_minimum = is_nox ? 10000 : 20000;                                                              /**< sraw minimum */
+    static constexpr float gating_max_duration_minutes = (float)Tuning::gating_max_duration_minutes;                             /**< gating max duration minutes */
+    static constexpr float init_duration_mean = is_nox ? (3600.f * 4.75f) : (3600.f * 0.75f);                                    /**< init duration mean */
+    static constexpr float init_duration_variance = is_nox ? (3600.f * 5.70f) : (3600.f * 1.45f);                                /**< init duration variance */
+    static constexpr float gating_threshold = is_nox ? 30.f : 340.f;                                                             /**< gating threshold */
+    static constexpr float index_gain = (float)Tuning::gain_factor;                                                              /**< index gain */
+    static constexpr float tau_mean_hours = (float)Tuning::learning_time_offset_hours;                                           /**< tau mean hours */
+    static constexpr float tau_variance_hours = (float)Tuning::learning_time_gain_hours;                                          /**< tau variance hours */
+    static constexpr float sraw_std_initial = (float)Tuning::std_initial;                                                        /**< sraw std initial */
+    static constexpr float gamma_mean = ((8.f * 64.f) * (sampling_interval / 3600.f)) /
+                                        (tau_mean_hours + (sampling_interval / 3600.f));                                         /**< gamma mean */
+    static constexpr float gamma_variance = (64.f * (sampling_interval / 3600.f)) /
+                                            (tau_variance_hours + (sampling_interval / 3600.f));                                 /**< gamma variance */
+    static constexpr float gamma_initial_mean = ((8.f * 64.f) * sampling_interval) /
+                                                ((is_nox ? 1200.f : 20.f) + sampling_interval);                                  /**< gamma initial mean */
+    static constexpr float gamma_initial_variance = (64.f * sampling_interval) / (2500.f + sampling_interval);                   /**< gamma initial variance */
+    static constexpr float sigmoid_k = is_nox ? -0.0101f : -0.0065f;                                                             /**< sigmoid scaled k */
+    static constexpr float sigmoid_x0 = is_nox ? 614.f : 213.f;                                                                  /**< sigmoid scaled x0 */
+    static constexpr float sigmoid_offset_default = is_nox ? 1.f : 100.f;                                                        /**< sigmoid scaled offset default */
+    static constexpr float sigmoid_shift = is_nox ? ((500.f / 499.f) * (1.f - index_offset)) :
+                                                    ((500.f - (5.f * index_offset)) / 4.f);                                      /**< sigmoid scaled shift */
+    static constexpr float lowpass_a1 = sampling_interval / (20.0f + sampling_interval);                                         /**< adaptive lowpass a1 */
+    static constexpr float lowpass_a2 = sampling_interval / (500.0f + sampling_interval);                                        /**< adaptive lowpass a2 */
+    static constexpr float uptime_limit = 32767.f - sampling_interval;                                                           /**< uptime limit */
+
+    /**
+     * @brief constructor, same state as sgp41_algorithm_init
+     */
+    gas_index_algorithm()
+    {
+        reset();
+    }
+
+    /**
+     * @brief algorithm reset
+     */
+    void reset()
+    {
+        m_uptime = 0.f;
+        m_sraw = 0.f;
+        m_gas_index = 0.f;
+        m_mve_initialized = false;
+        m_mve_mean = 0.f;
+        m_mve_sraw_offset = 0.f;
+        m_mve_std = sraw_std_initial;
+        m_mve_uptime_gamma = 0.f;
+        m_mve_uptime_gating = 0.f;
+        m_mve_gating_duration_minutes = 0.f;
+        m_mox_sraw_std = m_mve_std;
+        m_mox_sraw_mean = m_mve_mean + m_mve_sraw_offset;
+        m_lowpass_initialized = false;
+        m_lowpass_x1 = 0.f;
+        m_lowpass_x2 = 0.f;
+        m_lowpass_x3 = 0.f;
+    }
+
+    /**
+     * @brief      algorithm get states
+     * @param[out] &state0 reference to a state0 buffer
+     * @param[out] &state1 reference to a state1 buffer
+     */
+    void get_states(float &state0, float &state1) const
+    {
+        state0 = m_mve_mean + m_mve_sraw_offset;
+        state1 = m_mve_std;
+    }
+
+    /**
+     * @brief     algorithm set states
+     * @param[in] state0 state0
+     * @param[in] state1 state1
+     */
+    void set_states(float state0, float state1)
+    {
+        m_mve_mean = state0;
+        m_mve_std = state1;
+        m_mve_uptime_gamma = 3.f * 3600.f;
+        m_mve_initialized = true;
+        m_mox_sraw_std = m_mve_std;
+        m_mox_sraw_mean = m_mve_mean + m_mve_sraw_offset;
+        m_sraw = state0;
+    }
+
+    /**
+     * @brief     algorithm process
+     * @param[in] sraw source raw
+     * @return    gas index
+     */
+    int32_t process(int32_t sraw)
+    {
+        if (m_uptime <= 45.f)
+        {
+            m_uptime = m_uptime + sampling_interval;
+        }
+        else
+        {
+            if ((sraw > 0) && (sraw < 65000))
+            {
+                if (sraw < (sraw_minimum + 1))
+                {
+                    sraw = sraw_minimum + 1;
+                }
+                else if (sraw > (sraw_minimum + 32767))
+                {
+                    sraw = sraw_minimum + 32767;
+                }
+                m_sraw = (float)(sraw - sraw_minimum);
+            }
+            if (!is_nox || m_mve_initialized)
+            {
+                m_gas_index = sigmoid_scaled_process(mox_model_process(m_sraw));
+            }
+            else
+            {
+                m_gas_index = index_offset;
+            }
+            m_gas_index = adaptive_lowpass_process(m_gas_index);
+            if (m_gas_index < 0.5f)
+            {
+                m_gas_index = 0.5f;
+            }
+            if (m_sraw > 0.f)
+            {
+                mean_variance_estimator_process(m_sraw);
+                m_mox_sraw_std = m_mve_std;
+                m_mox_sraw_mean = m_mve_mean + m_mve_sraw_offset;
+            }
+        }
+
+        return (int32_t)(m_gas_index + 0.5f);
+    }
+
+  private:
+    /**
+     * @brief     estimator sigmoid
+     * @param[in] sample input sample
+     * @param[in] x0 sigmoid x0
+     * @param[in] k sigmoid k
+     * @return    sigmoid result
+     */
+    static float sigmoid(float sample, float x0, float k)
+    {
+        float x = k * (sample - x0);
+
+        if (x < -50.f)
+        {
+            return 1.f;
+        }
+        else if (x > 50.f)
+        {
+            return 0.f;
+        }
+        else
+        {
+            return 1.f / (1.f + expf(x));
+        }
+    }
+
+    /**
+     * @brief  mean variance estimator gamma, the n gammas only live for one sample
+     * @param[out] &n_gamma_mean reference to a n gamma mean buffer
+     * @param[out] &n_gamma_variance reference to a n gamma variance buffer
+     */
+    void calculate_gamma(float &n_gamma_mean, float &n_gamma_variance)
+    {
+        float sigmoid_gamma_mean;
+        float sigmoid_gating_mean;
+        float sigmoid_gamma_variance;
+        float sigmoid_gating_variance;
+        float threshold;
+
+        if (m_mve_uptime_gamma < uptime_limit)
+        {
+            m_mve_uptime_gamma = m_mve_uptime_gamma + sampling_interval;
+        }
+        if (m_mve_uptime_gating < uptime_limit)
+        {
+            m_mve_uptime_gating = m_mve_uptime_gating + sampling_interval;
+        }
+        sigmoid_gamma_mean = sigmoid(m_mve_uptime_gamma, init_duration_mean, 0.01f);
+        threshold = gating_threshold + ((510.f - gating_threshold) *
+                                        sigmoid(m_mve_uptime_gating, init_duration_mean, 0.01f));
+        sigmoid_gating_mean = sigmoid(m_gas_index, threshold, 0.09f);
+        n_gamma_mean = sigmoid_gating_mean * (gamma_mean + ((gamma_initial_mean - gamma_mean) * sigmoid_gamma_mean));
+        sigmoid_gamma_variance = sigmoid(m_mve_uptime_gamma, init_duration_variance, 0.01f);
+        threshold = gating_threshold + ((510.f - gating_threshold) *
+                                        sigmoid(m_mve_uptime_gating, init_duration_variance, 0.01f));
+        sigmoid_gating_variance = sigmoid(m_gas_index, threshold, 0.09f);
+        n_gamma_variance = sigmoid_gating_variance * (gamma_variance + ((gamma_initial_variance - gamma_variance) *
+                                                                        (sigmoid_gamma_variance - sigmoid_gamma_mean)));
+        m_mve_gating_duration_minutes = m_mve_gating_duration_minutes +
+                                        ((sampling_interval / 60.f) * (((1.f - sigmoid_gating_mean) * (1.f + 0.3f)) - 0.3f));
+        if (m_mve_gating_duration_minutes < 0.f)
+        {
+            m_mve_gating_duration_minutes = 0.f;
+        }
+        if (m_mve_gating_duration_minutes > gating_max_duration_minutes)
+        {
+            m_mve_uptime_gating = 0.f;
+        }
+    }
+
+    /**
+     * @brief     mean variance estimator process
+     * @param[in] sraw source raw
+     */
+    void mean_variance_estimator_process(float sraw)
+    {
+        float n_gamma_mean;
+        float n_gamma_variance;
+        float delta_sgp;
+        float c;
+        float additional_scaling;
+
+        if (!m_mve_initialized)
+        {
+            m_mve_initialized = true;
+            m_mve_sraw_offset = sraw;
+            m_mve_mean = 0.f;
+
+            return;
+        }
+        if ((m_mve_mean >= 100.f) || (m_mve_mean <= -100.f))
+        {
+            m_mve_sraw_offset = m_mve_sraw_offset + m_mve_mean;
+            m_mve_mean = 0.f;
+        }
+        sraw = sraw - m_mve_sraw_offset;
+        calculate_gamma(n_gamma_mean, n_gamma_variance);
+        delta_sgp = (sraw - m_mve_mean) / 64.f;
+        if (delta_sgp < 0.f)
+        {
+            c = m_mve_std - delta_sgp;
+        }
+        else
+        {
+            c = m_mve_std + delta_sgp;
+        }
+        additional_scaling = 1.f;
+        if (c > 1440.f)
+        {
+            additional_scaling = (c / 1440.f) * (c / 1440.f);
+        }
+        m_mve_std = sqrtf(additional_scaling * (64.f - n_gamma_variance)) *
+                    sqrtf((m_mve_std * (m_mve_std / (64.f * additional_scaling))) +
+                          (((n_gamma_variance * delta_sgp) / additional_scaling) * delta_sgp));
+        m_mve_mean = m_mve_mean + ((n_gamma_mean * delta_sgp) / 8.f);
+    }
+
+    /**
+     * @brief     mox model process
+     * @param[in] sraw source raw
+     * @return    model output
+     */
+    float mox_model_process(float sraw) const
+    {
+        if (is_nox)
+        {
+            return ((sraw - m_mox_sraw_mean) / 2000.f) * index_gain;
+        }
+        else
+        {
+            return ((sraw - m_mox_sraw_mean) / (-1.f * (m_mox_sraw_std + 220.f))) * index_gain;
+        }
+    }
+
+    /**
+     * @brief     sigmoid scaled process
+     * @param[in] sample input sample
+     * @return    scaled output
+     */
+    static float sigmoid_scaled_process(float sample)
+    {
+        float x = sigmoid_k * (sample - sigmoid_x0);
+
+        if (x < -50.f)
+        {
+            return 500.f;
+        }
+        else if (x > 50.f)
+        {
+            return 0.f;
+        }
+        else if (sample >= 0.f)
+        {
+            return ((500.f + sigmoid_shift) / (1.f + expf(x))) - sigmoid_shift;
+        }
+        else
+        {
+            return (index_offset / sigmoid_offset_default) * (500.f / (1.f + expf(x)));
+        }
+    }
+
+    /**
+     * @brief     adaptive lowpass process
+     * @param[in] sample input sample
+     * @return    filtered output
+     */
+    float adaptive_lowpass_process(float sample)
+    {
+        float abs_delta;
+        float tau_a;
+        float a3;
+
+        if (!m_lowpass_initialized)
+        {
+            m_lowpass_x1 = sample;
+            m_lowpass_x2 = sample;
+            m_lowpass_x3 = sample;
+            m_lowpass_initialized = true;
+        }
+        m_lowpass_x1 = ((1.f - lowpass_a1) * m_lowpass_x1) + (lowpass_a1 * sample);
+        m_lowpass_x2 = ((1.f - lowpass_a2) * m_lowpass_x2) + (lowpass_a2 * sample);
+        abs_delta = m_lowpass_x1 - m_lowpass_x2;
+        if (abs_delta < 0.f)
+        {
+            abs_delta = -1.f * abs_delta;
+        }
+        tau_a = ((500.0f - 20.0f) * expf(-0.2f * abs_delta)) + 20.0f;
+        a3 = sampling_interval / (sampling_interval + tau_a);
+        m_lowpass_x3 = ((1.f - a3) * m_lowpass_x3) + (a3 * sample);
+
+        return m_lowpass_x3;
+    }
+
+    float m_uptime;                               /**< uptime */
+    float m_sraw;                                 /**< sraw */
+    float m_gas_index;                            /**< gas index */
+    float m_mve_mean;                             /**< mean variance estimator mean */
+    float m_mve_sraw_offset;                      /**< mean variance estimator sraw offset */
+    float m_mve_std;                              /**< mean variance estimator std */
+    float m_mve_uptime_gamma;                     /**< mean variance estimator uptime gamma */
+    float m_mve_uptime_gating;                    /**< mean variance estimator uptime gating */
+    float m_mve_gating_duration_minutes;          /**< mean variance estimator gating duration minutes */
+    float m_mox_sraw_std;                         /**< mox model sraw std */
+    float m_mox_sraw_mean;                        /**< mox model sraw mean */
+    float m_lowpass_x1;                           /**< adaptive lowpass x1 */
+    float m_lowpass_x2;                           /**< adaptive lowpass x2 */
+    float m_lowpass_x3;                           /**< adaptive lowpass x3 */
+    bool m_mve_initialized;                       /**< mean variance estimator initialized */
+    bool m_lowpass_initialized;                   /**< adaptive lowpass initialized */
+};
+
+/**
+ * @brief default voc and nox algorithm definition
+ */
+typedef gas_index_algorithm<SGP41_ALGORITHM_TYPE_VOC> voc_algorithm;        /**< voc algorithm at 1 s */
+typedef gas_index_algorithm<SGP41_ALGORITHM_TYPE_NOX> nox_algorithm;        /**< nox algorithm at 1 s */
+
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,301 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_algorithm_profile.c
+ * @brief     driver sgp41 algorithm profile source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_algorithm_profile.h"
+
+static sgp41_algorithm_profile_t *gs_profile = NULL;        /**< attached profile */
+
+/**
+ * @brief stage name definition
+ */
+static const char *const gs_stage_name[SGP41_ALGORITHM_PROFILE_COUNTERS] =
+{
+    "input", "mox", "sigmoid", "lowpass", "estimator", "gamma", "total",
+};
+
+/**
+ * @brief     add a sample to a counter
+ * @param[in] *counter pointer to a counter
+ * @param[in] ticks sample ticks
+ * @note      none
+ */
+static void a_profile_counter_add(sgp41_algorithm_profile_counter_t *counter, uint32_t ticks)
+{
+    if ((counter->count == 0) || (ticks < counter->min))                    /* check min */
+    {
+        counter->min = ticks;                                               /* set min */
+    }
+    if ((counter->count == 0) || (ticks > counter->max))                    /* check max */
+    {
+        counter->max = ticks;                                               /* set max */
+    }
+    counter->sum += ticks;                                                  /* add ticks */
+    counter->count++;                                                       /* count */
+}
+
+/**
+ * @brief     algorithm profile probe
+ * @param[in] stage stage that starts now
+ * @note      the time up to the next probe belongs to this stage, a stage entered twice in
+ *            one process is one sample
+ */
+void sgp41_algorithm_profile_probe(uint8_t stage)
+{
+    sgp41_algorithm_profile_t *profile = gs_profile;
+    uint32_t ticks;
+    uint32_t total;
+    uint8_t i;
+
+    if ((profile == NULL) || (stage >= SGP41_ALGORITHM_PROFILE_COUNTERS))   /* check profile */
+    {
+        return;                                                             /* nothing to do */
+    }
+
+    ticks = profile->clock() - profile->last;                               /* ticks of the running stage */
+    ticks = (ticks > profile->overhead) ? (ticks - profile->overhead) : 0;  /* remove the probe */
+    if (stage == SGP41_ALGORITHM_STAGE_INPUT)                               /* new process */
+    {
+        memset(profile->current, 0, sizeof(profile->current));              /* clear current */
+        memset(profile->seen, 0, sizeof(profile->seen));                    /* clear seen */
+        profile->running = 1;                                               /* set running */
+    }
+    else if (profile->running != 0)                                         /* inside a process */
+    {
+        profile->current[profile->stage] += ticks;                          /* add to the running stage */
+        profile->seen[profile->stage] = 1;                                  /* mark */
+        if (stage == SGP41_ALGORITHM_STAGE_END)                             /* commit the process */
+        {
+            total = 0;                                                      /* init 0 */
+            for (i = 0; i < SGP41_ALGORITHM_STAGE_END; i++)                 /* every stage */
+            {
+                if (profile->seen[i] != 0)                                  /* ran */
+                {
+                    a_profile_counter_add(&profile->counter[i], profile->current[i]);
+                    total += profile->current[i];                           /* add total */
+                }
+            }
+            a_profile_counter_add(&profile->counter[SGP41_ALGORITHM_STAGE_END], total);
+            profile->running = 0;                                           /* clear running */
+        }
+    }
+    else
+    {
+        
+    }
+    profile->stage = stage;                                                 /* set stage */
+    profile->last = profile->clock();                                       /* stage start after the probe */
+}
+
+/**
+ * @brief     algorithm profile exponential
+ * @param[in] x exponent
+ * @return    e to the power of x
+ * @note      runs the backend of the attached profile
+ */
+float sgp41_algorithm_profile_expf(float x)
+{
+    sgp41_algorithm_profile_t *profile = gs_profile;
+
+    if ((profile != NULL) && (profile->exp_backend != NULL))                /* check backend */
+    {
+        return profile->exp_backend(x);                                     /* run the backend */
+    }
+
+    return expf(x);                                                         /* libm */
+}
+
+/**
+ * @brief     algorithm profile init
+ * @param[in] *profile pointer to an sgp41 algorithm profile structure
+ * @param[in] *clock pointer to a clock function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or clock is NULL
+ * @note      the probe overhead is measured with the clock and taken off every stage
+ */
+uint8_t sgp41_algorithm_profile_init(sgp41_algorithm_profile_t *profile, uint32_t (*clock)(void))
+{
+    sgp41_algorithm_profile_t *attached = gs_profile;
+    uint32_t i;
+
+    if ((profile == NULL) || (clock == NULL))                               /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+
+    memset(profile, 0, sizeof(sgp41_algorithm_profile_t));                  /* clear the handle */
+    profile->clock = clock;                                                 /* set clock */
+    profile->inited = 1;                                                    /* flag finish initialization */
+
+    gs_profile = profile;                                                   /* time empty processes */
+    for (i = 0; i < SGP41_ALGORITHM_PROFILE_CALIBRATION; i++)               /* calibrate */
+    {
+        sgp41_algorithm_profile_probe(SGP41_ALGORITHM_STAGE_INPUT);         /* start */
+        sgp41_algorithm_profile_probe(SGP41_ALGORITHM_STAGE_END);           /* end */
+    }
+    gs_profile = attached;                                                  /* restore */
+    profile->overhead = profile->counter[SGP41_ALGORITHM_STAGE_END].min;    /* set overhead */
+    (void)sgp41_algorithm_profile_clear(profile);                           /* clear counters */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     algorithm profile set the exponential backend
+ * @param[in] *profile pointer to an sgp41 algorithm profile structure
+ * @param[in] *backend pointer to an exponential function, NULL is expf
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sgp41_algorithm_profile_set_exp_backend(sgp41_algorithm_profile_t *profile, float (*backend)(float x))
+{
+    if (profile == NULL)                                                    /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (profile->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    profile->exp_backend = backend;                                         /* set backend */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     algorithm profile clear the counters
+ * @param[in] *profile pointer to an sgp41 algorithm profile structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sgp41_algorithm_profile_clear(sgp41_algorithm_profile_t *profile)
+{
+    if (profile == NULL)                                                    /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (profile->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    memset(profile->counter, 0, sizeof(profile->counter));                  /* clear counters */
+    profile->running = 0;                                                   /* clear running */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     algorithm profile attach
+ * @param[in] *profile pointer to an sgp41 algorithm profile structure, NULL detaches
+ * @return    status code
+ *            - 0 success
+ *            - 3 handle is not initialized
+ * @note      the probes of every algorithm instance go to the attached profile
+ */
+uint8_t sgp41_algorithm_profile_attach(sgp41_algorithm_profile_t *profile)
+{
+    if ((profile != NULL) && (profile->inited != 1))                        /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    if (profile != NULL)                                                    /* attach */
+    {
+        profile->running = 0;                                               /* wait for the next process */
+    }
+    gs_profile = profile;                                                   /* set profile */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      algorithm profile get a counter
+ * @param[in]  *profile pointer to an sgp41 algorithm profile structure
+ * @param[in]  stage algorithm stage, SGP41_ALGORITHM_STAGE_END is the whole process
+ * @param[out] *counter pointer to a counter buffer
+ * @param[out] *mean pointer to a mean ticks buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 stage is invalid
+ * @note       none
+ */
+uint8_t sgp41_algorithm_profile_get_counter(const sgp41_algorithm_profile_t *profile, uint8_t stage,
+                                            sgp41_algorithm_profile_counter_t *counter, uint32_t *mean)
+{
+    if (profile == NULL)                                                    /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (profile->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if (stage >= SGP41_ALGORITHM_PROFILE_COUNTERS)                          /* check stage */
+    {
+        return 4;                                                           /* return error */
+    }
+
+    *counter = profile->counter[stage];                                     /* copy counter */
+    *mean = (counter->count != 0) ? (uint32_t)(counter->sum / counter->count) : 0;      /* get mean */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     algorithm profile get the stage name
+ * @param[in] stage algorithm stage
+ * @return    stage name
+ * @note      none
+ */
+const char *sgp41_algorithm_profile_stage_name(uint8_t stage)
+{
+    if (stage >= SGP41_ALGORITHM_PROFILE_COUNTERS)                          /* check stage */
+    {
+        return "unknown";                                                   /* unknown */
+    }
+
+    return gs_stage_name[stage];                                            /* return name */
+}
@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_algorithm_profile.h
+ * @brief     driver sgp41 algorithm profile header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_ALGORITHM_PROFILE_H
+#define DRIVER_SGP41_ALGORITHM_PROFILE_H
+
+#include "driver_sgp41_algorithm.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_algorithm_profile sgp41 algorithm profile function
+ * @brief    sgp41 algorithm stage timing modules
+ * @ingroup  sgp41_algorithm
+ * @{
+ */
+
+/**
+ * @brief sgp41 algorithm profile param definition
+ */
+#define SGP41_ALGORITHM_PROFILE_COUNTERS        (SGP41_ALGORITHM_STAGE_END + 1)        /**< one counter per stage, the end counter is the whole process */
+#define SGP41_ALGORITHM_PROFILE_CALIBRATION     100                                    /**< probe pairs timed for the overhead */
+
+/**
+ * @brief sgp41 algorithm profile counter structure definition
+ */
+typedef struct sgp41_algorithm_profile_counter_s
+{
+    uint32_t min;          /**< min ticks per process */
+    uint32_t max;          /**< max ticks per process */
+    uint64_t sum;          /**< tick sum */
+    uint32_t count;        /**< processes that ran the stage */
+} sgp41_algorithm_profile_counter_t;
+
+/**
+ * @brief sgp41 algorithm profile structure definition
+ */
+typedef struct sgp41_algorithm_profile_s
+{
+    uint32_t (*clock)(void);                                                           /**< point to a clock function, cycles or ns */
+    float (*exp_backend)(float x);                                                     /**< point to an exponential, NULL is expf */
+    uint32_t overhead;                                                                 /**< probe ticks taken off every stage */
+    uint32_t last;                                                                     /**< running stage start */
+    uint8_t stage;                                                                     /**< running stage */
+    uint8_t running;                                                                   /**< process running flag */
+    uint32_t current[SGP41_ALGORITHM_PROFILE_COUNTERS];                                /**< ticks of the running process */
+    uint8_t seen[SGP41_ALGORITHM_PROFILE_COUNTERS];                                    /**< stages of the running process */
+    sgp41_algorithm_profile_counter_t counter[SGP41_ALGORITHM_PROFILE_COUNTERS];       /**< aggregated counters */
+    uint8_t inited;                                                                    /**< inited flag */
+} sgp41_algorithm_profile_t;
+
+/**
+ * @brief     algorithm profile init
+ * @param[in] *profile pointer to an sgp41 algorithm profile structure
+ * @param[in] *clock pointer to a clock function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or clock is NULL
+ * @note      the probe overhead is measured with the clock and taken off every stage
+ */
+uint8_t sgp41_algorithm_profile_init(sgp41_algorithm_profile_t *profile, uint32_t (*clock)(void));
+
+/**
+ * @brief     algorithm profile set the exponential backend
+ * @param[in] *profile pointer to an sgp41 algorithm profile structure
+ * @param[in] *backend pointer to an exponential function, NULL is expf
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sgp41_algorithm_profile_set_exp_backend(sgp41_algorithm_profile_t *profile, float (*backend)(float x));
+
+/**
+ * @brief     algorithm profile clear the counters
+ * @param[in] *profile pointer to an sgp41 algorithm profile structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sgp41_algorithm_profile_clear(sgp41_algorithm_profile_t *profile);
+
+/**
+ * @brief     algorithm profile attach
+ * @param[in] *profile pointer to an sgp41 algorithm profile structure, NULL detaches
+ * @return    status code
+ *            - 0 success
+ *            - 3 handle is not initialized
+ * @note      the probes of every algorithm instance go to the attached profile
+ */
+uint8_t sgp41_algorithm_profile_attach(sgp41_algorithm_profile_t *profile);
+
+/**
+ * @brief      algorithm profile get a counter
+ * @param[in]  *profile pointer to an sgp41 algorithm profile structure
+ * @param[in]  stage algorithm stage, SGP41_ALGORITHM_STAGE_END is the whole process
+ * @param[out] *counter pointer to a counter buffer
+ * @param[out] *mean pointer to a mean ticks buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 stage is invalid
+ * @note       none
+ */
+uint8_t sgp41_algorithm_profile_get_counter(const sgp41_algorithm_profile_t *profile, uint8_t stage,
+                                            sgp41_algorithm_profile_counter_t *counter, uint32_t *mean);
+
+/**
+ * @brief     algorithm profile probe
+ * @param[in] stage stage that starts now
+ * @note      called by the SGP41_ALGORITHM_PROFILE build, an input and an end probe
+ *            around a whole call also work without it
+ */
+void sgp41_algorithm_profile_probe(uint8_t stage);
+
+/**
+ * @brief     algorithm profile exponential
+ * @param[in] x exponent
+ * @return    e to the power of x
+ * @note      runs the backend of the attached profile
+ */
+float sgp41_algorithm_profile_expf(float x);
+
+/**
+ * @brief     algorithm profile get the stage name
+ * @param[in] stage algorithm stage
+ * @return    stage name
+ * @note      none
+ */
+const char *sgp41_algorithm_profile_stage_name(uint8_t stage);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
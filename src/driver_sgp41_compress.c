@@ -0,0 +1,604 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_compress.c
+ * @brief     driver sgp41 compress source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_compress.h"
+
+/**
+ * @brief compress block header offset definition
+ */
+#define SGP41_COMPRESS_HEADER_TIMESTAMP        0         /**< first timestamp offset */
+#define SGP41_COMPRESS_HEADER_VALUE            4         /**< first value offset */
+#define SGP41_COMPRESS_HEADER_COUNT            8         /**< sample count offset */
+#define SGP41_COMPRESS_HEADER_PAYLOAD          10        /**< payload size offset */
+#define SGP41_COMPRESS_PAYLOAD_MAX             65535     /**< max payload size */
+
+/**
+ * @brief     put a big endian word
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v word
+ * @param[in] len byte length
+ * @note      none
+ */
+static void a_sgp41_compress_put(uint8_t *buf, uint32_t v, uint8_t len)
+{
+    uint8_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = (uint8_t)((v >> (8 * (len - 1 - i))) & 0xFF);        /* msb first */
+    }
+}
+
+/**
+ * @brief     get a big endian word
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len byte length
+ * @return    word
+ * @note      none
+ */
+static uint32_t a_sgp41_compress_get(const uint8_t *buf, uint8_t len)
+{
+    uint32_t v;
+    uint8_t i;
+
+    v = 0;
+    for (i = 0; i < len; i++)
+    {
+        v = (v << 8) | buf[i];        /* msb first */
+    }
+
+    return v;
+}
+
+/**
+ * @brief     zigzag encode
+ * @param[in] v signed value
+ * @return    unsigned value
+ * @note      none
+ */
+static uint32_t a_sgp41_compress_zigzag(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(-(int32_t)((uint32_t)v >> 31));        /* small magnitudes map to small codes */
+}
+
+/**
+ * @brief     zigzag decode
+ * @param[in] v unsigned value
+ * @return    signed value
+ * @note      none
+ */
+static int32_t a_sgp41_compress_unzigzag(uint32_t v)
+{
+    return (int32_t)((v >> 1) ^ (uint32_t)(-(int32_t)(v & 1)));        /* inverse zigzag */
+}
+
+/**
+ * @brief     write bits msb first
+ * @param[in] *encoder pointer to an sgp41 compress encoder structure
+ * @param[in] v bits
+ * @param[in] n bit number, 1 - 32
+ * @note      the caller checks the space
+ */
+static void a_sgp41_compress_write_bits(sgp41_compress_encoder_t *encoder, uint32_t v, uint8_t n)
+{
+    while (n > 0)
+    {
+        uint32_t byte = encoder->bit_pos >> 3;
+        uint8_t used = (uint8_t)(encoder->bit_pos & 7);
+        uint8_t take = (uint8_t)(8 - used);
+        uint8_t chunk;
+
+        if (used == 0)                                                               /* new byte */
+        {
+            encoder->buf[byte] = 0;                                                  /* clear the byte */
+        }
+        if (take > n)                                                                /* check length */
+        {
+            take = n;                                                                /* set length */
+        }
+        chunk = (uint8_t)((v >> (n - take)) & ((1U << take) - 1U));                  /* top bits */
+        encoder->buf[byte] |= (uint8_t)(chunk << (8 - used - take));                 /* put bits */
+        encoder->bit_pos += take;                                                    /* step */
+        n = (uint8_t)(n - take);                                                     /* next */
+    }
+}
+
+/**
+ * @brief      read bits msb first
+ * @param[in]  *decoder pointer to an sgp41 compress decoder structure
+ * @param[in]  n bit number, 1 - 32
+ * @param[out] *v pointer to a bits buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 out of block
+ * @note       none
+ */
+static uint8_t a_sgp41_compress_read_bits(sgp41_compress_decoder_t *decoder, uint8_t n, uint32_t *v)
+{
+    uint32_t r;
+
+    if ((decoder->bit_pos + n) > (decoder->block_next * 8))                          /* check the block end */
+    {
+        return 1;                                                                    /* return error */
+    }
+    r = 0;
+    while (n > 0)
+    {
+        uint8_t used = (uint8_t)(decoder->bit_pos & 7);
+        uint8_t take = (uint8_t)(8 - used);
+        uint8_t byte = decoder->buf[decoder->bit_pos >> 3];
+
+        if (take > n)                                                                /* check length */
+        {
+            take = n;                                                                /* set length */
+        }
+        r = (r << take) | (uint32_t)((byte >> (8 - used - take)) & ((1U << take) - 1U));    /* get bits */
+        decoder->bit_pos += take;                                                    /* step */
+        n = (uint8_t)(n - take);                                                     /* next */
+    }
+    *v = r;                                                                          /* set bits */
+
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     write a prefix coded zigzag value
+ * @param[in] *encoder pointer to an sgp41 compress encoder structure
+ * @param[in] z zigzag value
+ * @param[in] *width pointer to a three bucket width table
+ * @note      prefix 0 is zero, 10, 110 and 1110 select the buckets, 1111 is raw 32 bits
+ */
+static void a_sgp41_compress_write_code(sgp41_compress_encoder_t *encoder, uint32_t z, const uint8_t *width)
+{
+    if (z == 0)                                                       /* no change */
+    {
+        a_sgp41_compress_write_bits(encoder, 0x0, 1);                 /* 0 */
+    }
+    else if (z < (1UL << width[0]))                                   /* bucket 0 */
+    {
+        a_sgp41_compress_write_bits(encoder, 0x2, 2);                 /* 10 */
+        a_sgp41_compress_write_bits(encoder, z, width[0]);            /* value */
+    }
+    else if (z < (1UL << width[1]))                                   /* bucket 1 */
+    {
+        a_sgp41_compress_write_bits(encoder, 0x6, 3);                 /* 110 */
+        a_sgp41_compress_write_bits(encoder, z, width[1]);            /* value */
+    }
+    else if (z < (1UL << width[2]))                                   /* bucket 2 */
+    {
+        a_sgp41_compress_write_bits(encoder, 0xE, 4);                 /* 1110 */
+        a_sgp41_compress_write_bits(encoder, z, width[2]);            /* value */
+    }
+    else                                                              /* raw */
+    {
+        a_sgp41_compress_write_bits(encoder, 0xF, 4);                 /* 1111 */
+        a_sgp41_compress_write_bits(encoder, z, 32);                  /* value */
+    }
+}
+
+/**
+ * @brief      read a prefix coded zigzag value
+ * @param[in]  *decoder pointer to an sgp41 compress decoder structure
+ * @param[in]  *width pointer to a three bucket width table
+ * @param[out] *z pointer to a zigzag value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 out of block
+ * @note       none
+ */
+static uint8_t a_sgp41_compress_read_code(sgp41_compress_decoder_t *decoder, const uint8_t *width, uint32_t *z)
+{
+    uint32_t bit;
+    uint8_t ones;
+
+    ones = 0;
+    while (ones < 4)                                                                  /* count the prefix */
+    {
+        if (a_sgp41_compress_read_bits(decoder, 1, &bit) != 0)                        /* read one bit */
+        {
+            return 1;                                                                 /* return error */
+        }
+        if (bit == 0)                                                                 /* prefix end */
+        {
+            break;                                                                    /* break */
+        }
+        ones++;                                                                       /* next */
+    }
+    if (ones == 0)                                                                    /* no change */
+    {
+        *z = 0;                                                                       /* set 0 */
+
+        return 0;                                                                     /* success return 0 */
+    }
+
+    return a_sgp41_compress_read_bits(decoder, (ones < 4) ? width[ones - 1] : 32, z);        /* read the value */
+}
+
+/**
+ * @brief timestamp delta of delta and value delta bucket width definition
+ */
+static const uint8_t gs_dod_width[3] = {6, 9, 16};            /**< delta of delta widths */
+static const uint8_t gs_value_width[3] = {3, 6, 12};          /**< value delta widths */
+
+/**
+ * @brief     close the open block
+ * @param[in] *encoder pointer to an sgp41 compress encoder structure
+ * @note      none
+ */
+static void a_sgp41_compress_close_block(sgp41_compress_encoder_t *encoder)
+{
+    uint32_t end;
+    uint32_t payload;
+
+    end = (encoder->bit_pos + 7) >> 3;                                                               /* byte align */
+    payload = end - encoder->block_offset - SGP41_COMPRESS_BLOCK_HEADER_SIZE;                        /* payload size */
+    a_sgp41_compress_put(&encoder->buf[encoder->block_offset + SGP41_COMPRESS_HEADER_COUNT],
+                         encoder->count, 2);                                                         /* set count */
+    a_sgp41_compress_put(&encoder->buf[encoder->block_offset + SGP41_COMPRESS_HEADER_PAYLOAD],
+                         payload, 2);                                                                /* set payload */
+    encoder->block_offset = end;                                                                     /* next header */
+    encoder->bit_pos = end * 8;                                                                      /* next bit */
+    encoder->count = 0;                                                                              /* no open block */
+    encoder->blocks++;                                                                               /* count blocks */
+}
+
+/**
+ * @brief      load a block header
+ * @param[in]  *decoder pointer to an sgp41 compress decoder structure
+ * @param[in]  offset block header offset
+ * @return     status code
+ *             - 0 success
+ *             - 1 no block
+ * @note       the first sample of the block becomes the last sample
+ */
+static uint8_t a_sgp41_compress_load_block(sgp41_compress_decoder_t *decoder, uint32_t offset)
+{
+    const uint8_t *h;
+    uint32_t next;
+
+    if ((offset + SGP41_COMPRESS_BLOCK_HEADER_SIZE) > decoder->len)                         /* check header */
+    {
+        return 1;                                                                           /* return error */
+    }
+    h = &decoder->buf[offset];
+    next = offset + SGP41_COMPRESS_BLOCK_HEADER_SIZE +
+           a_sgp41_compress_get(&h[SGP41_COMPRESS_HEADER_PAYLOAD], 2);                      /* next block */
+    if ((next > decoder->len) || (a_sgp41_compress_get(&h[SGP41_COMPRESS_HEADER_COUNT], 2) == 0))        /* check block */
+    {
+        return 1;                                                                           /* return error */
+    }
+    decoder->block_offset = offset;                                                         /* set offset */
+    decoder->block_next = next;                                                             /* set next */
+    decoder->block_count = (uint16_t)a_sgp41_compress_get(&h[SGP41_COMPRESS_HEADER_COUNT], 2);         /* set count */
+    decoder->block_index = 1;                                                               /* first sample is decoded */
+    decoder->last_ts = a_sgp41_compress_get(&h[SGP41_COMPRESS_HEADER_TIMESTAMP], 4);        /* set timestamp */
+    decoder->last_value = (int32_t)a_sgp41_compress_get(&h[SGP41_COMPRESS_HEADER_VALUE], 4);           /* set value */
+    decoder->last_delta = 0;                                                                /* init delta */
+    decoder->bit_pos = (offset + SGP41_COMPRESS_BLOCK_HEADER_SIZE) * 8;                     /* set bit */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      decode the next sample without the pending check
+ * @param[in]  *decoder pointer to an sgp41 compress decoder structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of stream or stream is corrupted
+ * @note       the sample is left in last_ts and last_value
+ */
+static uint8_t a_sgp41_compress_step(sgp41_compress_decoder_t *decoder)
+{
+    uint32_t z;
+
+    if (decoder->block_count == 0)                                                          /* first block */
+    {
+        return a_sgp41_compress_load_block(decoder, 0);                                     /* load the first block */
+    }
+    if (decoder->block_index >= decoder->block_count)                                       /* block end */
+    {
+        return a_sgp41_compress_load_block(decoder, decoder->block_next);                   /* load the next block */
+    }
+    if (a_sgp41_compress_read_code(decoder, gs_dod_width, &z) != 0)                         /* read delta of delta */
+    {
+        return 1;                                                                           /* return error */
+    }
+    decoder->last_delta = decoder->last_delta + (uint32_t)a_sgp41_compress_unzigzag(z);     /* get delta */
+    decoder->last_ts = decoder->last_ts + decoder->last_delta;                              /* get timestamp */
+    if (a_sgp41_compress_read_code(decoder, gs_value_width, &z) != 0)                       /* read value delta */
+    {
+        return 1;                                                                           /* return error */
+    }
+    decoder->last_value = (int32_t)((uint32_t)decoder->last_value +
+                                    (uint32_t)a_sgp41_compress_unzigzag(z));                /* get value */
+    decoder->block_index++;                                                                 /* next */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     initialize the encoder
+ * @param[in] *encoder pointer to an sgp41 compress encoder structure
+ * @param[in] *buf pointer to an output buffer
+ * @param[in] size output buffer size
+ * @param[in] block_samples max samples per block, 0 means the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is too small
+ *            - 2 encoder is NULL
+ * @note      every block is byte aligned and starts with an uncompressed
+ *            header, so a reader can hop from block to block without decoding
+ */
+uint8_t sgp41_compress_encoder_init(sgp41_compress_encoder_t *encoder, uint8_t *buf, uint32_t size, uint16_t block_samples)
+{
+    if (encoder == NULL)                                                 /* check encoder */
+    {
+        return 2;                                                        /* return error */
+    }
+    if ((buf == NULL) || (size < SGP41_COMPRESS_BLOCK_HEADER_SIZE))      /* check buffer */
+    {
+        return 1;                                                        /* return error */
+    }
+
+    memset(encoder, 0, sizeof(sgp41_compress_encoder_t));                /* clear the encoder */
+    encoder->buf = buf;                                                  /* set buffer */
+    encoder->size = size;                                                /* set size */
+    encoder->block_samples = (block_samples == 0) ? SGP41_COMPRESS_DEFAULT_BLOCK_SAMPLES :
+                             block_samples;                              /* set block samples */
+    encoder->inited = 1;                                                 /* flag finish initialization */
+
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief     append one sample
+ * @param[in] *encoder pointer to an sgp41 compress encoder structure
+ * @param[in] timestamp sample timestamp
+ * @param[in] value sample value, gas index or sraw
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      timestamps use the unit of the caller, usually seconds
+ */
+uint8_t sgp41_compress_encoder_append(sgp41_compress_encoder_t *encoder, uint32_t timestamp, int32_t value)
+{
+    uint32_t delta;
+    uint32_t used;
+
+    if (encoder == NULL)                                                                               /* check encoder */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    if (encoder->inited != 1)                                                                          /* check encoder initialization */
+    {
+        return 3;                                                                                      /* return error */
+    }
+    if ((encoder->samples != 0) && (timestamp < encoder->last_ts))                                     /* check timestamp */
+    {
+        return 4;                                                                                      /* return error */
+    }
+
+    if (encoder->count != 0)                                                                           /* open block */
+    {
+        used = ((encoder->bit_pos + 7) >> 3) - encoder->block_offset - SGP41_COMPRESS_BLOCK_HEADER_SIZE;
+        if ((encoder->count >= encoder->block_samples) ||
+            ((used + SGP41_COMPRESS_SAMPLE_MAX_SIZE) > SGP41_COMPRESS_PAYLOAD_MAX) ||
+            ((((encoder->bit_pos + 7) >> 3) + SGP41_COMPRESS_SAMPLE_MAX_SIZE) > encoder->size))        /* block is full */
+        {
+            a_sgp41_compress_close_block(encoder);                                                     /* close the block */
+        }
+    }
+    if (encoder->count == 0)                                                                           /* start a block */
+    {
+        if ((encoder->block_offset + SGP41_COMPRESS_BLOCK_HEADER_SIZE) > encoder->size)                /* check space */
+        {
+            return 1;                                                                                  /* return error */
+        }
+        a_sgp41_compress_put(&encoder->buf[encoder->block_offset + SGP41_COMPRESS_HEADER_TIMESTAMP],
+                             timestamp, 4);                                                            /* set timestamp */
+        a_sgp41_compress_put(&encoder->buf[encoder->block_offset + SGP41_COMPRESS_HEADER_VALUE],
+                             (uint32_t)value, 4);                                                      /* set value */
+        encoder->bit_pos = (encoder->block_offset + SGP41_COMPRESS_BLOCK_HEADER_SIZE) * 8;             /* payload start */
+        encoder->last_delta = 0;                                                                       /* init delta */
+    }
+    else
+    {
+        delta = timestamp - encoder->last_ts;                                                          /* timestamp delta */
+        a_sgp41_compress_write_code(encoder,
+                                    a_sgp41_compress_zigzag((int32_t)(delta - encoder->last_delta)),
+                                    gs_dod_width);                                                     /* delta of delta */
+        a_sgp41_compress_write_code(encoder,
+                                    a_sgp41_compress_zigzag((int32_t)((uint32_t)value -
+                                                                      (uint32_t)encoder->last_value)),
+                                    gs_value_width);                                                   /* value delta */
+        encoder->last_delta = delta;                                                                   /* save delta */
+    }
+    encoder->last_ts = timestamp;                                                                      /* save timestamp */
+    encoder->last_value = value;                                                                       /* save value */
+    encoder->count++;                                                                                  /* count */
+    encoder->samples++;                                                                                /* count */
+
+    return 0;                                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      close the open block and get the stream length
+ * @param[in]  *encoder pointer to an sgp41 compress encoder structure
+ * @param[out] *len pointer to a stream length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 encoder is NULL
+ *             - 3 encoder is not initialized
+ * @note       appending after finish starts a new block
+ */
+uint8_t sgp41_compress_encoder_finish(sgp41_compress_encoder_t *encoder, uint32_t *len)
+{
+    if (encoder == NULL)                                  /* check encoder */
+    {
+        return 2;                                         /* return error */
+    }
+    if (encoder->inited != 1)                             /* check encoder initialization */
+    {
+        return 3;                                         /* return error */
+    }
+
+    if (encoder->count != 0)                              /* open block */
+    {
+        a_sgp41_compress_close_block(encoder);            /* close the block */
+    }
+    *len = encoder->block_offset;                         /* set the length */
+
+    return 0;                                             /* success return 0 */
+}
+
+/**
+ * @brief     initialize the decoder
+ * @param[in] *decoder pointer to an sgp41 compress decoder structure
+ * @param[in] *buf pointer to an input buffer
+ * @param[in] len input length
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder is NULL
+ * @note      none
+ */
+uint8_t sgp41_compress_decoder_init(sgp41_compress_decoder_t *decoder, const uint8_t *buf, uint32_t len)
+{
+    if (decoder == NULL)                                        /* check decoder */
+    {
+        return 2;                                               /* return error */
+    }
+
+    memset(decoder, 0, sizeof(sgp41_compress_decoder_t));       /* clear the decoder */
+    decoder->buf = buf;                                         /* set buffer */
+    decoder->len = (buf == NULL) ? 0 : len;                     /* set length */
+    decoder->inited = 1;                                        /* flag finish initialization */
+
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief      decode the next sample
+ * @param[in]  *decoder pointer to an sgp41 compress decoder structure
+ * @param[out] *timestamp pointer to a timestamp buffer
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of stream or stream is corrupted
+ *             - 2 decoder is NULL
+ *             - 3 decoder is not initialized
+ * @note       none
+ */
+uint8_t sgp41_compress_decoder_next(sgp41_compress_decoder_t *decoder, uint32_t *timestamp, int32_t *value)
+{
+    if (decoder == NULL)                                /* check decoder */
+    {
+        return 2;                                       /* return error */
+    }
+    if (decoder->inited != 1)                           /* check decoder initialization */
+    {
+        return 3;                                       /* return error */
+    }
+
+    if (decoder->pending != 0)                          /* sample held back by seek */
+    {
+        decoder->pending = 0;                           /* clear pending */
+    }
+    else if (a_sgp41_compress_step(decoder) != 0)       /* decode */
+    {
+        return 1;                                       /* return error */
+    }
+    *timestamp = decoder->last_ts;                      /* set timestamp */
+    *value = decoder->last_value;                       /* set value */
+
+    return 0;                                           /* success return 0 */
+}
+
+/**
+ * @brief     seek to the first sample at or after a timestamp
+ * @param[in] *decoder pointer to an sgp41 compress decoder structure
+ * @param[in] timestamp target timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 no sample at or after the timestamp
+ *            - 2 decoder is NULL
+ *            - 3 decoder is not initialized
+ * @note      block headers are hopped without decoding, only the target block is decoded
+ */
+uint8_t sgp41_compress_decoder_seek(sgp41_compress_decoder_t *decoder, uint32_t timestamp)
+{
+    uint32_t offset;
+    uint32_t found;
+
+    if (decoder == NULL)                                                                                     /* check decoder */
+    {
+        return 2;                                                                                            /* return error */
+    }
+    if (decoder->inited != 1)                                                                                /* check decoder initialization */
+    {
+        return 3;                                                                                            /* return error */
+    }
+
+    offset = 0;                                                                                              /* first block */
+    found = 0;                                                                                               /* first block */
+    while ((offset + SGP41_COMPRESS_BLOCK_HEADER_SIZE) <= decoder->len)                                      /* hop the headers */
+    {
+        if (a_sgp41_compress_get(&decoder->buf[offset + SGP41_COMPRESS_HEADER_TIMESTAMP], 4) > timestamp)    /* block starts later */
+        {
+            break;                                                                                           /* break */
+        }
+        found = offset;                                                                                      /* candidate block */
+        offset = offset + SGP41_COMPRESS_BLOCK_HEADER_SIZE +
+                 a_sgp41_compress_get(&decoder->buf[offset + SGP41_COMPRESS_HEADER_PAYLOAD], 2);             /* next block */
+    }
+    decoder->pending = 0;                                                                                    /* clear pending */
+    if (a_sgp41_compress_load_block(decoder, found) != 0)                                                    /* load the block */
+    {
+        return 1;                                                                                            /* return error */
+    }
+    while (decoder->last_ts < timestamp)                                                                     /* skip older samples */
+    {
+        if (a_sgp41_compress_step(decoder) != 0)                                                             /* decode */
+        {
+            return 1;                                                                                        /* return error */
+        }
+    }
+    decoder->pending = 1;                                                                                    /* hold the sample */
+
+    return 0;                                                                                                /* success return 0 */
+}
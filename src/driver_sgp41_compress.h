@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_compress.h
+ * @brief     driver sgp41 compress header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_COMPRESS_H
+#define DRIVER_SGP41_COMPRESS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_compress sgp41 compress function
+ * @brief    sgp41 compress modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 compress param definition
+ */
+#define SGP41_COMPRESS_BLOCK_HEADER_SIZE        12         /**< block header size in bytes */
+#define SGP41_COMPRESS_SAMPLE_MAX_SIZE          10         /**< worst case encoded sample size in bytes */
+#define SGP41_COMPRESS_DEFAULT_BLOCK_SAMPLES    256        /**< default samples per block */
+
+/**
+ * @brief sgp41 compress encoder structure definition
+ */
+typedef struct sgp41_compress_encoder_s
+{
+    uint8_t *buf;                  /**< output buffer */
+    uint32_t size;                 /**< output buffer size */
+    uint32_t block_offset;         /**< current block header offset */
+    uint32_t bit_pos;              /**< next bit position in the buffer */
+    uint16_t block_samples;        /**< max samples per block */
+    uint16_t count;                /**< samples in the current block */
+    uint32_t last_ts;              /**< last timestamp */
+    uint32_t last_delta;           /**< last timestamp delta */
+    int32_t last_value;            /**< last value */
+    uint32_t blocks;               /**< closed block number */
+    uint32_t samples;              /**< total sample number */
+    uint8_t inited;                /**< inited flag */
+} sgp41_compress_encoder_t;
+
+/**
+ * @brief sgp41 compress decoder structure definition
+ */
+typedef struct sgp41_compress_decoder_s
+{
+    const uint8_t *buf;            /**< input buffer */
+    uint32_t len;                  /**< input length */
+    uint32_t block_offset;         /**< current block header offset */
+    uint32_t block_next;           /**< next block header offset */
+    uint32_t bit_pos;              /**< next bit position in the buffer */
+    uint16_t block_count;          /**< samples in the current block */
+    uint16_t block_index;          /**< decoded samples in the current block */
+    uint32_t last_ts;              /**< last timestamp */
+    uint32_t last_delta;           /**< last timestamp delta */
+    int32_t last_value;            /**< last value */
+    uint8_t pending;               /**< a sample is held back by seek */
+    uint8_t inited;                /**< inited flag */
+} sgp41_compress_decoder_t;
+
+/**
+ * @brief     initialize the encoder
+ * @param[in] *encoder pointer to an sgp41 compress encoder structure
+ * @param[in] *buf pointer to an output buffer
+ * @param[in] size output buffer size
+ * @param[in] block_samples max samples per block, 0 means the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is too small
+ *            - 2 encoder is NULL
+ * @note      every block is byte aligned and starts with an uncompressed
+ *            header, so a reader can hop from block to block without decoding
+ */
+uint8_t sgp41_compress_encoder_init(sgp41_compress_encoder_t *encoder, uint8_t *buf, uint32_t size, uint16_t block_samples);
+
+/**
+ * @brief     append one sample
+ * @param[in] *encoder pointer to an sgp41 compress encoder structure
+ * @param[in] timestamp sample timestamp
+ * @param[in] value sample value, gas index or sraw
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      timestamps use the unit of the caller, usually seconds
+ */
+uint8_t sgp41_compress_encoder_append(sgp41_compress_encoder_t *encoder, uint32_t timestamp, int32_t value);
+
+/**
+ * @brief      close the open block and get the stream length
+ * @param[in]  *encoder pointer to an sgp41 compress encoder structure
+ * @param[out] *len pointer to a stream length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 encoder is NULL
+ *             - 3 encoder is not initialized
+ * @note       appending after finish starts a new block
+ */
+uint8_t sgp41_compress_encoder_finish(sgp41_compress_encoder_t *encoder, uint32_t *len);
+
+/**
+ * @brief     initialize the decoder
+ * @param[in] *decoder pointer to an sgp41 compress decoder structure
+ * @param[in] *buf pointer to an input buffer
+ * @param[in] len input length
+ * @return    status code
+ *            - 0 success
+ *            - 2 decoder is NULL
+ * @note      none
+ */
+uint8_t sgp41_compress_decoder_init(sgp41_compress_decoder_t *decoder, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      decode the next sample
+ * @param[in]  *decoder pointer to an sgp41 compress decoder structure
+ * @param[out] *timestamp pointer to a timestamp buffer
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of stream or stream is corrupted
+ *             - 2 decoder is NULL
+ *             - 3 decoder is not initialized
+ * @note       none
+ */
+uint8_t sgp41_compress_decoder_next(sgp41_compress_decoder_t *decoder, uint32_t *timestamp, int32_t *value);
+
+/**
+ * @brief     seek to the first sample at or after a timestamp
+ * @param[in] *decoder pointer to an sgp41 compress decoder structure
+ * @param[in] timestamp target timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 no sample at or after the timestamp
+ *            - 2 decoder is NULL
+ *            - 3 decoder is not initialized
+ * @note      block headers are hopped without decoding, only the target block is decoded
+ */
+uint8_t sgp41_compress_decoder_seek(sgp41_compress_decoder_t *decoder, uint32_t timestamp);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,492 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_coroutine.hpp
+ * @brief     driver sgp41 coroutine c++ header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_COROUTINE_HPP
+#define DRIVER_SGP41_COROUTINE_HPP
+
+#include "driver_sgp41.h"
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @defgroup sgp41_coroutine sgp41 coroutine function
+ * @brief    sgp41 c++20 coroutine modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+namespace sgp41
+{
+
+/**
+ * @brief sgp41 timer queue class definition
+ * @note  a single thread executor, coroutines are resumed in deadline order
+ *        and in schedule order for equal deadlines, in virtual time mode the
+ *        clock jumps to the next deadline instead of sleeping
+ */
+class timer_queue
+{
+  public:
+    using clock = std::chrono::steady_clock;         /**< clock type */
+    using time_point = clock::time_point;            /**< time point type */
+    using duration = clock::duration;                /**< duration type */
+
+    /**
+     * @brief sleep awaitable definition
+     */
+    struct sleep_awaitable
+    {
+        timer_queue &queue;                                                  /**< owner queue */
+        time_point deadline;                                                 /**< wake up time */
+        bool await_ready() const noexcept { return false; }                  /**< always suspend */
+        void await_suspend(std::coroutine_handle<> h) { queue.schedule(deadline, h); }
+        void await_resume() const noexcept {}                                /**< nothing to return */
+    };
+
+    /**
+     * @brief     constructor
+     * @param[in] virtual_time virtual time mode flag
+     * @note      the virtual clock starts at the current steady clock time
+     */
+    explicit timer_queue(bool virtual_time = false)
+        : m_virtual(virtual_time), m_now(clock::now()), m_seq(0)
+    {
+    }
+
+    /**
+     * @brief  get the queue time
+     * @return current time
+     * @note   none
+     */
+    time_point now() const
+    {
+        return m_virtual ? m_now : clock::now();
+    }
+
+    /**
+     * @brief     schedule a coroutine
+     * @param[in] deadline resume time
+     * @param[in] h coroutine handle
+     * @note      none
+     */
+    void schedule(time_point deadline, std::coroutine_handle<> h)
+    {
+        m_heap.push(entry{deadline, m_seq++, h});
+    }
+
+    /**
+     * @brief     sleep until a time point
+     * @param[in] deadline wake up time
+     * @return    awaitable
+     * @note      none
+     */
+    sleep_awaitable sleep_until(time_point deadline)
+    {
+        return sleep_awaitable{*this, deadline};
+    }
+
+    /**
+     * @brief     sleep for a duration
+     * @param[in] d sleep duration
+     * @return    awaitable
+     * @note      none
+     */
+    sleep_awaitable sleep_for(duration d)
+    {
+        return sleep_awaitable{*this, now() + d};
+    }
+
+    /**
+     * @brief  resume the earliest coroutine
+     * @return false when the queue is empty
+     * @note   blocks until its deadline in real time mode
+     */
+    bool run_one()
+    {
+        entry e;
+
+        if (m_heap.empty())
+        {
+            return false;
+        }
+        e = m_heap.top();
+        m_heap.pop();
+        if (m_virtual)
+        {
+            if (e.deadline > m_now)
+            {
+                m_now = e.deadline;
+            }
+        }
+        else
+        {
+            std::this_thread::sleep_until(e.deadline);
+        }
+        e.handle.resume();
+
+        return true;
+    }
+
+    /**
+     * @brief  run until the queue is empty
+     * @return resumed coroutine count
+     * @note   none
+     */
+    uint64_t run()
+    {
+        uint64_t n = 0;
+
+        while (run_one())
+        {
+            n++;
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief     run until a time point
+     * @param[in] end stop time
+     * @return    resumed coroutine count
+     * @note      coroutines due after end stay queued
+     */
+    uint64_t run_until(time_point end)
+    {
+        uint64_t n = 0;
+
+        while (!m_heap.empty() && (m_heap.top().deadline <= end))
+        {
+            (void)run_one();
+            n++;
+        }
+        if (m_virtual && (m_now < end))
+        {
+            m_now = end;
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief  get the queued coroutine count
+     * @return queued count
+     * @note   none
+     */
+    size_t pending() const
+    {
+        return m_heap.size();
+    }
+
+  private:
+    /**
+     * @brief timer entry definition
+     */
+    struct entry
+    {
+        time_point deadline;                  /**< resume time */
+        uint64_t seq;                         /**< schedule order */
+        std::coroutine_handle<> handle;       /**< coroutine */
+        bool operator>(const entry &e) const
+        {
+            return (deadline != e.deadline) ? (deadline > e.deadline) : (seq > e.seq);
+        }
+    };
+
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry> > m_heap;        /**< deadline heap */
+    bool m_virtual;                                                                     /**< virtual time mode */
+    time_point m_now;                                                                   /**< virtual clock */
+    uint64_t m_seq;                                                                     /**< next schedule order */
+};
+
+/**
+ * @brief sgp41 task class definition
+ * @note  a fire and forget coroutine, it starts at once and frees its frame
+ *        when it returns, an escaping exception terminates the program
+ */
+struct task
+{
+    /**
+     * @brief promise definition
+     */
+    struct promise_type
+    {
+        task get_return_object() noexcept { return task{}; }                          /**< get the task */
+        std::suspend_never initial_suspend() noexcept { return {}; }                  /**< run at once */
+        std::suspend_never final_suspend() noexcept { return {}; }                    /**< free at the end */
+        void return_void() noexcept {}                                                /**< no return value */
+        void unhandled_exception() noexcept { std::terminate(); }                     /**< no exception */
+    };
+};
+
+/**
+ * @brief sgp41 conditioning result definition
+ */
+struct conditioning_result
+{
+    uint8_t status;          /**< driver status code, 0 means success */
+    uint16_t sraw_voc;       /**< raw voc */
+};
+
+/**
+ * @brief sgp41 measure raw result definition
+ */
+struct measure_raw_result
+{
+    uint8_t status;          /**< driver status code, 0 means success */
+    uint16_t sraw_voc;       /**< raw voc */
+    uint16_t sraw_nox;       /**< raw nox */
+};
+
+/**
+ * @brief sgp41 self test result definition
+ */
+struct self_test_result
+{
+    uint8_t status;          /**< driver status code, 0 means success */
+    uint16_t result;         /**< self test result, 0xD400 means passed */
+};
+
+/**
+ * @brief sgp41 serial id result definition
+ */
+struct serial_id_result
+{
+    uint8_t status;                     /**< driver status code, 0 means success */
+    std::array<uint16_t, 3> id;         /**< serial id */
+};
+
+/**
+ * @brief sgp41 command awaitable class definition
+ * @note  await_suspend writes the command, the coroutine is resumed by the
+ *        queue after the execution time and await_resume reads the answer,
+ *        a failed write resumes at once with the start status
+ */
+template <class Result, class Start, class Read>
+class command_awaitable
+{
+  public:
+    /**
+     * @brief     constructor
+     * @param[in] &queue reference to a timer queue
+     * @param[in] ms execution time in ms
+     * @param[in] start command write function
+     * @param[in] read answer read function
+     * @note      none
+     */
+    command_awaitable(timer_queue &queue, uint32_t ms, Start start, Read read)
+        : m_queue(queue), m_ms(ms), m_start(start), m_read(read), m_status(0)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> h)
+    {
+        m_status = m_start();
+        if (m_status != 0)
+        {
+            return false;
+        }
+        m_queue.schedule(m_queue.now() + std::chrono::milliseconds(m_ms), h);
+
+        return true;
+    }
+
+    Result await_resume()
+    {
+        Result r{};
+
+        if (m_status != 0)
+        {
+            r.status = m_status;
+
+            return r;
+        }
+
+        return m_read();
+    }
+
+  private:
+    timer_queue &m_queue;        /**< owner queue */
+    uint32_t m_ms;               /**< execution time */
+    Start m_start;               /**< command write */
+    Read m_read;                 /**< answer read */
+    uint8_t m_status;            /**< start status */
+};
+
+/**
+ * @brief     make a command awaitable
+ * @param[in] &queue reference to a timer queue
+ * @param[in] ms execution time in ms
+ * @param[in] start command write function
+ * @param[in] read answer read function
+ * @return    awaitable
+ * @note      the result type is the return type of read
+ */
+template <class Start, class Read>
+command_awaitable<decltype(std::declval<Read>()()), Start, Read> make_command(timer_queue &queue, uint32_t ms, Start start, Read read)
+{
+    return command_awaitable<decltype(std::declval<Read>()()), Start, Read>(queue, ms, start, read);
+}
+
+/**
+ * @brief sgp41 async device class definition
+ * @note  the handle must be initialized with sgp41_init, only one command may
+ *        be in flight per device, devices on other addresses or buses can be
+ *        awaited at the same time from the same thread
+ */
+class async_device
+{
+  public:
+    /**
+     * @brief     constructor
+     * @param[in] *handle pointer to an initialized sgp41 handle structure
+     * @param[in] &queue reference to a timer queue
+     * @note      none
+     */
+    async_device(sgp41_handle_t *handle, timer_queue &queue)
+        : m_handle(handle), m_queue(queue)
+    {
+    }
+
+    /**
+     * @brief  await the execute conditioning command
+     * @return awaitable of conditioning_result
+     * @note   none
+     */
+    auto execute_conditioning()
+    {
+        sgp41_handle_t *handle = m_handle;
+
+        return make_command(m_queue, SGP41_EXECUTION_TIME_CONDITIONING_MS,
+                    [handle]() { return sgp41_start_execute_conditioning(handle); },
+                    [handle]() {
+                        conditioning_result r{};
+                        r.status = sgp41_read_execute_conditioning(handle, &r.sraw_voc);
+                        return r;
+                    });
+    }
+
+    /**
+     * @brief     await the measure raw command
+     * @param[in] raw_humidity humidity raw data
+     * @param[in] raw_temperature temperature raw data
+     * @return    awaitable of measure_raw_result
+     * @note      the defaults measure without compensation
+     */
+    auto measure_raw(uint16_t raw_humidity = 0x8000, uint16_t raw_temperature = 0x6666)
+    {
+        sgp41_handle_t *handle = m_handle;
+
+        return make_command(m_queue, SGP41_EXECUTION_TIME_MEASURE_RAW_MS,
+                    [handle, raw_humidity, raw_temperature]() {
+                        return sgp41_start_measure_raw(handle, raw_humidity, raw_temperature);
+                    },
+                    [handle]() {
+                        measure_raw_result r{};
+                        r.status = sgp41_read_measure_raw(handle, &r.sraw_voc, &r.sraw_nox);
+                        return r;
+                    });
+    }
+
+    /**
+     * @brief  await the self test command
+     * @return awaitable of self_test_result
+     * @note   none
+     */
+    auto self_test()
+    {
+        sgp41_handle_t *handle = m_handle;
+
+        return make_command(m_queue, SGP41_EXECUTION_TIME_SELF_TEST_MS,
+                    [handle]() { return sgp41_start_measure_test(handle); },
+                    [handle]() {
+                        self_test_result r{};
+                        r.status = sgp41_read_measure_test(handle, &r.result);
+                        return r;
+                    });
+    }
+
+    /**
+     * @brief  await the get serial id command
+     * @return awaitable of serial_id_result
+     * @note   none
+     */
+    auto serial_id()
+    {
+        sgp41_handle_t *handle = m_handle;
+
+        return make_command(m_queue, SGP41_EXECUTION_TIME_SERIAL_ID_MS,
+                    [handle]() { return sgp41_start_serial_id(handle); },
+                    [handle]() {
+                        serial_id_result r{};
+                        r.status = sgp41_read_serial_id(handle, r.id.data());
+                        return r;
+                    });
+    }
+
+    /**
+     * @brief  get the timer queue
+     * @return reference to the timer queue
+     * @note   none
+     */
+    timer_queue &queue()
+    {
+        return m_queue;
+    }
+
+  private:
+    sgp41_handle_t *m_handle;        /**< driver handle */
+    timer_queue &m_queue;            /**< owner queue */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_log.c
+ * @brief     driver sgp41 log source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_log.h"
+
+/**
+ * @brief log message text definition
+ */
+static const char *const gs_text[SGP41_LOG_MAX] =
+{
+    [SGP41_LOG_IIC_INIT_NULL] = SGP41_LOG_TEXT_IIC_INIT_NULL,
+    [SGP41_LOG_IIC_DEINIT_NULL] = SGP41_LOG_TEXT_IIC_DEINIT_NULL,
+    [SGP41_LOG_IIC_WRITE_CMD_NULL] = SGP41_LOG_TEXT_IIC_WRITE_CMD_NULL,
+    [SGP41_LOG_IIC_READ_CMD_NULL] = SGP41_LOG_TEXT_IIC_READ_CMD_NULL,
+    [SGP41_LOG_DELAY_MS_NULL] = SGP41_LOG_TEXT_DELAY_MS_NULL,
+    [SGP41_LOG_IIC_INIT_FAILED] = SGP41_LOG_TEXT_IIC_INIT_FAILED,
+    [SGP41_LOG_TURN_HEATER_OFF_FAILED] = SGP41_LOG_TEXT_TURN_HEATER_OFF_FAILED,
+    [SGP41_LOG_IIC_CLOSE_FAILED] = SGP41_LOG_TEXT_IIC_CLOSE_FAILED,
+    [SGP41_LOG_READ_MEASURE_RAW_FAILED] = SGP41_LOG_TEXT_READ_MEASURE_RAW_FAILED,
+    [SGP41_LOG_WRITE_MEASURE_RAW_FAILED] = SGP41_LOG_TEXT_WRITE_MEASURE_RAW_FAILED,
+    [SGP41_LOG_SRAW_VOC_CRC_ERROR] = SGP41_LOG_TEXT_SRAW_VOC_CRC_ERROR,
+    [SGP41_LOG_SRAW_NOX_CRC_ERROR] = SGP41_LOG_TEXT_SRAW_NOX_CRC_ERROR,
+    [SGP41_LOG_READ_MEASURE_TEST_FAILED] = SGP41_LOG_TEXT_READ_MEASURE_TEST_FAILED,
+    [SGP41_LOG_WRITE_MEASURE_TEST_FAILED] = SGP41_LOG_TEXT_WRITE_MEASURE_TEST_FAILED,
+    [SGP41_LOG_MEASURE_TEST_CHECK_ERROR] = SGP41_LOG_TEXT_MEASURE_TEST_CHECK_ERROR,
+    [SGP41_LOG_WRITE_SOFT_RESET_FAILED] = SGP41_LOG_TEXT_WRITE_SOFT_RESET_FAILED,
+    [SGP41_LOG_WRITE_TURN_HEATER_OFF_FAILED] = SGP41_LOG_TEXT_WRITE_TURN_HEATER_OFF_FAILED,
+    [SGP41_LOG_READ_SERIAL_ID_FAILED] = SGP41_LOG_TEXT_READ_SERIAL_ID_FAILED,
+    [SGP41_LOG_WRITE_SERIAL_ID_FAILED] = SGP41_LOG_TEXT_WRITE_SERIAL_ID_FAILED,
+    [SGP41_LOG_SERIAL_ID_CRC_ERROR] = SGP41_LOG_TEXT_SERIAL_ID_CRC_ERROR,
+    [SGP41_LOG_READ_EXECUTE_CONDITIONING_FAILED] = SGP41_LOG_TEXT_READ_EXECUTE_CONDITIONING_FAILED,
+    [SGP41_LOG_WRITE_EXECUTE_CONDITIONING_FAILED] = SGP41_LOG_TEXT_WRITE_EXECUTE_CONDITIONING_FAILED,
+};
+
+static sgp41_log_handle_t *gs_log = NULL;        /**< log of sgp41_log_write */
+
+/**
+ * @brief     start the log
+ * @param[in] *handle pointer to an sgp41 log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 get_time_us is NULL
+ * @note      the ring is emptied, the handle becomes the one of sgp41_log_write
+ */
+uint8_t sgp41_log_init(sgp41_log_handle_t *handle)
+{
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->get_time_us == NULL)                                        /* check get_time_us */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    handle->head = 0;                                                       /* empty the ring */
+    handle->tail = 0;                                                       /* empty the ring */
+    handle->dropped = 0;                                                    /* clear the counter */
+    handle->inited = 1;                                                     /* flag finish initialization */
+    gs_log = handle;                                                        /* set the active log */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     stop the log
+ * @param[in] *handle pointer to an sgp41 log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      later sgp41_log_write calls are ignored
+ */
+uint8_t sgp41_log_deinit(sgp41_log_handle_t *handle)
+{
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    if (gs_log == handle)                                                   /* active log */
+    {
+        gs_log = NULL;                                                      /* clear the active log */
+    }
+    handle->inited = 0;                                                     /* flag close */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     write one record
+ * @param[in] id message id
+ * @param[in] arg message argument
+ * @note      link it to the sgp41 handle with DRIVER_SGP41_LINK_DEBUG_LOG,
+ *            no lock and no formatting, a full ring drops the record,
+ *            one producer context at a time, calls that can preempt each other need their own guard
+ */
+void sgp41_log_write(uint8_t id, uint16_t arg)
+{
+    sgp41_log_handle_t *handle = gs_log;
+    sgp41_log_record_t *record;
+    uint32_t head;
+
+    if (handle == NULL)                                                     /* no active log */
+    {
+        return;                                                             /* ignore */
+    }
+
+    head = handle->head;                                                    /* own index */
+    if ((uint32_t)(head - handle->tail) >= SGP41_LOG_RING_SIZE)             /* ring full */
+    {
+        handle->dropped++;                                                  /* drop + 1 */
+
+        return;                                                             /* drop the record */
+    }
+    SGP41_LOG_ACQUIRE();                                                    /* freed slot before the record */
+    record = &handle->ring[head & (SGP41_LOG_RING_SIZE - 1)];               /* free slot */
+    record->time_us = (uint32_t)handle->get_time_us();                      /* set the time */
+    record->id = id;                                                        /* set the id */
+    record->reserved = 0;                                                   /* set 0 */
+    record->arg = arg;                                                      /* set the argument */
+    SGP41_LOG_RELEASE();                                                    /* record before the index */
+    handle->head = head + 1;                                                /* publish */
+}
+
+/**
+ * @brief      read one record
+ * @param[in]  *handle pointer to an sgp41 log handle structure
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one consumer, it may run beside the producer
+ */
+uint8_t sgp41_log_read(sgp41_log_handle_t *handle, sgp41_log_record_t *record)
+{
+    uint32_t tail;
+
+    if ((handle == NULL) || (record == NULL))                               /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    tail = handle->tail;                                                    /* own index */
+    if (tail == handle->head)                                               /* ring empty */
+    {
+        return 1;                                                           /* return error */
+    }
+    SGP41_LOG_ACQUIRE();                                                    /* index before the record */
+    *record = handle->ring[tail & (SGP41_LOG_RING_SIZE - 1)];               /* copy the record */
+    SGP41_LOG_RELEASE();                                                    /* copy before the slot is freed */
+    handle->tail = tail + 1;                                                /* free the slot */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      format one record
+ * @param[in]  *record pointer to a record
+ * @param[out] *buf pointer to a text buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 message id is unknown
+ *             - 2 record or buf is NULL
+ * @note       the text is the one the text level prints, cut to the buffer,
+ *             only the decoding side needs it, a linker with section garbage collection drops the strings otherwise
+ */
+uint8_t sgp41_log_decode(const sgp41_log_record_t *record, char *buf, uint16_t len)
+{
+    if ((record == NULL) || (buf == NULL) || (len == 0))                    /* check the params */
+    {
+        return 2;                                                           /* return error */
+    }
+    if ((record->id >= SGP41_LOG_MAX) || (gs_text[record->id] == NULL))     /* check the id */
+    {
+        buf[0] = '\0';                                                      /* empty text */
+
+        return 1;                                                           /* return error */
+    }
+
+    (void)snprintf(buf, len, gs_text[record->id], (int)record->arg);        /* format */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 log handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_log_get_stats(const sgp41_log_handle_t *handle, sgp41_log_stats_t *stats)
+{
+    if ((handle == NULL) || (stats == NULL))                                /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    stats->records = handle->head;                                          /* written records */
+    stats->dropped = handle->dropped;                                       /* dropped records */
+    stats->pending = handle->head - handle->tail;                           /* unread records */
+
+    return 0;                                                               /* success return 0 */
+}
@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_log.h
+ * @brief     driver sgp41 log header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_LOG_H
+#define DRIVER_SGP41_LOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_log sgp41 log function
+ * @brief    sgp41 deferred binary log modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 log level definition
+ * @note  the driver is built with one level, set SGP41_LOG_LEVEL on the compiler command line
+ */
+#define SGP41_LOG_LEVEL_NONE          0        /**< no log, the driver keeps no message */
+#define SGP41_LOG_LEVEL_BINARY        1        /**< message id and argument through debug_log, no string in the driver */
+#define SGP41_LOG_LEVEL_TEXT          2        /**< formatted through debug_print */
+
+#ifndef SGP41_LOG_LEVEL
+    #define SGP41_LOG_LEVEL SGP41_LOG_LEVEL_TEXT
+#endif
+
+/**
+ * @brief sgp41 log param definition
+ */
+#define SGP41_LOG_RING_SIZE           256        /**< ring records, a power of 2 */
+
+/**
+ * @brief sgp41 log barrier definition
+ * @note  orders the record against the indexes between the producer and the consumer,
+ *        a single core mcu only needs the compiler to keep the order
+ */
+#ifndef SGP41_LOG_ACQUIRE
+    #if defined(__GNUC__)
+        #define SGP41_LOG_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+        #define SGP41_LOG_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+    #else
+        #define SGP41_LOG_ACQUIRE()
+        #define SGP41_LOG_RELEASE()
+    #endif
+#endif
+
+/**
+ * @brief sgp41 log message enumeration definition
+ * @note  the values are kept in recorded logs, append new messages only
+ */
+typedef enum
+{
+    SGP41_LOG_IIC_INIT_NULL                     = 0x01,        /**< iic_init is null */
+    SGP41_LOG_IIC_DEINIT_NULL                   = 0x02,        /**< iic_deinit is null */
+    SGP41_LOG_IIC_WRITE_CMD_NULL                = 0x03,        /**< iic_write_cmd is null */
+    SGP41_LOG_IIC_READ_CMD_NULL                 = 0x04,        /**< iic_read_cmd is null */
+    SGP41_LOG_DELAY_MS_NULL                     = 0x05,        /**< delay_ms is null */
+    SGP41_LOG_IIC_INIT_FAILED                   = 0x06,        /**< iic init failed */
+    SGP41_LOG_TURN_HEATER_OFF_FAILED            = 0x07,        /**< turn heater off failed */
+    SGP41_LOG_IIC_CLOSE_FAILED                  = 0x08,        /**< iic close failed */
+    SGP41_LOG_READ_MEASURE_RAW_FAILED           = 0x09,        /**< read measure raw failed */
+    SGP41_LOG_WRITE_MEASURE_RAW_FAILED          = 0x0A,        /**< write measure raw failed */
+    SGP41_LOG_SRAW_VOC_CRC_ERROR                = 0x0B,        /**< sraw voc crc check error */
+    SGP41_LOG_SRAW_NOX_CRC_ERROR                = 0x0C,        /**< sraw nox crc check error */
+    SGP41_LOG_READ_MEASURE_TEST_FAILED          = 0x0D,        /**< read measure test failed */
+    SGP41_LOG_WRITE_MEASURE_TEST_FAILED         = 0x0E,        /**< write measure test failed */
+    SGP41_LOG_MEASURE_TEST_CHECK_ERROR          = 0x0F,        /**< measure test check error */
+    SGP41_LOG_WRITE_SOFT_RESET_FAILED           = 0x10,        /**< write soft reset failed */
+    SGP41_LOG_WRITE_TURN_HEATER_OFF_FAILED      = 0x11,        /**< write turn heater off failed */
+    SGP41_LOG_READ_SERIAL_ID_FAILED             = 0x12,        /**< read serial id failed */
+    SGP41_LOG_WRITE_SERIAL_ID_FAILED            = 0x13,        /**< write serial id failed */
+    SGP41_LOG_SERIAL_ID_CRC_ERROR               = 0x14,        /**< crc check failed, the argument is the word */
+    SGP41_LOG_READ_EXECUTE_CONDITIONING_FAILED  = 0x15,        /**< read execute conditioning failed */
+    SGP41_LOG_WRITE_EXECUTE_CONDITIONING_FAILED = 0x16,        /**< write execute conditioning failed */
+    SGP41_LOG_MAX                               = 0x17,        /**< first unused id */
+} sgp41_log_id_t;
+
+/**
+ * @brief sgp41 log message text definition
+ * @note  one per id, the text level prints them and sgp41_log_decode formats them
+ */
+#define SGP41_LOG_TEXT_IIC_INIT_NULL                        "sgp41: iic_init is null.\n"
+#define SGP41_LOG_TEXT_IIC_DEINIT_NULL                      "sgp41: iic_deinit is null.\n"
+#define SGP41_LOG_TEXT_IIC_WRITE_CMD_NULL                   "sgp41: iic_write_cmd is null.\n"
+#define SGP41_LOG_TEXT_IIC_READ_CMD_NULL                    "sgp41: iic_read_cmd is null.\n"
+#define SGP41_LOG_TEXT_DELAY_MS_NULL                        "sgp41: delay_ms is null.\n"
+#define SGP41_LOG_TEXT_IIC_INIT_FAILED                      "sgp41: iic init failed.\n"
+#define SGP41_LOG_TEXT_TURN_HEATER_OFF_FAILED               "sgp41: turn heater off failed.\n"
+#define SGP41_LOG_TEXT_IIC_CLOSE_FAILED                     "sgp41: iic close failed.\n"
+#define SGP41_LOG_TEXT_READ_MEASURE_RAW_FAILED              "sgp41: read measure raw failed.\n"
+#define SGP41_LOG_TEXT_WRITE_MEASURE_RAW_FAILED             "sgp41: write measure raw failed.\n"
+#define SGP41_LOG_TEXT_SRAW_VOC_CRC_ERROR                   "sgp41: sraw voc crc check error.\n"
+#define SGP41_LOG_TEXT_SRAW_NOX_CRC_ERROR                   "sgp41: sraw nox crc check error.\n"
+#define SGP41_LOG_TEXT_READ_MEASURE_TEST_FAILED             "sgp41: read measure test failed.\n"
+#define SGP41_LOG_TEXT_WRITE_MEASURE_TEST_FAILED            "sgp41: write measure test failed.\n"
+#define SGP41_LOG_TEXT_MEASURE_TEST_CHECK_ERROR             "sgp41: measure test check error.\n"
+#define SGP41_LOG_TEXT_WRITE_SOFT_RESET_FAILED              "sgp41: write soft reset failed.\n"
+#define SGP41_LOG_TEXT_WRITE_TURN_HEATER_OFF_FAILED         "sgp41: write turn heater off failed.\n"
+#define SGP41_LOG_TEXT_READ_SERIAL_ID_FAILED                "sgp41: read serial id failed.\n"
+#define SGP41_LOG_TEXT_WRITE_SERIAL_ID_FAILED               "sgp41: write serial id failed.\n"
+#define SGP41_LOG_TEXT_SERIAL_ID_CRC_ERROR                  "sgp41: crc %d check failed.\n"
+#define SGP41_LOG_TEXT_READ_EXECUTE_CONDITIONING_FAILED     "sgp41: read execute conditioning failed.\n"
+#define SGP41_LOG_TEXT_WRITE_EXECUTE_CONDITIONING_FAILED    "sgp41: write execute conditioning failed.\n"
+
+/**
+ * @brief sgp41 log record structure definition
+ */
+typedef struct sgp41_log_record_s
+{
+    uint32_t time_us;        /**< time of the call, low 32 bits */
+    uint8_t id;              /**< message id */
+    uint8_t reserved;        /**< reserved */
+    uint16_t arg;            /**< message argument */
+} sgp41_log_record_t;
+
+/**
+ * @brief sgp41 log statistics structure definition
+ */
+typedef struct sgp41_log_stats_s
+{
+    uint32_t records;        /**< records written */
+    uint32_t dropped;        /**< records lost on a full ring */
+    uint32_t pending;        /**< records not read yet */
+} sgp41_log_stats_t;
+
+/**
+ * @brief sgp41 log handle structure definition
+ */
+typedef struct sgp41_log_handle_s
+{
+    uint64_t (*get_time_us)(void);                          /**< point to a get_time_us function address */
+    sgp41_log_record_t ring[SGP41_LOG_RING_SIZE];           /**< record ring */
+    volatile uint32_t head;                                 /**< write index, moved by the producer only */
+    volatile uint32_t tail;                                 /**< read index, moved by the consumer only */
+    volatile uint32_t dropped;                              /**< dropped counter */
+    uint8_t inited;                                         /**< inited flag */
+} sgp41_log_handle_t;
+
+/**
+ * @defgroup sgp41_log_link sgp41 log link function
+ * @brief    sgp41 log link functions
+ * @ingroup  sgp41_log
+ * @{
+ */
+
+/**
+ * @brief     initialize sgp41_log_handle_t structure
+ * @param[in] HANDLE pointer to an sgp41 log handle structure
+ * @param[in] STRUCTURE sgp41_log_handle_t
+ * @note      none
+ */
+#define DRIVER_SGP41_LOG_LINK_INIT(HANDLE, STRUCTURE)           memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link get_time_us function
+ * @param[in] HANDLE pointer to an sgp41 log handle structure
+ * @param[in] FUC pointer to a get_time_us function address
+ * @note      none
+ */
+#define DRIVER_SGP41_LOG_LINK_GET_TIME_US(HANDLE, FUC)          (HANDLE)->get_time_us = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @brief     start the log
+ * @param[in] *handle pointer to an sgp41 log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 get_time_us is NULL
+ * @note      the ring is emptied, the handle becomes the one of sgp41_log_write
+ */
+uint8_t sgp41_log_init(sgp41_log_handle_t *handle);
+
+/**
+ * @brief     stop the log
+ * @param[in] *handle pointer to an sgp41 log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      later sgp41_log_write calls are ignored
+ */
+uint8_t sgp41_log_deinit(sgp41_log_handle_t *handle);
+
+/**
+ * @brief     write one record
+ * @param[in] id message id
+ * @param[in] arg message argument
+ * @note      link it to the sgp41 handle with DRIVER_SGP41_LINK_DEBUG_LOG,
+ *            no lock and no formatting, a full ring drops the record,
+ *            one producer context at a time, calls that can preempt each other need their own guard
+ */
+void sgp41_log_write(uint8_t id, uint16_t arg);
+
+/**
+ * @brief      read one record
+ * @param[in]  *handle pointer to an sgp41 log handle structure
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one consumer, it may run beside the producer
+ */
+uint8_t sgp41_log_read(sgp41_log_handle_t *handle, sgp41_log_record_t *record);
+
+/**
+ * @brief      format one record
+ * @param[in]  *record pointer to a record
+ * @param[out] *buf pointer to a text buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 message id is unknown
+ *             - 2 record or buf is NULL
+ * @note       the text is the one the text level prints, cut to the buffer,
+ *             only the decoding side needs it, a linker with section garbage collection drops the strings otherwise
+ */
+uint8_t sgp41_log_decode(const sgp41_log_record_t *record, char *buf, uint16_t len);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 log handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_log_get_stats(const sgp41_log_handle_t *handle, sgp41_log_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
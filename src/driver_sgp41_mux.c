@@ -0,0 +1,544 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_mux.c
+ * @brief     driver sgp41 mux source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_mux.h"
+
+static SGP41_MUX_THREAD_LOCAL sgp41_mux_handle_t *gs_mux = NULL;        /**< mux of the routed iic functions */
+
+/**
+ * @brief         set the channel mask of one mux
+ * @param[in]     *handle pointer to an sgp41 mux handle structure
+ * @param[in,out] *mask pointer to a channel mask table
+ * @param[in,out] *known pointer to the known bits
+ * @param[in]     mux mux index
+ * @param[in]     value channel mask
+ * @param[in]     issue write the bus flag, 0 only counts
+ * @param[in,out] *writes pointer to a write counter
+ * @return        status code
+ *                - 0 success
+ *                - 1 write failed
+ * @note          a failed write leaves the mux state unknown
+ */
+static uint8_t a_sgp41_mux_set(sgp41_mux_handle_t *handle, uint8_t *mask, uint8_t *known,
+                               uint8_t mux, uint8_t value, uint8_t issue, uint32_t *writes)
+{
+    if (((((*known) >> mux) & 0x01) != 0) && (mask[mux] == value))               /* already set */
+    {
+        return 0;                                                                /* nothing to do */
+    }
+
+    (*writes)++;                                                                 /* one mux write */
+    if (issue != 0)                                                              /* write the bus */
+    {
+        if (handle->iic_write_cmd(handle->mux_addr[mux], &value, 1) != 0)        /* write the mask */
+        {
+            *known &= (uint8_t)(~(1U << mux));                                   /* state is unknown */
+
+            return 1;                                                            /* return error */
+        }
+    }
+    mask[mux] = value;                                                           /* save mask */
+    *known |= (uint8_t)(1U << mux);                                              /* state is known */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief         switch the muxes to a sensor
+ * @param[in]     *handle pointer to an sgp41 mux handle structure
+ * @param[in,out] *mask pointer to a channel mask table
+ * @param[in,out] *known pointer to the known bits
+ * @param[in]     sensor sensor index
+ * @param[in]     issue write the bus flag, 0 only counts
+ * @param[in,out] *writes pointer to a write counter
+ * @return        status code
+ *                - 0 success
+ *                - 1 write failed
+ * @note          the other muxes are closed first, two sensors at one address must
+ *                never be visible together
+ */
+static uint8_t a_sgp41_mux_switch(sgp41_mux_handle_t *handle, uint8_t *mask, uint8_t *known,
+                                  uint8_t sensor, uint8_t issue, uint32_t *writes)
+{
+    uint8_t mux;
+    uint8_t i;
+
+    mux = handle->sensor_mux[sensor];                                            /* get mux */
+    for (i = 0; i < handle->mux_count; i++)                                      /* close the other muxes */
+    {
+        if (i == mux)                                                            /* skip the target */
+        {
+            continue;                                                            /* next */
+        }
+        if (a_sgp41_mux_set(handle, mask, known, i, 0, issue, writes) != 0)      /* deselect */
+        {
+            return 1;                                                            /* return error */
+        }
+    }
+
+    return a_sgp41_mux_set(handle, mask, known, mux,
+                           (uint8_t)(1U << handle->sensor_channel[sensor]),
+                           issue, writes);                                       /* select the channel */
+}
+
+/**
+ * @brief     initialize the mux transport
+ * @param[in] *handle pointer to an sgp41 mux handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the mux handle owns the bus, the sgp41 handles link the sgp41_mux_iic functions
+ */
+uint8_t sgp41_mux_init(sgp41_mux_handle_t *handle)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if ((handle->iic_init == NULL) || (handle->iic_deinit == NULL) ||
+        (handle->iic_write_cmd == NULL) || (handle->iic_read_cmd == NULL))       /* check linked functions */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    if (handle->iic_init() != 0)                                                 /* iic init */
+    {
+        return 1;                                                                /* return error */
+    }
+    memset(handle->mux_mask, 0, sizeof(handle->mux_mask));                       /* clear masks */
+    handle->mux_known = 0;                                                       /* nothing known */
+    handle->mux_count = 0;                                                       /* no mux */
+    handle->sensor_count = 0;                                                    /* no sensor */
+    handle->target = 0;                                                          /* no route */
+    handle->transactions = 0;                                                    /* clear transactions */
+    handle->selects = 0;                                                         /* clear selects */
+    handle->rounds = 0;                                                          /* clear rounds */
+    handle->round_transactions = 0;                                              /* clear round transactions */
+    handle->round_selects = 0;                                                   /* clear round selects */
+    handle->round_unsorted_selects = 0;                                          /* clear round unsorted selects */
+    handle->inited = 1;                                                          /* flag finish initialization */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     close the mux transport
+ * @param[in] *handle pointer to an sgp41 mux handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 deselect failed
+ * @note      every mux is deselected first
+ */
+uint8_t sgp41_mux_deinit(sgp41_mux_handle_t *handle)
+{
+    uint32_t writes;
+    uint8_t i;
+
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    writes = 0;                                                                  /* setup writes are not counted */
+    for (i = 0; i < handle->mux_count; i++)                                      /* every mux */
+    {
+        if (a_sgp41_mux_set(handle, handle->mux_mask, &handle->mux_known,
+                            i, 0, 1, &writes) != 0)                              /* deselect */
+        {
+            return 4;                                                            /* return error */
+        }
+    }
+    if (handle->iic_deinit() != 0)                                               /* iic deinit */
+    {
+        return 1;                                                                /* return error */
+    }
+    if (gs_mux == handle)                                                        /* active mux */
+    {
+        gs_mux = NULL;                                                           /* detach */
+    }
+    handle->inited = 0;                                                          /* flag close */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      add a mux
+ * @param[in]  *handle pointer to an sgp41 mux handle structure
+ * @param[in]  addr mux iic address
+ * @param[out] *mux pointer to a mux index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 deselect failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 too many muxes
+ * @note       the mux is deselected so its state is known
+ */
+uint8_t sgp41_mux_add_mux(sgp41_mux_handle_t *handle, uint8_t addr, uint8_t *mux)
+{
+    uint32_t writes;
+    uint8_t index;
+
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if (handle->mux_count >= SGP41_MUX_MAX_MUXES)                                /* check mux number */
+    {
+        return 4;                                                                /* return error */
+    }
+
+    index = handle->mux_count;                                                   /* next index */
+    handle->mux_addr[index] = addr;                                              /* set address */
+    handle->mux_known &= (uint8_t)(~(1U << index));                              /* state is unknown */
+    writes = 0;                                                                  /* setup writes are not counted */
+    if (a_sgp41_mux_set(handle, handle->mux_mask, &handle->mux_known,
+                        index, 0, 1, &writes) != 0)                              /* deselect */
+    {
+        return 1;                                                                /* return error */
+    }
+    handle->mux_count++;                                                         /* add mux */
+    *mux = index;                                                                /* set index */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      add a sensor
+ * @param[in]  *handle pointer to an sgp41 mux handle structure
+ * @param[in]  mux mux index
+ * @param[in]  channel mux channel
+ * @param[out] *sensor pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 mux or channel is invalid
+ *             - 5 too many sensors
+ * @note       none
+ */
+uint8_t sgp41_mux_add_sensor(sgp41_mux_handle_t *handle, uint8_t mux, uint8_t channel, uint8_t *sensor)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if ((mux >= handle->mux_count) || (channel >= SGP41_MUX_MAX_CHANNELS))       /* check route */
+    {
+        return 4;                                                                /* return error */
+    }
+    if (handle->sensor_count >= SGP41_MUX_MAX_SENSORS)                           /* check sensor number */
+    {
+        return 5;                                                                /* return error */
+    }
+
+    handle->sensor_mux[handle->sensor_count] = mux;                              /* set mux */
+    handle->sensor_channel[handle->sensor_count] = channel;                      /* set channel */
+    *sensor = handle->sensor_count;                                              /* set index */
+    handle->sensor_count++;                                                      /* add sensor */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     route the next transactions to a sensor
+ * @param[in] *handle pointer to an sgp41 mux handle structure
+ * @param[in] sensor sensor index
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 sensor is invalid
+ * @note      no bus traffic, the mux is written by the next transaction and only when
+ *            another channel is selected, the handle becomes the active one of the
+ *            sgp41_mux_iic functions
+ */
+uint8_t sgp41_mux_route(sgp41_mux_handle_t *handle, uint8_t sensor)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if (sensor >= handle->sensor_count)                                          /* check sensor */
+    {
+        return 4;                                                                /* return error */
+    }
+
+    handle->target = sensor;                                                     /* set target */
+    gs_mux = handle;                                                             /* set active mux */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      schedule a polling round
+ * @param[in]  *handle pointer to an sgp41 mux handle structure
+ * @param[in]  *sensors pointer to a sensor list
+ * @param[in]  count sensor number, at most SGP41_MUX_MAX_SENSORS
+ * @param[out] *order pointer to a scheduled sensor list buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 sensor or count is invalid
+ * @note       the sensors of one channel are served together, the selected channel first,
+ *             then the other channels of the selected mux, sensors of one channel keep the
+ *             caller order, the round statistics start here
+ */
+uint8_t sgp41_mux_schedule(sgp41_mux_handle_t *handle, const uint8_t *sensors, uint8_t count, uint8_t *order)
+{
+    uint8_t mask[SGP41_MUX_MAX_MUXES];
+    uint16_t key[SGP41_MUX_MAX_SENSORS];
+    uint8_t known;
+    uint8_t cur_mux;
+    uint8_t cur_channel;
+    uint32_t writes;
+    uint16_t k;
+    uint8_t s;
+    uint8_t i;
+    uint8_t j;
+
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if (count > SGP41_MUX_MAX_SENSORS)                                           /* check count */
+    {
+        return 4;                                                                /* return error */
+    }
+    for (i = 0; i < count; i++)                                                  /* check sensors */
+    {
+        if (sensors[i] >= handle->sensor_count)                                  /* check sensor */
+        {
+            return 4;                                                            /* return error */
+        }
+    }
+
+    /* mux writes of the caller order */
+    memcpy(mask, handle->mux_mask, sizeof(mask));                                /* copy masks */
+    known = handle->mux_known;                                                   /* copy known bits */
+    writes = 0;                                                                  /* init 0 */
+    for (i = 0; i < count; i++)                                                  /* caller order */
+    {
+        (void)a_sgp41_mux_switch(handle, mask, &known, sensors[i], 0, &writes);  /* count only */
+    }
+
+    /* find the selected channel */
+    cur_mux = SGP41_MUX_MAX_MUXES;                                               /* none */
+    cur_channel = SGP41_MUX_MAX_CHANNELS;                                        /* none */
+    for (i = 0; i < handle->mux_count; i++)                                      /* every mux */
+    {
+        if ((((handle->mux_known >> i) & 0x01) != 0) && (handle->mux_mask[i] != 0))
+        {
+            cur_mux = i;                                                         /* set mux */
+            for (j = 0; j < SGP41_MUX_MAX_CHANNELS; j++)                         /* find the channel */
+            {
+                if (((handle->mux_mask[i] >> j) & 0x01) != 0)                    /* selected */
+                {
+                    cur_channel = j;                                             /* set channel */
+
+                    break;                                                       /* break */
+                }
+            }
+
+            break;                                                               /* break */
+        }
+    }
+
+    /* stable insertion sort by mux then channel, the selected ones rank first */
+    for (i = 0; i < count; i++)                                                  /* every sensor */
+    {
+        s = sensors[i];                                                          /* get sensor */
+        k = (uint16_t)((handle->sensor_mux[s] == cur_mux) ? 0 : (handle->sensor_mux[s] + 1)) << 4;
+        k |= (uint16_t)(((handle->sensor_mux[s] == cur_mux) &&
+                         (handle->sensor_channel[s] == cur_channel)) ? 0 : (handle->sensor_channel[s] + 1));
+        for (j = i; (j > 0) && (key[j - 1] > k); j--)                            /* shift the larger keys */
+        {
+            key[j] = key[j - 1];                                                 /* move key */
+            order[j] = order[j - 1];                                             /* move sensor */
+        }
+        key[j] = k;                                                              /* set key */
+        order[j] = s;                                                            /* set sensor */
+    }
+
+    /* start the round */
+    handle->rounds++;                                                            /* add round */
+    handle->round_transactions = handle->transactions;                           /* save transactions */
+    handle->round_selects = handle->selects;                                     /* save selects */
+    handle->round_unsorted_selects = writes;                                     /* save caller order selects */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 mux handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the round fields count from the last sgp41_mux_schedule
+ */
+uint8_t sgp41_mux_get_stats(const sgp41_mux_handle_t *handle, sgp41_mux_stats_t *stats)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    stats->transactions = handle->transactions;                                  /* set transactions */
+    stats->selects = handle->selects;                                            /* set selects */
+    stats->naive_selects = handle->transactions;                                 /* one select per transaction */
+    stats->rounds = handle->rounds;                                              /* set rounds */
+    stats->round_transactions = handle->transactions - handle->round_transactions;        /* set round transactions */
+    stats->round_selects = handle->selects - handle->round_selects;              /* set round selects */
+    stats->round_naive_selects = stats->round_transactions;                      /* one select per transaction */
+    stats->round_unsorted_selects = handle->round_unsorted_selects;              /* set caller order selects */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief  routed iic init
+ * @return status code
+ *         - 0 success
+ *         - 1 no mux is active
+ * @note   link it to the sgp41 handles, the bus is initialized by sgp41_mux_init
+ */
+uint8_t sgp41_mux_iic_init(void)
+{
+    return (gs_mux != NULL) ? 0 : 1;                                             /* the mux owns the bus */
+}
+
+/**
+ * @brief  routed iic deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 no mux is active
+ * @note   link it to the sgp41 handles, the bus is closed by sgp41_mux_deinit
+ */
+uint8_t sgp41_mux_iic_deinit(void)
+{
+    return (gs_mux != NULL) ? 0 : 1;                                             /* the mux owns the bus */
+}
+
+/**
+ * @brief     routed iic write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      link it to the sgp41 handles
+ */
+uint8_t sgp41_mux_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    sgp41_mux_handle_t *handle = gs_mux;
+
+    if (handle == NULL)                                                          /* check active mux */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    handle->transactions++;                                                      /* add transaction */
+    if (a_sgp41_mux_switch(handle, handle->mux_mask, &handle->mux_known,
+                           handle->target, 1, &handle->selects) != 0)            /* route */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    return handle->iic_write_cmd(addr, buf, len);                                /* write */
+}
+
+/**
+ * @brief      routed iic read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       link it to the sgp41 handles
+ */
+uint8_t sgp41_mux_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    sgp41_mux_handle_t *handle = gs_mux;
+
+    if (handle == NULL)                                                          /* check active mux */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    handle->transactions++;                                                      /* add transaction */
+    if (a_sgp41_mux_switch(handle, handle->mux_mask, &handle->mux_known,
+                           handle->target, 1, &handle->selects) != 0)            /* route */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    return handle->iic_read_cmd(addr, buf, len);                                 /* read */
+}
@@ -0,0 +1,313 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_mux.h
+ * @brief     driver sgp41 mux header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_MUX_H
+#define DRIVER_SGP41_MUX_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_mux sgp41 mux function
+ * @brief    sgp41 iic multiplexer transport modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 mux param definition
+ */
+#define SGP41_MUX_MAX_MUXES           8                  /**< three address pins, eight muxes per bus */
+#define SGP41_MUX_MAX_CHANNELS        8                  /**< channels per mux */
+#define SGP41_MUX_MAX_SENSORS         64                 /**< every channel of every mux */
+#define SGP41_MUX_ADDRESS(n)          ((0x70 + (n)) << 1)        /**< tca9548a address with a0 to a2 set to n */
+
+/**
+ * @brief sgp41 mux active handle storage class definition
+ * @note  define it as __thread or _Thread_local to route one bus per thread
+ */
+#ifndef SGP41_MUX_THREAD_LOCAL
+    #define SGP41_MUX_THREAD_LOCAL
+#endif
+
+/**
+ * @brief sgp41 mux statistics structure definition
+ */
+typedef struct sgp41_mux_stats_s
+{
+    uint32_t transactions;                 /**< sensor bus transactions */
+    uint32_t selects;                      /**< mux writes issued */
+    uint32_t naive_selects;                /**< mux writes of a transport that selects before every transaction */
+    uint32_t rounds;                       /**< scheduled rounds */
+    uint32_t round_transactions;           /**< sensor bus transactions of the last round */
+    uint32_t round_selects;                /**< mux writes of the last round */
+    uint32_t round_naive_selects;          /**< mux writes of the last round selecting before every transaction */
+    uint32_t round_unsorted_selects;       /**< mux writes the last round needs in the caller order */
+} sgp41_mux_stats_t;
+
+/**
+ * @brief sgp41 mux handle structure definition
+ */
+typedef struct sgp41_mux_handle_s
+{
+    uint8_t (*iic_init)(void);                                                 /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void);                                               /**< point to an iic_deinit function address */
+    uint8_t (*iic_write_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);        /**< point to an iic_write_cmd function address */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);         /**< point to an iic_read_cmd function address */
+    uint8_t mux_addr[SGP41_MUX_MAX_MUXES];                                     /**< mux addresses */
+    uint8_t mux_mask[SGP41_MUX_MAX_MUXES];                                     /**< enabled channel mask of every mux */
+    uint8_t mux_known;                                                         /**< mux mask known bits */
+    uint8_t mux_count;                                                         /**< mux number */
+    uint8_t sensor_mux[SGP41_MUX_MAX_SENSORS];                                 /**< mux of every sensor */
+    uint8_t sensor_channel[SGP41_MUX_MAX_SENSORS];                             /**< channel of every sensor */
+    uint8_t sensor_count;                                                      /**< sensor number */
+    uint8_t target;                                                            /**< routed sensor */
+    uint32_t transactions;                                                     /**< transaction counter */
+    uint32_t selects;                                                          /**< select counter */
+    uint32_t rounds;                                                           /**< round counter */
+    uint32_t round_transactions;                                               /**< transactions at the round start */
+    uint32_t round_selects;                                                    /**< selects at the round start */
+    uint32_t round_unsorted_selects;                                           /**< caller order selects of the round */
+    uint8_t inited;                                                            /**< inited flag */
+} sgp41_mux_handle_t;
+
+/**
+ * @defgroup sgp41_mux_link sgp41 mux link function
+ * @brief    sgp41 mux link functions
+ * @ingroup  sgp41_mux
+ * @{
+ */
+
+/**
+ * @brief     initialize sgp41_mux_handle_t structure
+ * @param[in] HANDLE pointer to an sgp41 mux handle structure
+ * @param[in] STRUCTURE sgp41_mux_handle_t
+ * @note      none
+ */
+#define DRIVER_SGP41_MUX_LINK_INIT(HANDLE, STRUCTURE)           memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link iic_init function
+ * @param[in] HANDLE pointer to an sgp41 mux handle structure
+ * @param[in] FUC pointer to an iic_init function address
+ * @note      none
+ */
+#define DRIVER_SGP41_MUX_LINK_IIC_INIT(HANDLE, FUC)             (HANDLE)->iic_init = FUC
+
+/**
+ * @brief     link iic_deinit function
+ * @param[in] HANDLE pointer to an sgp41 mux handle structure
+ * @param[in] FUC pointer to an iic_deinit function address
+ * @note      none
+ */
+#define DRIVER_SGP41_MUX_LINK_IIC_DEINIT(HANDLE, FUC)           (HANDLE)->iic_deinit = FUC
+
+/**
+ * @brief     link iic_write_cmd function
+ * @param[in] HANDLE pointer to an sgp41 mux handle structure
+ * @param[in] FUC pointer to an iic_write_cmd function address
+ * @note      none
+ */
+#define DRIVER_SGP41_MUX_LINK_IIC_WRITE_COMMAND(HANDLE, FUC)    (HANDLE)->iic_write_cmd = FUC
+
+/**
+ * @brief     link iic_read_cmd function
+ * @param[in] HANDLE pointer to an sgp41 mux handle structure
+ * @param[in] FUC pointer to an iic_read_cmd function address
+ * @note      none
+ */
+#define DRIVER_SGP41_MUX_LINK_IIC_READ_COMMAND(HANDLE, FUC)     (HANDLE)->iic_read_cmd = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @brief     initialize the mux transport
+ * @param[in] *handle pointer to an sgp41 mux handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the mux handle owns the bus, the sgp41 handles link the sgp41_mux_iic functions
+ */
+uint8_t sgp41_mux_init(sgp41_mux_handle_t *handle);
+
+/**
+ * @brief     close the mux transport
+ * @param[in] *handle pointer to an sgp41 mux handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 deselect failed
+ * @note      every mux is deselected first
+ */
+uint8_t sgp41_mux_deinit(sgp41_mux_handle_t *handle);
+
+/**
+ * @brief      add a mux
+ * @param[in]  *handle pointer to an sgp41 mux handle structure
+ * @param[in]  addr mux iic address
+ * @param[out] *mux pointer to a mux index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 deselect failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 too many muxes
+ * @note       the mux is deselected so its state is known
+ */
+uint8_t sgp41_mux_add_mux(sgp41_mux_handle_t *handle, uint8_t addr, uint8_t *mux);
+
+/**
+ * @brief      add a sensor
+ * @param[in]  *handle pointer to an sgp41 mux handle structure
+ * @param[in]  mux mux index
+ * @param[in]  channel mux channel
+ * @param[out] *sensor pointer to a sensor index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 mux or channel is invalid
+ *             - 5 too many sensors
+ * @note       none
+ */
+uint8_t sgp41_mux_add_sensor(sgp41_mux_handle_t *handle, uint8_t mux, uint8_t channel, uint8_t *sensor);
+
+/**
+ * @brief     route the next transactions to a sensor
+ * @param[in] *handle pointer to an sgp41 mux handle structure
+ * @param[in] sensor sensor index
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 sensor is invalid
+ * @note      no bus traffic, the mux is written by the next transaction and only when
+ *            another channel is selected, the handle becomes the active one of the
+ *            sgp41_mux_iic functions
+ */
+uint8_t sgp41_mux_route(sgp41_mux_handle_t *handle, uint8_t sensor);
+
+/**
+ * @brief      schedule a polling round
+ * @param[in]  *handle pointer to an sgp41 mux handle structure
+ * @param[in]  *sensors pointer to a sensor list
+ * @param[in]  count sensor number, at most SGP41_MUX_MAX_SENSORS
+ * @param[out] *order pointer to a scheduled sensor list buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 sensor or count is invalid
+ * @note       the sensors of one channel are served together, the selected channel first,
+ *             then the other channels of the selected mux, sensors of one channel keep the
+ *             caller order, the round statistics start here
+ */
+uint8_t sgp41_mux_schedule(sgp41_mux_handle_t *handle, const uint8_t *sensors, uint8_t count, uint8_t *order);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 mux handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the round fields count from the last sgp41_mux_schedule
+ */
+uint8_t sgp41_mux_get_stats(const sgp41_mux_handle_t *handle, sgp41_mux_stats_t *stats);
+
+/**
+ * @brief  routed iic init
+ * @return status code
+ *         - 0 success
+ *         - 1 no mux is active
+ * @note   link it to the sgp41 handles, the bus is initialized by sgp41_mux_init
+ */
+uint8_t sgp41_mux_iic_init(void);
+
+/**
+ * @brief  routed iic deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 no mux is active
+ * @note   link it to the sgp41 handles, the bus is closed by sgp41_mux_deinit
+ */
+uint8_t sgp41_mux_iic_deinit(void);
+
+/**
+ * @brief     routed iic write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      link it to the sgp41 handles
+ */
+uint8_t sgp41_mux_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      routed iic read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       link it to the sgp41 handles
+ */
+uint8_t sgp41_mux_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,295 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_rate.c
+ * @brief     driver sgp41 rate source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_rate.h"
+#include <math.h>
+
+/**
+ * @brief     initialize the rate handle
+ * @param[in] *handle pointer to an sgp41 rate handle structure
+ * @param[in] min_period_ms fastest period in ms
+ * @param[in] max_period_ms slowest period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 period is invalid
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t sgp41_rate_init(sgp41_rate_handle_t *handle, uint32_t min_period_ms, uint32_t max_period_ms)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if ((min_period_ms == 0) || (max_period_ms < min_period_ms) ||
+        (max_period_ms > SGP41_RATE_MAX_PERIOD_LIMIT_MS))                        /* check period */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    memset(handle, 0, sizeof(sgp41_rate_handle_t));                              /* clear the handle */
+    handle->min_period_ms = min_period_ms;                                       /* set min period */
+    handle->max_period_ms = max_period_ms;                                       /* set max period */
+    handle->std_low = SGP41_RATE_DEFAULT_STD_LOW;                                /* set std low */
+    handle->std_high = SGP41_RATE_DEFAULT_STD_HIGH;                              /* set std high */
+    handle->slope_high = SGP41_RATE_DEFAULT_SLOPE_HIGH;                          /* set slope high */
+    handle->hold = SGP41_RATE_DEFAULT_HOLD;                                      /* set hold */
+    handle->bus_us_per_sample = SGP41_RATE_DEFAULT_BUS_US_PER_SAMPLE;            /* set bus cost */
+    handle->cpu_ns_per_sample = SGP41_RATE_DEFAULT_CPU_NS_PER_SAMPLE;            /* set cpu cost */
+    handle->period_ms = min_period_ms;                                           /* start fast */
+    handle->inited = 1;                                                          /* flag finish initialization */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     set the volatility thresholds
+ * @param[in] *handle pointer to an sgp41 rate handle structure
+ * @param[in] std_low index std below which the period may grow
+ * @param[in] std_high index std above which the fastest period is used
+ * @param[in] slope_high index change per second above which the fastest period is used
+ * @param[in] hold quiet samples before the period doubles
+ * @return    status code
+ *            - 0 success
+ *            - 1 threshold is invalid
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sgp41_rate_set_thresholds(sgp41_rate_handle_t *handle, float std_low, float std_high, float slope_high, uint32_t hold)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if ((std_low < 0.0f) || (std_high <= std_low) || (slope_high <= 0.0f))       /* check thresholds */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    handle->std_low = std_low;                                                   /* set std low */
+    handle->std_high = std_high;                                                 /* set std high */
+    handle->slope_high = slope_high;                                             /* set slope high */
+    handle->hold = hold;                                                         /* set hold */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     set the cost of one sample
+ * @param[in] *handle pointer to an sgp41 rate handle structure
+ * @param[in] bus_us bus time of one sample in us
+ * @param[in] cpu_ns cpu time of one sample in ns
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sgp41_rate_set_cost(sgp41_rate_handle_t *handle, uint32_t bus_us, uint32_t cpu_ns)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    handle->bus_us_per_sample = bus_us;                                          /* set bus cost */
+    handle->cpu_ns_per_sample = cpu_ns;                                          /* set cpu cost */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      feed one sample and get the next period
+ * @param[in]  *handle pointer to an sgp41 rate handle structure
+ * @param[in]  timestamp_ms sample time in ms
+ * @param[in]  voc_index voc gas index
+ * @param[in]  nox_index nox gas index
+ * @param[out] *period_ms pointer to a next period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timestamp is not newer than the last sample
+ * @note       none
+ */
+uint8_t sgp41_rate_update(sgp41_rate_handle_t *handle, uint32_t timestamp_ms, int32_t voc_index, int32_t nox_index, uint32_t *period_ms)
+{
+    int32_t index[2];
+    uint32_t dt_ms;
+    float dt;
+    float a;
+    float d;
+    float std;
+    float slope;
+    uint8_t gas;
+
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    index[0] = voc_index;                                                        /* set voc */
+    index[1] = nox_index;                                                        /* set nox */
+    if (handle->started == 0)                                                    /* first sample */
+    {
+        for (gas = 0; gas < 2; gas++)
+        {
+            handle->last_index[gas] = index[gas];                                /* set last index */
+            handle->mean[gas] = (float)index[gas];                               /* set mean */
+            handle->var[gas] = 0.0f;                                             /* set variance */
+        }
+        handle->last = timestamp_ms;                                             /* set last */
+        handle->samples = 1;                                                     /* one sample */
+        handle->started = 1;                                                     /* set started */
+        handle->period_ms = handle->min_period_ms;                               /* start fast */
+        *period_ms = handle->period_ms;                                          /* get period */
+
+        return 0;                                                                /* success return 0 */
+    }
+    dt_ms = timestamp_ms - handle->last;                                         /* wrap safe difference */
+    if ((dt_ms == 0) || (dt_ms >= 0x80000000U))                                  /* check timestamp */
+    {
+        return 4;                                                                /* return error */
+    }
+
+    /* exponentially weighted mean and variance with a fixed time constant */
+    dt = (float)dt_ms / 1000.0f;                                                 /* elapsed in s */
+    a = dt / (SGP41_RATE_VOLATILITY_TAU_S + dt);                                 /* weight of this sample */
+    std = 0.0f;
+    slope = 0.0f;
+    for (gas = 0; gas < 2; gas++)
+    {
+        float s;
+        float v;
+
+        s = fabsf((float)(index[gas] - handle->last_index[gas])) / dt;           /* index change per second */
+        d = (float)index[gas] - handle->mean[gas];                               /* deviation */
+        handle->mean[gas] += a * d;                                              /* update mean */
+        handle->var[gas] = (1.0f - a) * (handle->var[gas] + a * d * d);          /* update variance */
+        v = sqrtf(handle->var[gas]);                                             /* get std */
+        std = (v > std) ? v : std;                                               /* worst gas */
+        slope = (s > slope) ? s : slope;                                         /* worst gas */
+        handle->last_index[gas] = index[gas];                                    /* set last index */
+    }
+    handle->std = std;                                                           /* save std */
+    handle->slope = slope;                                                       /* save slope */
+    handle->last = timestamp_ms;                                                 /* set last */
+    handle->elapsed_ms += dt_ms;                                                 /* add time */
+    handle->samples++;                                                           /* add sample */
+
+    /* drop at once, grow slowly */
+    if ((slope >= handle->slope_high) || (std >= handle->std_high))              /* busy air */
+    {
+        if (handle->period_ms != handle->min_period_ms)                          /* check period */
+        {
+            handle->period_ms = handle->min_period_ms;                           /* fastest period */
+            handle->speedups++;                                                  /* add speedup */
+        }
+        handle->quiet = 0;                                                       /* clear quiet */
+    }
+    else if ((std <= handle->std_low) && (slope < (handle->slope_high / 2.0f)))  /* quiet air */
+    {
+        handle->quiet++;                                                         /* add quiet */
+        if ((handle->quiet >= handle->hold) && (handle->period_ms < handle->max_period_ms))
+        {
+            handle->period_ms = (handle->period_ms > (handle->max_period_ms / 2)) ?
+                                 handle->max_period_ms : (handle->period_ms * 2);  /* double the period */
+            handle->slowdowns++;                                                 /* add slowdown */
+            handle->quiet = 0;                                                   /* clear quiet */
+        }
+    }
+    else
+    {
+        handle->quiet = 0;                                                       /* keep the period */
+    }
+    *period_ms = handle->period_ms;                                              /* get period */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 rate handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_rate_get_stats(const sgp41_rate_handle_t *handle, sgp41_rate_stats_t *stats)
+{
+    uint32_t saved;
+
+    if ((handle == NULL) || (stats == NULL))                                     /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    memset(stats, 0, sizeof(sgp41_rate_stats_t));                                /* clear the stats */
+    stats->samples = handle->samples;                                            /* set samples */
+    stats->fixed_samples = (uint32_t)(handle->elapsed_ms / handle->min_period_ms) +
+                           ((handle->started != 0) ? 1 : 0);                     /* set fixed samples */
+    stats->speedups = handle->speedups;                                          /* set speedups */
+    stats->slowdowns = handle->slowdowns;                                        /* set slowdowns */
+    saved = (stats->fixed_samples > stats->samples) ?
+            (stats->fixed_samples - stats->samples) : 0;                         /* saved samples */
+    stats->bus_us_saved = (uint64_t)saved * handle->bus_us_per_sample;           /* set bus time */
+    stats->cpu_ns_saved = (uint64_t)saved * handle->cpu_ns_per_sample;           /* set cpu time */
+    if (stats->fixed_samples != 0)                                               /* check fixed samples */
+    {
+        stats->saved_ratio = (float)saved / (float)stats->fixed_samples;         /* set ratio */
+    }
+
+    return 0;                                                                    /* success return 0 */
+}
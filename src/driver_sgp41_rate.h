@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_rate.h
+ * @brief     driver sgp41 rate header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_RATE_H
+#define DRIVER_SGP41_RATE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_rate sgp41 rate function
+ * @brief    sgp41 adaptive sampling rate modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 rate param definition
+ */
+#define SGP41_RATE_DEFAULT_MIN_PERIOD_MS          1000         /**< fastest period, the algorithm nominal interval */
+#define SGP41_RATE_DEFAULT_MAX_PERIOD_MS          8000         /**< slowest period */
+#define SGP41_RATE_MAX_PERIOD_LIMIT_MS            600000       /**< longest allowed period, the algorithm gap bound */
+#define SGP41_RATE_DEFAULT_STD_LOW                2.0f         /**< index std below which the period may grow */
+#define SGP41_RATE_DEFAULT_STD_HIGH               6.0f         /**< index std above which the fastest period is used */
+#define SGP41_RATE_DEFAULT_SLOPE_HIGH             0.5f         /**< index change per second above which the fastest period is used */
+#define SGP41_RATE_DEFAULT_HOLD                   8            /**< quiet samples before the period doubles */
+#define SGP41_RATE_VOLATILITY_TAU_S               60.0f        /**< time constant of the index mean and std in seconds */
+#define SGP41_RATE_DEFAULT_BUS_US_PER_SAMPLE      1440         /**< measure raw frame, 16 bytes at 100 kHz */
+#define SGP41_RATE_DEFAULT_CPU_NS_PER_SAMPLE      300          /**< frame and both algorithms, simulator bench on x86-64 */
+
+/**
+ * @brief sgp41 rate statistics structure definition
+ */
+typedef struct sgp41_rate_stats_s
+{
+    uint32_t samples;                 /**< measured samples */
+    uint32_t fixed_samples;           /**< samples the fastest fixed period would have measured */
+    uint32_t speedups;                /**< period drops to the fastest period */
+    uint32_t slowdowns;               /**< period doublings */
+    uint64_t bus_us_saved;            /**< bus time saved in us */
+    uint64_t cpu_ns_saved;            /**< cpu time saved in ns */
+    float saved_ratio;                /**< saved share of the fixed rate samples */
+} sgp41_rate_stats_t;
+
+/**
+ * @brief sgp41 rate handle structure definition
+ */
+typedef struct sgp41_rate_handle_s
+{
+    uint32_t min_period_ms;           /**< fastest period */
+    uint32_t max_period_ms;           /**< slowest period */
+    float std_low;                    /**< quiet std threshold */
+    float std_high;                   /**< busy std threshold */
+    float slope_high;                 /**< busy slope threshold */
+    uint32_t hold;                    /**< quiet samples before a doubling */
+    uint32_t bus_us_per_sample;       /**< bus time of one sample */
+    uint32_t cpu_ns_per_sample;       /**< cpu time of one sample */
+    uint32_t period_ms;               /**< current period */
+    uint32_t quiet;                   /**< quiet sample count */
+    uint32_t last;                    /**< last sample timestamp in ms */
+    int32_t last_index[2];            /**< last voc and nox index */
+    float mean[2];                    /**< voc and nox index mean */
+    float var[2];                     /**< voc and nox index variance */
+    float std;                        /**< last worst index std */
+    float slope;                      /**< last worst index slope per second */
+    uint64_t elapsed_ms;              /**< observed time */
+    uint32_t samples;                 /**< sample number */
+    uint32_t speedups;                /**< speedup number */
+    uint32_t slowdowns;               /**< slowdown number */
+    uint8_t started;                  /**< first sample flag */
+    uint8_t inited;                   /**< inited flag */
+} sgp41_rate_handle_t;
+
+/**
+ * @brief     initialize the rate handle
+ * @param[in] *handle pointer to an sgp41 rate handle structure
+ * @param[in] min_period_ms fastest period in ms
+ * @param[in] max_period_ms slowest period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 period is invalid
+ *            - 2 handle is NULL
+ * @note      the max period must not be longer than SGP41_RATE_MAX_PERIOD_LIMIT_MS,
+ *            longer steps are outages for the gas index algorithm
+ */
+uint8_t sgp41_rate_init(sgp41_rate_handle_t *handle, uint32_t min_period_ms, uint32_t max_period_ms);
+
+/**
+ * @brief     set the volatility thresholds
+ * @param[in] *handle pointer to an sgp41 rate handle structure
+ * @param[in] std_low index std below which the period may grow
+ * @param[in] std_high index std above which the fastest period is used
+ * @param[in] slope_high index change per second above which the fastest period is used
+ * @param[in] hold quiet samples before the period doubles
+ * @return    status code
+ *            - 0 success
+ *            - 1 threshold is invalid
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      std_low must be below std_high
+ */
+uint8_t sgp41_rate_set_thresholds(sgp41_rate_handle_t *handle, float std_low, float std_high, float slope_high, uint32_t hold);
+
+/**
+ * @brief     set the cost of one sample
+ * @param[in] *handle pointer to an sgp41 rate handle structure
+ * @param[in] bus_us bus time of one sample in us
+ * @param[in] cpu_ns cpu time of one sample in ns
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      only used by the statistics
+ */
+uint8_t sgp41_rate_set_cost(sgp41_rate_handle_t *handle, uint32_t bus_us, uint32_t cpu_ns);
+
+/**
+ * @brief      feed one sample and get the next period
+ * @param[in]  *handle pointer to an sgp41 rate handle structure
+ * @param[in]  timestamp_ms sample time in ms
+ * @param[in]  voc_index voc gas index
+ * @param[in]  nox_index nox gas index
+ * @param[out] *period_ms pointer to a next period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timestamp is not newer than the last sample
+ * @note       a fast index change or a high std drops to the fastest period at once, a quiet
+ *             index doubles the period after hold samples, feed the algorithm with the true
+ *             elapsed time, see sgp41_algorithm_process_with_elapsed
+ */
+uint8_t sgp41_rate_update(sgp41_rate_handle_t *handle, uint32_t timestamp_ms, int32_t voc_index, int32_t nox_index, uint32_t *period_ms);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 rate handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the savings are counted against sampling at the fastest period
+ */
+uint8_t sgp41_rate_get_stats(const sgp41_rate_handle_t *handle, sgp41_rate_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,556 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_registry.c
+ * @brief     driver sgp41 registry source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_registry.h"
+
+/**
+ * @brief     get the hash slot of a serial id
+ * @param[in] *id pointer to a serial id
+ * @return    hash slot
+ * @note      fibonacci hashing of the 48 bit id
+ */
+static uint8_t a_sgp41_registry_hash(const uint16_t id[3])
+{
+    uint64_t key;
+
+    key = ((uint64_t)id[0] << 32) | ((uint64_t)id[1] << 16) | (uint64_t)id[2];              /* 48 bit key */
+
+    return (uint8_t)(((key * 0x9E3779B97F4A7C15ULL) >> 40) & (SGP41_REGISTRY_TABLE_SIZE - 1)); /* top bits */
+}
+
+/**
+ * @brief     find a serial id
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @param[in] *id pointer to a serial id
+ * @return    entry or SGP41_REGISTRY_NONE
+ * @note      linear probing up to the next empty hash slot
+ */
+static uint8_t a_sgp41_registry_find(const sgp41_registry_handle_t *handle, const uint16_t id[3])
+{
+    uint8_t i;
+
+    for (i = a_sgp41_registry_hash(id); handle->table[i] != 0;
+         i = (uint8_t)((i + 1) & (SGP41_REGISTRY_TABLE_SIZE - 1)))                          /* probe */
+    {
+        const sgp41_registry_entry_t *entry = &handle->entry[handle->table[i] - 1];
+
+        if ((entry->id[0] == id[0]) && (entry->id[1] == id[1]) && (entry->id[2] == id[2]))  /* same id */
+        {
+            return (uint8_t)(handle->table[i] - 1);                                         /* return the entry */
+        }
+    }
+
+    return SGP41_REGISTRY_NONE;                                                             /* unknown */
+}
+
+/**
+ * @brief     drop an entry from the hash
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @param[in] e entry
+ * @note      the following entries of the run are shifted back, so no probe stops early
+ */
+static void a_sgp41_registry_unhash(sgp41_registry_handle_t *handle, uint8_t e)
+{
+    uint8_t hole;
+    uint8_t i;
+
+    for (hole = a_sgp41_registry_hash(handle->entry[e].id); handle->table[hole] != e + 1;
+         hole = (uint8_t)((hole + 1) & (SGP41_REGISTRY_TABLE_SIZE - 1)))                    /* find the entry */
+    {
+    }
+    handle->table[hole] = 0;                                                                /* make a hole */
+    for (i = (uint8_t)((hole + 1) & (SGP41_REGISTRY_TABLE_SIZE - 1)); handle->table[i] != 0;
+         i = (uint8_t)((i + 1) & (SGP41_REGISTRY_TABLE_SIZE - 1)))                          /* rest of the run */
+    {
+        uint8_t home = a_sgp41_registry_hash(handle->entry[handle->table[i] - 1].id);
+        uint8_t dist_home = (uint8_t)((i - home) & (SGP41_REGISTRY_TABLE_SIZE - 1));
+        uint8_t dist_hole = (uint8_t)((i - hole) & (SGP41_REGISTRY_TABLE_SIZE - 1));
+
+        if (dist_home >= dist_hole)                                                         /* the hole is on its probe path */
+        {
+            handle->table[hole] = handle->table[i];                                         /* move back */
+            handle->table[i] = 0;                                                           /* new hole */
+            hole = i;                                                                       /* save the hole */
+        }
+    }
+}
+
+/**
+ * @brief     save the checkpoint of an entry
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @param[in] e entry
+ * @return    status code
+ *            - 0 success
+ *            - 1 save failed
+ * @note      a sensor that has learned nothing yet keeps its older checkpoint
+ */
+static uint8_t a_sgp41_registry_save(sgp41_registry_handle_t *handle, uint8_t e)
+{
+    sgp41_registry_entry_t *entry = &handle->entry[e];
+    sgp41_registry_checkpoint_t checkpoint;
+
+    if (handle->save == NULL)                                                               /* no save link */
+    {
+        return 0;                                                                           /* success return 0 */
+    }
+
+    memset(&checkpoint, 0, sizeof(sgp41_registry_checkpoint_t));                            /* clear */
+    memcpy(checkpoint.id, entry->id, sizeof(checkpoint.id));                                /* copy the id */
+    checkpoint.voc_valid = entry->voc.m_mean_variance_estimator_initialized;                /* voc learned */
+    checkpoint.nox_valid = entry->nox.m_mean_variance_estimator_initialized;                /* nox learned */
+    if ((checkpoint.voc_valid == 0) && (checkpoint.nox_valid == 0))                         /* nothing learned */
+    {
+        return 0;                                                                           /* success return 0 */
+    }
+    sgp41_algorithm_get_states(&entry->voc, &checkpoint.voc_state0, &checkpoint.voc_state1); /* voc states */
+    sgp41_algorithm_get_states(&entry->nox, &checkpoint.nox_state0, &checkpoint.nox_state1); /* nox states */
+    if (handle->save(&checkpoint) != 0)                                                     /* save */
+    {
+        handle->save_errors++;                                                              /* save error + 1 */
+
+        return 1;                                                                           /* return error */
+    }
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     take an entry for a new sensor
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @return    entry or SGP41_REGISTRY_NONE
+ * @note      a free entry first, else the detached sensor attached the longest ago
+ */
+static uint8_t a_sgp41_registry_take(sgp41_registry_handle_t *handle)
+{
+    uint8_t oldest = SGP41_REGISTRY_NONE;
+    uint8_t i;
+
+    for (i = 0; i < SGP41_REGISTRY_MAX_SENSORS; i++)                                        /* all entries */
+    {
+        if (handle->entry[i].used == 0)                                                     /* free */
+        {
+            return i;                                                                       /* return the entry */
+        }
+        if ((handle->entry[i].slot == SGP41_REGISTRY_NONE) &&
+            ((oldest == SGP41_REGISTRY_NONE) || (handle->entry[i].stamp < handle->entry[oldest].stamp)))  /* older */
+        {
+            oldest = i;                                                                     /* save the entry */
+        }
+    }
+    if (oldest != SGP41_REGISTRY_NONE)                                                      /* evict */
+    {
+        a_sgp41_registry_unhash(handle, oldest);                                            /* drop from the hash */
+        handle->entry[oldest].used = 0;                                                     /* free */
+        handle->evictions++;                                                                /* eviction + 1 */
+    }
+
+    return oldest;                                                                          /* return the entry */
+}
+
+/**
+ * @brief     initialize the registry
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the registry starts empty, new sensors get the default voc and nox states
+ */
+uint8_t sgp41_registry_init(sgp41_registry_handle_t *handle)
+{
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+
+    sgp41_algorithm_init(&handle->voc_template, SGP41_ALGORITHM_TYPE_VOC);                  /* default voc */
+    sgp41_algorithm_init(&handle->nox_template, SGP41_ALGORITHM_TYPE_NOX);                  /* default nox */
+    memset(handle->entry, 0, sizeof(handle->entry));                                        /* no sensor */
+    memset(handle->table, 0, sizeof(handle->table));                                        /* empty hash */
+    memset(handle->slot, SGP41_REGISTRY_NONE, sizeof(handle->slot));                        /* empty slots */
+    handle->stamp = 0;                                                                      /* init 0 */
+    handle->fresh = 0;                                                                      /* init 0 */
+    handle->memory_hits = 0;                                                                /* init 0 */
+    handle->restores = 0;                                                                   /* init 0 */
+    handle->evictions = 0;                                                                  /* init 0 */
+    handle->save_errors = 0;                                                                /* init 0 */
+    handle->inited = 1;                                                                     /* flag finish initialization */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     close the registry
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 checkpoint save failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      every known sensor is saved first
+ */
+uint8_t sgp41_registry_deinit(sgp41_registry_handle_t *handle)
+{
+    uint8_t res;
+
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    res = sgp41_registry_checkpoint(handle);                                                /* save the attached sensors */
+    handle->inited = 0;                                                                     /* flag close */
+
+    return res;                                                                             /* return the result */
+}
+
+/**
+ * @brief     set the states of a new sensor
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @param[in] *voc pointer to an initialized voc algorithm
+ * @param[in] *nox pointer to an initialized nox algorithm
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      for another sampling interval or tuning, sensors already known keep their states
+ */
+uint8_t sgp41_registry_set_template(sgp41_registry_handle_t *handle, const sgp41_gas_index_algorithm_t *voc,
+                                    const sgp41_gas_index_algorithm_t *nox)
+{
+    if ((handle == NULL) || (voc == NULL) || (nox == NULL))                                 /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    handle->voc_template = *voc;                                                            /* copy voc */
+    handle->nox_template = *nox;                                                            /* copy nox */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      bind the sensor with a serial id to a slot
+ * @param[in]  *handle pointer to an sgp41 registry handle structure
+ * @param[in]  slot bus position
+ * @param[in]  *id pointer to the serial id of sgp41_get_serial_id
+ * @param[out] *source pointer to a source buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 every known sensor is attached
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 slot is invalid
+ * @note       call it after a hot plug or a rescan, a sensor that was on the slot is detached and saved,
+ *             a sensor that moved from another slot takes its states along
+ */
+uint8_t sgp41_registry_attach(sgp41_registry_handle_t *handle, uint8_t slot, const uint16_t id[3], uint8_t *source)
+{
+    sgp41_registry_entry_t *entry;
+    sgp41_registry_checkpoint_t checkpoint;
+    uint8_t e;
+    uint8_t h;
+
+    if ((handle == NULL) || (id == NULL) || (source == NULL))                               /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    if (slot >= SGP41_REGISTRY_MAX_SLOTS)                                                   /* check slot */
+    {
+        return 4;                                                                           /* return error */
+    }
+
+    e = a_sgp41_registry_find(handle, id);                                                  /* look the id up */
+    if ((e == SGP41_REGISTRY_NONE) || (handle->slot[slot] != e))                            /* another sensor */
+    {
+        (void)sgp41_registry_detach(handle, slot);                                          /* free the slot */
+    }
+    if (e != SGP41_REGISTRY_NONE)                                                           /* known sensor */
+    {
+        entry = &handle->entry[e];                                                          /* get the entry */
+        if ((entry->slot != SGP41_REGISTRY_NONE) && (entry->slot != slot))                  /* moved */
+        {
+            handle->slot[entry->slot] = SGP41_REGISTRY_NONE;                                /* leave the old slot */
+        }
+        handle->memory_hits++;                                                              /* memory hit + 1 */
+        *source = SGP41_REGISTRY_SOURCE_MEMORY;                                             /* kept states */
+    }
+    else
+    {
+        e = a_sgp41_registry_take(handle);                                                  /* take an entry */
+        if (e == SGP41_REGISTRY_NONE)                                                       /* all attached */
+        {
+            return 1;                                                                       /* return error */
+        }
+        entry = &handle->entry[e];                                                          /* get the entry */
+        memcpy(entry->id, id, sizeof(entry->id));                                           /* copy the id */
+        entry->used = 1;                                                                    /* used */
+        entry->voc = handle->voc_template;                                                  /* default voc */
+        entry->nox = handle->nox_template;                                                  /* default nox */
+        *source = SGP41_REGISTRY_SOURCE_NEW;                                                /* fresh states */
+        if ((handle->load != NULL) && (handle->load(id, &checkpoint) == 0) &&
+            (memcmp(checkpoint.id, id, sizeof(checkpoint.id)) == 0))                        /* saved checkpoint */
+        {
+            if (checkpoint.voc_valid != 0)                                                  /* learned voc */
+            {
+                sgp41_algorithm_set_states(&entry->voc, checkpoint.voc_state0, checkpoint.voc_state1);  /* restore voc */
+            }
+            if (checkpoint.nox_valid != 0)                                                  /* learned nox */
+            {
+                sgp41_algorithm_set_states(&entry->nox, checkpoint.nox_state0, checkpoint.nox_state1);  /* restore nox */
+            }
+            *source = SGP41_REGISTRY_SOURCE_CHECKPOINT;                                     /* restored states */
+        }
+        if (*source == SGP41_REGISTRY_SOURCE_CHECKPOINT)                                    /* count the source */
+        {
+            handle->restores++;                                                             /* restore + 1 */
+        }
+        else
+        {
+            handle->fresh++;                                                                /* fresh + 1 */
+        }
+        for (h = a_sgp41_registry_hash(id); handle->table[h] != 0;
+             h = (uint8_t)((h + 1) & (SGP41_REGISTRY_TABLE_SIZE - 1)))                      /* find an empty hash slot */
+        {
+        }
+        handle->table[h] = (uint8_t)(e + 1);                                                /* add to the hash */
+    }
+    entry->slot = slot;                                                                     /* bind the entry */
+    entry->stamp = ++handle->stamp;                                                         /* set the stamp */
+    handle->slot[slot] = e;                                                                 /* bind the slot */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     unbind a slot
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @param[in] slot bus position
+ * @return    status code
+ *            - 0 success
+ *            - 1 checkpoint save failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 slot is invalid
+ * @note      the sensor is saved and kept in the registry, an empty slot is a success
+ */
+uint8_t sgp41_registry_detach(sgp41_registry_handle_t *handle, uint8_t slot)
+{
+    uint8_t e;
+
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    if (slot >= SGP41_REGISTRY_MAX_SLOTS)                                                   /* check slot */
+    {
+        return 4;                                                                           /* return error */
+    }
+
+    e = handle->slot[slot];                                                                 /* get the entry */
+    if (e == SGP41_REGISTRY_NONE)                                                           /* empty slot */
+    {
+        return 0;                                                                           /* success return 0 */
+    }
+    handle->slot[slot] = SGP41_REGISTRY_NONE;                                               /* free the slot */
+    handle->entry[e].slot = SGP41_REGISTRY_NONE;                                            /* detached */
+
+    return a_sgp41_registry_save(handle, e);                                                /* save */
+}
+
+/**
+ * @brief      get the algorithm states of a slot
+ * @param[in]  *handle pointer to an sgp41 registry handle structure
+ * @param[in]  slot bus position
+ * @param[out] **voc pointer to a voc algorithm pointer buffer
+ * @param[out] **nox pointer to a nox algorithm pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 slot is invalid or empty
+ * @note       the pointers stay valid until the slot is attached again or detached
+ */
+uint8_t sgp41_registry_get(sgp41_registry_handle_t *handle, uint8_t slot,
+                           sgp41_gas_index_algorithm_t **voc, sgp41_gas_index_algorithm_t **nox)
+{
+    if ((handle == NULL) || (voc == NULL) || (nox == NULL))                                 /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+    if ((slot >= SGP41_REGISTRY_MAX_SLOTS) || (handle->slot[slot] == SGP41_REGISTRY_NONE))  /* check slot */
+    {
+        return 4;                                                                           /* return error */
+    }
+
+    *voc = &handle->entry[handle->slot[slot]].voc;                                          /* voc states */
+    *nox = &handle->entry[handle->slot[slot]].nox;                                          /* nox states */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      look a serial id up
+ * @param[in]  *handle pointer to an sgp41 registry handle structure
+ * @param[in]  *id pointer to a serial id
+ * @param[out] *slot pointer to a slot buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sensor is unknown
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a known sensor that is not attached gives SGP41_REGISTRY_NONE
+ */
+uint8_t sgp41_registry_lookup(sgp41_registry_handle_t *handle, const uint16_t id[3], uint8_t *slot)
+{
+    uint8_t e;
+
+    if ((handle == NULL) || (id == NULL) || (slot == NULL))                                 /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    e = a_sgp41_registry_find(handle, id);                                                  /* look the id up */
+    if (e == SGP41_REGISTRY_NONE)                                                           /* unknown */
+    {
+        return 1;                                                                           /* return error */
+    }
+    *slot = handle->entry[e].slot;                                                          /* get the slot */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     save every attached sensor
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 checkpoint save failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it now and then, nothing to do without a save link
+ */
+uint8_t sgp41_registry_checkpoint(sgp41_registry_handle_t *handle)
+{
+    uint8_t res = 0;
+    uint8_t i;
+
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    for (i = 0; i < SGP41_REGISTRY_MAX_SLOTS; i++)                                          /* all slots */
+    {
+        if ((handle->slot[i] != SGP41_REGISTRY_NONE) && (a_sgp41_registry_save(handle, handle->slot[i]) != 0))  /* save */
+        {
+            res = 1;                                                                        /* save failed */
+        }
+    }
+
+    return res;                                                                             /* return the result */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 registry handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_registry_get_stats(const sgp41_registry_handle_t *handle, sgp41_registry_stats_t *stats)
+{
+    uint8_t i;
+
+    if ((handle == NULL) || (stats == NULL))                                                /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    memset(stats, 0, sizeof(sgp41_registry_stats_t));                                       /* clear */
+    for (i = 0; i < SGP41_REGISTRY_MAX_SENSORS; i++)                                        /* all entries */
+    {
+        if (handle->entry[i].used != 0)                                                     /* known */
+        {
+            stats->sensors++;                                                               /* sensor + 1 */
+            if (handle->entry[i].slot != SGP41_REGISTRY_NONE)                               /* attached */
+            {
+                stats->attached++;                                                          /* attached + 1 */
+            }
+        }
+    }
+    stats->fresh = handle->fresh;                                                           /* fresh */
+    stats->memory_hits = handle->memory_hits;                                               /* memory hits */
+    stats->restores = handle->restores;                                                     /* restores */
+    stats->evictions = handle->evictions;                                                   /* evictions */
+    stats->save_errors = handle->save_errors;                                               /* save errors */
+
+    return 0;                                                                               /* success return 0 */
+}
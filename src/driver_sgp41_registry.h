@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_registry.h
+ * @brief     driver sgp41 registry header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_REGISTRY_H
+#define DRIVER_SGP41_REGISTRY_H
+
+#include "driver_sgp41_algorithm.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_registry sgp41 registry function
+ * @brief    sgp41 serial id keyed algorithm state modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 registry param definition
+ */
+#define SGP41_REGISTRY_MAX_SENSORS        16          /**< known sensors, attached or kept for a return */
+#define SGP41_REGISTRY_MAX_SLOTS          8           /**< bus positions */
+#define SGP41_REGISTRY_TABLE_SIZE         32          /**< hash slots, a power of 2 of at least twice the sensors */
+#define SGP41_REGISTRY_NONE               0xFF        /**< no slot or no sensor */
+
+/**
+ * @brief sgp41 registry source enumeration definition
+ */
+typedef enum
+{
+    SGP41_REGISTRY_SOURCE_NEW        = 0x00,        /**< unknown sensor, fresh algorithm states */
+    SGP41_REGISTRY_SOURCE_MEMORY     = 0x01,        /**< known sensor, its states were kept in the registry */
+    SGP41_REGISTRY_SOURCE_CHECKPOINT = 0x02,        /**< states restored from a saved checkpoint */
+} sgp41_registry_source_t;
+
+/**
+ * @brief sgp41 registry checkpoint structure definition
+ */
+typedef struct sgp41_registry_checkpoint_s
+{
+    uint16_t id[3];              /**< serial id */
+    uint8_t voc_valid;           /**< voc states are learned */
+    uint8_t nox_valid;           /**< nox states are learned */
+    float voc_state0;            /**< voc state0 */
+    float voc_state1;            /**< voc state1 */
+    float nox_state0;            /**< nox state0 */
+    float nox_state1;            /**< nox state1 */
+} sgp41_registry_checkpoint_t;
+
+/**
+ * @brief sgp41 registry entry structure definition
+ */
+typedef struct sgp41_registry_entry_s
+{
+    uint16_t id[3];                          /**< serial id */
+    uint8_t used;                            /**< used flag */
+    uint8_t slot;                            /**< attached slot or SGP41_REGISTRY_NONE */
+    uint32_t stamp;                          /**< last attach, the oldest detached entry is evicted first */
+    sgp41_gas_index_algorithm_t voc;         /**< voc algorithm */
+    sgp41_gas_index_algorithm_t nox;         /**< nox algorithm */
+} sgp41_registry_entry_t;
+
+/**
+ * @brief sgp41 registry statistics structure definition
+ */
+typedef struct sgp41_registry_stats_s
+{
+    uint32_t sensors;            /**< known sensors */
+    uint32_t attached;           /**< attached sensors */
+    uint32_t fresh;              /**< attaches with fresh states */
+    uint32_t memory_hits;        /**< attaches with the kept states */
+    uint32_t restores;           /**< attaches restored from a checkpoint */
+    uint32_t evictions;          /**< sensors dropped for a new one */
+    uint32_t save_errors;        /**< failed checkpoint saves */
+} sgp41_registry_stats_t;
+
+/**
+ * @brief sgp41 registry handle structure definition
+ */
+typedef struct sgp41_registry_handle_s
+{
+    uint8_t (*load)(const uint16_t id[3], sgp41_registry_checkpoint_t *checkpoint);        /**< point to a load function address */
+    uint8_t (*save)(const sgp41_registry_checkpoint_t *checkpoint);                        /**< point to a save function address */
+    sgp41_gas_index_algorithm_t voc_template;                                              /**< voc states of a new sensor */
+    sgp41_gas_index_algorithm_t nox_template;                                              /**< nox states of a new sensor */
+    sgp41_registry_entry_t entry[SGP41_REGISTRY_MAX_SENSORS];                              /**< sensors */
+    uint8_t table[SGP41_REGISTRY_TABLE_SIZE];                                              /**< id hash, entry + 1, 0 is empty */
+    uint8_t slot[SGP41_REGISTRY_MAX_SLOTS];                                                /**< entry of every slot */
+    uint32_t stamp;                                                                        /**< attach counter */
+    uint32_t fresh;                                                                        /**< fresh counter */
+    uint32_t memory_hits;                                                                  /**< memory hit counter */
+    uint32_t restores;                                                                     /**< restore counter */
+    uint32_t evictions;                                                                    /**< eviction counter */
+    uint32_t save_errors;                                                                  /**< save error counter */
+    uint8_t inited;                                                                        /**< inited flag */
+} sgp41_registry_handle_t;
+
+/**
+ * @defgroup sgp41_registry_link sgp41 registry link function
+ * @brief    sgp41 registry link functions
+ * @ingroup  sgp41_registry
+ * @{
+ */
+
+/**
+ * @brief     initialize sgp41_registry_handle_t structure
+ * @param[in] HANDLE pointer to an sgp41 registry handle structure
+ * @param[in] STRUCTURE sgp41_registry_handle_t
+ * @note      none
+ */
+#define DRIVER_SGP41_REGISTRY_LINK_INIT(HANDLE, STRUCTURE)        memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link load function
+ * @param[in] HANDLE pointer to an sgp41 registry handle structure
+ * @param[in] FUC pointer to a load function address
+ * @note      optional, it returns 0 when a checkpoint of the id was found
+ */
+#define DRIVER_SGP41_REGISTRY_LINK_LOAD(HANDLE, FUC)              (HANDLE)->load = FUC
+
+/**
+ * @brief     link save function
+ * @param[in] HANDLE pointer to an sgp41 registry handle structure
+ * @param[in] FUC pointer to a save function address
+ * @note      optional, it replaces the checkpoint of the same id
+ */
+#define DRIVER_SGP41_REGISTRY_LINK_SAVE(HANDLE, FUC)              (HANDLE)->save = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @brief     initialize the registry
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the registry starts empty, new sensors get the default voc and nox states
+ */
+uint8_t sgp41_registry_init(sgp41_registry_handle_t *handle);
+
+/**
+ * @brief     close the registry
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 checkpoint save failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      every known sensor is saved first
+ */
+uint8_t sgp41_registry_deinit(sgp41_registry_handle_t *handle);
+
+/**
+ * @brief     set the states of a new sensor
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @param[in] *voc pointer to an initialized voc algorithm
+ * @param[in] *nox pointer to an initialized nox algorithm
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      for another sampling interval or tuning, sensors already known keep their states
+ */
+uint8_t sgp41_registry_set_template(sgp41_registry_handle_t *handle, const sgp41_gas_index_algorithm_t *voc,
+                                    const sgp41_gas_index_algorithm_t *nox);
+
+/**
+ * @brief      bind the sensor with a serial id to a slot
+ * @param[in]  *handle pointer to an sgp41 registry handle structure
+ * @param[in]  slot bus position
+ * @param[in]  *id pointer to the serial id of sgp41_get_serial_id
+ * @param[out] *source pointer to a source buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 every known sensor is attached
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 slot is invalid
+ * @note       call it after a hot plug or a rescan, a sensor that was on the slot is detached and saved,
+ *             a sensor that moved from another slot takes its states along
+ */
+uint8_t sgp41_registry_attach(sgp41_registry_handle_t *handle, uint8_t slot, const uint16_t id[3], uint8_t *source);
+
+/**
+ * @brief     unbind a slot
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @param[in] slot bus position
+ * @return    status code
+ *            - 0 success
+ *            - 1 checkpoint save failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 slot is invalid
+ * @note      the sensor is saved and kept in the registry, an empty slot is a success
+ */
+uint8_t sgp41_registry_detach(sgp41_registry_handle_t *handle, uint8_t slot);
+
+/**
+ * @brief      get the algorithm states of a slot
+ * @param[in]  *handle pointer to an sgp41 registry handle structure
+ * @param[in]  slot bus position
+ * @param[out] **voc pointer to a voc algorithm pointer buffer
+ * @param[out] **nox pointer to a nox algorithm pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 slot is invalid or empty
+ * @note       the pointers stay valid until the slot is attached again or detached
+ */
+uint8_t sgp41_registry_get(sgp41_registry_handle_t *handle, uint8_t slot,
+                           sgp41_gas_index_algorithm_t **voc, sgp41_gas_index_algorithm_t **nox);
+
+/**
+ * @brief      look a serial id up
+ * @param[in]  *handle pointer to an sgp41 registry handle structure
+ * @param[in]  *id pointer to a serial id
+ * @param[out] *slot pointer to a slot buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sensor is unknown
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a known sensor that is not attached gives SGP41_REGISTRY_NONE
+ */
+uint8_t sgp41_registry_lookup(sgp41_registry_handle_t *handle, const uint16_t id[3], uint8_t *slot);
+
+/**
+ * @brief     save every attached sensor
+ * @param[in] *handle pointer to an sgp41 registry handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 checkpoint save failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it now and then, nothing to do without a save link
+ */
+uint8_t sgp41_registry_checkpoint(sgp41_registry_handle_t *handle);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 registry handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sgp41_registry_get_stats(const sgp41_registry_handle_t *handle, sgp41_registry_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,489 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_rollup.c
+ * @brief     driver sgp41 rollup source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_rollup.h"
+
+/**
+ * @brief     close one level window, merge it upwards and emit it
+ * @param[in] *handle pointer to an sgp41 rollup handle structure
+ * @param[in] level closed level
+ * @note      none
+ */
+static void a_sgp41_rollup_close(sgp41_rollup_handle_t *handle, uint8_t level)
+{
+    uint8_t gas;
+
+    for (gas = 0; gas < (uint8_t)SGP41_ROLLUP_GAS_MAX; gas++)
+    {
+        sgp41_rollup_aggregate_t *aggregate = &handle->aggregate[gas][level];
+
+        if (aggregate->count == 0)                                                                      /* empty window */
+        {
+            continue;                                                                                   /* skip */
+        }
+        if ((level + 1) < (uint8_t)SGP41_ROLLUP_LEVEL_MAX)                                              /* not the top level */
+        {
+            (void)sgp41_rollup_aggregate_merge(&handle->aggregate[gas][level + 1], aggregate);          /* merge upwards */
+        }
+        if (handle->window_callback != NULL)                                                            /* check callback */
+        {
+            handle->window_callback(handle->id, (sgp41_rollup_gas_t)gas,
+                                    (sgp41_rollup_level_t)level, aggregate);                            /* emit the window */
+        }
+    }
+}
+
+/**
+ * @brief     advance all levels to a timestamp
+ * @param[in] *handle pointer to an sgp41 rollup handle structure
+ * @param[in] timestamp current timestamp
+ * @note      levels are closed bottom up so that a closed window is merged
+ *            into the upper window it belongs to before that one closes
+ */
+static void a_sgp41_rollup_advance(sgp41_rollup_handle_t *handle, uint32_t timestamp)
+{
+    uint8_t level;
+    uint8_t gas;
+
+    for (level = 0; level < (uint8_t)SGP41_ROLLUP_LEVEL_MAX; level++)
+    {
+        uint32_t start = handle->aggregate[0][level].start;
+        uint32_t length = handle->aggregate[0][level].length;
+
+        if ((timestamp - start) < length)                                                     /* window is still open */
+        {
+            break;                                                                            /* upper levels are open too */
+        }
+        a_sgp41_rollup_close(handle, level);                                                  /* close the window */
+        for (gas = 0; gas < (uint8_t)SGP41_ROLLUP_GAS_MAX; gas++)
+        {
+            (void)sgp41_rollup_aggregate_clear(&handle->aggregate[gas][level],
+                                               timestamp - (timestamp % length), length);     /* open the next window */
+        }
+    }
+}
+
+/**
+ * @brief     clear an aggregate
+ * @param[in] *aggregate pointer to an aggregate buffer
+ * @param[in] start window start timestamp
+ * @param[in] length window length in seconds
+ * @return    status code
+ *            - 0 success
+ *            - 2 aggregate is NULL
+ * @note      none
+ */
+uint8_t sgp41_rollup_aggregate_clear(sgp41_rollup_aggregate_t *aggregate, uint32_t start, uint32_t length)
+{
+    if (aggregate == NULL)                                         /* check aggregate */
+    {
+        return 2;                                                  /* return error */
+    }
+
+    memset(aggregate, 0, sizeof(sgp41_rollup_aggregate_t));        /* clear the aggregate */
+    aggregate->start = start;                                      /* set start */
+    aggregate->length = length;                                    /* set length */
+    aggregate->min = SGP41_ROLLUP_INDEX_MAX;                       /* set min */
+    aggregate->max = 0;                                            /* set max */
+
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief     add one index to an aggregate
+ * @param[in] *aggregate pointer to an aggregate buffer
+ * @param[in] gas_index gas index
+ * @return    status code
+ *            - 0 success
+ *            - 2 aggregate is NULL
+ * @note      the index is clamped to 0 - 500
+ */
+uint8_t sgp41_rollup_aggregate_add(sgp41_rollup_aggregate_t *aggregate, int32_t gas_index)
+{
+    uint32_t bin;
+
+    if (aggregate == NULL)                                                 /* check aggregate */
+    {
+        return 2;                                                          /* return error */
+    }
+
+    if (gas_index < 0)                                                     /* check min */
+    {
+        gas_index = 0;                                                     /* clamp */
+    }
+    if (gas_index > SGP41_ROLLUP_INDEX_MAX)                                /* check max */
+    {
+        gas_index = SGP41_ROLLUP_INDEX_MAX;                                /* clamp */
+    }
+    bin = (uint32_t)gas_index / SGP41_ROLLUP_SKETCH_WIDTH;                 /* get the bin */
+    if (bin >= SGP41_ROLLUP_SKETCH_BINS)                                   /* the max index */
+    {
+        bin = SGP41_ROLLUP_SKETCH_BINS - 1;                                /* fold into the last bin */
+    }
+    aggregate->sketch[bin]++;                                              /* count the bin */
+    aggregate->count++;                                                    /* count the sample */
+    aggregate->sum += (uint64_t)gas_index;                                 /* add the sum */
+    if (gas_index < aggregate->min)                                        /* check min */
+    {
+        aggregate->min = gas_index;                                        /* set min */
+    }
+    if (gas_index > aggregate->max)                                        /* check max */
+    {
+        aggregate->max = gas_index;                                        /* set max */
+    }
+
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     merge an aggregate into another one
+ * @param[in] *dst pointer to a destination aggregate buffer
+ * @param[in] *src pointer to a source aggregate buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 dst or src is NULL
+ * @note      used for zone views over many sensors, the window of dst is kept
+ */
+uint8_t sgp41_rollup_aggregate_merge(sgp41_rollup_aggregate_t *dst, const sgp41_rollup_aggregate_t *src)
+{
+    uint32_t i;
+
+    if ((dst == NULL) || (src == NULL))               /* check aggregate */
+    {
+        return 2;                                     /* return error */
+    }
+    if (src->count == 0)                              /* empty source */
+    {
+        return 0;                                     /* success return 0 */
+    }
+
+    for (i = 0; i < SGP41_ROLLUP_SKETCH_BINS; i++)
+    {
+        dst->sketch[i] += src->sketch[i];             /* merge the sketch */
+    }
+    dst->count += src->count;                         /* merge the count */
+    dst->sum += src->sum;                             /* merge the sum */
+    if (src->min < dst->min)                          /* check min */
+    {
+        dst->min = src->min;                          /* set min */
+    }
+    if (src->max > dst->max)                          /* check max */
+    {
+        dst->max = src->max;                          /* set max */
+    }
+
+    return 0;                                         /* success return 0 */
+}
+
+/**
+ * @brief      get the mean of an aggregate
+ * @param[in]  *aggregate pointer to an aggregate buffer
+ * @param[out] *mean pointer to a mean buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 aggregate is empty
+ *             - 2 aggregate is NULL
+ * @note       none
+ */
+uint8_t sgp41_rollup_aggregate_mean(const sgp41_rollup_aggregate_t *aggregate, float *mean)
+{
+    if (aggregate == NULL)                                                  /* check aggregate */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (aggregate->count == 0)                                              /* check count */
+    {
+        return 1;                                                           /* return error */
+    }
+
+    *mean = (float)((double)aggregate->sum / (double)aggregate->count);     /* get the mean */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get a quantile of an aggregate
+ * @param[in]  *aggregate pointer to an aggregate buffer
+ * @param[in]  q quantile in 0.0 - 1.0
+ * @param[out] *value pointer to a quantile buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 aggregate is empty
+ *             - 2 aggregate is NULL
+ *             - 4 q is invalid
+ * @note       linear interpolation inside one sketch bin, the error is
+ *             below SGP41_ROLLUP_SKETCH_WIDTH and the result is clamped to min - max
+ */
+uint8_t sgp41_rollup_aggregate_quantile(const sgp41_rollup_aggregate_t *aggregate, float q, float *value)
+{
+    uint32_t i;
+    float rank;
+    float cum;
+    float v;
+
+    if (aggregate == NULL)                                                          /* check aggregate */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (aggregate->count == 0)                                                      /* check count */
+    {
+        return 1;                                                                   /* return error */
+    }
+    if ((q < 0.0f) || (q > 1.0f))                                                   /* check q */
+    {
+        return 4;                                                                   /* return error */
+    }
+
+    rank = q * (float)aggregate->count;                                             /* get the rank */
+    cum = 0.0f;                                                                     /* init 0 */
+    v = (float)aggregate->max;                                                      /* default to max */
+    for (i = 0; i < SGP41_ROLLUP_SKETCH_BINS; i++)
+    {
+        float n = (float)aggregate->sketch[i];
+
+        if ((n > 0.0f) && ((cum + n) >= rank))                                      /* rank is in this bin */
+        {
+            v = ((float)i + ((rank - cum) / n)) * (float)SGP41_ROLLUP_SKETCH_WIDTH; /* interpolate */
+
+            break;                                                                  /* break */
+        }
+        cum += n;                                                                   /* accumulate */
+    }
+    if (v < (float)aggregate->min)                                                  /* check min */
+    {
+        v = (float)aggregate->min;                                                  /* clamp */
+    }
+    if (v > (float)aggregate->max)                                                  /* check max */
+    {
+        v = (float)aggregate->max;                                                  /* clamp */
+    }
+    *value = v;                                                                     /* set the value */
+
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     initialize the rollup handle
+ * @param[in] *handle pointer to an sgp41 rollup handle structure
+ * @param[in] id sensor id passed to the callback
+ * @param[in] minute_s minute level window length in seconds
+ * @param[in] hour_s hour level window length in seconds
+ * @param[in] day_s day level window length in seconds
+ * @param[in] *window_callback pointer to a window callback function, it can be NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 window length is invalid
+ *            - 2 handle is NULL
+ * @note      every level window must be a multiple of the level below,
+ *            the classic setting is 60, 3600 and 86400
+ */
+uint8_t sgp41_rollup_init(sgp41_rollup_handle_t *handle, uint32_t id,
+                          uint32_t minute_s, uint32_t hour_s, uint32_t day_s,
+                          void (*window_callback)(uint32_t id, sgp41_rollup_gas_t gas,
+                                                  sgp41_rollup_level_t level,
+                                                  const sgp41_rollup_aggregate_t *aggregate))
+{
+    uint32_t length[SGP41_ROLLUP_LEVEL_MAX];
+    uint8_t level;
+    uint8_t gas;
+
+    if (handle == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if ((minute_s == 0) || (hour_s < minute_s) || (day_s < hour_s))                  /* check length */
+    {
+        return 1;                                                                    /* return error */
+    }
+    if (((hour_s % minute_s) != 0) || ((day_s % hour_s) != 0))                       /* check multiple */
+    {
+        return 1;                                                                    /* return error */
+    }
+
+    memset(handle, 0, sizeof(sgp41_rollup_handle_t));                                /* clear the handle */
+    length[0] = minute_s;                                                            /* set minute */
+    length[1] = hour_s;                                                              /* set hour */
+    length[2] = day_s;                                                               /* set day */
+    for (gas = 0; gas < (uint8_t)SGP41_ROLLUP_GAS_MAX; gas++)
+    {
+        for (level = 0; level < (uint8_t)SGP41_ROLLUP_LEVEL_MAX; level++)
+        {
+            (void)sgp41_rollup_aggregate_clear(&handle->aggregate[gas][level],
+                                               0, length[level]);                    /* clear the aggregate */
+        }
+    }
+    handle->window_callback = window_callback;                                       /* set the callback */
+    handle->id = id;                                                                 /* set the id */
+    handle->inited = 1;                                                              /* flag finish initialization */
+
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     update the rollup with one sample
+ * @param[in] *handle pointer to an sgp41 rollup handle structure
+ * @param[in] timestamp sample timestamp in seconds
+ * @param[in] voc_gas_index voc gas index
+ * @param[in] nox_gas_index nox gas index
+ * @return    status code
+ *            - 0 success
+ *            - 1 timestamp is older than the last sample
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      only the minute level is touched per sample, upper levels are
+ *            merged when the level below closes a window
+ */
+uint8_t sgp41_rollup_update(sgp41_rollup_handle_t *handle, uint32_t timestamp,
+                            int32_t voc_gas_index, int32_t nox_gas_index)
+{
+    uint8_t level;
+    uint8_t gas;
+
+    if (handle == NULL)                                                                                       /* check handle */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                                  /* check handle initialization */
+    {
+        return 3;                                                                                             /* return error */
+    }
+
+    if (handle->started == 0)                                                                                 /* first sample */
+    {
+        for (gas = 0; gas < (uint8_t)SGP41_ROLLUP_GAS_MAX; gas++)
+        {
+            for (level = 0; level < (uint8_t)SGP41_ROLLUP_LEVEL_MAX; level++)
+            {
+                uint32_t length = handle->aggregate[gas][level].length;
+
+                (void)sgp41_rollup_aggregate_clear(&handle->aggregate[gas][level],
+                                                   timestamp - (timestamp % length), length);                 /* align the window */
+            }
+        }
+        handle->started = 1;                                                                                  /* set started */
+    }
+    else
+    {
+        if (timestamp < handle->last)                                                                         /* check timestamp */
+        {
+            return 1;                                                                                         /* return error */
+        }
+        a_sgp41_rollup_advance(handle, timestamp);                                                            /* close finished windows */
+    }
+    handle->last = timestamp;                                                                                 /* save the timestamp */
+    (void)sgp41_rollup_aggregate_add(&handle->aggregate[SGP41_ROLLUP_GAS_VOC][0], voc_gas_index);             /* add voc */
+    (void)sgp41_rollup_aggregate_add(&handle->aggregate[SGP41_ROLLUP_GAS_NOX][0], nox_gas_index);             /* add nox */
+
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     close and emit all open windows
+ * @param[in] *handle pointer to an sgp41 rollup handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      partial windows are emitted with the samples they hold
+ */
+uint8_t sgp41_rollup_flush(sgp41_rollup_handle_t *handle)
+{
+    uint8_t level;
+    uint8_t gas;
+
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    for (level = 0; level < (uint8_t)SGP41_ROLLUP_LEVEL_MAX; level++)
+    {
+        a_sgp41_rollup_close(handle, level);                                                /* close the window */
+        for (gas = 0; gas < (uint8_t)SGP41_ROLLUP_GAS_MAX; gas++)
+        {
+            (void)sgp41_rollup_aggregate_clear(&handle->aggregate[gas][level], 0,
+                                               handle->aggregate[gas][level].length);       /* clear the window */
+        }
+    }
+    handle->started = 0;                                                                    /* realign on the next sample */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the running aggregate of one level
+ * @param[in]  *handle pointer to an sgp41 rollup handle structure
+ * @param[in]  gas rollup gas
+ * @param[in]  level rollup level
+ * @param[out] *aggregate pointer to an aggregate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 gas or level is invalid
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       upper levels include the closed windows below plus the open window below
+ */
+uint8_t sgp41_rollup_get_aggregate(sgp41_rollup_handle_t *handle, sgp41_rollup_gas_t gas,
+                                   sgp41_rollup_level_t level, sgp41_rollup_aggregate_t *aggregate)
+{
+    uint8_t i;
+
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if ((gas >= SGP41_ROLLUP_GAS_MAX) || (level >= SGP41_ROLLUP_LEVEL_MAX))           /* check param */
+    {
+        return 1;                                                                     /* return error */
+    }
+
+    memcpy(aggregate, &handle->aggregate[gas][level],
+           sizeof(sgp41_rollup_aggregate_t));                                         /* copy the level */
+    for (i = 0; i < (uint8_t)level; i++)
+    {
+        (void)sgp41_rollup_aggregate_merge(aggregate, &handle->aggregate[gas][i]);    /* add the open windows below */
+    }
+
+    return 0;                                                                         /* success return 0 */
+}
@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_rollup.h
+ * @brief     driver sgp41 rollup header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_ROLLUP_H
+#define DRIVER_SGP41_ROLLUP_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_rollup sgp41 rollup function
+ * @brief    sgp41 rollup modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 rollup param definition
+ */
+#define SGP41_ROLLUP_INDEX_MAX          500        /**< max gas index */
+#define SGP41_ROLLUP_SKETCH_WIDTH       10         /**< sketch bin width in index points */
+#define SGP41_ROLLUP_SKETCH_BINS        50         /**< sketch bin number */
+
+/**
+ * @brief sgp41 rollup gas enumeration definition
+ */
+typedef enum
+{
+    SGP41_ROLLUP_GAS_VOC = 0x00,        /**< voc index */
+    SGP41_ROLLUP_GAS_NOX = 0x01,        /**< nox index */
+    SGP41_ROLLUP_GAS_MAX = 0x02,        /**< gas number */
+} sgp41_rollup_gas_t;
+
+/**
+ * @brief sgp41 rollup level enumeration definition
+ */
+typedef enum
+{
+    SGP41_ROLLUP_LEVEL_MINUTE = 0x00,        /**< minute level */
+    SGP41_ROLLUP_LEVEL_HOUR   = 0x01,        /**< hour level */
+    SGP41_ROLLUP_LEVEL_DAY    = 0x02,        /**< day level */
+    SGP41_ROLLUP_LEVEL_MAX    = 0x03,        /**< level number */
+} sgp41_rollup_level_t;
+
+/**
+ * @brief sgp41 rollup aggregate structure definition
+ */
+typedef struct sgp41_rollup_aggregate_s
+{
+    uint32_t start;                                /**< window start timestamp in seconds */
+    uint32_t length;                               /**< window length in seconds */
+    uint32_t count;                                /**< sample count */
+    int32_t min;                                   /**< min index */
+    int32_t max;                                   /**< max index */
+    uint64_t sum;                                  /**< index sum */
+    uint32_t sketch[SGP41_ROLLUP_SKETCH_BINS];     /**< quantile sketch bins */
+} sgp41_rollup_aggregate_t;
+
+/**
+ * @brief sgp41 rollup handle structure definition
+ */
+typedef struct sgp41_rollup_handle_s
+{
+    void (*window_callback)(uint32_t id, sgp41_rollup_gas_t gas,
+                            sgp41_rollup_level_t level,
+                            const sgp41_rollup_aggregate_t *aggregate);                   /**< point to a window_callback function address */
+    uint32_t id;                                                                          /**< sensor id passed to the callback */
+    uint32_t last;                                                                        /**< last sample timestamp */
+    uint8_t started;                                                                      /**< windows started flag */
+    sgp41_rollup_aggregate_t aggregate[SGP41_ROLLUP_GAS_MAX][SGP41_ROLLUP_LEVEL_MAX];     /**< running aggregates */
+    uint8_t inited;                                                                       /**< inited flag */
+} sgp41_rollup_handle_t;
+
+/**
+ * @brief     initialize the rollup handle
+ * @param[in] *handle pointer to an sgp41 rollup handle structure
+ * @param[in] id sensor id passed to the callback
+ * @param[in] minute_s minute level window length in seconds
+ * @param[in] hour_s hour level window length in seconds
+ * @param[in] day_s day level window length in seconds
+ * @param[in] *window_callback pointer to a window callback function, it can be NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 window length is invalid
+ *            - 2 handle is NULL
+ * @note      every level window must be a multiple of the level below,
+ *            the classic setting is 60, 3600 and 86400
+ */
+uint8_t sgp41_rollup_init(sgp41_rollup_handle_t *handle, uint32_t id,
+                          uint32_t minute_s, uint32_t hour_s, uint32_t day_s,
+                          void (*window_callback)(uint32_t id, sgp41_rollup_gas_t gas,
+                                                  sgp41_rollup_level_t level,
+                                                  const sgp41_rollup_aggregate_t *aggregate));
+
+/**
+ * @brief     update the rollup with one sample
+ * @param[in] *handle pointer to an sgp41 rollup handle structure
+ * @param[in] timestamp sample timestamp in seconds
+ * @param[in] voc_gas_index voc gas index
+ * @param[in] nox_gas_index nox gas index
+ * @return    status code
+ *            - 0 success
+ *            - 1 timestamp is older than the last sample
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      only the minute level is touched per sample, upper levels are
+ *            merged when the level below closes a window
+ */
+uint8_t sgp41_rollup_update(sgp41_rollup_handle_t *handle, uint32_t timestamp,
+                            int32_t voc_gas_index, int32_t nox_gas_index);
+
+/**
+ * @brief     close and emit all open windows
+ * @param[in] *handle pointer to an sgp41 rollup handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      partial windows are emitted with the samples they hold
+ */
+uint8_t sgp41_rollup_flush(sgp41_rollup_handle_t *handle);
+
+/**
+ * @brief      get the running aggregate of one level
+ * @param[in]  *handle pointer to an sgp41 rollup handle structure
+ * @param[in]  gas rollup gas
+ * @param[in]  level rollup level
+ * @param[out] *aggregate pointer to an aggregate buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 gas or level is invalid
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       upper levels include the closed windows below plus the open window below
+ */
+uint8_t sgp41_rollup_get_aggregate(sgp41_rollup_handle_t *handle, sgp41_rollup_gas_t gas,
+                                   sgp41_rollup_level_t level, sgp41_rollup_aggregate_t *aggregate);
+
+/**
+ * @brief     clear an aggregate
+ * @param[in] *aggregate pointer to an aggregate buffer
+ * @param[in] start window start timestamp
+ * @param[in] length window length in seconds
+ * @return    status code
+ *            - 0 success
+ *            - 2 aggregate is NULL
+ * @note      none
+ */
+uint8_t sgp41_rollup_aggregate_clear(sgp41_rollup_aggregate_t *aggregate, uint32_t start, uint32_t length);
+
+/**
+ * @brief     add one index to an aggregate
+ * @param[in] *aggregate pointer to an aggregate buffer
+ * @param[in] gas_index gas index
+ * @return    status code
+ *            - 0 success
+ *            - 2 aggregate is NULL
+ * @note      the index is clamped to 0 - 500
+ */
+uint8_t sgp41_rollup_aggregate_add(sgp41_rollup_aggregate_t *aggregate, int32_t gas_index);
+
+/**
+ * @brief     merge an aggregate into another one
+ * @param[in] *dst pointer to a destination aggregate buffer
+ * @param[in] *src pointer to a source aggregate buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 dst or src is NULL
+ * @note      used for zone views over many sensors, the window of dst is kept
+ */
+uint8_t sgp41_rollup_aggregate_merge(sgp41_rollup_aggregate_t *dst, const sgp41_rollup_aggregate_t *src);
+
+/**
+ * @brief      get the mean of an aggregate
+ * @param[in]  *aggregate pointer to an aggregate buffer
+ * @param[out] *mean pointer to a mean buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 aggregate is empty
+ *             - 2 aggregate is NULL
+ * @note       none
+ */
+uint8_t sgp41_rollup_aggregate_mean(const sgp41_rollup_aggregate_t *aggregate, float *mean);
+
+/**
+ * @brief      get a quantile of an aggregate
+ * @param[in]  *aggregate pointer to an aggregate buffer
+ * @param[in]  q quantile in 0.0 - 1.0
+ * @param[out] *value pointer to a quantile buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 aggregate is empty
+ *             - 2 aggregate is NULL
+ *             - 4 q is invalid
+ * @note       linear interpolation inside one sketch bin, the error is
+ *             below SGP41_ROLLUP_SKETCH_WIDTH and the result is clamped to min - max
+ */
+uint8_t sgp41_rollup_aggregate_quantile(const sgp41_rollup_aggregate_t *aggregate, float q, float *value);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
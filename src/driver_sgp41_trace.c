@@ -0,0 +1,667 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_trace.c
+ * @brief     driver sgp41 trace source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_trace.h"
+
+/**
+ * @brief trace file header definition
+ */
+static const uint8_t gs_header[SGP41_TRACE_HEADER_SIZE] = {'S', 'G', 'T', 0x01};        /**< magic and version */
+
+static sgp41_trace_handle_t *gs_trace = NULL;        /**< trace of the sgp41_trace functions */
+
+/**
+ * @brief     append one byte to the record buffer
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @param[in] byte appended byte
+ * @note      a full buffer goes to the file first, a failed file write drops it
+ */
+static void a_sgp41_trace_put(sgp41_trace_handle_t *handle, uint8_t byte)
+{
+    if (handle->buf_len >= SGP41_TRACE_BUFFER_SIZE)                              /* buffer full */
+    {
+        if (handle->write_file(handle->buf, handle->buf_len) != 0)               /* write the file */
+        {
+            handle->file_errors++;                                               /* add file error */
+        }
+        handle->buf_len = 0;                                                     /* empty the buffer */
+    }
+    handle->buf[handle->buf_len] = byte;                                         /* append */
+    handle->buf_len++;                                                           /* buffered + 1 */
+    handle->bytes++;                                                             /* byte + 1 */
+}
+
+/**
+ * @brief     append a varint to the record buffer
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @param[in] value appended value
+ * @note      7 bits per byte, low bits first
+ */
+static void a_sgp41_trace_put_varint(sgp41_trace_handle_t *handle, uint64_t value)
+{
+    while (value >= 0x80)                                                        /* more bytes follow */
+    {
+        a_sgp41_trace_put(handle, (uint8_t)(value | 0x80));                      /* low 7 bits */
+        value >>= 7;                                                             /* next 7 bits */
+    }
+    a_sgp41_trace_put(handle, (uint8_t)value);                                   /* last byte */
+}
+
+/**
+ * @brief     append a record head
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @param[in] type record type
+ * @param[in] failed failed call flag
+ * @param[in] time_us call time
+ * @note      none
+ */
+static void a_sgp41_trace_put_head(sgp41_trace_handle_t *handle, uint8_t type, uint8_t failed, uint64_t time_us)
+{
+    a_sgp41_trace_put(handle, (uint8_t)(type | ((failed != 0) ? 0x80 : 0x00)));  /* tag */
+    a_sgp41_trace_put_varint(handle, time_us - handle->last_us);                 /* time since the last record */
+    handle->last_us = time_us;                                                   /* save the time */
+    handle->records++;                                                           /* record + 1 */
+}
+
+/**
+ * @brief      take one byte of the recording
+ * @param[in]  *handle pointer to an sgp41 trace handle structure
+ * @param[out] *byte pointer to a byte buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of the recording
+ * @note       none
+ */
+static uint8_t a_sgp41_trace_get(sgp41_trace_handle_t *handle, uint8_t *byte)
+{
+    if (handle->pos >= handle->size)                                             /* check the end */
+    {
+        return 1;                                                                /* return error */
+    }
+    *byte = handle->data[handle->pos];                                           /* get the byte */
+    handle->pos++;                                                               /* position + 1 */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      take a varint of the recording
+ * @param[in]  *handle pointer to an sgp41 trace handle structure
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of the recording or the varint is too long
+ * @note       none
+ */
+static uint8_t a_sgp41_trace_get_varint(sgp41_trace_handle_t *handle, uint64_t *value)
+{
+    uint8_t byte;
+    uint8_t shift;
+
+    *value = 0;                                                                  /* init 0 */
+    for (shift = 0; shift < 64; shift += 7)                                      /* at most 10 bytes */
+    {
+        if (a_sgp41_trace_get(handle, &byte) != 0)                               /* get the byte */
+        {
+            return 1;                                                            /* return error */
+        }
+        *value |= (uint64_t)(byte & 0x7F) << shift;                              /* add 7 bits */
+        if ((byte & 0x80) == 0)                                                  /* last byte */
+        {
+            return 0;                                                            /* success return 0 */
+        }
+    }
+
+    return 1;                                                                    /* return error */
+}
+
+/**
+ * @brief      take the next record head if it has the expected type
+ * @param[in]  *handle pointer to an sgp41 trace handle structure
+ * @param[in]  type expected record type
+ * @param[out] *failed pointer to a failed call flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of the recording or another type, nothing is taken
+ * @note       none
+ */
+static uint8_t a_sgp41_trace_get_head(sgp41_trace_handle_t *handle, uint8_t type, uint8_t *failed)
+{
+    uint32_t pos = handle->pos;
+    uint64_t dt;
+    uint8_t tag;
+
+    if ((a_sgp41_trace_get(handle, &tag) != 0) || ((tag & 0x07) != type) ||
+        (a_sgp41_trace_get_varint(handle, &dt) != 0))                            /* get the head */
+    {
+        handle->pos = pos;                                                       /* restore the position */
+
+        return 1;                                                                /* return error */
+    }
+    *failed = (uint8_t)((tag & 0x80) != 0);                                      /* set failed */
+    handle->records++;                                                           /* record + 1 */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     trace a call without data
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @param[in] type record type
+ * @param[in] *call pointer to the forwarded function
+ * @return    status code
+ *            - 0 success
+ *            - 1 call failed or differs from the recording
+ * @note      init and deinit
+ */
+static uint8_t a_sgp41_trace_call(sgp41_trace_handle_t *handle, uint8_t type, uint8_t (*call)(void))
+{
+    uint64_t now;
+    uint8_t failed;
+    uint8_t res;
+
+    if (handle->mode == SGP41_TRACE_MODE_RECORD)                                 /* record */
+    {
+        now = handle->get_time_us();                                             /* call time */
+        res = call();                                                            /* forward */
+        a_sgp41_trace_put_head(handle, type, res, now);                          /* log */
+
+        return res;                                                              /* return the result */
+    }
+    if (a_sgp41_trace_get_head(handle, type, &failed) != 0)                      /* replay */
+    {
+        handle->mismatches++;                                                    /* add mismatch */
+
+        return 1;                                                                /* return error */
+    }
+
+    return failed;                                                               /* return the recorded result */
+}
+
+/**
+ * @brief     start a recording
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the iic functions, delay_ms, get_time_us and write_file must be linked,
+ *            the handle becomes the active one of the sgp41_trace functions
+ */
+uint8_t sgp41_trace_record(sgp41_trace_handle_t *handle)
+{
+    uint8_t i;
+
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if ((handle->iic_init == NULL) || (handle->iic_deinit == NULL) ||
+        (handle->iic_write_cmd == NULL) || (handle->iic_read_cmd == NULL) ||
+        (handle->delay_ms == NULL) || (handle->get_time_us == NULL) ||
+        (handle->write_file == NULL))                                            /* check linked functions */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    handle->mode = SGP41_TRACE_MODE_RECORD;                                      /* set mode */
+    handle->buf_len = 0;                                                         /* empty the buffer */
+    handle->data = NULL;                                                         /* no recording */
+    handle->size = 0;                                                            /* no recording */
+    handle->pos = 0;                                                             /* no recording */
+    handle->records = 0;                                                         /* clear records */
+    handle->bytes = 0;                                                           /* clear bytes */
+    handle->mismatches = 0;                                                      /* clear mismatches */
+    handle->file_errors = 0;                                                     /* clear file errors */
+    handle->last_us = handle->get_time_us();                                     /* time base */
+    for (i = 0; i < SGP41_TRACE_HEADER_SIZE; i++)                                /* file header */
+    {
+        a_sgp41_trace_put(handle, gs_header[i]);                                 /* append */
+    }
+    handle->inited = 1;                                                          /* flag finish initialization */
+    gs_trace = handle;                                                           /* set active */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     start a replay
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @param[in] *data pointer to a recording
+ * @param[in] size recording length
+ * @param[in] mode replay mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or data is NULL
+ *            - 3 delay_ms is NULL in the timed mode
+ *            - 4 recording header is invalid
+ *            - 5 mode is invalid
+ * @note      the recording must stay valid until the replay ends, no iic function is called,
+ *            the handle becomes the active one of the sgp41_trace functions
+ */
+uint8_t sgp41_trace_replay(sgp41_trace_handle_t *handle, const uint8_t *data, uint32_t size, sgp41_trace_mode_t mode)
+{
+    if ((handle == NULL) || (data == NULL))                                      /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if ((mode != SGP41_TRACE_MODE_REPLAY) && (mode != SGP41_TRACE_MODE_REPLAY_TIMED))  /* check mode */
+    {
+        return 5;                                                                /* return error */
+    }
+    if ((mode == SGP41_TRACE_MODE_REPLAY_TIMED) && (handle->delay_ms == NULL))   /* check linked functions */
+    {
+        return 3;                                                                /* return error */
+    }
+    if ((size < SGP41_TRACE_HEADER_SIZE) ||
+        (memcmp(data, gs_header, SGP41_TRACE_HEADER_SIZE) != 0))                 /* check header */
+    {
+        return 4;                                                                /* return error */
+    }
+
+    handle->mode = (uint8_t)mode;                                                /* set mode */
+    handle->buf_len = 0;                                                         /* empty the buffer */
+    handle->data = data;                                                         /* set recording */
+    handle->size = size;                                                         /* set size */
+    handle->pos = SGP41_TRACE_HEADER_SIZE;                                       /* first record */
+    handle->records = 0;                                                         /* clear records */
+    handle->bytes = 0;                                                           /* clear bytes */
+    handle->mismatches = 0;                                                      /* clear mismatches */
+    handle->file_errors = 0;                                                     /* clear file errors */
+    handle->inited = 1;                                                          /* flag finish initialization */
+    gs_trace = handle;                                                           /* set active */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     write the buffered records to the file
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 file write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      nothing to do in the replay modes
+ */
+uint8_t sgp41_trace_flush(sgp41_trace_handle_t *handle)
+{
+    uint8_t res;
+
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    if ((handle->mode != SGP41_TRACE_MODE_RECORD) || (handle->buf_len == 0))     /* nothing buffered */
+    {
+        return 0;                                                                /* success return 0 */
+    }
+    res = handle->write_file(handle->buf, handle->buf_len);                      /* write the file */
+    handle->buf_len = 0;                                                         /* empty the buffer */
+    if (res != 0)                                                                /* check the result */
+    {
+        handle->file_errors++;                                                   /* add file error */
+
+        return 1;                                                                /* return error */
+    }
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     stop a recording or a replay
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 file write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      a recording is flushed first
+ */
+uint8_t sgp41_trace_deinit(sgp41_trace_handle_t *handle)
+{
+    uint8_t res;
+
+    res = sgp41_trace_flush(handle);                                             /* flush */
+    if ((res == 2) || (res == 3))                                                /* check handle */
+    {
+        return res;                                                              /* return error */
+    }
+    handle->inited = 0;                                                          /* flag close */
+    if (gs_trace == handle)                                                      /* active */
+    {
+        gs_trace = NULL;                                                         /* clear active */
+    }
+
+    return res;                                                                  /* return the result */
+}
+
+/**
+ * @brief     make a trace the active one
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      needed only with more than one trace
+ */
+uint8_t sgp41_trace_route(sgp41_trace_handle_t *handle)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    gs_trace = handle;                                                           /* set active */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 trace handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a buffered record is counted before it is flushed
+ */
+uint8_t sgp41_trace_get_stats(const sgp41_trace_handle_t *handle, sgp41_trace_stats_t *stats)
+{
+    if ((handle == NULL) || (stats == NULL))                                     /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+
+    stats->records = handle->records;                                            /* set records */
+    stats->bytes = (handle->mode == SGP41_TRACE_MODE_RECORD) ?
+                   handle->bytes : handle->pos;                                  /* set bytes */
+    stats->mismatches = handle->mismatches;                                      /* set mismatches */
+    stats->file_errors = handle->file_errors;                                    /* set file errors */
+    stats->remaining = handle->size - ((handle->mode == SGP41_TRACE_MODE_RECORD) ?
+                                       0 : handle->pos);                         /* set remaining */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief  traced iic init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed or differs from the recording
+ * @note   link it to the sgp41 handle
+ */
+uint8_t sgp41_trace_iic_init(void)
+{
+    if ((gs_trace == NULL) || (gs_trace->inited != 1))                           /* check active trace */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    return a_sgp41_trace_call(gs_trace, SGP41_TRACE_TYPE_INIT, gs_trace->iic_init);  /* trace */
+}
+
+/**
+ * @brief  traced iic deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed or differs from the recording
+ * @note   link it to the sgp41 handle
+ */
+uint8_t sgp41_trace_iic_deinit(void)
+{
+    if ((gs_trace == NULL) || (gs_trace->inited != 1))                           /* check active trace */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    return a_sgp41_trace_call(gs_trace, SGP41_TRACE_TYPE_DEINIT, gs_trace->iic_deinit);  /* trace */
+}
+
+/**
+ * @brief     traced iic write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed or differs from the recording
+ * @note      link it to the sgp41 handle
+ */
+uint8_t sgp41_trace_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    sgp41_trace_handle_t *handle = gs_trace;
+    uint64_t now;
+    uint64_t value;
+    uint16_t i;
+    uint8_t failed;
+    uint8_t differ;
+    uint8_t byte;
+    uint8_t res;
+
+    if ((handle == NULL) || (handle->inited != 1))                               /* check active trace */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    if (handle->mode == SGP41_TRACE_MODE_RECORD)                                 /* record */
+    {
+        now = handle->get_time_us();                                             /* call time */
+        res = handle->iic_write_cmd(addr, buf, len);                             /* forward */
+        a_sgp41_trace_put_head(handle, SGP41_TRACE_TYPE_WRITE, res, now);        /* log the head */
+        a_sgp41_trace_put(handle, addr);                                         /* log the address */
+        a_sgp41_trace_put_varint(handle, len);                                   /* log the length */
+        for (i = 0; i < len; i++)                                                /* log the data */
+        {
+            a_sgp41_trace_put(handle, buf[i]);                                   /* append */
+        }
+
+        return res;                                                              /* return the result */
+    }
+
+    if (a_sgp41_trace_get_head(handle, SGP41_TRACE_TYPE_WRITE, &failed) != 0)    /* next record */
+    {
+        handle->mismatches++;                                                    /* add mismatch */
+
+        return 1;                                                                /* return error */
+    }
+    if ((a_sgp41_trace_get(handle, &byte) != 0) ||
+        (a_sgp41_trace_get_varint(handle, &value) != 0))                         /* address and length */
+    {
+        handle->mismatches++;                                                    /* add mismatch */
+
+        return 1;                                                                /* return error */
+    }
+    differ = (uint8_t)((byte != addr) || (value != len));                        /* compare the head */
+    for (i = 0; i < value; i++)                                                  /* compare the data */
+    {
+        if (a_sgp41_trace_get(handle, &byte) != 0)                               /* truncated */
+        {
+            differ = 1;                                                          /* differ */
+
+            break;                                                               /* break */
+        }
+        if ((i >= len) || (buf[i] != byte))                                      /* other data */
+        {
+            differ = 1;                                                          /* differ */
+        }
+    }
+    if (differ != 0)                                                             /* check the write */
+    {
+        handle->mismatches++;                                                    /* add mismatch */
+
+        return 1;                                                                /* return error */
+    }
+
+    return failed;                                                               /* return the recorded result */
+}
+
+/**
+ * @brief      traced iic read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed or differs from the recording
+ * @note       link it to the sgp41 handle
+ */
+uint8_t sgp41_trace_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    sgp41_trace_handle_t *handle = gs_trace;
+    uint64_t now;
+    uint64_t value;
+    uint16_t i;
+    uint8_t failed;
+    uint8_t differ;
+    uint8_t byte;
+    uint8_t res;
+
+    if ((handle == NULL) || (handle->inited != 1))                               /* check active trace */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    if (handle->mode == SGP41_TRACE_MODE_RECORD)                                 /* record */
+    {
+        now = handle->get_time_us();                                             /* call time */
+        res = handle->iic_read_cmd(addr, buf, len);                              /* forward */
+        a_sgp41_trace_put_head(handle, SGP41_TRACE_TYPE_READ, res, now);         /* log the head */
+        a_sgp41_trace_put(handle, addr);                                         /* log the address */
+        a_sgp41_trace_put_varint(handle, len);                                   /* log the length */
+        for (i = 0; (res == 0) && (i < len); i++)                                /* log the data */
+        {
+            a_sgp41_trace_put(handle, buf[i]);                                   /* append */
+        }
+
+        return res;                                                              /* return the result */
+    }
+
+    if (a_sgp41_trace_get_head(handle, SGP41_TRACE_TYPE_READ, &failed) != 0)     /* next record */
+    {
+        handle->mismatches++;                                                    /* add mismatch */
+
+        return 1;                                                                /* return error */
+    }
+    if ((a_sgp41_trace_get(handle, &byte) != 0) ||
+        (a_sgp41_trace_get_varint(handle, &value) != 0))                         /* address and length */
+    {
+        handle->mismatches++;                                                    /* add mismatch */
+
+        return 1;                                                                /* return error */
+    }
+    differ = (uint8_t)((byte != addr) || (value != len));                        /* compare the head */
+    if (failed != 0)                                                             /* a failed read has no data */
+    {
+        if (differ != 0)                                                         /* check the read */
+        {
+            handle->mismatches++;                                                /* add mismatch */
+        }
+
+        return 1;                                                                /* return the recorded result */
+    }
+    for (i = 0; i < value; i++)                                                  /* take the data */
+    {
+        if (a_sgp41_trace_get(handle, &byte) != 0)                               /* truncated */
+        {
+            differ = 1;                                                          /* differ */
+
+            break;                                                               /* break */
+        }
+        if (i < len)                                                             /* in the buffer */
+        {
+            buf[i] = byte;                                                       /* copy */
+        }
+    }
+    if (differ != 0)                                                             /* check the read */
+    {
+        handle->mismatches++;                                                    /* add mismatch */
+
+        return 1;                                                                /* return error */
+    }
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     traced delay
+ * @param[in] ms time
+ * @note      link it to the sgp41 handle
+ */
+void sgp41_trace_delay_ms(uint32_t ms)
+{
+    sgp41_trace_handle_t *handle = gs_trace;
+    uint64_t value;
+    uint8_t failed;
+
+    if ((handle == NULL) || (handle->inited != 1))                               /* check active trace */
+    {
+        return;                                                                  /* nothing to trace */
+    }
+
+    if (handle->mode == SGP41_TRACE_MODE_RECORD)                                 /* record */
+    {
+        a_sgp41_trace_put_head(handle, SGP41_TRACE_TYPE_DELAY, 0, handle->get_time_us());   /* log the head */
+        a_sgp41_trace_put_varint(handle, ms);                                    /* log the time */
+        handle->delay_ms(ms);                                                    /* forward */
+
+        return;                                                                  /* return */
+    }
+
+    if ((a_sgp41_trace_get_head(handle, SGP41_TRACE_TYPE_DELAY, &failed) != 0) ||
+        (a_sgp41_trace_get_varint(handle, &value) != 0) || (value != ms))        /* next record */
+    {
+        handle->mismatches++;                                                    /* add mismatch */
+    }
+    if (handle->mode == SGP41_TRACE_MODE_REPLAY_TIMED)                           /* timed replay */
+    {
+        handle->delay_ms(ms);                                                    /* delay */
+    }
+}
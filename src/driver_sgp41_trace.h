@@ -0,0 +1,336 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_trace.h
+ * @brief     driver sgp41 trace header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SGP41_TRACE_H
+#define DRIVER_SGP41_TRACE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sgp41_trace sgp41 trace function
+ * @brief    sgp41 iic transaction recorder and replay modules
+ * @ingroup  sgp41_driver
+ * @{
+ */
+
+/**
+ * @brief sgp41 trace param definition
+ * @note  file:   "SGT" 0x01, then the records
+ *        record: tag, varint us since the last record, body
+ *        tag:    bit 0 to 2 type, bit 7 set when the call failed
+ *        body:   write and read, address, varint length, data, a failed read has no data
+ *                delay, varint ms
+ *                init and deinit, none
+ *        a varint is 7 bits per byte, low bits first, bit 7 set on every byte but the last
+ */
+#define SGP41_TRACE_BUFFER_SIZE        256        /**< record buffer, flushed to the file when full */
+#define SGP41_TRACE_HEADER_SIZE        4          /**< file header length */
+
+/**
+ * @brief sgp41 trace mode enumeration definition
+ */
+typedef enum
+{
+    SGP41_TRACE_MODE_RECORD       = 0x00,        /**< forward every call and log it */
+    SGP41_TRACE_MODE_REPLAY       = 0x01,        /**< answer from a recording, the delays are skipped */
+    SGP41_TRACE_MODE_REPLAY_TIMED = 0x02,        /**< answer from a recording, the delays are kept */
+} sgp41_trace_mode_t;
+
+/**
+ * @brief sgp41 trace record type enumeration definition
+ */
+typedef enum
+{
+    SGP41_TRACE_TYPE_INIT   = 0x01,        /**< iic init */
+    SGP41_TRACE_TYPE_DEINIT = 0x02,        /**< iic deinit */
+    SGP41_TRACE_TYPE_WRITE  = 0x03,        /**< iic write command */
+    SGP41_TRACE_TYPE_READ   = 0x04,        /**< iic read command */
+    SGP41_TRACE_TYPE_DELAY  = 0x05,        /**< delay ms */
+} sgp41_trace_type_t;
+
+/**
+ * @brief sgp41 trace statistics structure definition
+ */
+typedef struct sgp41_trace_stats_s
+{
+    uint32_t records;             /**< records written or replayed */
+    uint32_t bytes;               /**< file bytes written or consumed */
+    uint32_t mismatches;          /**< calls that differ from the recording */
+    uint32_t file_errors;         /**< failed file writes */
+    uint32_t remaining;           /**< recording bytes left to replay */
+} sgp41_trace_stats_t;
+
+/**
+ * @brief sgp41 trace handle structure definition
+ */
+typedef struct sgp41_trace_handle_s
+{
+    uint8_t (*iic_init)(void);                                                 /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void);                                               /**< point to an iic_deinit function address */
+    uint8_t (*iic_write_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);        /**< point to an iic_write_cmd function address */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);         /**< point to an iic_read_cmd function address */
+    void (*delay_ms)(uint32_t ms);                                             /**< point to a delay_ms function address */
+    uint64_t (*get_time_us)(void);                                             /**< point to a get_time_us function address */
+    uint8_t (*write_file)(const uint8_t *buf, uint16_t len);                   /**< point to a write_file function address */
+    uint8_t mode;                                                              /**< trace mode */
+    uint8_t buf[SGP41_TRACE_BUFFER_SIZE];                                      /**< record buffer */
+    uint16_t buf_len;                                                          /**< buffered bytes */
+    uint64_t last_us;                                                          /**< time of the last record */
+    const uint8_t *data;                                                       /**< recording to replay */
+    uint32_t size;                                                             /**< recording length */
+    uint32_t pos;                                                              /**< replay position */
+    uint32_t records;                                                          /**< record counter */
+    uint32_t bytes;                                                            /**< byte counter */
+    uint32_t mismatches;                                                       /**< mismatch counter */
+    uint32_t file_errors;                                                      /**< file error counter */
+    uint8_t inited;                                                            /**< inited flag */
+} sgp41_trace_handle_t;
+
+/**
+ * @defgroup sgp41_trace_link sgp41 trace link function
+ * @brief    sgp41 trace link functions
+ * @ingroup  sgp41_trace
+ * @{
+ */
+
+/**
+ * @brief     initialize sgp41_trace_handle_t structure
+ * @param[in] HANDLE pointer to an sgp41 trace handle structure
+ * @param[in] STRUCTURE sgp41_trace_handle_t
+ * @note      none
+ */
+#define DRIVER_SGP41_TRACE_LINK_INIT(HANDLE, STRUCTURE)           memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link iic_init function
+ * @param[in] HANDLE pointer to an sgp41 trace handle structure
+ * @param[in] FUC pointer to an iic_init function address
+ * @note      none
+ */
+#define DRIVER_SGP41_TRACE_LINK_IIC_INIT(HANDLE, FUC)             (HANDLE)->iic_init = FUC
+
+/**
+ * @brief     link iic_deinit function
+ * @param[in] HANDLE pointer to an sgp41 trace handle structure
+ * @param[in] FUC pointer to an iic_deinit function address
+ * @note      none
+ */
+#define DRIVER_SGP41_TRACE_LINK_IIC_DEINIT(HANDLE, FUC)           (HANDLE)->iic_deinit = FUC
+
+/**
+ * @brief     link iic_write_cmd function
+ * @param[in] HANDLE pointer to an sgp41 trace handle structure
+ * @param[in] FUC pointer to an iic_write_cmd function address
+ * @note      none
+ */
+#define DRIVER_SGP41_TRACE_LINK_IIC_WRITE_COMMAND(HANDLE, FUC)    (HANDLE)->iic_write_cmd = FUC
+
+/**
+ * @brief     link iic_read_cmd function
+ * @param[in] HANDLE pointer to an sgp41 trace handle structure
+ * @param[in] FUC pointer to an iic_read_cmd function address
+ * @note      none
+ */
+#define DRIVER_SGP41_TRACE_LINK_IIC_READ_COMMAND(HANDLE, FUC)     (HANDLE)->iic_read_cmd = FUC
+
+/**
+ * @brief     link delay_ms function
+ * @param[in] HANDLE pointer to an sgp41 trace handle structure
+ * @param[in] FUC pointer to a delay_ms function address
+ * @note      none
+ */
+#define DRIVER_SGP41_TRACE_LINK_DELAY_MS(HANDLE, FUC)             (HANDLE)->delay_ms = FUC
+
+/**
+ * @brief     link get_time_us function
+ * @param[in] HANDLE pointer to an sgp41 trace handle structure
+ * @param[in] FUC pointer to a get_time_us function address
+ * @note      none
+ */
+#define DRIVER_SGP41_TRACE_LINK_GET_TIME_US(HANDLE, FUC)          (HANDLE)->get_time_us = FUC
+
+/**
+ * @brief     link write_file function
+ * @param[in] HANDLE pointer to an sgp41 trace handle structure
+ * @param[in] FUC pointer to a write_file function address
+ * @note      none
+ */
+#define DRIVER_SGP41_TRACE_LINK_WRITE_FILE(HANDLE, FUC)           (HANDLE)->write_file = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @brief     start a recording
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the iic functions, delay_ms, get_time_us and write_file must be linked,
+ *            the handle becomes the active one of the sgp41_trace functions
+ */
+uint8_t sgp41_trace_record(sgp41_trace_handle_t *handle);
+
+/**
+ * @brief     start a replay
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @param[in] *data pointer to a recording
+ * @param[in] size recording length
+ * @param[in] mode replay mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or data is NULL
+ *            - 3 delay_ms is NULL in the timed mode
+ *            - 4 recording header is invalid
+ *            - 5 mode is invalid
+ * @note      the recording must stay valid until the replay ends, no iic function is called,
+ *            the handle becomes the active one of the sgp41_trace functions
+ */
+uint8_t sgp41_trace_replay(sgp41_trace_handle_t *handle, const uint8_t *data, uint32_t size, sgp41_trace_mode_t mode);
+
+/**
+ * @brief     write the buffered records to the file
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 file write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      nothing to do in the replay modes
+ */
+uint8_t sgp41_trace_flush(sgp41_trace_handle_t *handle);
+
+/**
+ * @brief     stop a recording or a replay
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 file write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      a recording is flushed first
+ */
+uint8_t sgp41_trace_deinit(sgp41_trace_handle_t *handle);
+
+/**
+ * @brief     make a trace the active one
+ * @param[in] *handle pointer to an sgp41 trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      needed only with more than one trace
+ */
+uint8_t sgp41_trace_route(sgp41_trace_handle_t *handle);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *handle pointer to an sgp41 trace handle structure
+ * @param[out] *stats pointer to a statistics buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a buffered record is counted before it is flushed
+ */
+uint8_t sgp41_trace_get_stats(const sgp41_trace_handle_t *handle, sgp41_trace_stats_t *stats);
+
+/**
+ * @brief  traced iic init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed or differs from the recording
+ * @note   link it to the sgp41 handle
+ */
+uint8_t sgp41_trace_iic_init(void);
+
+/**
+ * @brief  traced iic deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed or differs from the recording
+ * @note   link it to the sgp41 handle
+ */
+uint8_t sgp41_trace_iic_deinit(void);
+
+/**
+ * @brief     traced iic write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed or differs from the recording
+ * @note      link it to the sgp41 handle
+ */
+uint8_t sgp41_trace_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      traced iic read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed or differs from the recording
+ * @note       link it to the sgp41 handle
+ */
+uint8_t sgp41_trace_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     traced delay
+ * @param[in] ms time
+ * @note      link it to the sgp41 handle
+ */
+void sgp41_trace_delay_ms(uint32_t ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_compress_test.c
+ * @brief     driver sgp41 compress test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_compress_test.h"
+#include "driver_sgp41_compress.h"
+#include "driver_sgp41_algorithm.h"
+#include <stdlib.h>
+
+/**
+ * @brief compress test param definition
+ */
+#define COMPRESS_TEST_SAMPLES        86400                                   /**< one day of 1 s samples */
+#define COMPRESS_TEST_BUFFER_SIZE    (COMPRESS_TEST_SAMPLES * 4)             /**< stream buffer size */
+
+static uint32_t gs_timestamp[COMPRESS_TEST_SAMPLES];        /**< trace timestamps */
+static int32_t gs_sraw[COMPRESS_TEST_SAMPLES];              /**< trace voc sraw */
+static int32_t gs_index[COMPRESS_TEST_SAMPLES];             /**< trace voc index */
+static uint8_t gs_stream[COMPRESS_TEST_BUFFER_SIZE];        /**< stream buffer */
+
+/**
+ * @brief  build a one day trace
+ * @note   voc sraw with a slow drift, sensor noise and a few events, a
+ *         few missed samples and the index computed by the gas index algorithm
+ */
+static void a_compress_trace(void)
+{
+    sgp41_gas_index_algorithm_t algorithm;
+    uint32_t t;
+    uint32_t i;
+
+    srand(0x5347);
+    sgp41_algorithm_init(&algorithm, SGP41_ALGORITHM_TYPE_VOC);
+    t = 1700000000U;
+    for (i = 0; i < COMPRESS_TEST_SAMPLES; i++)
+    {
+        int32_t sraw;
+
+        sraw = 30000 + (int32_t)((i % 43200U) / 80U) - 270;
+        sraw += (int32_t)(rand() % 21) - 10;
+        if ((i % 7200U) < 300U)
+        {
+            sraw -= (int32_t)((i % 7200U) * 10U);
+        }
+        gs_timestamp[i] = t;
+        gs_sraw[i] = sraw;
+        sgp41_algorithm_process(&algorithm, sraw, &gs_index[i]);
+        t += ((rand() % 1000) == 0) ? 2U : 1U;
+    }
+}
+
+/**
+ * @brief     compress one series and check it
+ * @param[in] *name pointer to a series name
+ * @param[in] *value pointer to a series buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_compress_series(const char *name, const int32_t *value)
+{
+    sgp41_compress_encoder_t encoder;
+    sgp41_compress_decoder_t decoder;
+    uint32_t len;
+    uint32_t i;
+    uint32_t ts;
+    int32_t v;
+
+    /* encode */
+    if (sgp41_compress_encoder_init(&encoder, gs_stream, COMPRESS_TEST_BUFFER_SIZE, 0) != 0)
+    {
+        sgp41_interface_debug_print("sgp41: compress encoder init failed.\n");
+
+        return 1;
+    }
+    for (i = 0; i < COMPRESS_TEST_SAMPLES; i++)
+    {
+        if (sgp41_compress_encoder_append(&encoder, gs_timestamp[i], value[i]) != 0)
+        {
+            sgp41_interface_debug_print("sgp41: compress encoder append failed.\n");
+
+            return 1;
+        }
+    }
+    (void)sgp41_compress_encoder_finish(&encoder, &len);
+
+    /* decode and compare */
+    (void)sgp41_compress_decoder_init(&decoder, gs_stream, len);
+    for (i = 0; i < COMPRESS_TEST_SAMPLES; i++)
+    {
+        if ((sgp41_compress_decoder_next(&decoder, &ts, &v) != 0) ||
+            (ts != gs_timestamp[i]) || (v != value[i]))
+        {
+            sgp41_interface_debug_print("sgp41: %s sample %d mismatch.\n", name, i);
+
+            return 1;
+        }
+    }
+    if (sgp41_compress_decoder_next(&decoder, &ts, &v) != 1)
+    {
+        sgp41_interface_debug_print("sgp41: %s stream end error.\n", name);
+
+        return 1;
+    }
+
+    /* random access */
+    for (i = 0; i < 1000; i++)
+    {
+        uint32_t k;
+
+        k = (uint32_t)rand() % COMPRESS_TEST_SAMPLES;
+        if ((sgp41_compress_decoder_seek(&decoder, gs_timestamp[k]) != 0) ||
+            (sgp41_compress_decoder_next(&decoder, &ts, &v) != 0) ||
+            (ts != gs_timestamp[k]) || (v != value[k]))
+        {
+            sgp41_interface_debug_print("sgp41: %s seek %d failed.\n", name, gs_timestamp[k]);
+
+            return 1;
+        }
+    }
+    if (sgp41_compress_decoder_seek(&decoder, gs_timestamp[COMPRESS_TEST_SAMPLES - 1] + 1) != 1)
+    {
+        sgp41_interface_debug_print("sgp41: %s seek past the end error.\n", name);
+
+        return 1;
+    }
+
+    sgp41_interface_debug_print("sgp41: check %s round trip and seek ok.\n", name);
+
+    return 0;
+}
+
+/**
+ * @brief  compress test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_compress_test(void)
+{
+    sgp41_compress_encoder_t encoder;
+    uint8_t small[SGP41_COMPRESS_BLOCK_HEADER_SIZE + 4];
+    uint32_t i;
+    uint8_t res;
+
+    /* start compress test */
+    sgp41_interface_debug_print("sgp41: start compress test.\n");
+
+    /* build the trace */
+    a_compress_trace();
+
+    /* index series */
+    sgp41_interface_debug_print("sgp41: compress voc index test.\n");
+    if (a_compress_series("index", gs_index) != 0)
+    {
+        return 1;
+    }
+
+    /* sraw series */
+    sgp41_interface_debug_print("sgp41: compress voc sraw test.\n");
+    if (a_compress_series("sraw", gs_sraw) != 0)
+    {
+        return 1;
+    }
+
+    /* out of order test */
+    (void)sgp41_compress_encoder_init(&encoder, gs_stream, COMPRESS_TEST_BUFFER_SIZE, 0);
+    (void)sgp41_compress_encoder_append(&encoder, 100, 1);
+    res = sgp41_compress_encoder_append(&encoder, 99, 1);
+    sgp41_interface_debug_print("sgp41: check out of order timestamp %s.\n", res == 4 ? "ok" : "error");
+    if (res != 4)
+    {
+        return 1;
+    }
+
+    /* full buffer test */
+    (void)sgp41_compress_encoder_init(&encoder, small, sizeof(small), 0);
+    res = 0;
+    for (i = 0; (i < 100) && (res == 0); i++)
+    {
+        res = sgp41_compress_encoder_append(&encoder, i, (int32_t)(i * 1000U));
+    }
+    sgp41_interface_debug_print("sgp41: check full buffer %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        return 1;
+    }
+
+    /* finish compress test */
+    sgp41_interface_debug_print("sgp41: finish compress test.\n");
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_log_test.c
+ * @brief     driver sgp41 log test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_log_test.h"
+#include "driver_sgp41_log.h"
+
+/**
+ * @brief log test param definition
+ */
+#define LOG_TEST_OVERFLOW        10        /**< records written past a full ring */
+#define LOG_TEST_TEXT_SIZE       64        /**< decoded text buffer */
+
+static sgp41_log_handle_t gs_log;        /**< log handle */
+
+/**
+ * @brief  log test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_log_test(void)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t last_us;
+    sgp41_log_record_t record;
+    sgp41_log_stats_t stats;
+    char text[LOG_TEST_TEXT_SIZE];
+
+    /* start log test */
+    sgp41_interface_debug_print("sgp41: start log test.\n");
+
+    /* invalid param test */
+    sgp41_interface_debug_print("sgp41: log invalid param test.\n");
+    DRIVER_SGP41_LOG_LINK_INIT(&gs_log, sgp41_log_handle_t);
+    res = sgp41_log_init(&gs_log);
+    sgp41_interface_debug_print("sgp41: check missing links %s.\n", res == 3 ? "ok" : "error");
+    if (res != 3)
+    {
+        return 1;
+    }
+    res = sgp41_log_read(&gs_log, &record);
+    sgp41_interface_debug_print("sgp41: check read before init %s.\n", res == 3 ? "ok" : "error");
+    if (res != 3)
+    {
+        return 1;
+    }
+    record.id = SGP41_LOG_MAX;
+    record.arg = 0;
+    res = sgp41_log_decode(&record, text, LOG_TEST_TEXT_SIZE);
+    sgp41_interface_debug_print("sgp41: check unknown id %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        return 1;
+    }
+
+    /* write and decode test */
+    sgp41_interface_debug_print("sgp41: log decode test.\n");
+    DRIVER_SGP41_LOG_LINK_GET_TIME_US(&gs_log, sgp41_interface_get_time_us);
+    res = sgp41_log_init(&gs_log);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: log init failed.\n");
+
+        return 1;
+    }
+    sgp41_log_write(SGP41_LOG_SRAW_VOC_CRC_ERROR, 0);
+    sgp41_log_write(SGP41_LOG_SERIAL_ID_CRC_ERROR, 2);
+    res = sgp41_log_read(&gs_log, &record);
+    if ((res != 0) || (sgp41_log_decode(&record, text, LOG_TEST_TEXT_SIZE) != 0) ||
+        (strcmp(text, SGP41_LOG_TEXT_SRAW_VOC_CRC_ERROR) != 0))
+    {
+        sgp41_interface_debug_print("sgp41: first record is wrong.\n");
+
+        return 1;
+    }
+    last_us = record.time_us;
+    res = sgp41_log_read(&gs_log, &record);
+    if ((res != 0) || (sgp41_log_decode(&record, text, LOG_TEST_TEXT_SIZE) != 0) ||
+        (strcmp(text, "sgp41: crc 2 check failed.\n") != 0) || ((int32_t)(record.time_us - last_us) < 0))
+    {
+        sgp41_interface_debug_print("sgp41: second record is wrong.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: decoded %s", text);
+    res = sgp41_log_read(&gs_log, &record);
+    sgp41_interface_debug_print("sgp41: check empty ring %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        return 1;
+    }
+
+    /* full ring test */
+    sgp41_interface_debug_print("sgp41: log full ring test.\n");
+    for (i = 0; i < SGP41_LOG_RING_SIZE + LOG_TEST_OVERFLOW; i++)
+    {
+        sgp41_log_write(SGP41_LOG_READ_MEASURE_RAW_FAILED, (uint16_t)i);
+    }
+    (void)sgp41_log_get_stats(&gs_log, &stats);
+    sgp41_interface_debug_print("sgp41: %d records, %d dropped, %d pending.\n", stats.records, stats.dropped, stats.pending);
+    if ((stats.dropped != LOG_TEST_OVERFLOW) || (stats.pending != SGP41_LOG_RING_SIZE))
+    {
+        sgp41_interface_debug_print("sgp41: check full ring error.\n");
+
+        return 1;
+    }
+    for (i = 0; i < SGP41_LOG_RING_SIZE; i++)
+    {
+        if ((sgp41_log_read(&gs_log, &record) != 0) || (record.arg != i))
+        {
+            sgp41_interface_debug_print("sgp41: record %d is wrong.\n", i);
+
+            return 1;
+        }
+    }
+    sgp41_interface_debug_print("sgp41: check record order ok.\n");
+
+    /* deinit test */
+    sgp41_interface_debug_print("sgp41: log deinit test.\n");
+    (void)sgp41_log_get_stats(&gs_log, &stats);
+    res = sgp41_log_deinit(&gs_log);
+    sgp41_log_write(SGP41_LOG_IIC_INIT_FAILED, 0);
+    if ((res != 0) || (gs_log.head != stats.records))
+    {
+        sgp41_interface_debug_print("sgp41: check write after deinit error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check write after deinit ok.\n");
+
+    /* finish log test */
+    sgp41_interface_debug_print("sgp41: finish log test.\n");
+
+    return 0;
+}
@@ -0,0 +1,536 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_mux_test.c
+ * @brief     driver sgp41 mux test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_mux_test.h"
+#include "driver_sgp41_mux.h"
+
+/**
+ * @brief mux test param definition
+ */
+#define MUX_TEST_MUXES           2         /**< muxes on the fake bus */
+#define MUX_TEST_CHANNELS        6         /**< sensors per mux, one per channel */
+#define MUX_TEST_SENSORS         (MUX_TEST_MUXES * MUX_TEST_CHANNELS)
+#define MUX_TEST_LONG_LIST       200       /**< a list repeating one sensor past SGP41_MUX_MAX_SENSORS */
+
+/**
+ * @brief fake sensor structure definition
+ */
+typedef struct mux_test_sensor_s
+{
+    uint16_t id[3];             /**< serial id */
+    uint16_t sraw[2];           /**< voc and nox sraw */
+    uint8_t pending[9];         /**< read data */
+    uint8_t pending_len;        /**< read data length */
+} mux_test_sensor_t;
+
+static sgp41_mux_handle_t gs_mux;                                            /**< mux handle */
+static sgp41_handle_t gs_handle[MUX_TEST_SENSORS];                           /**< sgp41 handles */
+static uint8_t gs_sensor[MUX_TEST_SENSORS];                                  /**< mux sensor index of every handle */
+static mux_test_sensor_t gs_fake[MUX_TEST_MUXES][MUX_TEST_CHANNELS];         /**< fake sensors behind the muxes */
+static uint8_t gs_fake_mask[MUX_TEST_MUXES];                                 /**< fake mux channel masks */
+static uint32_t gs_fake_mux_writes;                                          /**< fake mux writes */
+static uint32_t gs_fake_collisions;                                          /**< transactions with no or two sensors visible */
+static uint8_t gs_fake_fail;                                                 /**< fail the next mux write */
+
+/**
+ * @brief     crc of one word
+ * @param[in] *data pointer to a data buffer
+ * @return    crc
+ * @note      the sgp41 crc8, polynomial 0x31 and init 0xff
+ */
+static uint8_t a_mux_test_crc(const uint8_t *data)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+    uint8_t bit;
+
+    for (i = 0; i < 2; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = ((crc & 0x80) != 0) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief  find the visible sensor
+ * @return pointer to the sensor, NULL on no or two sensors
+ * @note   every sensor answers at 0x59, two enabled channels collide
+ */
+static mux_test_sensor_t *a_mux_test_visible(void)
+{
+    mux_test_sensor_t *sensor = NULL;
+    uint8_t count = 0;
+    uint8_t m;
+    uint8_t c;
+
+    for (m = 0; m < MUX_TEST_MUXES; m++)
+    {
+        for (c = 0; c < MUX_TEST_CHANNELS; c++)
+        {
+            if (((gs_fake_mask[m] >> c) & 0x01) != 0)
+            {
+                sensor = &gs_fake[m][c];
+                count++;
+            }
+        }
+    }
+    if (count != 1)
+    {
+        gs_fake_collisions++;
+
+        return NULL;
+    }
+
+    return sensor;
+}
+
+/**
+ * @brief     put the read data of a sensor
+ * @param[in] *sensor pointer to a fake sensor
+ * @param[in] *words pointer to the words
+ * @param[in] count word number
+ * @note      none
+ */
+static void a_mux_test_put(mux_test_sensor_t *sensor, const uint16_t *words, uint8_t count)
+{
+    uint8_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        sensor->pending[i * 3 + 0] = (uint8_t)(words[i] >> 8);
+        sensor->pending[i * 3 + 1] = (uint8_t)(words[i] & 0xFF);
+        sensor->pending[i * 3 + 2] = a_mux_test_crc(&sensor->pending[i * 3]);
+    }
+    sensor->pending_len = (uint8_t)(count * 3);
+}
+
+/**
+ * @brief  fake bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_mux_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  fake bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_mux_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     fake bus write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 nack
+ * @note      the muxes take one mask byte, the sensors take a command
+ */
+static uint8_t a_mux_test_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    mux_test_sensor_t *sensor;
+    uint16_t command;
+    uint8_t m;
+
+    for (m = 0; m < MUX_TEST_MUXES; m++)
+    {
+        if (addr == SGP41_MUX_ADDRESS(m))
+        {
+            gs_fake_mux_writes++;
+            if ((gs_fake_fail != 0) || (len != 1))
+            {
+                gs_fake_fail = 0;
+
+                return 1;
+            }
+            gs_fake_mask[m] = buf[0];
+
+            return 0;
+        }
+    }
+    if ((addr != (0x59 << 1)) || (len < 2))
+    {
+        return 1;
+    }
+    sensor = a_mux_test_visible();
+    if (sensor == NULL)
+    {
+        return 1;
+    }
+    command = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+    if (command == 0x3682U)
+    {
+        a_mux_test_put(sensor, sensor->id, 3);
+    }
+    else if (command == 0x2619U)
+    {
+        a_mux_test_put(sensor, sensor->sraw, 2);
+    }
+    else
+    {
+        sensor->pending_len = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      fake bus read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 nack
+ * @note       none
+ */
+static uint8_t a_mux_test_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    mux_test_sensor_t *sensor;
+
+    if (addr != (0x59 << 1))
+    {
+        return 1;
+    }
+    sensor = a_mux_test_visible();
+    if ((sensor == NULL) || (sensor->pending_len != len))
+    {
+        return 1;
+    }
+    memcpy(buf, sensor->pending, len);
+    sensor->pending_len = 0;
+
+    return 0;
+}
+
+/**
+ * @brief     measure every sensor in a scheduled round
+ * @param[in] *order pointer to a sensor order
+ * @param[in] count sensor number
+ * @return    status code
+ *            - 0 success
+ *            - 1 measure failed
+ * @note      every handle must read its own sraw
+ */
+static uint8_t a_mux_test_round(const uint8_t *order, uint8_t count)
+{
+    uint16_t sraw_voc;
+    uint16_t sraw_nox;
+    uint8_t i;
+    uint8_t s;
+
+    for (i = 0; i < count; i++)
+    {
+        s = order[i];
+        if (sgp41_mux_route(&gs_mux, gs_sensor[s]) != 0)
+        {
+            return 1;
+        }
+        if (sgp41_get_measure_raw(&gs_handle[s], 0x8000, 0x6666, &sraw_voc, &sraw_nox) != 0)
+        {
+            return 1;
+        }
+        if ((sraw_voc != gs_fake[s % MUX_TEST_MUXES][s / MUX_TEST_MUXES].sraw[0]) ||
+            (sraw_nox != gs_fake[s % MUX_TEST_MUXES][s / MUX_TEST_MUXES].sraw[1]))
+        {
+            sgp41_interface_debug_print("sgp41: sensor %d read another sensor.\n", s);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  mux test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_mux_test(void)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t mux[MUX_TEST_MUXES];
+    uint8_t caller[MUX_TEST_LONG_LIST];
+    uint8_t order[MUX_TEST_LONG_LIST];
+    uint8_t index;
+    uint16_t id[3];
+    uint32_t writes;
+    sgp41_mux_stats_t stats;
+
+    /* start mux test */
+    sgp41_interface_debug_print("sgp41: start mux test.\n");
+
+    /* fake sensors, handle s sits on mux s % 2 channel s / 2 */
+    memset(gs_fake, 0, sizeof(gs_fake));
+    memset(gs_fake_mask, 0xFF, sizeof(gs_fake_mask));
+    for (i = 0; i < MUX_TEST_SENSORS; i++)
+    {
+        mux_test_sensor_t *sensor = &gs_fake[i % MUX_TEST_MUXES][i / MUX_TEST_MUXES];
+
+        sensor->id[0] = 0x1000U + i;
+        sensor->id[1] = 0x2000U + i;
+        sensor->id[2] = 0x3000U + i;
+        sensor->sraw[0] = (uint16_t)(30000U + i * 7U);
+        sensor->sraw[1] = (uint16_t)(16000U + i * 3U);
+    }
+    gs_fake_mux_writes = 0;
+    gs_fake_collisions = 0;
+    gs_fake_fail = 0;
+
+    /* invalid param test */
+    sgp41_interface_debug_print("sgp41: mux invalid param test.\n");
+    DRIVER_SGP41_MUX_LINK_INIT(&gs_mux, sgp41_mux_handle_t);
+    res = sgp41_mux_init(&gs_mux);
+    sgp41_interface_debug_print("sgp41: check missing links %s.\n", res == 3 ? "ok" : "error");
+    if (res != 3)
+    {
+        return 1;
+    }
+    DRIVER_SGP41_MUX_LINK_IIC_INIT(&gs_mux, a_mux_test_iic_init);
+    DRIVER_SGP41_MUX_LINK_IIC_DEINIT(&gs_mux, a_mux_test_iic_deinit);
+    DRIVER_SGP41_MUX_LINK_IIC_WRITE_COMMAND(&gs_mux, a_mux_test_iic_write_cmd);
+    DRIVER_SGP41_MUX_LINK_IIC_READ_COMMAND(&gs_mux, a_mux_test_iic_read_cmd);
+    res = sgp41_mux_init(&gs_mux);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: mux init failed.\n");
+
+        return 1;
+    }
+    for (i = 0; i < MUX_TEST_MUXES; i++)
+    {
+        res = sgp41_mux_add_mux(&gs_mux, SGP41_MUX_ADDRESS(i), &mux[i]);
+        if (res != 0)
+        {
+            sgp41_interface_debug_print("sgp41: add mux failed.\n");
+            (void)sgp41_mux_deinit(&gs_mux);
+
+            return 1;
+        }
+    }
+    res = sgp41_mux_add_sensor(&gs_mux, mux[0], SGP41_MUX_MAX_CHANNELS, &index);
+    sgp41_interface_debug_print("sgp41: check invalid channel %s.\n", res == 4 ? "ok" : "error");
+    if (res != 4)
+    {
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+    if ((gs_fake_mask[0] != 0) || (gs_fake_mask[1] != 0))
+    {
+        sgp41_interface_debug_print("sgp41: add mux did not deselect.\n");
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+
+    /* one sgp41 handle per sensor, all at the same address */
+    sgp41_interface_debug_print("sgp41: mux routing test.\n");
+    for (i = 0; i < MUX_TEST_SENSORS; i++)
+    {
+        DRIVER_SGP41_LINK_INIT(&gs_handle[i], sgp41_handle_t);
+        DRIVER_SGP41_LINK_IIC_INIT(&gs_handle[i], sgp41_mux_iic_init);
+        DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle[i], sgp41_mux_iic_deinit);
+        DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle[i], sgp41_mux_iic_write_cmd);
+        DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle[i], sgp41_mux_iic_read_cmd);
+        DRIVER_SGP41_LINK_DELAY_MS(&gs_handle[i], sgp41_interface_delay_ms);
+        DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle[i], sgp41_interface_debug_print);
+        res = sgp41_mux_add_sensor(&gs_mux, mux[i % MUX_TEST_MUXES], i / MUX_TEST_MUXES, &gs_sensor[i]);
+        if (res != 0)
+        {
+            sgp41_interface_debug_print("sgp41: add sensor failed.\n");
+            (void)sgp41_mux_deinit(&gs_mux);
+
+            return 1;
+        }
+        (void)sgp41_mux_route(&gs_mux, gs_sensor[i]);
+        res = sgp41_init(&gs_handle[i]);
+        if (res != 0)
+        {
+            sgp41_interface_debug_print("sgp41: init failed.\n");
+            (void)sgp41_mux_deinit(&gs_mux);
+
+            return 1;
+        }
+        res = sgp41_get_serial_id(&gs_handle[i], id);
+        if ((res != 0) || (id[0] != 0x1000U + i) || (id[1] != 0x2000U + i) || (id[2] != 0x3000U + i))
+        {
+            sgp41_interface_debug_print("sgp41: sensor %d serial id is wrong.\n", i);
+            (void)sgp41_mux_deinit(&gs_mux);
+
+            return 1;
+        }
+    }
+    sgp41_interface_debug_print("sgp41: check %d serial ids behind %d muxes ok.\n", MUX_TEST_SENSORS, MUX_TEST_MUXES);
+
+    /* the caller alternates the muxes, the worst order */
+    sgp41_interface_debug_print("sgp41: mux round test.\n");
+    for (i = 0; i < MUX_TEST_SENSORS; i++)
+    {
+        caller[i] = i;
+    }
+    res = sgp41_mux_schedule(&gs_mux, caller, MUX_TEST_SENSORS, order);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: schedule failed.\n");
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+    writes = gs_fake_mux_writes;
+    if (a_mux_test_round(order, MUX_TEST_SENSORS) != 0)
+    {
+        sgp41_interface_debug_print("sgp41: round failed.\n");
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+    (void)sgp41_mux_get_stats(&gs_mux, &stats);
+    sgp41_interface_debug_print("sgp41: round of %d sensors, %d transactions.\n", MUX_TEST_SENSORS, stats.round_transactions);
+    sgp41_interface_debug_print("sgp41: mux writes %d scheduled, %d in caller order, %d selecting every transaction.\n",
+                                stats.round_selects, stats.round_unsorted_selects, stats.round_naive_selects);
+    sgp41_interface_debug_print("sgp41: mux writes reduced by %d per round.\n", stats.round_naive_selects - stats.round_selects);
+    if ((stats.round_selects != gs_fake_mux_writes - writes) ||
+        (stats.round_selects > MUX_TEST_SENSORS + MUX_TEST_MUXES - 1) ||
+        (stats.round_selects >= stats.round_unsorted_selects) ||
+        (stats.round_transactions != MUX_TEST_SENSORS * 2))
+    {
+        sgp41_interface_debug_print("sgp41: mux write count is wrong.\n");
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+
+    /* the next round starts on the selected channel */
+    index = order[MUX_TEST_SENSORS - 1];
+    res = sgp41_mux_schedule(&gs_mux, caller, MUX_TEST_SENSORS, order);
+    if ((res != 0) || (order[0] != index))
+    {
+        sgp41_interface_debug_print("sgp41: next round does not start on the selected channel.\n");
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+    if (a_mux_test_round(order, MUX_TEST_SENSORS) != 0)
+    {
+        sgp41_interface_debug_print("sgp41: round failed.\n");
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+    (void)sgp41_mux_get_stats(&gs_mux, &stats);
+    sgp41_interface_debug_print("sgp41: next round mux writes %d.\n", stats.round_selects);
+
+    /* a list may repeat sensors, but the schedule bounds its length */
+    for (i = 0; i < MUX_TEST_LONG_LIST; i++)
+    {
+        caller[i] = 0;
+    }
+    res = sgp41_mux_schedule(&gs_mux, caller, MUX_TEST_LONG_LIST, order);
+    sgp41_interface_debug_print("sgp41: check over-long schedule list %s.\n", res == 4 ? "ok" : "error");
+    if (res != 4)
+    {
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+
+    /* a failed mux write leaves the state unknown and the next access writes it again */
+    sgp41_interface_debug_print("sgp41: mux write failure test.\n");
+    gs_fake_fail = 1;
+    order[0] = 0;
+    res = a_mux_test_round(order, 1);
+    sgp41_interface_debug_print("sgp41: check failed select %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+    res = a_mux_test_round(order, 1);
+    sgp41_interface_debug_print("sgp41: check recovery %s.\n", res == 0 ? "ok" : "error");
+    if (res != 0)
+    {
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+    if (gs_fake_collisions != 0)
+    {
+        sgp41_interface_debug_print("sgp41: %d transactions saw no or two sensors.\n", gs_fake_collisions);
+        (void)sgp41_mux_deinit(&gs_mux);
+
+        return 1;
+    }
+
+    /* close */
+    for (i = 0; i < MUX_TEST_SENSORS; i++)
+    {
+        (void)sgp41_mux_route(&gs_mux, gs_sensor[i]);
+        (void)sgp41_deinit(&gs_handle[i]);
+    }
+    res = sgp41_mux_deinit(&gs_mux);
+    if ((res != 0) || (gs_fake_mask[0] != 0) || (gs_fake_mask[1] != 0))
+    {
+        sgp41_interface_debug_print("sgp41: mux deinit failed.\n");
+
+        return 1;
+    }
+
+    /* finish mux test */
+    sgp41_interface_debug_print("sgp41: finish mux test.\n");
+
+    return 0;
+}
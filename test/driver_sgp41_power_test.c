@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_power_test.c
+ * @brief     driver sgp41 power test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_power_test.h"
+#include "driver_sgp41_low_power.h"
+#include "driver_sgp41_algorithm.h"
+#include <stdlib.h>
+
+static sgp41_gas_index_algorithm_t gs_continuous;        /**< 1 s continuous voc */
+static sgp41_gas_index_algorithm_t gs_low_power;         /**< low power voc */
+
+/**
+ * @brief     synthetic voc sraw
+ * @param[in] t time in s
+ * @return    sraw
+ * @note      quiet air with sensor noise and a cooking event every two hours
+ */
+static int32_t a_power_sraw(uint32_t t)
+{
+    int32_t v;
+    uint32_t p;
+
+    v = 30000 + (rand() % 9) - 4;
+    p = t % 7200U;
+    if ((t > 3600U) && (p >= 3600U) && (p < 4200U))
+    {
+        /* a fast fall and a slow recovery */
+        p -= 3600U;
+        v -= (p < 120U) ? (int32_t)p * 25 : (int32_t)(3000 - (p - 120U) * 6);
+    }
+
+    return v;
+}
+
+/**
+ * @brief  power test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_power_test(void)
+{
+    uint32_t t;
+    uint32_t period_s;
+    uint32_t count;
+    uint32_t on_ms;
+    uint32_t events;
+    uint32_t lag;
+    uint32_t max_lag;
+    uint32_t ref_start;
+    uint32_t low_start;
+    uint8_t armed;
+    int32_t ref;
+    int32_t low;
+    int32_t err;
+    int32_t max_err;
+    float sum_err;
+    float duty;
+    float max_current_ma;
+    sgp41_info_t info;
+
+    /* start power test */
+    sgp41_interface_debug_print("sgp41: start power test.\n");
+
+    /* twelve hours of continuous against low power sampling */
+    sgp41_interface_debug_print("sgp41: power twelve hours trace test.\n");
+    period_s = SGP41_LOW_POWER_DEFAULT_PERIOD_MS / 1000;
+    sgp41_algorithm_init(&gs_continuous, SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init_with_sampling_interval(&gs_low_power, SGP41_ALGORITHM_TYPE_VOC, (float)period_s);
+    srand(0x5347);
+    low = 0;
+    count = 0;
+    sum_err = 0.0f;
+    max_err = 0;
+    events = 0;
+    max_lag = 0;
+    ref_start = 0;
+    low_start = 0;
+    armed = 1;
+    for (t = 0; t < 12U * 3600U; t++)
+    {
+        int32_t sraw;
+
+        sraw = a_power_sraw(t);
+        sgp41_algorithm_process(&gs_continuous, sraw, &ref);
+        if ((t % period_s) == 0)
+        {
+            sgp41_algorithm_process(&gs_low_power, sraw, &low);
+            if (t > 3600U)
+            {
+                err = abs(ref - low);
+                sum_err += (float)err;
+                count++;
+                max_err = (err > max_err) ? err : max_err;
+            }
+        }
+
+        /* event detection lag at an index of 200, armed again when both are back below 150 */
+        if ((ref >= 200) && (ref_start == 0))
+        {
+            ref_start = t;
+        }
+        if ((low >= 200) && (low_start == 0))
+        {
+            low_start = t;
+        }
+        if ((ref_start != 0) && (low_start != 0) && (armed != 0))
+        {
+            lag = (low_start > ref_start) ? (low_start - ref_start) : 0;
+            max_lag = (lag > max_lag) ? lag : max_lag;
+            events++;
+            armed = 0;
+        }
+        if ((ref < 150) && (low < 150))
+        {
+            ref_start = 0;
+            low_start = 0;
+            armed = 1;
+        }
+    }
+
+    /* heater on time of one low power sample */
+    (void)sgp41_info(&info);
+    max_current_ma = info.max_current_ma;
+    on_ms = 2 * SGP41_EXECUTION_TIME_MEASURE_RAW_MS + SGP41_LOW_POWER_PREHEAT_MS + 1;
+    duty = (float)on_ms / (float)SGP41_LOW_POWER_DEFAULT_PERIOD_MS;
+    sgp41_interface_debug_print("sgp41: low power %ds, mean index error %0.2f, max index error %d.\n",
+                                period_s, sum_err / (float)count, max_err);
+    sgp41_interface_debug_print("sgp41: %d events, max detection lag %ds.\n", events, max_lag);
+    sgp41_interface_debug_print("sgp41: heater duty %0.2f%%, %0.3fmAh per hour against %0.3fmAh per hour continuous.\n",
+                                duty * 100.0f, duty * max_current_ma, max_current_ma);
+    if ((events != 6) || (max_lag > period_s) || ((sum_err / (float)count) > 3.0f) || (duty > 0.05f))
+    {
+        sgp41_interface_debug_print("sgp41: check power error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check power ok.\n");
+
+    /* finish power test */
+    sgp41_interface_debug_print("sgp41: finish power test.\n");
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_rate_test.c
+ * @brief     driver sgp41 rate test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_rate_test.h"
+#include "driver_sgp41_rate.h"
+#include "driver_sgp41_algorithm.h"
+#include <stdlib.h>
+
+static sgp41_rate_handle_t gs_rate;                   /**< rate handle */
+static sgp41_gas_index_algorithm_t gs_ref[2];         /**< 1 s reference voc and nox */
+static sgp41_gas_index_algorithm_t gs_dut[2];         /**< adaptive voc and nox */
+
+/**
+ * @brief     synthetic sraw
+ * @param[in] t time in s
+ * @param[in] nox nox flag
+ * @return    sraw
+ * @note      quiet air with sensor noise, a voc event every two hours and one nox event
+ */
+static int32_t a_rate_sraw(uint32_t t, uint8_t nox)
+{
+    int32_t v;
+    uint32_t p;
+
+    v = (nox != 0) ? 16000 : 30000;
+    v += (rand() % 9) - 4;
+    if (nox != 0)
+    {
+        if ((t >= 5U * 3600U) && (t < 5U * 3600U + 600U))
+        {
+            /* a gas stove */
+            v += (int32_t)((t < 5U * 3600U + 300U) ? (t - 5U * 3600U) : (5U * 3600U + 600U - t)) * 4;
+        }
+
+        return v;
+    }
+    p = t % 7200U;
+    if ((t > 3600U) && (p >= 3600U) && (p < 4200U))
+    {
+        /* cooking, a fast fall and a slow recovery */
+        p -= 3600U;
+        v -= (p < 120U) ? (int32_t)p * 25 : (int32_t)(3000 - (p - 120U) * 6);
+    }
+
+    return v;
+}
+
+/**
+ * @brief  rate test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_rate_test(void)
+{
+    uint8_t res;
+    uint8_t gas;
+    uint32_t t;
+    uint32_t next;
+    uint32_t last;
+    uint32_t period;
+    uint32_t max_period;
+    int32_t ref[2];
+    int32_t dut[2];
+    int32_t err;
+    int32_t max_err;
+    uint32_t count;
+    float sum_err;
+    sgp41_rate_stats_t stats;
+
+    /* start rate test */
+    sgp41_interface_debug_print("sgp41: start rate test.\n");
+
+    /* invalid param test */
+    sgp41_interface_debug_print("sgp41: rate invalid param test.\n");
+    res = sgp41_rate_init(&gs_rate, 0, 1000);
+    sgp41_interface_debug_print("sgp41: check zero period %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        return 1;
+    }
+    res = sgp41_rate_init(&gs_rate, 1000, SGP41_RATE_MAX_PERIOD_LIMIT_MS + 1);
+    sgp41_interface_debug_print("sgp41: check too long period %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        return 1;
+    }
+    res = sgp41_rate_init(&gs_rate, SGP41_RATE_DEFAULT_MIN_PERIOD_MS, SGP41_RATE_DEFAULT_MAX_PERIOD_MS);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: rate init failed.\n");
+
+        return 1;
+    }
+    res = sgp41_rate_set_thresholds(&gs_rate, 6.0f, 2.0f, 0.5f, 8);
+    sgp41_interface_debug_print("sgp41: check inverted thresholds %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        return 1;
+    }
+
+    /* eight hours against the 1 s reference, the max error is the lag at an event onset */
+    sgp41_interface_debug_print("sgp41: rate eight hours test.\n");
+    sgp41_algorithm_init(&gs_ref[0], SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_ref[1], SGP41_ALGORITHM_TYPE_NOX);
+    sgp41_algorithm_init(&gs_dut[0], SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_dut[1], SGP41_ALGORITHM_TYPE_NOX);
+    srand(0x5347);
+    next = 0;
+    last = 0;
+    max_err = 0;
+    sum_err = 0.0f;
+    count = 0;
+    max_period = 0;
+    for (t = 0; t < 8U * 3600U; t++)
+    {
+        int32_t sraw[2];
+
+        sraw[0] = a_rate_sraw(t, 0);
+        sraw[1] = a_rate_sraw(t, 1);
+        for (gas = 0; gas < 2; gas++)
+        {
+            sgp41_algorithm_process(&gs_ref[gas], sraw[gas], &ref[gas]);
+        }
+        if (t != next)
+        {
+            continue;
+        }
+
+        /* adaptive sample */
+        for (gas = 0; gas < 2; gas++)
+        {
+            sgp41_algorithm_process_with_elapsed(&gs_dut[gas], sraw[gas], (t == 0) ? 1.0f : (float)(t - last), &dut[gas]);
+        }
+        res = sgp41_rate_update(&gs_rate, t * 1000U, dut[0], dut[1], &period);
+        if (res != 0)
+        {
+            sgp41_interface_debug_print("sgp41: rate update failed.\n");
+
+            return 1;
+        }
+        last = t;
+        next = t + period / 1000U;
+        max_period = (period > max_period) ? period : max_period;
+        if (t > 3600U)
+        {
+            for (gas = 0; gas < 2; gas++)
+            {
+                err = abs(ref[gas] - dut[gas]);
+                max_err = (err > max_err) ? err : max_err;
+                sum_err += (float)err;
+                count++;
+            }
+        }
+    }
+    res = sgp41_rate_update(&gs_rate, last * 1000U, dut[0], dut[1], &period);
+    sgp41_interface_debug_print("sgp41: check repeated timestamp %s.\n", res == 4 ? "ok" : "error");
+    if (res != 4)
+    {
+        return 1;
+    }
+    (void)sgp41_rate_get_stats(&gs_rate, &stats);
+    sgp41_interface_debug_print("sgp41: %d samples against %d at the fixed rate, %0.1f%% saved.\n",
+                                stats.samples, stats.fixed_samples, stats.saved_ratio * 100.0f);
+    sgp41_interface_debug_print("sgp41: bus time saved %dms, cpu time saved %dus.\n",
+                                (uint32_t)(stats.bus_us_saved / 1000U), (uint32_t)(stats.cpu_ns_saved / 1000U));
+    sgp41_interface_debug_print("sgp41: %d speedups, %d slowdowns, max period %dms.\n",
+                                stats.speedups, stats.slowdowns, max_period);
+    sgp41_interface_debug_print("sgp41: mean index error %0.2f, max index error %d.\n", sum_err / (float)count, max_err);
+    if ((stats.saved_ratio < 0.5f) || (stats.speedups < 4) ||
+        (max_period != SGP41_RATE_DEFAULT_MAX_PERIOD_MS) || ((sum_err / (float)count) > 1.0f) || (max_err > 40))
+    {
+        sgp41_interface_debug_print("sgp41: check rate error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check rate ok.\n");
+
+    /* finish rate test */
+    sgp41_interface_debug_print("sgp41: finish rate test.\n");
+
+    return 0;
+}
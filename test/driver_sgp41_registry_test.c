@@ -0,0 +1,359 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_registry_test.c
+ * @brief     driver sgp41 registry test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_registry_test.h"
+#include "driver_sgp41_registry.h"
+
+/**
+ * @brief registry test param definition
+ */
+#define REGISTRY_TEST_SAMPLES        120        /**< samples learned by every sensor */
+#define REGISTRY_TEST_STORE          32         /**< saved checkpoints */
+
+static sgp41_handle_t gs_handle;                                                 /**< sgp41 handle */
+static sgp41_registry_handle_t gs_registry;                                      /**< registry handle */
+static sgp41_registry_checkpoint_t gs_store[REGISTRY_TEST_STORE];                /**< checkpoint store */
+static uint8_t gs_store_len;                                                     /**< saved checkpoints */
+
+/**
+ * @brief      checkpoint store load
+ * @param[in]  *id pointer to a serial id
+ * @param[out] *checkpoint pointer to a checkpoint buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no checkpoint
+ * @note       none
+ */
+static uint8_t a_registry_test_load(const uint16_t id[3], sgp41_registry_checkpoint_t *checkpoint)
+{
+    uint8_t i;
+
+    for (i = 0; i < gs_store_len; i++)
+    {
+        if (memcmp(gs_store[i].id, id, sizeof(gs_store[i].id)) == 0)
+        {
+            *checkpoint = gs_store[i];
+
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief     checkpoint store save
+ * @param[in] *checkpoint pointer to a checkpoint
+ * @return    status code
+ *            - 0 success
+ *            - 1 store is full
+ * @note      the checkpoint of the same id is replaced
+ */
+static uint8_t a_registry_test_save(const sgp41_registry_checkpoint_t *checkpoint)
+{
+    uint8_t i;
+
+    for (i = 0; i < gs_store_len; i++)
+    {
+        if (memcmp(gs_store[i].id, checkpoint->id, sizeof(gs_store[i].id)) == 0)
+        {
+            break;
+        }
+    }
+    if (i >= REGISTRY_TEST_STORE)
+    {
+        return 1;
+    }
+    gs_store[i] = *checkpoint;
+    if (i == gs_store_len)
+    {
+        gs_store_len++;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     feed samples to the sensor of a slot
+ * @param[in] slot bus position
+ * @param[in] sraw raw value
+ * @return    status code
+ *            - 0 success
+ *            - 1 slot is empty
+ * @note      none
+ */
+static uint8_t a_registry_test_learn(uint8_t slot, int32_t sraw)
+{
+    sgp41_gas_index_algorithm_t *voc;
+    sgp41_gas_index_algorithm_t *nox;
+    int32_t index;
+    uint32_t i;
+
+    if (sgp41_registry_get(&gs_registry, slot, &voc, &nox) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < REGISTRY_TEST_SAMPLES; i++)
+    {
+        sgp41_algorithm_process(voc, sraw + (int32_t)(i % 7), &index);
+        sgp41_algorithm_process(nox, sraw / 2 + (int32_t)(i % 5), &index);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      get the voc states of a slot
+ * @param[in]  slot bus position
+ * @param[out] *state0 pointer to a state0 buffer
+ * @param[out] *state1 pointer to a state1 buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 slot is empty
+ * @note       none
+ */
+static uint8_t a_registry_test_states(uint8_t slot, float *state0, float *state1)
+{
+    sgp41_gas_index_algorithm_t *voc;
+    sgp41_gas_index_algorithm_t *nox;
+
+    if (sgp41_registry_get(&gs_registry, slot, &voc, &nox) != 0)
+    {
+        return 1;
+    }
+    sgp41_algorithm_get_states(voc, state0, state1);
+
+    return 0;
+}
+
+/**
+ * @brief  registry test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_registry_test(void)
+{
+    uint8_t res;
+    uint8_t source;
+    uint8_t slot;
+    uint32_t i;
+    uint16_t a[3];
+    uint16_t b[3] = {0x0001, 0x0002, 0x0003};
+    uint16_t c[3] = {0x0001, 0x0002, 0x0004};
+    uint16_t id[3];
+    float a0, a1, b0, b1, s0, s1;
+    sgp41_registry_stats_t stats;
+
+    /* start registry test */
+    sgp41_interface_debug_print("sgp41: start registry test.\n");
+
+    /* the first serial id comes from the chip */
+    DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, sgp41_interface_iic_init);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, sgp41_interface_iic_deinit);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, sgp41_interface_iic_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, sgp41_interface_iic_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, sgp41_interface_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle, sgp41_interface_debug_print);
+    res = sgp41_init(&gs_handle);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: init failed.\n");
+
+        return 1;
+    }
+    res = sgp41_get_serial_id(&gs_handle, a);
+    (void)sgp41_deinit(&gs_handle);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: get serial id failed.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: serial id 0x%04X 0x%04X 0x%04X.\n", a[0], a[1], a[2]);
+
+    /* invalid param test */
+    sgp41_interface_debug_print("sgp41: registry invalid param test.\n");
+    DRIVER_SGP41_REGISTRY_LINK_INIT(&gs_registry, sgp41_registry_handle_t);
+    res = sgp41_registry_attach(&gs_registry, 0, a, &source);
+    sgp41_interface_debug_print("sgp41: check attach before init %s.\n", res == 3 ? "ok" : "error");
+    if (res != 3)
+    {
+        return 1;
+    }
+    DRIVER_SGP41_REGISTRY_LINK_LOAD(&gs_registry, a_registry_test_load);
+    DRIVER_SGP41_REGISTRY_LINK_SAVE(&gs_registry, a_registry_test_save);
+    gs_store_len = 0;
+    res = sgp41_registry_init(&gs_registry);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: registry init failed.\n");
+
+        return 1;
+    }
+    res = sgp41_registry_attach(&gs_registry, SGP41_REGISTRY_MAX_SLOTS, a, &source);
+    sgp41_interface_debug_print("sgp41: check invalid slot %s.\n", res == 4 ? "ok" : "error");
+    if (res != 4)
+    {
+        return 1;
+    }
+
+    /* attach and learn */
+    sgp41_interface_debug_print("sgp41: registry attach test.\n");
+    if ((sgp41_registry_attach(&gs_registry, 0, a, &source) != 0) || (source != SGP41_REGISTRY_SOURCE_NEW) ||
+        (sgp41_registry_attach(&gs_registry, 1, b, &source) != 0) || (source != SGP41_REGISTRY_SOURCE_NEW) ||
+        (a_registry_test_learn(0, 30000) != 0) || (a_registry_test_learn(1, 24000) != 0))
+    {
+        sgp41_interface_debug_print("sgp41: attach new sensors failed.\n");
+
+        return 1;
+    }
+    (void)a_registry_test_states(0, &a0, &a1);
+    (void)a_registry_test_states(1, &b0, &b1);
+    sgp41_interface_debug_print("sgp41: slot 0 voc states %0.1f %0.1f, slot 1 voc states %0.1f %0.1f.\n", a0, a1, b0, b1);
+
+    /* swap the sensors */
+    sgp41_interface_debug_print("sgp41: registry swap test.\n");
+    if ((sgp41_registry_attach(&gs_registry, 1, a, &source) != 0) || (source != SGP41_REGISTRY_SOURCE_MEMORY) ||
+        (sgp41_registry_attach(&gs_registry, 0, b, &source) != 0) || (source != SGP41_REGISTRY_SOURCE_MEMORY))
+    {
+        sgp41_interface_debug_print("sgp41: swap sensors failed.\n");
+
+        return 1;
+    }
+    (void)a_registry_test_states(1, &s0, &s1);
+    res = ((s0 == a0) && (s1 == a1)) ? 0 : 1;
+    (void)a_registry_test_states(0, &s0, &s1);
+    res |= ((s0 == b0) && (s1 == b1)) ? 0 : 1;
+    sgp41_interface_debug_print("sgp41: check states follow the serial id %s.\n", res == 0 ? "ok" : "error");
+    if (res != 0)
+    {
+        return 1;
+    }
+
+    /* replace a sensor */
+    sgp41_interface_debug_print("sgp41: registry replace test.\n");
+    if ((sgp41_registry_attach(&gs_registry, 0, c, &source) != 0) || (source != SGP41_REGISTRY_SOURCE_NEW) ||
+        (sgp41_registry_lookup(&gs_registry, b, &slot) != 0) || (slot != SGP41_REGISTRY_NONE))
+    {
+        sgp41_interface_debug_print("sgp41: replace sensor failed.\n");
+
+        return 1;
+    }
+    (void)a_registry_test_states(0, &s0, &s1);
+    res = ((s0 != b0) || (s1 != b1)) ? 0 : 1;
+    sgp41_interface_debug_print("sgp41: check new sensor has fresh states %s.\n", res == 0 ? "ok" : "error");
+    if (res != 0)
+    {
+        return 1;
+    }
+
+    /* restore after a restart */
+    sgp41_interface_debug_print("sgp41: registry checkpoint test.\n");
+    res = sgp41_registry_deinit(&gs_registry);
+    sgp41_interface_debug_print("sgp41: %d checkpoints saved.\n", gs_store_len);
+    if ((res != 0) || (sgp41_registry_init(&gs_registry) != 0))
+    {
+        sgp41_interface_debug_print("sgp41: registry restart failed.\n");
+
+        return 1;
+    }
+    if ((sgp41_registry_attach(&gs_registry, 3, b, &source) != 0) || (source != SGP41_REGISTRY_SOURCE_CHECKPOINT) ||
+        (sgp41_registry_attach(&gs_registry, 2, a, &source) != 0) || (source != SGP41_REGISTRY_SOURCE_CHECKPOINT) ||
+        (sgp41_registry_attach(&gs_registry, 1, c, &source) != 0) || (source != SGP41_REGISTRY_SOURCE_NEW))
+    {
+        sgp41_interface_debug_print("sgp41: restore sensors failed.\n");
+
+        return 1;
+    }
+    (void)a_registry_test_states(2, &s0, &s1);
+    res = ((s0 == a0) && (s1 == a1)) ? 0 : 1;
+    (void)a_registry_test_states(3, &s0, &s1);
+    res |= ((s0 == b0) && (s1 == b1)) ? 0 : 1;
+    sgp41_interface_debug_print("sgp41: check restored states %s.\n", res == 0 ? "ok" : "error");
+    if (res != 0)
+    {
+        return 1;
+    }
+
+    /* eviction test */
+    sgp41_interface_debug_print("sgp41: registry eviction test.\n");
+    (void)sgp41_registry_deinit(&gs_registry);
+    DRIVER_SGP41_REGISTRY_LINK_INIT(&gs_registry, sgp41_registry_handle_t);
+    (void)sgp41_registry_init(&gs_registry);
+    for (i = 0; i < SGP41_REGISTRY_MAX_SENSORS + 8; i++)
+    {
+        id[0] = (uint16_t)(i * 0x1111);
+        id[1] = (uint16_t)i;
+        id[2] = 0x5A5A;
+        if (sgp41_registry_attach(&gs_registry, (uint8_t)(i % SGP41_REGISTRY_MAX_SLOTS), id, &source) != 0)
+        {
+            sgp41_interface_debug_print("sgp41: attach sensor %d failed.\n", i);
+
+            return 1;
+        }
+    }
+    for (i = 0; i < SGP41_REGISTRY_MAX_SENSORS + 8; i++)
+    {
+        id[0] = (uint16_t)(i * 0x1111);
+        id[1] = (uint16_t)i;
+        id[2] = 0x5A5A;
+        res = sgp41_registry_lookup(&gs_registry, id, &slot);
+        if (res != ((i < 8) ? 1 : 0))
+        {
+            sgp41_interface_debug_print("sgp41: lookup sensor %d failed.\n", i);
+
+            return 1;
+        }
+    }
+    (void)sgp41_registry_get_stats(&gs_registry, &stats);
+    sgp41_interface_debug_print("sgp41: %d sensors, %d attached, %d evictions.\n", stats.sensors, stats.attached, stats.evictions);
+    if ((stats.sensors != SGP41_REGISTRY_MAX_SENSORS) || (stats.attached != SGP41_REGISTRY_MAX_SLOTS) || (stats.evictions != 8))
+    {
+        sgp41_interface_debug_print("sgp41: check eviction error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check eviction ok.\n");
+    (void)sgp41_registry_deinit(&gs_registry);
+
+    /* finish registry test */
+    sgp41_interface_debug_print("sgp41: finish registry test.\n");
+
+    return 0;
+}
@@ -0,0 +1,307 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_rollup_test.c
+ * @brief     driver sgp41 rollup test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_rollup_test.h"
+#include "driver_sgp41_rollup.h"
+#include <stdlib.h>
+
+static sgp41_rollup_handle_t gs_rollup[2];                 /**< rollup handles */
+static uint32_t gs_exact[SGP41_ROLLUP_INDEX_MAX + 1];      /**< exact voc histogram of the open hour */
+static uint32_t gs_hour_windows;                           /**< emitted hour windows */
+static uint32_t gs_day_windows;                            /**< emitted day windows */
+static uint32_t gs_minute_windows;                         /**< emitted minute windows */
+static uint32_t gs_errors;                                 /**< check errors */
+static float gs_max_quantile_error;                        /**< max quantile error */
+
+/**
+ * @brief     get the exact quantile of the open hour
+ * @param[in] q quantile
+ * @return    exact quantile
+ * @note      none
+ */
+static int32_t a_rollup_exact_quantile(float q)
+{
+    uint32_t count;
+    uint32_t cum;
+    int32_t i;
+    float rank;
+
+    count = 0;
+    for (i = 0; i <= SGP41_ROLLUP_INDEX_MAX; i++)
+    {
+        count += gs_exact[i];
+    }
+    rank = q * (float)count;
+    cum = 0;
+    for (i = 0; i <= SGP41_ROLLUP_INDEX_MAX; i++)
+    {
+        cum += gs_exact[i];
+        if ((gs_exact[i] != 0) && ((float)cum >= rank))
+        {
+            return i;
+        }
+    }
+
+    return SGP41_ROLLUP_INDEX_MAX;
+}
+
+/**
+ * @brief     rollup window callback
+ * @param[in] id sensor id
+ * @param[in] gas rollup gas
+ * @param[in] level rollup level
+ * @param[in] *aggregate pointer to an aggregate buffer
+ * @note      none
+ */
+static void a_rollup_callback(uint32_t id, sgp41_rollup_gas_t gas,
+                              sgp41_rollup_level_t level,
+                              const sgp41_rollup_aggregate_t *aggregate)
+{
+    uint64_t sum;
+    uint32_t count;
+    int32_t min;
+    int32_t max;
+    int32_t i;
+    float p95;
+    float err;
+
+    if ((id != 0) || (gas != SGP41_ROLLUP_GAS_VOC))
+    {
+        return;
+    }
+    if (level == SGP41_ROLLUP_LEVEL_MINUTE)
+    {
+        gs_minute_windows++;
+
+        return;
+    }
+    if (level == SGP41_ROLLUP_LEVEL_DAY)
+    {
+        gs_day_windows++;
+
+        return;
+    }
+
+    /* check the hour against the exact values */
+    gs_hour_windows++;
+    sum = 0;
+    count = 0;
+    min = SGP41_ROLLUP_INDEX_MAX;
+    max = 0;
+    for (i = 0; i <= SGP41_ROLLUP_INDEX_MAX; i++)
+    {
+        if (gs_exact[i] != 0)
+        {
+            sum += (uint64_t)gs_exact[i] * (uint64_t)i;
+            count += gs_exact[i];
+            min = (i < min) ? i : min;
+            max = (i > max) ? i : max;
+        }
+    }
+    if ((sum != aggregate->sum) || (count != aggregate->count) ||
+        (min != aggregate->min) || (max != aggregate->max))
+    {
+        sgp41_interface_debug_print("sgp41: hour %d aggregate mismatch.\n", aggregate->start);
+        gs_errors++;
+    }
+    (void)sgp41_rollup_aggregate_quantile(aggregate, 0.95f, &p95);
+    err = p95 - (float)a_rollup_exact_quantile(0.95f);
+    err = (err < 0.0f) ? -err : err;
+    if (err > gs_max_quantile_error)
+    {
+        gs_max_quantile_error = err;
+    }
+    if (err > (float)SGP41_ROLLUP_SKETCH_WIDTH)
+    {
+        sgp41_interface_debug_print("sgp41: hour %d p95 error %0.2f.\n", aggregate->start, err);
+        gs_errors++;
+    }
+    memset(gs_exact, 0, sizeof(gs_exact));
+}
+
+/**
+ * @brief     synthetic gas index
+ * @param[in] t timestamp
+ * @param[in] seed trace seed
+ * @return    gas index
+ * @note      slow daily cycle plus short cooking like peaks
+ */
+static int32_t a_rollup_index(uint32_t t, uint32_t seed)
+{
+    int32_t v;
+    uint32_t phase;
+
+    phase = (t + seed * 977U) % 86400U;
+    v = 100 + (int32_t)((phase < 43200U) ? (phase / 864U) : ((86400U - phase) / 864U));
+    if (((t / 600U) % 13U) == (seed % 13U))
+    {
+        v += (int32_t)((t % 600U) / 2U);
+    }
+    v += (int32_t)(rand() % 5) - 2;
+
+    return v;
+}
+
+/**
+ * @brief  rollup test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_rollup_test(void)
+{
+    uint8_t res;
+    uint32_t t;
+    uint32_t t0;
+    sgp41_rollup_aggregate_t zone;
+    sgp41_rollup_aggregate_t day;
+    float mean;
+    float p95;
+
+    /* start rollup test */
+    sgp41_interface_debug_print("sgp41: start rollup test.\n");
+
+    /* init */
+    gs_minute_windows = 0;
+    gs_hour_windows = 0;
+    gs_day_windows = 0;
+    gs_errors = 0;
+    gs_max_quantile_error = 0.0f;
+    memset(gs_exact, 0, sizeof(gs_exact));
+    res = sgp41_rollup_init(&gs_rollup[0], 0, 60, 3600, 86400, a_rollup_callback);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: rollup init failed.\n");
+
+        return 1;
+    }
+    res = sgp41_rollup_init(&gs_rollup[1], 1, 60, 3600, 86400, a_rollup_callback);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: rollup init failed.\n");
+
+        return 1;
+    }
+
+    /* invalid window test */
+    sgp41_interface_debug_print("sgp41: rollup invalid window test.\n");
+    res = sgp41_rollup_init(&gs_rollup[1], 1, 60, 3500, 86400, a_rollup_callback);
+    sgp41_interface_debug_print("sgp41: check invalid window %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        return 1;
+    }
+    (void)sgp41_rollup_init(&gs_rollup[1], 1, 60, 3600, 86400, a_rollup_callback);
+
+    /* two days of 1 s samples */
+    sgp41_interface_debug_print("sgp41: rollup two days stream test.\n");
+    t0 = 1700000000U - (1700000000U % 86400U);
+    for (t = t0; t < (t0 + 2U * 86400U); t++)
+    {
+        int32_t voc;
+
+        voc = a_rollup_index(t, 0);
+        res = sgp41_rollup_update(&gs_rollup[0], t, voc, 1);
+        if (res != 0)
+        {
+            sgp41_interface_debug_print("sgp41: rollup update failed.\n");
+
+            return 1;
+        }
+        gs_exact[(voc < 0) ? 0 : ((voc > SGP41_ROLLUP_INDEX_MAX) ? SGP41_ROLLUP_INDEX_MAX : voc)]++;
+        res = sgp41_rollup_update(&gs_rollup[1], t, a_rollup_index(t, 7), 1);
+        if (res != 0)
+        {
+            sgp41_interface_debug_print("sgp41: rollup update failed.\n");
+
+            return 1;
+        }
+    }
+
+    /* out of order test */
+    res = sgp41_rollup_update(&gs_rollup[0], t0, 100, 1);
+    sgp41_interface_debug_print("sgp41: check out of order timestamp %s.\n", res == 1 ? "ok" : "error");
+    if (res != 1)
+    {
+        return 1;
+    }
+
+    /* zone view of the open day */
+    res = sgp41_rollup_get_aggregate(&gs_rollup[0], SGP41_ROLLUP_GAS_VOC, SGP41_ROLLUP_LEVEL_DAY, &zone);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: rollup get aggregate failed.\n");
+
+        return 1;
+    }
+    res = sgp41_rollup_get_aggregate(&gs_rollup[1], SGP41_ROLLUP_GAS_VOC, SGP41_ROLLUP_LEVEL_DAY, &day);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: rollup get aggregate failed.\n");
+
+        return 1;
+    }
+    (void)sgp41_rollup_aggregate_merge(&zone, &day);
+    (void)sgp41_rollup_aggregate_mean(&zone, &mean);
+    (void)sgp41_rollup_aggregate_quantile(&zone, 0.95f, &p95);
+    sgp41_interface_debug_print("sgp41: zone day count %d min %d max %d mean %0.2f p95 %0.2f.\n",
+                                zone.count, zone.min, zone.max, mean, p95);
+    if (zone.count != 2U * 86400U)
+    {
+        sgp41_interface_debug_print("sgp41: zone count error.\n");
+
+        return 1;
+    }
+
+    /* flush */
+    (void)sgp41_rollup_flush(&gs_rollup[0]);
+    sgp41_interface_debug_print("sgp41: minute windows %d, hour windows %d, day windows %d.\n",
+                                gs_minute_windows, gs_hour_windows, gs_day_windows);
+    sgp41_interface_debug_print("sgp41: max p95 error is %0.2f.\n", gs_max_quantile_error);
+    if ((gs_minute_windows != 2U * 1440U) || (gs_hour_windows != 48U) || (gs_day_windows != 2U) || (gs_errors != 0))
+    {
+        sgp41_interface_debug_print("sgp41: check rollup error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check rollup ok.\n");
+
+    /* finish rollup test */
+    sgp41_interface_debug_print("sgp41: finish rollup test.\n");
+
+    return 0;
+}
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_timestep_test.c
+ * @brief     driver sgp41 timestep test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_timestep_test.h"
+#include "driver_sgp41_algorithm.h"
+#include <stdlib.h>
+
+static sgp41_gas_index_algorithm_t gs_ref;             /**< 1 s reference */
+static sgp41_gas_index_algorithm_t gs_dut;             /**< algorithm under test */
+static sgp41_gas_index_algorithm_t gs_naive;           /**< fixed step algorithm */
+
+/**
+ * @brief     synthetic voc sraw
+ * @param[in] t time in s
+ * @return    sraw
+ * @note      a continuous function of time, so any sampling sees the same air
+ */
+static int32_t a_timestep_sraw(float t)
+{
+    float v;
+    float p;
+
+    v = 30000.0f + 300.0f * sinf(t * (2.0f * 3.14159265f / 5400.0f));
+    p = fmodf(t, 2700.0f);
+    if (p < 300.0f)
+    {
+        /* a short voc event */
+        v -= 6.0f * p;
+    }
+    else if (p < 900.0f)
+    {
+        v -= 6.0f * 300.0f * (900.0f - p) / 600.0f;
+    }
+
+    return (int32_t)v;
+}
+
+/**
+ * @brief  timestep test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_timestep_test(void)
+{
+    uint32_t i;
+    uint32_t ts;
+    uint32_t last;
+    uint32_t next;
+    uint32_t count;
+    float sum_err;
+    float gamma;
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    int32_t err;
+    int32_t max_err;
+    int32_t max_naive_err;
+    float s0;
+    float s1;
+    float r0;
+    float r1;
+
+    /* start timestep test */
+    sgp41_interface_debug_print("sgp41: start timestep test.\n");
+
+    /* nominal steps must match the fixed step process */
+    sgp41_interface_debug_print("sgp41: timestep nominal test.\n");
+    sgp41_algorithm_init(&gs_ref, SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_dut, SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_naive, SGP41_ALGORITHM_TYPE_VOC);
+    ts = 0xFFFFFFFFU - 3600U * 1000U;
+    for (i = 0; i < 4U * 3600U; i++)
+    {
+        sgp41_algorithm_process(&gs_ref, a_timestep_sraw((float)i), &a);
+        sgp41_algorithm_process_with_elapsed(&gs_dut, a_timestep_sraw((float)i), 1.0f, &b);
+        sgp41_algorithm_process_with_timestamp(&gs_naive, a_timestep_sraw((float)i), ts, &c);
+        ts += 1000U;
+        if ((a != b) || (a != c))
+        {
+            sgp41_interface_debug_print("sgp41: sample %d index %d %d %d.\n", i, a, b, c);
+            sgp41_interface_debug_print("sgp41: check nominal error.\n");
+
+            return 1;
+        }
+    }
+    sgp41_algorithm_get_states(&gs_ref, &r0, &r1);
+    sgp41_algorithm_get_states(&gs_naive, &s0, &s1);
+    if ((r0 != s0) || (r1 != s1))
+    {
+        sgp41_interface_debug_print("sgp41: check nominal error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check nominal ok.\n");
+
+    /* jittered and dropped samples against the 1 s reference */
+    sgp41_interface_debug_print("sgp41: timestep jitter test.\n");
+    sgp41_algorithm_init(&gs_ref, SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_dut, SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_naive, SGP41_ALGORITHM_TYPE_VOC);
+    srand(0x5347);
+    last = 0;
+    next = 0;
+    max_err = 0;
+    max_naive_err = 0;
+    sum_err = 0.0f;
+    count = 0;
+    for (i = 0; i < 6U * 3600U; i++)
+    {
+        sgp41_algorithm_process(&gs_ref, a_timestep_sraw((float)i), &a);
+        if (i != next)
+        {
+            continue;
+        }
+
+        /* the first sample is a nominal step, then 1 s to 3 s steps and every tenth sample is dropped */
+        sgp41_algorithm_process_with_elapsed(&gs_dut, a_timestep_sraw((float)i), (i == 0) ? 1.0f : (float)(i - last), &b);
+        sgp41_algorithm_process(&gs_naive, a_timestep_sraw((float)i), &c);
+        last = i;
+        next = i + 1U + (uint32_t)(rand() % 3);
+        if ((rand() % 10) == 0)
+        {
+            next++;
+        }
+        if (i > 3600U)
+        {
+            err = abs(a - b);
+            sum_err += (float)err;
+            count++;
+            max_err = (err > max_err) ? err : max_err;
+            err = abs(a - c);
+            max_naive_err = (err > max_naive_err) ? err : max_naive_err;
+        }
+    }
+    sgp41_interface_debug_print("sgp41: mean index error %0.2f, max index error %d, fixed step max index error %d.\n",
+                                sum_err / (float)count, max_err, max_naive_err);
+    sgp41_interface_debug_print("sgp41: uptime gamma %0.0fs, reference %0.0fs, fixed step %0.0fs.\n",
+                                gs_dut.m_mean_variance_estimator_uptime_gamma,
+                                gs_ref.m_mean_variance_estimator_uptime_gamma,
+                                gs_naive.m_mean_variance_estimator_uptime_gamma);
+    if (((sum_err / (float)count) > 4.0f) || (max_err > 30) || (max_err >= max_naive_err) ||
+        (fabsf(gs_dut.m_mean_variance_estimator_uptime_gamma - gs_ref.m_mean_variance_estimator_uptime_gamma) > 4.0f))
+    {
+        sgp41_interface_debug_print("sgp41: check jitter error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check jitter ok.\n");
+
+    /* an outage is one bounded step and restarts the output filter */
+    sgp41_interface_debug_print("sgp41: timestep gap test.\n");
+    gamma = gs_dut.m_mean_variance_estimator_uptime_gamma;
+    sgp41_algorithm_process_with_elapsed(&gs_dut, a_timestep_sraw(10.0f * 3600.0f), 4.0f * 3600.0f, &b);
+    sgp41_interface_debug_print("sgp41: uptime gamma step %0.0fs, index %d.\n",
+                                gs_dut.m_mean_variance_estimator_uptime_gamma - gamma, b);
+    if ((gs_dut.m_mean_variance_estimator_uptime_gamma - gamma != SGP41_ALGORITHM_MAX_GAP) ||
+        (gs_dut.m_adaptive_lowpass_x1 != gs_dut.m_adaptive_lowpass_x3) ||
+        (gs_dut.m_adaptive_lowpass_x2 != gs_dut.m_adaptive_lowpass_x3) ||
+        (b < 1) || (b > 500))
+    {
+        sgp41_interface_debug_print("sgp41: check gap error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check gap ok.\n");
+
+    /* a duplicate or backwards timestamp leaves the state unchanged */
+    sgp41_interface_debug_print("sgp41: timestep duplicate test.\n");
+    sgp41_algorithm_init(&gs_ref, SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_dut, SGP41_ALGORITHM_TYPE_VOC);
+    ts = 0xFFFFFFFFU - 600U * 1000U;
+    a = 0;
+    for (i = 0; i < 3600U; i++)
+    {
+        sgp41_algorithm_process(&gs_ref, a_timestep_sraw((float)i), &a);
+        sgp41_algorithm_process_with_timestamp(&gs_dut, a_timestep_sraw((float)i), ts, &b);
+        ts += 1000U;
+    }
+    ts -= 1000U;
+    gs_naive = gs_dut;
+    sgp41_algorithm_process_with_timestamp(&gs_dut, a_timestep_sraw(7200.0f), ts, &b);
+    sgp41_algorithm_process_with_elapsed(&gs_dut, a_timestep_sraw(7200.0f), 0.0f, &c);
+    sgp41_interface_debug_print("sgp41: duplicate index %d %d, last %d.\n", b, c, a);
+    if ((b != a) || (c != a) || (memcmp(&gs_naive, &gs_dut, sizeof(gs_dut)) != 0))
+    {
+        sgp41_interface_debug_print("sgp41: check duplicate error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check duplicate ok.\n");
+    sgp41_interface_debug_print("sgp41: timestep backwards test.\n");
+    ts -= 3600U * 1000U;
+    sgp41_algorithm_process_with_timestamp(&gs_dut, a_timestep_sraw(7200.0f), ts, &b);
+    gs_naive.m_timestamp_ms = ts;
+    if ((b != a) || (memcmp(&gs_naive, &gs_dut, sizeof(gs_dut)) != 0))
+    {
+        sgp41_interface_debug_print("sgp41: check backwards error.\n");
+
+        return 1;
+    }
+    for (i = 3600U; i < 3700U; i++)
+    {
+        ts += 1000U;
+        sgp41_algorithm_process(&gs_ref, a_timestep_sraw((float)i), &a);
+        sgp41_algorithm_process_with_timestamp(&gs_dut, a_timestep_sraw((float)i), ts, &b);
+        if (a != b)
+        {
+            sgp41_interface_debug_print("sgp41: sample %d index %d %d.\n", i, a, b);
+            sgp41_interface_debug_print("sgp41: check backwards error.\n");
+
+            return 1;
+        }
+    }
+    sgp41_algorithm_get_states(&gs_ref, &r0, &r1);
+    sgp41_algorithm_get_states(&gs_dut, &s0, &s1);
+    if ((r0 != s0) || (r1 != s1))
+    {
+        sgp41_interface_debug_print("sgp41: check backwards error.\n");
+
+        return 1;
+    }
+    sgp41_interface_debug_print("sgp41: check backwards ok.\n");
+
+    /* finish timestep test */
+    sgp41_interface_debug_print("sgp41: finish timestep test.\n");
+
+    return 0;
+}
@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sgp41_trace_test.c
+ * @brief     driver sgp41 trace test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sgp41_trace_test.h"
+#include "driver_sgp41_trace.h"
+#include "driver_sgp41_algorithm.h"
+
+/**
+ * @brief trace test param definition
+ */
+#define TRACE_TEST_SAMPLES        10            /**< measurements per session */
+#define TRACE_TEST_FILE_SIZE      4096          /**< recording buffer */
+#define TRACE_TEST_HUMIDITY       0x8000        /**< 50 %RH */
+#define TRACE_TEST_TEMPERATURE    0x6666        /**< 25 C */
+
+/**
+ * @brief trace test session structure definition
+ */
+typedef struct trace_test_session_s
+{
+    uint16_t id[3];                              /**< serial id */
+    uint16_t sraw_voc[TRACE_TEST_SAMPLES];       /**< voc sraw */
+    uint16_t sraw_nox[TRACE_TEST_SAMPLES];       /**< nox sraw */
+    int32_t voc_index[TRACE_TEST_SAMPLES];       /**< voc index */
+    int32_t nox_index[TRACE_TEST_SAMPLES];       /**< nox index */
+} trace_test_session_t;
+
+static sgp41_handle_t gs_handle;                             /**< sgp41 handle */
+static sgp41_trace_handle_t gs_trace;                        /**< trace handle */
+static sgp41_gas_index_algorithm_t gs_voc_handle;            /**< voc handle */
+static sgp41_gas_index_algorithm_t gs_nox_handle;            /**< nox handle */
+static uint8_t gs_file[TRACE_TEST_FILE_SIZE];                /**< recording */
+static uint32_t gs_file_len;                                 /**< recording length */
+static trace_test_session_t gs_recorded;                     /**< recorded session */
+static trace_test_session_t gs_replayed;                     /**< replayed session */
+
+/**
+ * @brief     ram file write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 file is full
+ * @note      none
+ */
+static uint8_t a_trace_test_write_file(const uint8_t *buf, uint16_t len)
+{
+    if (gs_file_len + len > TRACE_TEST_FILE_SIZE)
+    {
+        return 1;
+    }
+    memcpy(&gs_file[gs_file_len], buf, len);
+    gs_file_len += len;
+
+    return 0;
+}
+
+/**
+ * @brief      run one session through the trace
+ * @param[in]  raw_humidity humidity raw data
+ * @param[out] *session pointer to a session buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 session failed
+ * @note       init, serial id, conditioning, measurements with the algorithm and deinit
+ */
+static uint8_t a_trace_test_session(uint16_t raw_humidity, trace_test_session_t *session)
+{
+    uint16_t sraw_voc;
+    uint32_t i;
+
+    DRIVER_SGP41_LINK_INIT(&gs_handle, sgp41_handle_t);
+    DRIVER_SGP41_LINK_IIC_INIT(&gs_handle, sgp41_trace_iic_init);
+    DRIVER_SGP41_LINK_IIC_DEINIT(&gs_handle, sgp41_trace_iic_deinit);
+    DRIVER_SGP41_LINK_IIC_WRITE_COMMAND(&gs_handle, sgp41_trace_iic_write_cmd);
+    DRIVER_SGP41_LINK_IIC_READ_COMMAND(&gs_handle, sgp41_trace_iic_read_cmd);
+    DRIVER_SGP41_LINK_DELAY_MS(&gs_handle, sgp41_trace_delay_ms);
+    DRIVER_SGP41_LINK_DEBUG_PRINT(&gs_handle, sgp41_interface_debug_print);
+    sgp41_algorithm_init(&gs_voc_handle, SGP41_ALGORITHM_TYPE_VOC);
+    sgp41_algorithm_init(&gs_nox_handle, SGP41_ALGORITHM_TYPE_NOX);
+    memset(session, 0, sizeof(trace_test_session_t));
+    if (sgp41_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    if ((sgp41_get_serial_id(&gs_handle, session->id) != 0) ||
+        (sgp41_get_execute_conditioning(&gs_handle, &sraw_voc) != 0))
+    {
+        (void)sgp41_deinit(&gs_handle);
+
+        return 1;
+    }
+    for (i = 0; i < TRACE_TEST_SAMPLES; i++)
+    {
+        if (sgp41_get_measure_raw(&gs_handle, raw_humidity, TRACE_TEST_TEMPERATURE,
+                                  &session->sraw_voc[i], &session->sraw_nox[i]) != 0)
+        {
+            (void)sgp41_deinit(&gs_handle);
+
+            return 1;
+        }
+        sgp41_algorithm_process(&gs_voc_handle, session->sraw_voc[i], &session->voc_index[i]);
+        sgp41_algorithm_process(&gs_nox_handle, session->sraw_nox[i], &session->nox_index[i]);
+    }
+
+    return (sgp41_deinit(&gs_handle) != 0) ? 1 : 0;
+}
+
+/**
+ * @brief  trace test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t sgp41_trace_test(void)
+{
+    uint8_t res;
+    sgp41_trace_stats_t stats;
+    uint32_t records;
+
+    /* start trace test */
+    sgp41_interface_debug_print("sgp41: start trace test.\n");
+
+    /* invalid param test */
+    sgp41_interface_debug_print("sgp41: trace invalid param test.\n");
+    DRIVER_SGP41_TRACE_LINK_INIT(&gs_trace, sgp41_trace_handle_t);
+    res = sgp41_trace_record(&gs_trace);
+    sgp41_interface_debug_print("sgp41: check missing links %s.\n", res == 3 ? "ok" : "error");
+    if (res != 3)
+    {
+        return 1;
+    }
+    res = sgp41_trace_replay(&gs_trace, (const uint8_t *)"SGP41", 5, SGP41_TRACE_MODE_REPLAY);
+    sgp41_interface_debug_print("sgp41: check invalid header %s.\n", res == 4 ? "ok" : "error");
+    if (res != 4)
+    {
+        return 1;
+    }
+
+    /* record a session from the bus */
+    sgp41_interface_debug_print("sgp41: trace record test.\n");
+    DRIVER_SGP41_TRACE_LINK_IIC_INIT(&gs_trace, sgp41_interface_iic_init);
+    DRIVER_SGP41_TRACE_LINK_IIC_DEINIT(&gs_trace, sgp41_interface_iic_deinit);
+    DRIVER_SGP41_TRACE_LINK_IIC_WRITE_COMMAND(&gs_trace, sgp41_interface_iic_write_cmd);
+    DRIVER_SGP41_TRACE_LINK_IIC_READ_COMMAND(&gs_trace, sgp41_interface_iic_read_cmd);
+    DRIVER_SGP41_TRACE_LINK_DELAY_MS(&gs_trace, sgp41_interface_delay_ms);
+    DRIVER_SGP41_TRACE_LINK_GET_TIME_US(&gs_trace, sgp41_interface_get_time_us);
+    DRIVER_SGP41_TRACE_LINK_WRITE_FILE(&gs_trace, a_trace_test_write_file);
+    gs_file_len = 0;
+    res = sgp41_trace_record(&gs_trace);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: trace record failed.\n");
+
+        return 1;
+    }
+    res = a_trace_test_session(TRACE_TEST_HUMIDITY, &gs_recorded);
+    (void)sgp41_trace_get_stats(&gs_trace, &stats);
+    if ((res != 0) || (sgp41_trace_deinit(&gs_trace) != 0) || (stats.bytes != gs_file_len) || (stats.file_errors != 0))
+    {
+        sgp41_interface_debug_print("sgp41: recorded session failed.\n");
+
+        return 1;
+    }
+    records = stats.records;
+    sgp41_interface_debug_print("sgp41: recorded %d transactions and delays in %d bytes.\n", records, gs_file_len);
+
+    /* replay it without the bus */
+    sgp41_interface_debug_print("sgp41: trace replay test.\n");
+    res = sgp41_trace_replay(&gs_trace, gs_file, gs_file_len, SGP41_TRACE_MODE_REPLAY);
+    if (res != 0)
+    {
+        sgp41_interface_debug_print("sgp41: trace replay failed.\n");
+
+        return 1;
+    }
+    res = a_trace_test_session(TRACE_TEST_HUMIDITY, &gs_replayed);
+    (void)sgp41_trace_get_stats(&gs_trace, &stats);
+    (void)sgp41_trace_deinit(&gs_trace);
+    sgp41_interface_debug_print("sgp41: replayed %d records, %d mismatches, %d bytes left.\n",
+                                stats.records, stats.mismatches, stats.remaining);
+    if ((res != 0) || (stats.mismatches != 0) || (stats.remaining != 0) || (stats.records != records))
+    {
+        sgp41_interface_debug_print("sgp41: replayed session failed.\n");
+
+        return 1;
+    }
+    res = (uint8_t)(memcmp(&gs_recorded, &gs_replayed, sizeof(trace_test_session_t)) == 0);
+    sgp41_interface_debug_print("sgp41: check serial id, sraw and gas index %s.\n", res != 0 ? "ok" : "error");
+    if (res == 0)
+    {
+        return 1;
+    }
+
+    /* a driver that sends other compensation is caught */
+    sgp41_interface_debug_print("sgp41: trace divergence test.\n");
+    (void)sgp41_trace_replay(&gs_trace, gs_file, gs_file_len, SGP41_TRACE_MODE_REPLAY);
+    res = a_trace_test_session(TRACE_TEST_HUMIDITY + 1, &gs_replayed);
+    (void)sgp41_trace_get_stats(&gs_trace, &stats);
+    (void)sgp41_trace_deinit(&gs_trace);
+    sgp41_interface_debug_print("sgp41: check divergence %s.\n", ((res != 0) && (stats.mismatches != 0)) ? "ok" : "error");
+    if ((res == 0) || (stats.mismatches == 0))
+    {
+        return 1;
+    }
+
+    /* finish trace test */
+    sgp41_interface_debug_print("sgp41: finish trace test.\n");
+
+    return 0;
+}